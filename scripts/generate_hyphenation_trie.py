@@ -0,0 +1,295 @@
+"""
+Generate a packed Liang pattern trie header for the hyphenator.
+
+Reads TeX hyphenation patterns (hyph-*.tex / *.pat.txt, the body of
+\\patterns{...}) or an older generated pattern header (hyph-*.h with
+PatternC entries) and writes a header holding the patterns as a trie in
+flash-friendly arrays:
+
+  nodes[n]        first child index << 8 | child count; nodes are in
+                  breadth-first order, so the children of a node are
+                  contiguous and sorted by byte
+  labels[n]       byte on the edge from the parent to node n
+  level_ids[n]    0, or 1 + index of the levels of the pattern ending at n
+  level_offsets[] offset of each distinct level list in level_data
+  level_data[]    count, then (offset into the pattern, level) byte pairs
+
+liang_hyphenate() walks the trie once from every start position of the
+word instead of searching for every substring.
+
+Words of a \\hyphenation{...} exception list (from the input or from
+--exceptions) are written as an open-addressing hash table that
+liang_hyphenate() checks before the patterns:
+
+  exception_slots[s]  0 (empty), or 1 + offset of an entry; s is a power of
+                      two at least twice the number of words, the slot of a
+                      word is FNV-1a(word) & (s - 1), probed linearly
+  exception_entries[] per word: length, lowercase UTF-8 bytes, number of
+                      hyphens, byte offsets of the hyphens
+
+With --binary the same arrays are written as a .hyp file that the reader
+loads from /microreader/hyphenation/<language>.hyp on the SD card when a
+book in that language is opened (LiangHyphenation). All values are little
+endian:
+
+  0   "HYPT"
+  4   u8  version (1)
+  5   u8  longest pattern
+  6   u8  left minimum, 7 u8 right minimum (characters)
+  8   u32 node count
+  12  u16 level list count, 14 u16 level data bytes
+  16  nodes u32[n], level_ids u16[n], level_offsets u16[], labels u8[n],
+      level_data u8[]
+
+Version 2 files continue with the exception table, 2-byte aligned:
+u16 slot count, u16 entry bytes, exception_slots u16[], exception_entries.
+
+Usage:
+    python generate_hyphenation_trie.py <input> <output.h> --name en_us
+    python generate_hyphenation_trie.py hyph-fr.tex fr.hyp --binary --left-min 2 --right-min 3
+    python generate_hyphenation_trie.py hyph-en-us.h hyph-en-us-trie.h --name en_us \\
+        --exceptions resources/hyphenation/hyph-en-us-exceptions.tex
+"""
+
+import argparse
+import re
+import struct
+from collections import deque
+from pathlib import Path
+
+
+def parse_tex_patterns(text):
+    """Return (letters bytes, levels list) for each pattern of a TeX file."""
+    # Only the \patterns{...} block when there is one; plain lists otherwise
+    m = re.search(r"\\patterns\s*\{(.*?)\}", text, re.S)
+    body = m.group(1) if m else text
+    patterns = []
+    for line in body.splitlines():
+        line = line.split("%", 1)[0]
+        for token in line.split():
+            letters = bytearray()
+            levels = [0]
+            for ch in token:
+                if ch.isdigit():
+                    levels[-1] = int(ch)
+                else:
+                    encoded = ch.encode("utf-8")
+                    letters += encoded
+                    # Levels sit between bytes; none inside a multibyte character
+                    levels += [0] * len(encoded)
+            if letters:
+                patterns.append((bytes(letters), levels))
+    return patterns
+
+
+def parse_tex_exceptions(text):
+    """Return (lowercase word bytes, hyphen byte offsets) for each word of \\hyphenation{...}."""
+    exceptions = {}
+    for block in re.findall(r"\\hyphenation\s*\{(.*?)\}", text, re.S):
+        for line in block.splitlines():
+            for token in line.split("%", 1)[0].split():
+                word = bytearray()
+                offsets = []
+                for part in token.lower().split("-"):
+                    if word and part:
+                        offsets.append(len(word))
+                    word += part.encode("utf-8")
+                if word:
+                    exceptions[bytes(word)] = offsets
+    return sorted(exceptions.items())
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def build_exception_table(exceptions):
+    """Return (slots, entries) for the exception hash table."""
+    slot_count = 2
+    while slot_count < 2 * len(exceptions):
+        slot_count *= 2
+    slots = [0] * slot_count
+    entries = bytearray()
+    for word, offsets in exceptions:
+        if len(word) > 255 or len(offsets) > 255:
+            raise ValueError("exception too long: " + word.decode("utf-8"))
+        i = fnv1a(word) & (slot_count - 1)
+        while slots[i]:
+            i = (i + 1) & (slot_count - 1)
+        slots[i] = len(entries) + 1
+        entries += bytes([len(word)]) + word + bytes([len(offsets)] + offsets)
+    if len(entries) >= 0xFFFF:
+        raise ValueError("exception list too large")
+    return slots, list(entries)
+
+
+def parse_generated_header(text):
+    """Return (letters bytes, levels list) for each PatternC of an older header."""
+    letters = {}
+    values = {}
+    for kind, idx, items in re.findall(r"_(let|val)(\d+)\[\]\s*=\s*\{([^}]*)\}", text):
+        data = [int(x) for x in items.replace(" ", "").split(",") if x]
+        (letters if kind == "let" else values)[int(idx)] = data
+    return [(bytes(letters[i]), values[i]) for i in sorted(letters)]
+
+
+class Node:
+    __slots__ = ("children", "levels")
+
+    def __init__(self):
+        self.children = {}
+        self.levels = None
+
+
+def build_trie(patterns):
+    root = Node()
+    for letters, levels in patterns:
+        node = root
+        for b in letters:
+            node = node.children.setdefault(b, Node())
+        node.levels = tuple((i, v) for i, v in enumerate(levels) if v)
+    return root
+
+
+def flatten(root):
+    """Breadth-first layout: (nodes, labels, level_ids, level_offsets, level_data, max_len)."""
+    order = [(root, 0, 0)]  # node, label, depth
+    queue = deque([(root, 0)])
+    first_child = {}
+    while queue:
+        node, depth = queue.popleft()
+        first_child[id(node)] = len(order)
+        if len(node.children) > 255:
+            raise ValueError("more than 255 children under one node")
+        for b in sorted(node.children):
+            child = node.children[b]
+            order.append((child, b, depth + 1))
+            queue.append((child, depth + 1))
+
+    distinct = {}
+    level_offsets = []
+    level_data = []
+    nodes, labels, level_ids = [], [], []
+    max_len = 0
+    for node, label, depth in order:
+        nodes.append(first_child[id(node)] << 8 | len(node.children))
+        labels.append(label)
+        level_id = 0
+        if node.levels is not None:
+            max_len = max(max_len, depth)
+            if node.levels not in distinct:
+                distinct[node.levels] = len(level_offsets)
+                level_offsets.append(len(level_data))
+                level_data.append(len(node.levels))
+                for offset, level in node.levels:
+                    level_data += [offset, level]
+            level_id = distinct[node.levels] + 1
+        level_ids.append(level_id)
+    if len(order) >= 1 << 24 or len(level_offsets) >= 0xFFFF or len(level_data) > 0xFFFF:
+        raise ValueError("pattern set too large for the packed trie")
+    return nodes, labels, level_ids, level_offsets, level_data, max_len
+
+
+def c_array(ctype, name, values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i : i + per_line]) + ",")
+    return "static const {} {}[] = {{\n{}\n}};\n".format(ctype, name, "\n".join(lines))
+
+
+def write_header(path, name, source, pattern_count, trie, exceptions):
+    nodes, labels, level_ids, level_offsets, level_data, max_len = trie
+    guard = "HYPH_{}_TRIE_H".format(name.upper())
+    flash = len(nodes) * 4 + len(labels) + len(level_ids) * 2 + len(level_offsets) * 2 + len(level_data)
+    table = build_exception_table(exceptions) if exceptions else None
+    if table:
+        flash += len(table[0]) * 2 + len(table[1])
+    out = []
+    out.append("#ifndef {0}\n#define {0}\n\n".format(guard))
+    out.append('#include "liang_hyphenation_patterns.h"\n\n')
+    out.append("// Generated by scripts/generate_hyphenation_trie.py from {}.\n".format(source))
+    out.append(
+        "// {} patterns, {} exceptions, {} trie nodes, {} bytes. Do not edit.\n\n".format(
+            pattern_count, len(exceptions), len(nodes), flash
+        )
+    )
+    out.append(c_array("std::uint32_t", name + "_trie_nodes", nodes, 8))
+    out.append(c_array("std::uint8_t", name + "_trie_labels", labels))
+    out.append(c_array("std::uint16_t", name + "_trie_level_ids", level_ids, 12))
+    out.append(c_array("std::uint16_t", name + "_trie_level_offsets", level_offsets, 12))
+    out.append(c_array("std::uint8_t", name + "_trie_level_data", level_data))
+    opening = "static const HyphenationTrie {0}_trie = {{".format(name)
+    out.append(
+        "\n{0}{1}_trie_nodes, {1}_trie_labels, {1}_trie_level_ids,\n{2}{1}_trie_level_offsets, "
+        "{1}_trie_level_data, {3}, {4}}};\n".format(opening, name, " " * len(opening), len(nodes), max_len)
+    )
+    if table:
+        out.append("\n" + c_array("std::uint16_t", name + "_exception_slots", table[0], 12))
+        out.append(c_array("std::uint8_t", name + "_exception_entries", table[1]))
+        out.append(
+            "\nstatic const HyphenationExceptions {0}_exceptions = {{{0}_exception_slots, {0}_exception_entries, "
+            "{1}}};\n".format(name, len(table[0]))
+        )
+    out.append("\n#endif  // {}\n".format(guard))
+    Path(path).write_text("".join(out), encoding="ascii")
+    return flash
+
+
+def write_binary(path, trie, exceptions, left_min, right_min):
+    nodes, labels, level_ids, level_offsets, level_data, max_len = trie
+    out = bytearray(b"HYPT")
+    out += struct.pack("<BBBBIHH", 2 if exceptions else 1, max_len, left_min, right_min, len(nodes), len(level_offsets), len(level_data))
+    out += struct.pack("<{}I".format(len(nodes)), *nodes)
+    out += struct.pack("<{}H".format(len(level_ids)), *level_ids)
+    out += struct.pack("<{}H".format(len(level_offsets)), *level_offsets)
+    out += bytes(labels)
+    out += bytes(level_data)
+    if exceptions:
+        slots, entries = build_exception_table(exceptions)
+        out += bytes(len(out) % 2)
+        out += struct.pack("<HH", len(slots), len(entries))
+        out += struct.pack("<{}H".format(len(slots)), *slots)
+        out += bytes(entries)
+    Path(path).write_bytes(bytes(out))
+    return len(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate a packed Liang pattern trie header")
+    parser.add_argument("input", help="TeX pattern file or generated hyph-*.h header")
+    parser.add_argument("output", help="header to write")
+    parser.add_argument("--name", help="identifier prefix for a header, e.g. en_us")
+    parser.add_argument("--exceptions", help="TeX file with a \\hyphenation{...} exception list")
+    parser.add_argument("--binary", action="store_true", help="write a .hyp file for the SD card")
+    parser.add_argument("--left-min", type=int, default=2, help="lefthyphenmin of the language (--binary)")
+    parser.add_argument("--right-min", type=int, default=3, help="righthyphenmin of the language (--binary)")
+    args = parser.parse_args()
+    if not args.binary and not args.name:
+        parser.error("--name is required for a header")
+
+    text = Path(args.input).read_text(encoding="utf-8")
+    if "PatternC" in text:
+        patterns = parse_generated_header(text)
+    else:
+        patterns = parse_tex_patterns(text)
+    if not patterns:
+        raise SystemExit("no patterns found in " + args.input)
+    exceptions = parse_tex_exceptions(text)
+    if args.exceptions:
+        extra = parse_tex_exceptions(Path(args.exceptions).read_text(encoding="utf-8"))
+        exceptions = sorted(dict(exceptions + extra).items())
+
+    trie = flatten(build_trie(patterns))
+    if args.binary:
+        size = write_binary(args.output, trie, exceptions, args.left_min, args.right_min)
+        print("{}: {} patterns, {} nodes, {} bytes".format(args.output, len(patterns), len(trie[0]), size))
+        return
+    flash = write_header(args.output, args.name, Path(args.input).name, len(patterns), trie, exceptions)
+    print("{}: {} patterns, {} nodes, {} bytes".format(args.output, len(patterns), len(trie[0]), flash))
+
+
+if __name__ == "__main__":
+    main()
@@ -36,3 +36,72 @@ def format_c_code_list(code_list: List[int]) -> str:
         for i in range(0, len(parts), per_line)
     ]
     return ",\n".join(lines)
+
+
+# Run-length glyph coding, mirrored by src/rendering/GlyphRle.h. A pixel's
+# symbol is its raw (bw << 2) | (msb << 1) | lsb bits; runs are packed into
+# nibbles, high nibble first, and each glyph starts on a byte.
+RLE_SYMBOL_BLACK = 0
+RLE_SYMBOL_GRAY = 2
+RLE_SYMBOL_DARK_GRAY = 3
+RLE_SYMBOL_WHITE = 4
+RLE_SYMBOL_LIGHT_GRAY = 5
+RLE_MAX_WHITE_RUN = 8
+RLE_MAX_BLACK_RUN = 4
+RLE_MAX_ESCAPE_RUN = 32
+RLE_ESCAPE = 0xF
+RLE_SINGLE_CODES = {
+    RLE_SYMBOL_LIGHT_GRAY: 0xC,
+    RLE_SYMBOL_GRAY: 0xD,
+    RLE_SYMBOL_DARK_GRAY: 0xE,
+}
+
+
+def _rle_run_nibbles(symbol: int, length: int) -> List[int]:
+    out = []
+    while length > 0:
+        if symbol == RLE_SYMBOL_WHITE and length <= RLE_MAX_WHITE_RUN:
+            out.append(length - 1)
+            return out
+        if symbol == RLE_SYMBOL_BLACK and length <= RLE_MAX_BLACK_RUN:
+            out.append(7 + length)
+            return out
+        if length == 1 and symbol in RLE_SINGLE_CODES:
+            out.append(RLE_SINGLE_CODES[symbol])
+            return out
+        n = min(length, RLE_MAX_ESCAPE_RUN)
+        v = (symbol << 5) | (n - 1)
+        out.extend([RLE_ESCAPE, v >> 4, v & 0x0F])
+        length -= n
+    return out
+
+
+def encode_glyph_rle(
+    bw: List[int], lsb: List[int], msb: List[int], width: int, height: int
+) -> List[int]:
+    """Run-length code one glyph from its packed planes (lsb/msb may be None)."""
+    bpr = bytes_per_row(width)
+    nibbles = []
+    run_symbol = -1
+    run_length = 0
+    for y in range(height):
+        for x in range(width):
+            i = y * bpr + x // 8
+            bit = 7 - (x % 8)
+            symbol = ((bw[i] >> bit) & 1) << 2
+            if msb is not None:
+                symbol |= ((msb[i] >> bit) & 1) << 1
+            if lsb is not None:
+                symbol |= (lsb[i] >> bit) & 1
+            if symbol == run_symbol:
+                run_length += 1
+                continue
+            if run_length:
+                nibbles.extend(_rle_run_nibbles(run_symbol, run_length))
+            run_symbol = symbol
+            run_length = 1
+    if run_length:
+        nibbles.extend(_rle_run_nibbles(run_symbol, run_length))
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
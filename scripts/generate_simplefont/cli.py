@@ -36,7 +36,12 @@ from scripts.generate_simplefont.render import (
     render_preview_from_grayscale,
     render_combined_preview,
 )
-from scripts.generate_simplefont.writer import generate_header, write_header_from_data
+from scripts.generate_simplefont.kerning import extract_kerning
+from scripts.generate_simplefont.writer import (
+    generate_header,
+    write_binary_font,
+    write_header_from_data,
+)
 from scripts.generate_simplefont.bitmap_utils import (
     bytes_per_row,
     gen_bitmap_bytes,
@@ -109,6 +114,22 @@ def main(argv=None):
         default=True,
         help="Disable grayscale output: do not generate the Bitmaps_lsb/Bitmaps_msb arrays (default: enabled)",
     )
+    p.add_argument(
+        "--rle",
+        action="store_true",
+        help="Emit run-length coded glyph bitmaps (about 45%% of the planar size; TTF input only)",
+    )
+    p.add_argument(
+        "--no-kerning",
+        dest="kerning",
+        action="store_false",
+        default=True,
+        help="Do not emit the kerning pair table read from the font's GPOS/kern tables (default: enabled)",
+    )
+    p.add_argument(
+        "--binary-out",
+        help="Also write a binary font file (.mrf) to load from /microreader/fonts on the SD card (TTF input only)",
+    )
 
     args = p.parse_args(argv)
 
@@ -314,6 +335,13 @@ def main(argv=None):
                         )
 
         yadvance = args.size + 2
+        kerning = None
+        if args.kerning:
+            try:
+                kerning = extract_kerning(ttf_path, codes, args.size)
+                print(f"Kerning: {len(kerning)} pair(s)")
+            except Exception as e:
+                print(f"WARNING: could not read kerning: {e}")
         write_header_from_data(
             args.name,
             args.out,
@@ -324,7 +352,23 @@ def main(argv=None):
             bitmap_msb_all,
             yadvance,
             grayscale=args.grayscale,
+            rle=args.rle,
+            kerning=kerning,
         )
+        if args.binary_out:
+            write_binary_font(
+                args.name,
+                args.binary_out,
+                codes,
+                glyphs,
+                bitmap_all,
+                bitmap_lsb_all,
+                bitmap_msb_all,
+                yadvance,
+                args.size,
+                grayscale=args.grayscale,
+                kerning=kerning,
+            )
         # optional preview: render a combined image showing BW and grayscale side-by-side
         if args.preview_output:
             if args.grayscale:
@@ -442,7 +486,21 @@ def main(argv=None):
             bitmap_msb_all,
             yadvance,
             grayscale=args.grayscale,
+            rle=args.rle,
         )
+        if args.binary_out:
+            write_binary_font(
+                args.name,
+                args.binary_out,
+                codes,
+                glyphs,
+                bitmap_all,
+                bitmap_lsb_all,
+                bitmap_msb_all,
+                yadvance,
+                args.size,
+                grayscale=args.grayscale,
+            )
 
         if args.preview_output:
             if args.grayscale:
@@ -0,0 +1,103 @@
+"""Kerning pairs for the glyphs being generated, read with fontTools."""
+
+from typing import Dict, List, Tuple
+
+from fontTools.ttLib import TTFont
+
+
+def _pair_pos_lookups(gpos) -> List:
+    """PairPos subtables of the lookups used by the 'kern' feature."""
+    table = gpos.table
+    if not table.FeatureList or not table.LookupList:
+        return []
+    lookup_ids = set()
+    for record in table.FeatureList.FeatureRecord:
+        if record.FeatureTag == "kern":
+            lookup_ids.update(record.Feature.LookupListIndex)
+    subtables = []
+    for idx in sorted(lookup_ids):
+        lookup = table.LookupList.Lookup[idx]
+        for sub in lookup.SubTable:
+            # Extension lookups (type 9) wrap the real subtable
+            if lookup.LookupType == 9:
+                sub = sub.ExtSubTable
+            if getattr(sub, "LookupType", lookup.LookupType) == 2:
+                subtables.append(sub)
+    return subtables
+
+
+def _x_advance(value) -> int:
+    if value is None:
+        return 0
+    return getattr(value, "XAdvance", 0) or 0
+
+
+def _gpos_pairs(font: TTFont, names: set) -> Dict[Tuple[str, str], int]:
+    pairs: Dict[Tuple[str, str], int] = {}
+    for sub in _pair_pos_lookups(font["GPOS"]):
+        coverage = sub.Coverage.glyphs
+        if sub.Format == 1:
+            for first, pair_set in zip(coverage, sub.PairSet):
+                if first not in names:
+                    continue
+                for record in pair_set.PairValueRecord:
+                    key = (first, record.SecondGlyph)
+                    if record.SecondGlyph in names and key not in pairs:
+                        pairs[key] = _x_advance(record.Value1)
+        elif sub.Format == 2:
+            class1 = sub.ClassDef1.classDefs
+            class2 = sub.ClassDef2.classDefs
+            seconds = sorted(names)
+            for first in coverage:
+                if first not in names:
+                    continue
+                row = sub.Class1Record[class1.get(first, 0)]
+                for second in seconds:
+                    key = (first, second)
+                    if key in pairs:
+                        continue
+                    value = _x_advance(row.Class2Record[class2.get(second, 0)].Value1)
+                    if value:
+                        pairs[key] = value
+    return pairs
+
+
+def _kern_table_pairs(font: TTFont, names: set) -> Dict[Tuple[str, str], int]:
+    pairs: Dict[Tuple[str, str], int] = {}
+    for sub in getattr(font["kern"], "kernTables", []):
+        table = getattr(sub, "kernTable", None) or {}
+        for (first, second), value in table.items():
+            if first in names and second in names:
+                pairs.setdefault((first, second), value)
+    return pairs
+
+
+def extract_kerning(ttf_path: str, codes: List[int], size: int) -> Dict[Tuple[int, int], int]:
+    """Kerning of the glyphs for `codes` at `size` px.
+
+    Returns {(first glyph index, second glyph index): pixels} for non-zero
+    pairs, indices into `codes`. GPOS 'kern' pair lookups win over the legacy
+    'kern' table. Variable font axes are ignored (default instance).
+    """
+    font = TTFont(ttf_path)
+    cmap = font.getBestCmap() or {}
+    index_of_name = {}
+    for idx, ch in enumerate(codes):
+        name = cmap.get(ch)
+        if name is not None and name not in index_of_name:
+            index_of_name[name] = idx
+    names = set(index_of_name)
+
+    units = {}
+    if "GPOS" in font:
+        units = _gpos_pairs(font, names)
+    if not units and "kern" in font:
+        units = _kern_table_pairs(font, names)
+
+    scale = size / font["head"].unitsPerEm
+    pairs: Dict[Tuple[int, int], int] = {}
+    for (first, second), value in units.items():
+        px = max(-128, min(127, int(round(value * scale))))
+        if px:
+            pairs[(index_of_name[first], index_of_name[second])] = px
+    return pairs
@@ -1,15 +1,134 @@
 """Header generation for SimpleGFXfont from glyph and bitmap data."""
 
 import os
-from typing import List, Tuple
+import struct
+from typing import Dict, List, Optional, Tuple
 from .bitmap_utils import (
     bytes_per_row,
+    encode_glyph_rle,
     format_c_byte_list,
     format_c_code_list,
     gen_bitmap_bytes,
 )
 
 
+GLYPH_INDEX_NONE = 0xFFFF
+
+
+def format_latin1_index(font_name: str, chars: List[int]) -> str:
+    """256-entry codepoint -> glyph index table for ASCII/Latin-1.
+
+    Lets findGlyphIndex resolve the common case with a single load instead of
+    a binary search. `chars` must be in glyph array order (sorted).
+    """
+    index = [GLYPH_INDEX_NONE] * 256
+    for glyph_idx, ch in enumerate(chars):
+        if ch < 256:
+            index[ch] = glyph_idx
+    rows = []
+    for i in range(0, 256, 16):
+        rows.append("    " + ", ".join(f"0x{v:04X}" for v in index[i : i + 16]))
+    body = ",\n".join(rows)
+    return f"\nconst uint16_t {font_name}Latin1Index[256] PROGMEM = {{\n{body}\n}};\n\n"
+
+
+def build_kerning_arrays(
+    pairs: Dict[Tuple[int, int], int]
+) -> Tuple[List[int], List[int], List[int]]:
+    """SimpleGFXkerning arrays (index, second, adjust) for glyph index pairs.
+
+    The index only covers first glyphs up to the last one with pairs.
+    """
+    if not pairs:
+        return [0], [], []
+    index_count = max(first for first, _ in pairs) + 1
+    if len(pairs) > 0xFFFF:
+        raise ValueError(f"{len(pairs)} kerning pairs; at most 65535 are supported")
+    ordered = sorted(pairs.items())
+    second = [sec for (_, sec), _ in ordered]
+    adjust = [px for _, px in ordered]
+    index = []
+    pos = 0
+    for first in range(index_count + 1):
+        while pos < len(ordered) and ordered[pos][0][0] < first:
+            pos += 1
+        index.append(pos)
+    return index, second, adjust
+
+
+def format_kerning(font_name: str, pairs: Dict[Tuple[int, int], int]) -> str:
+    """SimpleGFXkerning table for `pairs` ({(first, second): px})."""
+    index, second, adjust = build_kerning_arrays(pairs)
+
+    def rows(values: List[int]) -> str:
+        return ",\n".join(
+            "    " + ", ".join(str(v) for v in values[i : i + 16])
+            for i in range(0, len(values), 16)
+        )
+
+    return (
+        f"\nconst uint16_t {font_name}KernIndex[] PROGMEM = {{\n{rows(index)}\n}};\n"
+        f"\nconst uint16_t {font_name}KernSecond[] PROGMEM = {{\n{rows(second)}\n}};\n"
+        f"\nconst int8_t {font_name}KernAdjust[] PROGMEM = {{\n{rows(adjust)}\n}};\n"
+        f"\nconst SimpleGFXkerning {font_name}Kerning PROGMEM = {{{font_name}KernIndex, {font_name}KernSecond,\n"
+        f"    {font_name}KernAdjust, {len(index) - 1}}};\n\n"
+    )
+
+
+def format_font_struct(
+    font_name: str,
+    count: int,
+    yadvance: int,
+    grayscale: bool,
+    rle: bool = False,
+    kerning: bool = False,
+) -> str:
+    """SimpleGFXfont initializer: pick pointers or nullptr based on grayscale.
+
+    Run-length coded fonts keep everything in the main bitmap array and mark
+    it with the bitmap format instead.
+    """
+    if grayscale and not rle:
+        planes = f"{font_name}Bitmaps_lsb, {font_name}Bitmaps_msb"
+    else:
+        planes = "nullptr, nullptr"
+    if rle:
+        fmt = "FONT_BITMAP_RLE_GRAY" if grayscale else "FONT_BITMAP_RLE_BW"
+    else:
+        fmt = "FONT_BITMAP_PLANES"
+    # bitmapSource is only set for fonts loaded at runtime
+    kern = f", nullptr, &{font_name}Kerning" if kerning else ""
+    return (
+        f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{font_name}Bitmaps, {planes}, {font_name}Glyphs,\n"
+        f"    {count}, {yadvance}, nullptr, 0, FontStyle::REGULAR, {font_name}Latin1Index, {fmt}{kern}}};\n"
+    )
+
+
+def encode_font_rle(
+    chars: List[int],
+    glyphs: List[dict],
+    bitmap_all: List[int],
+    bitmap_lsb_all: List[int],
+    bitmap_msb_all: List[int],
+    grayscale: bool,
+) -> Tuple[List[List[int]], List[int]]:
+    """Run-length code every glyph; returns per-glyph chunks and their offsets."""
+    chunks = []
+    offsets = []
+    offset = 0
+    for idx in range(len(chars)):
+        g = glyphs[idx]
+        start = g["bitmapOffset"]
+        end = start + bytes_per_row(g["width"]) * g["height"]
+        lsb = bitmap_lsb_all[start:end] if grayscale else None
+        msb = bitmap_msb_all[start:end] if grayscale else None
+        chunk = encode_glyph_rle(bitmap_all[start:end], lsb, msb, g["width"], g["height"])
+        chunks.append(chunk)
+        offsets.append(offset)
+        offset += len(chunk)
+    return chunks, offsets
+
+
 def generate_header(
     font_name: str,
     out_path: str,
@@ -129,14 +248,9 @@ const uint8_t {font_name}Bitmaps[] PROGMEM = {{
         f"\nconst SimpleGFXglyph {font_name}Glyphs[] PROGMEM = {{\n{glyphs_c}\n}};\n\n"
     )
 
-    # Final font struct initializer: pick pointers or nullptr based on grayscale
-    if grayscale:
-        header += f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{font_name}Bitmaps, {font_name}Bitmaps_lsb, {font_name}Bitmaps_msb, {font_name}Glyphs,\n    {count}, {yadvance}}};\n"
-    else:
-        header += (
-            f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{font_name}Bitmaps, nullptr, nullptr, {font_name}Glyphs,\n"
-            f"    {count}, {yadvance}}};\n"
-        )
+    # Latin-1 direct index and the font struct initializer
+    header += format_latin1_index(font_name, chars)
+    header += format_font_struct(font_name, count, yadvance, grayscale)
     os.makedirs(os.path.dirname(out_path), exist_ok=True)
     with open(out_path, "w", encoding="utf-8", newline="\n") as f:
         f.write(header)
@@ -154,7 +268,16 @@ def write_header_from_data(
     bitmap_msb_all: List[int],
     yadvance: int,
     grayscale: bool = True,
+    rle: bool = False,
+    kerning: Optional[Dict[Tuple[int, int], int]] = None,
 ):
+    if rle:
+        chunks, offsets = encode_font_rle(
+            chars, glyphs, bitmap_all, bitmap_lsb_all, bitmap_msb_all, grayscale
+        )
+        total = offsets[-1] + len(chunks[-1]) if chunks else 0
+        if total > 0xFFFF:
+            raise ValueError(f"RLE bitmap is {total} bytes; glyph offsets are limited to 64 KB")
     bmp_lines = []
     bmp_lsb_lines = []
     bmp_msb_lines = []
@@ -166,6 +289,8 @@ def write_header_from_data(
         chunk = bitmap_all[start:end]
         chunk_lsb = bitmap_lsb_all[start:end]
         chunk_msb = bitmap_msb_all[start:end]
+        if rle:
+            chunk = chunks[idx]
         display = chr(ch)
         comment = f"// 0x{ch:X} '{display}'"
         chunk_c = format_c_byte_list(chunk)
@@ -181,8 +306,9 @@ def write_header_from_data(
     glyph_lines = []
     for idx, g in enumerate(glyphs):
         ch = chars[idx]
+        bitmap_offset = offsets[idx] if rle else g["bitmapOffset"]
         glyph_lines.append(
-            f"    {{{g['bitmapOffset']}, 0x{ch:X}, {g['width']}, {g['height']}, {g['xAdvance']}, {g['xOffset']}, {g['yOffset']}}}"
+            f"    {{{bitmap_offset}, 0x{ch:X}, {g['width']}, {g['height']}, {g['xAdvance']}, {g['xOffset']}, {g['yOffset']}}}"
         )
     glyphs_c = ",\n".join(glyph_lines)
 
@@ -201,7 +327,8 @@ const uint8_t {font_name}Bitmaps[] PROGMEM = {{
 }};
 
 """
-    if grayscale:
+    # Run-length coded fonts carry the gray levels in the main array
+    if grayscale and not rle:
         header += f"\nconst uint8_t {font_name}Bitmaps_lsb[] PROGMEM = {{\n{bmp_lsb_c}\n}};\n\n"
         header += f"\nconst uint8_t {font_name}Bitmaps_msb[] PROGMEM = {{\n{bmp_msb_c}\n}};\n\n"
 
@@ -210,15 +337,86 @@ const uint8_t {font_name}Bitmaps[] PROGMEM = {{
         f"\nconst SimpleGFXglyph {font_name}Glyphs[] PROGMEM = {{\n{glyphs_c}\n}};\n\n"
     )
 
-    if grayscale:
-        header += f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{font_name}Bitmaps, {font_name}Bitmaps_lsb, {font_name}Bitmaps_msb, {font_name}Glyphs,\n    {count}, {yadvance}}};\n"
-    else:
-        header += (
-            f"\nconst SimpleGFXfont {font_name} PROGMEM = {{{font_name}Bitmaps, nullptr, nullptr, {font_name}Glyphs,\n"
-            f"    {count}, {yadvance}}};\n"
-        )
+    header += format_latin1_index(font_name, chars)
+    if kerning:
+        header += format_kerning(font_name, kerning)
+    header += format_font_struct(font_name, count, yadvance, grayscale, rle, bool(kerning))
 
     os.makedirs(os.path.dirname(out_path), exist_ok=True)
     with open(out_path, "w", encoding="utf-8", newline="\n") as f:
         f.write(header)
     print(f"Wrote {out_path}")
+
+
+# Binary font file read by SdFont (src/rendering/SdFont.h)
+BINARY_FONT_MAGIC = 0x0046524D  # "MRF\0"
+BINARY_FONT_VERSION = 1
+BINARY_FONT_HEADER = struct.Struct("<IBBBBB3xIIIIHH32s")
+BINARY_FONT_GLYPH = struct.Struct("<IIBBBbb3x")
+# SdFont keeps 16-bit offsets relative to each block of 64 glyphs
+BINARY_FONT_BLOCK = 64
+
+
+def write_binary_font(
+    font_name: str,
+    out_path: str,
+    chars: List[int],
+    glyphs: List[dict],
+    bitmap_all: List[int],
+    bitmap_lsb_all: List[int],
+    bitmap_msb_all: List[int],
+    yadvance: int,
+    size: int,
+    grayscale: bool = True,
+    style: int = 0,
+    kerning: Optional[Dict[Tuple[int, int], int]] = None,
+):
+    """Write a font the reader loads from the SD card at runtime.
+
+    Glyph bitmaps are always run-length coded; metrics match SimpleGFXglyph.
+    """
+    chunks, offsets = encode_font_rle(
+        chars, glyphs, bitmap_all, bitmap_lsb_all, bitmap_msb_all, grayscale
+    )
+    for idx in range(0, len(offsets), BINARY_FONT_BLOCK):
+        block = offsets[idx : idx + BINARY_FONT_BLOCK]
+        if block[-1] - block[0] > 0xFFFF:
+            raise ValueError(f"glyphs {idx}..{idx + len(block) - 1} span more than 64 KB")
+    data = b"".join(bytes(c) for c in chunks)
+    max_glyph = max((len(c) for c in chunks), default=0)
+    kern = b""
+    kern_index_count = 0
+    if kerning:
+        index, second, adjust = build_kerning_arrays(kerning)
+        kern_index_count = len(index) - 1
+        kern = struct.pack(f"<{len(index)}H{len(second)}H{len(adjust)}b", *index, *second, *adjust)
+    table_offset = BINARY_FONT_HEADER.size
+    data_offset = table_offset + BINARY_FONT_GLYPH.size * len(chars) + len(kern)
+    fmt = 2 if grayscale else 1  # FONT_BITMAP_RLE_GRAY / FONT_BITMAP_RLE_BW
+    header = BINARY_FONT_HEADER.pack(
+        BINARY_FONT_MAGIC,
+        BINARY_FONT_VERSION,
+        fmt,
+        yadvance,
+        size,
+        style,
+        len(chars),
+        table_offset,
+        data_offset,
+        len(data),
+        max_glyph,
+        kern_index_count,
+        font_name.encode("utf-8")[:31],
+    )
+    table = b"".join(
+        BINARY_FONT_GLYPH.pack(
+            ch, offsets[idx], g["width"], g["height"], g["xAdvance"], g["xOffset"], g["yOffset"]
+        )
+        for idx, (ch, g) in enumerate(zip(chars, glyphs))
+    )
+    out_dir = os.path.dirname(out_path)
+    if out_dir:
+        os.makedirs(out_dir, exist_ok=True)
+    with open(out_path, "wb") as f:
+        f.write(header + table + kern + data)
+    print(f"Wrote {out_path}")
@@ -1,10 +1,15 @@
 #include "CssParser.h"
 
 #include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
 
-static float parseSimpleFloat(const char* s, bool* ok) {
+// Parse a decimal number; `end` (if given) is set to the first byte after it
+static float parseSimpleFloat(const char* s, bool* ok, const char** end = nullptr) {
   if (ok)
     *ok = false;
+  if (end)
+    *end = s;
   if (!s)
     return 0.0f;
 
@@ -42,11 +47,23 @@ static float parseSimpleFloat(const char* s, bool* ok) {
     return 0.0f;
   if (ok)
     *ok = true;
+  if (end)
+    *end = s;
 
   float v = intPart + (scale > 1.0f ? (fracPart / scale) : 0.0f);
   return neg ? -v : v;
 }
 
+// Where parseFile() is in the stylesheet
+enum class ScanState : uint8_t {
+  Prelude,  // Selector list, up to '{'
+  Block,    // Declaration block
+  Quoted,   // String inside a declaration block
+  Comment,
+  AtRule,  // @-rule, up to ';' or its block
+  AtBlock  // Block of an @-rule (@media, @font-face, ...), skipped
+};
+
 CssParser::CssParser() {}
 
 CssParser::~CssParser() {}
@@ -58,158 +75,193 @@ bool CssParser::parseFile(const char* filepath) {
     return false;
   }
 
-  // Stream parse: read character-by-character and process rules
-  String selector;
-  String properties;
-  bool inComment = false;
-  bool inAtRule = false;
-  bool inRule = false;
-  bool inString = false;
-  char stringQuote = 0;
-  int braceCount = 0;
-
-  // Use a single-character pushback instead of File::peek(), which may be missing in mocks
-  int pushback = -1;
-  while (file.available() || pushback != -1) {
-    char c;
-    if (pushback != -1) {
-      c = (char)pushback;
-      pushback = -1;
+  // One buffer for the chunk being scanned and the rule being collected
+  char* chunk = static_cast<char*>(malloc(kReadChunkSize + kMaxRuleLength));
+  if (!chunk) {
+    file.close();
+    Serial.printf("CssParser: Out of memory for %s\n", filepath);
+    return false;
+  }
+  char* rule = chunk + kReadChunkSize;
+  size_t ruleLength = 0;
+  size_t selectorLength = 0;
+  bool tooLong = false;
+  int skipped = 0;
+
+  ScanState state = ScanState::Prelude;
+  ScanState afterComment = ScanState::Prelude;
+  char quote = 0;
+  int depth = 0;
+  bool slash = false;  // The last chunk ended in a '/' that may open a comment
+  bool star = false;   // The last comment byte was a '*'
+
+  // The selector list and declaration block are collected without comments;
+  // everything else is only scanned
+  auto collecting = [&]() {
+    return state == ScanState::Prelude || state == ScanState::Block || state == ScanState::Quoted;
+  };
+  auto collect = [&](const char* text, size_t length) {
+    if (ruleLength + length > kMaxRuleLength) {
+      tooLong = true;
+      return;
+    }
+    memcpy(rule + ruleLength, text, length);
+    ruleLength += length;
+  };
+  auto endRule = [&]() {
+    if (tooLong) {
+      skipped++;
     } else {
-      c = (char)file.read();
+      parseRule(rule, selectorLength, rule + selectorLength, ruleLength - selectorLength);
     }
+    ruleLength = 0;
+    tooLong = false;
+  };
 
-    // Handle comment start '/*'
-    if (!inComment && c == '/') {
-      // Probe next char
-      int next = -1;
-      if (file.available())
-        next = file.read();
-      if (next == '*') {
-        inComment = true;
-        continue;
-      }
-      // Not a comment. Push back the next char if any, and continue processing '/'
-      if (next != -1)
-        pushback = next;
-    }
-
-    if (inComment) {
-      // Look for end of comment '*/'
-      if (c == '*') {
-        int next = -1;
-        if (file.available())
-          next = file.read();
-        if (next == '/') {
-          inComment = false;
-        } else if (next != -1) {
-          pushback = next;
-        }
-      }
-      continue;
+  while (file.available()) {
+    const size_t got = file.read(reinterpret_cast<uint8_t*>(chunk), kReadChunkSize);
+    if (got == 0) {
+      break;
     }
 
-    // Ignore carriage returns entirely
-    if (c == '\r')
-      continue;
-
-    if (!inRule) {
-      // Handle AT-rules by skipping until ; or matching braces
-      if (inAtRule) {
-        if (c == '{') {
-          braceCount++;
-        } else if (c == '}') {
-          if (braceCount > 0) {
-            braceCount--;
-            if (braceCount == 0) {
-              inAtRule = false;
-            }
-          }
-        } else if (c == ';' && braceCount == 0) {
-          inAtRule = false;
-        }
-        continue;
+    size_t i = 0;
+    if (slash) {
+      slash = false;
+      if (chunk[0] == '*') {
+        afterComment = state;
+        state = ScanState::Comment;
+        star = false;
+        i = 1;
+      } else if (collecting()) {
+        collect("/", 1);
       }
+    }
 
-      // Not in rule and not in AT-rule
-      if (c == '@') {
-        inAtRule = true;
-        braceCount = 0;
-        // start collecting the at-rule but we don't need it; skip it
+    // chunk[run, i) is copied into the rule in one go at the next comment or
+    // brace, or at the end of the chunk
+    size_t run = i;
+    for (; i < got; i++) {
+      const char c = chunk[i];
+      if (state == ScanState::Comment) {
+        if (star && c == '/') {
+          state = afterComment;
+          run = i + 1;
+        }
+        star = (c == '*');
         continue;
       }
-
-      if (c == '{') {
-        // start of a declaration block
-        inRule = true;
-        braceCount = 1;
-        selector.trim();
-        properties = "";
+      if (state == ScanState::Quoted) {
+        if (c == quote) {
+          state = ScanState::Block;
+        }
         continue;
       }
-
-      // Normal selector characters
-      selector += c;
-    } else {
-      // We are inside a declaration block for a selector
-      // Track quoted strings so braces inside values don't confuse us
-      if (!inString && (c == '"' || c == '\'')) {
-        inString = true;
-        stringQuote = c;
-        properties += c;
-        continue;
-      } else if (inString && c == stringQuote) {
-        inString = false;
-        stringQuote = 0;
-        properties += c;
+      if (c == '/') {
+        if (i + 1 < got && chunk[i + 1] != '*') {
+          continue;
+        }
+        if (collecting()) {
+          collect(chunk + run, i - run);
+        }
+        run = i + 2;
+        if (i + 1 == got) {
+          slash = true;
+        } else {
+          afterComment = state;
+          state = ScanState::Comment;
+          star = false;
+          i++;
+        }
         continue;
       }
 
-      if (!inString) {
-        if (c == '{') {
-          braceCount++;
-          properties += c;
-          continue;
-        } else if (c == '}') {
-          braceCount--;
-          if (braceCount == 0) {
-            // End of declaration block; parse the rule
-            properties.trim();
-            if (selector.length() > 0 && properties.length() > 0) {
-              parseRule(selector, properties);
-            }
-            // Reset for next rule
-            selector = "";
-            properties = "";
-            inRule = false;
-            continue;
+      switch (state) {
+        case ScanState::Prelude:
+          if (c == '{') {
+            collect(chunk + run, i - run);
+            selectorLength = ruleLength;
+            depth = 1;
+            state = ScanState::Block;
+            run = i + 1;
+          } else if (c == '@' || c == '}') {
+            // An @-rule, or a stray '}' ending whatever came before it
+            ruleLength = 0;
+            tooLong = false;
+            state = (c == '@') ? ScanState::AtRule : ScanState::Prelude;
+            run = i + 1;
           }
-        }
+          break;
+        case ScanState::Block:
+          if (c == '"' || c == '\'') {
+            quote = c;
+            state = ScanState::Quoted;
+          } else if (c == '{') {
+            depth++;
+          } else if (c == '}' && --depth == 0) {
+            collect(chunk + run, i - run);
+            endRule();
+            state = ScanState::Prelude;
+            run = i + 1;
+          }
+          break;
+        case ScanState::AtRule:
+          if (c == ';') {
+            state = ScanState::Prelude;
+            run = i + 1;
+          } else if (c == '{') {
+            depth = 1;
+            state = ScanState::AtBlock;
+          }
+          break;
+        case ScanState::AtBlock:
+          if (c == '{') {
+            depth++;
+          } else if (c == '}' && --depth == 0) {
+            state = ScanState::Prelude;
+            run = i + 1;
+          }
+          break;
+        default:
+          break;
       }
-
-      // Append character to properties
-      properties += c;
+    }
+    if (collecting() && run < got) {
+      collect(chunk + run, got - run);
     }
   }
 
-  // If EOF reached and still inside a rule, try to finalize it
-  if (inRule && properties.length() > 0) {
-    properties.trim();
-    selector.trim();
-    if (selector.length() > 0) {
-      parseRule(selector, properties);
-    }
+  // A declaration block still open at the end of the file counts
+  if (state == ScanState::Block || state == ScanState::Quoted) {
+    endRule();
   }
 
+  free(chunk);
   file.close();
-  Serial.printf("  CssParser: Loaded %d style rules\n", styleMap_.size());
+  buildIndex();
+  Serial.printf("  CssParser: Loaded %d style rules, %d names\n", (int)rules_.size(), (int)names_.size());
+  if (skipped > 0) {
+    Serial.printf("  CssParser: Skipped %d rules longer than %d bytes\n", skipped, (int)kMaxRuleLength);
+  }
   return true;
 }
 
+void CssParser::clear() {
+  names_.clear();
+  nameSlots_.clear();
+  styles_.clear();
+  rules_.clear();
+  ancestors_.clear();
+  classStart_.clear();
+  classRules_.clear();
+  nameStart_.clear();
+  nameRules_.clear();
+  classStyles_.clear();
+}
+
 const CssStyle* CssParser::getStyleForClass(const String& className) const {
-  auto it = styleMap_.find(className);
-  if (it != styleMap_.end()) {
-    return &it->second;
+  const uint16_t id = findName(className.c_str(), className.length());
+  if (id < classStyles_.size() && !classStyles_[id].isEmpty()) {
+    return &classStyles_[id];
   }
   return nullptr;
 }
@@ -251,127 +303,515 @@ CssStyle CssParser::getCombinedStyle(const String& classNames) const {
   return combined;
 }
 
-void CssParser::parseRule(const String& selector, const String& properties) {
-  // Parse the selector - handle comma-separated selectors
-  int start = 0;
-  int len = selector.length();
+void CssParser::parseRule(const char* selector, size_t selectorLength, const char* block, size_t blockLength) {
+  CssStyle style;
+  parseDeclarations(block, blockLength, style);
 
-  while (start < len) {
-    // Find next comma or end
-    int end = selector.indexOf(',', start);
-    if (end < 0)
-      end = len;
-
-    String singleSelector = selector.substring(start, end);
-    singleSelector.trim();
-
-    if (singleSelector.length() > 0) {
-      // Extract class name from selector
-      String className = extractClassName(singleSelector);
-
-      if (className.length() > 0) {
-        // Parse properties
-        CssStyle style;
-
-        // Split properties by semicolon
-        int propStart = 0;
-        int propLen = properties.length();
-
-        while (propStart < propLen) {
-          int propEnd = properties.indexOf(';', propStart);
-          if (propEnd < 0)
-            propEnd = propLen;
-
-          String prop = properties.substring(propStart, propEnd);
-          prop.trim();
-
-          if (prop.length() > 0) {
-            // Split property into name and value
-            int colonPos = prop.indexOf(':');
-            if (colonPos > 0) {
-              String propName = prop.substring(0, colonPos);
-              String propValue = prop.substring(colonPos + 1);
-              propName.trim();
-              propValue.trim();
-
-              // Convert to lowercase for comparison
-              propName.toLowerCase();
-
-              parseProperty(propName, propValue, style);
-            }
-          }
+  // Only keep rules with supported properties
+  if (style.isEmpty() || styles_.size() >= kNoId) {
+    return;
+  }
 
-          propStart = propEnd + 1;
-        }
+  // Comma-separated selectors share the declaration block
+  const uint16_t styleIndex = (uint16_t)styles_.size();
+  const char* end = selector + selectorLength;
+  while (selector < end) {
+    const char* comma = static_cast<const char*>(memchr(selector, ',', end - selector));
+    const char* selectorEnd = comma ? comma : end;
+    addSelector(selector, selectorEnd - selector, styleIndex, style);
+    selector = comma ? comma + 1 : end;
+  }
+}
 
-        // Store style if it has any supported properties
-        if (style.hasTextAlign || style.hasFontStyle || style.hasFontWeight) {
-          // Merge with existing style if present
-          auto it = styleMap_.find(className);
-          if (it != styleMap_.end()) {
-            it->second.merge(style);
-          } else {
-            styleMap_[className] = style;
-          }
-        }
+// Longest tag name in a selector; no XHTML element name comes close
+static constexpr size_t kMaxTagLength = 16;
+
+// A name inside the collected stylesheet text
+struct NameSpan {
+  const char* text;
+  size_t length;
+};
+
+// Split "tag", ".class" or "tag.class" in place. Names can contain letters,
+// digits, hyphens and underscores; anything else (#id, :pseudo, [attr], >,
+// +, ~, *, a second '.') is unsupported.
+static bool splitCompound(const char* text, size_t length, NameSpan& tag, NameSpan& className) {
+  const char* dot = static_cast<const char*>(memchr(text, '.', length));
+  tag = {text, dot ? (size_t)(dot - text) : length};
+  className = {dot ? dot + 1 : text + length, dot ? length - tag.length - 1 : 0};
+  for (size_t i = 0; i < length; i++) {
+    const char c = text[i];
+    if (text + i != dot &&
+        !((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_')) {
+      return false;
+    }
+  }
+  return (!dot || className.length > 0) && tag.length <= kMaxTagLength;
+}
+
+bool CssParser::addSelector(const char* selector, size_t length, uint16_t styleIndex, const CssStyle& style) {
+  // Split into compounds at whitespace (the descendant combinator)
+  NameSpan tags[kMaxCompounds];
+  NameSpan classNames[kMaxCompounds];
+  size_t count = 0;
+  uint16_t specificity = 0;
+  size_t pos = 0;
+
+  while (pos < length) {
+    while (pos < length && isspace(static_cast<unsigned char>(selector[pos]))) {
+      pos++;
+    }
+    if (pos >= length)
+      break;
+
+    size_t end = pos;
+    while (end < length && !isspace(static_cast<unsigned char>(selector[end]))) {
+      end++;
+    }
+    if (count == kMaxCompounds || !splitCompound(selector + pos, end - pos, tags[count], classNames[count])) {
+      return false;
+    }
+    specificity += (classNames[count].length > 0 ? 0x100 : 0) + (tags[count].length > 0 ? 1 : 0);
+    count++;
+    pos = end;
+  }
+
+  if (count == 0 || rules_.size() >= kNoId || ancestors_.size() + count > kNoId) {
+    return false;
+  }
+
+  // The selector is supported: intern its names. Tag names are
+  // case-insensitive in XHTML stylesheets, class names are not.
+  Compound compounds[kMaxCompounds];
+  for (size_t i = 0; i < count; i++) {
+    char tag[kMaxTagLength];
+    for (size_t c = 0; c < tags[i].length; c++) {
+      tag[c] = (char)tolower(static_cast<unsigned char>(tags[i].text[c]));
+    }
+    compounds[i].name = tags[i].length > 0 ? internName(tag, tags[i].length) : kNoId;
+    compounds[i].classId = classNames[i].length > 0 ? internName(classNames[i].text, classNames[i].length) : kNoId;
+    if ((tags[i].length > 0 && compounds[i].name == kNoId) ||
+        (classNames[i].length > 0 && compounds[i].classId == kNoId)) {
+      return false;
+    }
+  }
+
+  // The first selector to use the declaration block stores it
+  if (styles_.size() == styleIndex) {
+    styles_.push_back(style);
+  }
+
+  Rule rule;
+  rule.subject = compounds[count - 1];
+  rule.ancestorStart = (uint16_t)ancestors_.size();
+  rule.ancestorCount = (uint8_t)(count - 1);
+  rule.specificity = specificity;
+  rule.style = styleIndex;
+  for (size_t i = count - 1; i-- > 0;) {
+    ancestors_.push_back(compounds[i]);
+  }
+  rules_.push_back(rule);
+
+  // Keep the per-class view for getStyleForClass()/getCombinedStyle()
+  if (rule.subject.classId != kNoId) {
+    if (classStyles_.size() <= rule.subject.classId) {
+      classStyles_.resize(names_.size());
+    }
+    classStyles_[rule.subject.classId].merge(style);
+  }
+  return true;
+}
+
+void CssParser::buildIndex() {
+  // Counting sort of the rules into one bucket per class id, and one per
+  // tag name id for rules without a class
+  classStart_.assign(names_.size() + 1, 0);
+  nameStart_.assign(names_.size() + 1, 0);
+  for (const Rule& rule : rules_) {
+    if (rule.subject.classId != kNoId) {
+      classStart_[rule.subject.classId + 1]++;
+    } else {
+      nameStart_[rule.subject.name + 1]++;
+    }
+  }
+  for (size_t i = 1; i <= names_.size(); i++) {
+    classStart_[i] += classStart_[i - 1];
+    nameStart_[i] += nameStart_[i - 1];
+  }
+
+  classRules_.resize(classStart_[names_.size()]);
+  nameRules_.resize(nameStart_[names_.size()]);
+  std::vector<uint16_t> classNext(classStart_.begin(), classStart_.end() - 1);
+  std::vector<uint16_t> nameNext(nameStart_.begin(), nameStart_.end() - 1);
+  for (size_t i = 0; i < rules_.size(); i++) {
+    const Compound& subject = rules_[i].subject;
+    if (subject.classId != kNoId) {
+      classRules_[classNext[subject.classId]++] = (uint16_t)i;
+    } else {
+      nameRules_[nameNext[subject.name]++] = (uint16_t)i;
+    }
+  }
+}
+
+CssParser::Element CssParser::compileElement(const String& tagName, const String& classAttr) const {
+  Element element;
+  element.name = findName(tagName.c_str(), tagName.length());
+
+  // Split the class attribute by whitespace without copying
+  const char* classes = classAttr.c_str();
+  const size_t len = classAttr.length();
+  size_t start = 0;
+  while (start < len && element.classCount < kMaxElementClasses) {
+    while (start < len && isspace(static_cast<unsigned char>(classes[start]))) {
+      start++;
+    }
+    size_t end = start;
+    while (end < len && !isspace(static_cast<unsigned char>(classes[end]))) {
+      end++;
+    }
+
+    const uint16_t id = end > start ? findName(classes + start, end - start) : kNoId;
+    bool seen = (id == kNoId);
+    for (uint8_t i = 0; i < element.classCount && !seen; i++) {
+      seen = (element.classes[i] == id);
+    }
+    if (!seen) {
+      element.classes[element.classCount++] = id;
+    }
+    start = end;
+  }
+  return element;
+}
+
+CssStyle CssParser::resolve(const Element* path, size_t depth) const {
+  CssStyle style;
+  if (depth == 0 || rules_.empty()) {
+    return style;
+  }
+
+  // Candidates are the buckets of the element's classes and tag name
+  const Element& element = path[depth - 1];
+  uint16_t matched[kMaxMatches];
+  size_t count = 0;
+  for (uint8_t c = 0; c <= element.classCount; c++) {
+    const bool byClass = c < element.classCount;
+    const uint16_t id = byClass ? element.classes[c] : element.name;
+    const std::vector<uint16_t>& start = byClass ? classStart_ : nameStart_;
+    const std::vector<uint16_t>& list = byClass ? classRules_ : nameRules_;
+    if (id == kNoId || (size_t)id + 1 >= start.size()) {
+      continue;
+    }
+    for (uint16_t i = start[id]; i < start[id + 1] && count < kMaxMatches; i++) {
+      if (matches(rules_[list[i]], path, depth)) {
+        matched[count++] = list[i];
       }
     }
+  }
 
-    start = end + 1;
+  // Cascade: lower specificity first, then source order
+  for (size_t i = 1; i < count; i++) {
+    const uint16_t rule = matched[i];
+    size_t j = i;
+    while (j > 0 && (rules_[matched[j - 1]].specificity > rules_[rule].specificity ||
+                     (rules_[matched[j - 1]].specificity == rules_[rule].specificity && matched[j - 1] > rule))) {
+      matched[j] = matched[j - 1];
+      j--;
+    }
+    matched[j] = rule;
+  }
+  for (size_t i = 0; i < count; i++) {
+    style.merge(styles_[rules_[matched[i]].style]);
   }
+  return style;
 }
 
-void CssParser::parseProperty(const String& name, const String& value, CssStyle& style) {
-  if (name == "text-align") {
+bool CssParser::matches(const Rule& rule, const Element* path, size_t depth) const {
+  if (!matchesCompound(rule.subject, path[depth - 1])) {
+    return false;
+  }
+
+  // Descendant combinators only: match each ancestor compound against the
+  // nearest remaining ancestor element that fits
+  size_t next = depth - 1;
+  for (uint8_t a = 0; a < rule.ancestorCount; a++) {
+    const Compound& compound = ancestors_[rule.ancestorStart + a];
+    bool found = false;
+    while (next > 0 && !found) {
+      found = matchesCompound(compound, path[--next]);
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CssParser::matchesCompound(const Compound& compound, const Element& element) {
+  if (compound.name != kNoId && compound.name != element.name) {
+    return false;
+  }
+  if (compound.classId == kNoId) {
+    return true;
+  }
+  for (uint8_t i = 0; i < element.classCount; i++) {
+    if (element.classes[i] == compound.classId) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// FNV-1a
+static uint32_t hashName(const char* name, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+  }
+  return hash;
+}
+
+uint16_t CssParser::findName(const char* name, size_t length) const {
+  if (nameSlots_.empty()) {
+    return kNoId;
+  }
+  const size_t mask = nameSlots_.size() - 1;
+  for (size_t slot = hashName(name, length) & mask; nameSlots_[slot] != 0; slot = (slot + 1) & mask) {
+    const String& candidate = names_[nameSlots_[slot] - 1];
+    if ((size_t)candidate.length() == length && memcmp(candidate.c_str(), name, length) == 0) {
+      return nameSlots_[slot] - 1;
+    }
+  }
+  return kNoId;
+}
+
+uint16_t CssParser::internName(const char* name, size_t length) {
+  const uint16_t existing = findName(name, length);
+  if (existing != kNoId) {
+    return existing;
+  }
+  if (names_.size() + 1 >= kNoId) {
+    return kNoId;
+  }
+
+  // Keep the table at most half full
+  if ((names_.size() + 1) * 2 > nameSlots_.size()) {
+    nameSlots_.assign(nameSlots_.empty() ? 64 : nameSlots_.size() * 2, 0);
+    const size_t mask = nameSlots_.size() - 1;
+    for (size_t id = 0; id < names_.size(); id++) {
+      size_t slot = hashName(names_[id].c_str(), names_[id].length()) & mask;
+      while (nameSlots_[slot] != 0) {
+        slot = (slot + 1) & mask;
+      }
+      nameSlots_[slot] = (uint16_t)(id + 1);
+    }
+  }
+
+  const size_t mask = nameSlots_.size() - 1;
+  size_t slot = hashName(name, length) & mask;
+  while (nameSlots_[slot] != 0) {
+    slot = (slot + 1) & mask;
+  }
+  String stored;
+  stored.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    stored += name[i];
+  }
+  names_.push_back(stored);
+  nameSlots_[slot] = (uint16_t)names_.size();
+  return (uint16_t)(names_.size() - 1);
+}
+
+// Parse a length ("1.5em", "20px", "12pt", or a bare number of pixels) to
+// pixels at 16px per em; `em` (if given) is set for lengths in em, which scale
+// with the element's font size. Returns false for percentages, keywords and other units.
+static bool parseLength(const char* value, float* px, bool* em = nullptr) {
+  bool parsed = false;
+  const char* unit = value;
+  const float number = parseSimpleFloat(value, &parsed, &unit);
+  if (!parsed) {
+    return false;
+  }
+  while (isspace(static_cast<unsigned char>(*unit))) {
+    unit++;
+  }
+
+  float factor = 1.0f;
+  const bool isEm = strcmp(unit, "em") == 0;
+  if (isEm || strcmp(unit, "rem") == 0) {
+    factor = 16.0f;
+  } else if (strcmp(unit, "pt") == 0) {
+    factor = 4.0f / 3.0f;
+  } else if (*unit != '\0' && strcmp(unit, "px") != 0) {
+    return false;
+  }
+  *px = number * factor;
+  if (em) {
+    *em = isEm;
+  }
+  return true;
+}
+
+// Clamp a margin in pixels; negative margins are not supported and count as 0
+static int16_t marginPixels(float px) {
+  return px <= 0.0f ? 0 : (px > 1000.0f ? 1000 : (int16_t)(px + 0.5f));
+}
+
+// Parse a font-size value to percent of the body size; returns 0 if unsupported
+static uint16_t parseFontSize(const char* value) {
+  static const struct {
+    const char* name;
+    uint16_t percent;
+  } kKeywords[] = {{"xx-small", 60},  {"x-small", 75},  {"small", 89},   {"medium", 100}, {"large", 120},
+                   {"x-large", 150},  {"xx-large", 200}, {"smaller", 83}, {"larger", 120}};
+  for (const auto& keyword : kKeywords) {
+    if (strcmp(value, keyword.name) == 0) {
+      return keyword.percent;
+    }
+  }
+
+  bool parsed = false;
+  const char* unit = value;
+  float percent = parseSimpleFloat(value, &parsed, &unit);
+  if (!parsed) {
+    return 0;
+  }
+  if (strcmp(unit, "%") != 0) {
+    float px = 0.0f;
+    if (!parseLength(value, &px)) {
+      return 0;
+    }
+    percent = px * (100.0f / 16.0f);
+  }
+  if (percent < 10.0f) {
+    return 0;
+  }
+  return percent > 400.0f ? 400 : (uint16_t)(percent + 0.5f);
+}
+
+// Longest property name and value parsed; longer ones belong to properties
+// we do not support (font-family lists, src urls, ...)
+static constexpr size_t kMaxPropertyName = 16;
+static constexpr size_t kMaxPropertyValue = 48;
+
+// Copy [begin, end) trimmed and in lower case to out[size]; false if it does not fit
+static bool copyLower(const char* begin, const char* end, char* out, size_t size) {
+  while (begin < end && isspace(static_cast<unsigned char>(*begin))) {
+    begin++;
+  }
+  while (end > begin && isspace(static_cast<unsigned char>(end[-1]))) {
+    end--;
+  }
+  if ((size_t)(end - begin) >= size) {
+    return false;
+  }
+  for (; begin < end; begin++) {
+    *out++ = (char)tolower(static_cast<unsigned char>(*begin));
+  }
+  *out = '\0';
+  return true;
+}
+
+void CssParser::parseDeclarations(const char* text, size_t length, CssStyle& style) {
+  // Split at ';' and each declaration at its first ':', without allocating
+  const char* end = text + length;
+  while (text < end) {
+    const char* semicolon = static_cast<const char*>(memchr(text, ';', end - text));
+    const char* declarationEnd = semicolon ? semicolon : end;
+    const char* colon = static_cast<const char*>(memchr(text, ':', declarationEnd - text));
+    char name[kMaxPropertyName];
+    char value[kMaxPropertyValue];
+    if (colon && copyLower(text, colon, name, sizeof(name)) && name[0] != '\0' &&
+        copyLower(colon + 1, declarationEnd, value, sizeof(value))) {
+      parseProperty(name, value, style);
+    }
+    text = semicolon ? semicolon + 1 : end;
+  }
+}
+
+void CssParser::parseProperty(const char* name, char* value, CssStyle& style) {
+  if (strcmp(name, "text-align") == 0) {
     style.textAlign = parseTextAlign(value);
     style.hasTextAlign = true;
-  } else if (name == "font-style") {
+  } else if (strcmp(name, "font-style") == 0) {
     style.fontStyle = parseFontStyle(value);
     style.hasFontStyle = true;
-  } else if (name == "font-weight") {
+  } else if (strcmp(name, "font-weight") == 0) {
     style.fontWeight = parseFontWeight(value);
     style.hasFontWeight = true;
-  } else if (name == "text-indent") {
-    // Parse text-indent values like '20px', '1.5em', or plain numbers.
-    String v = value;
-    v.trim();
-    v.toLowerCase();
-
-    // Default unit: pixels. For 'em' convert to px assuming 16px per em.
-    int16_t factor = 1;
-    if (v.length() >= 2 && v.substring(v.length() - 2) == String("em")) {
-      factor = 16;
-      v = v.substring(0, v.length() - 2);
-    } else if (v.length() >= 2 && v.substring(v.length() - 2) == String("px")) {
-      v = v.substring(0, v.length() - 2);
-    }
-
-    v.trim();
+  } else if (strcmp(name, "text-indent") == 0) {
+    // Zero cancels an earlier indent; hanging (negative) indents are not supported
     float indentVal = 0.0f;
-    if (v.length() > 0) {
-      bool parsed = false;
-      indentVal = parseSimpleFloat(v.c_str(), &parsed) * factor;
-      if (!parsed)
-        indentVal = 0.0f;
+    bool em = false;
+    if (parseLength(value, &indentVal, &em) && indentVal >= 0.0f) {
+      style.textIndent = indentVal > 1000.0f ? 1000 : (int16_t)indentVal;
+      style.hasTextIndent = true;
+      style.textIndentEm = em;
+    }
+  } else if (strcmp(name, "margin-top") == 0 || strcmp(name, "margin-bottom") == 0) {
+    float px = 0.0f;
+    bool em = false;
+    if (parseLength(value, &px, &em)) {
+      if (strcmp(name, "margin-top") == 0) {
+        style.marginTop = marginPixels(px);
+        style.hasMarginTop = true;
+        style.marginTopEm = em;
+      } else {
+        style.marginBottom = marginPixels(px);
+        style.hasMarginBottom = true;
+        style.marginBottomEm = em;
+      }
+    }
+  } else if (strcmp(name, "margin") == 0) {
+    // One to four values: top [right [bottom [left]]]; bottom defaults to top.
+    // Split the value in place.
+    const char* values[4];
+    int count = 0;
+    char* pos = value;
+    while (*pos && count < 4) {
+      while (isspace(static_cast<unsigned char>(*pos))) {
+        pos++;
+      }
+      if (!*pos) {
+        break;
+      }
+      values[count++] = pos;
+      while (*pos && !isspace(static_cast<unsigned char>(*pos))) {
+        pos++;
+      }
+      if (*pos) {
+        *pos++ = '\0';
+      }
+    }
+    float px = 0.0f;
+    bool em = false;
+    if (count > 0 && parseLength(values[0], &px, &em)) {
+      style.marginTop = marginPixels(px);
+      style.hasMarginTop = true;
+      style.marginTopEm = em;
+    }
+    if (count > 0 && parseLength(values[count >= 3 ? 2 : 0], &px, &em)) {
+      style.marginBottom = marginPixels(px);
+      style.hasMarginBottom = true;
+      style.marginBottomEm = em;
+    }
+  } else if (strcmp(name, "font-size") == 0) {
+    const uint16_t percent = parseFontSize(value);
+    if (percent > 0) {
+      style.fontSize = percent;
+      style.hasFontSize = true;
     }
-    style.textIndent = indentVal;
-    style.hasTextIndent = (indentVal > 0);
   }
   // Add more property parsing here as needed
 }
 
-TextAlign CssParser::parseTextAlign(const String& value) {
-  String v = value;
-  v.toLowerCase();
-  v.trim();
-
-  if (v == "left" || v == "start") {
+TextAlign CssParser::parseTextAlign(const char* value) {
+  if (strcmp(value, "left") == 0 || strcmp(value, "start") == 0) {
     return TextAlign::Left;
-  } else if (v == "right" || v == "end") {
+  } else if (strcmp(value, "right") == 0 || strcmp(value, "end") == 0) {
     return TextAlign::Right;
-  } else if (v == "center") {
+  } else if (strcmp(value, "center") == 0) {
     return TextAlign::Center;
-  } else if (v == "justify") {
+  } else if (strcmp(value, "justify") == 0) {
     return TextAlign::Justify;
   }
 
@@ -379,12 +819,8 @@ TextAlign CssParser::parseTextAlign(const String& value) {
   return TextAlign::Left;
 }
 
-CssFontStyle CssParser::parseFontStyle(const String& value) {
-  String v = value;
-  v.toLowerCase();
-  v.trim();
-
-  if (v == "italic" || v == "oblique") {
+CssFontStyle CssParser::parseFontStyle(const char* value) {
+  if (strcmp(value, "italic") == 0 || strcmp(value, "oblique") == 0) {
     return CssFontStyle::Italic;
   }
 
@@ -392,12 +828,9 @@ CssFontStyle CssParser::parseFontStyle(const String& value) {
   return CssFontStyle::Normal;
 }
 
-CssFontWeight CssParser::parseFontWeight(const String& value) {
-  String v = value;
-  v.toLowerCase();
-  v.trim();
-
-  if (v == "bold" || v == "bolder" || v == "700" || v == "800" || v == "900") {
+CssFontWeight CssParser::parseFontWeight(const char* value) {
+  if (strcmp(value, "bold") == 0 || strcmp(value, "bolder") == 0 || strcmp(value, "700") == 0 ||
+      strcmp(value, "800") == 0 || strcmp(value, "900") == 0) {
     return CssFontWeight::Bold;
   }
 
@@ -405,136 +838,9 @@ CssFontWeight CssParser::parseFontWeight(const String& value) {
   return CssFontWeight::Normal;
 }
 
-String CssParser::extractClassName(const String& selector) {
-  // Find the class selector (starts with '.')
-  int dotPos = selector.indexOf('.');
-  if (dotPos < 0) {
-    return String("");  // No class selector
-  }
-
-  // Extract class name (everything after '.' until end or special char)
-  int start = dotPos + 1;
-  int end = start;
-  int len = selector.length();
-
-  while (end < len) {
-    char c = selector.charAt(end);
-    // Class name can contain letters, digits, hyphens, underscores
-    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_') {
-      end++;
-    } else {
-      break;
-    }
-  }
-
-  if (end > start) {
-    return selector.substring(start, end);
-  }
-
-  return String("");
-}
-
-CssStyle CssParser::parseInlineStyle(const String& styleAttr) const {
-  CssStyle style;
-
-  if (styleAttr.isEmpty()) {
-    return style;
-  }
-
-  // Parse inline style declarations (semicolon-separated)
+CssStyle CssParser::parseInlineStyle(const String& styleAttr) {
   // Format: "property1: value1; property2: value2;"
-  int propStart = 0;
-  int propLen = styleAttr.length();
-
-  while (propStart < propLen) {
-    int propEnd = styleAttr.indexOf(';', propStart);
-    if (propEnd < 0)
-      propEnd = propLen;
-
-    String prop = styleAttr.substring(propStart, propEnd);
-    prop.trim();
-
-    if (prop.length() > 0) {
-      // Split property into name and value
-      int colonPos = prop.indexOf(':');
-      if (colonPos > 0) {
-        String propName = prop.substring(0, colonPos);
-        String propValue = prop.substring(colonPos + 1);
-        propName.trim();
-        propValue.trim();
-
-        // Convert to lowercase for comparison
-        propName.toLowerCase();
-
-        // Use the same parsing logic as parseProperty
-        // Note: parseProperty is non-const, so we inline the logic here
-        if (propName == "text-align") {
-          String v = propValue;
-          v.toLowerCase();
-          v.trim();
-
-          if (v == "left" || v == "start") {
-            style.textAlign = TextAlign::Left;
-          } else if (v == "right" || v == "end") {
-            style.textAlign = TextAlign::Right;
-          } else if (v == "center") {
-            style.textAlign = TextAlign::Center;
-          } else if (v == "justify") {
-            style.textAlign = TextAlign::Justify;
-          } else {
-            style.textAlign = TextAlign::Left;
-          }
-          style.hasTextAlign = true;
-        } else if (propName == "font-style") {
-          String v = propValue;
-          v.toLowerCase();
-          v.trim();
-
-          if (v == "italic" || v == "oblique") {
-            style.fontStyle = CssFontStyle::Italic;
-          } else {
-            style.fontStyle = CssFontStyle::Normal;
-          }
-          style.hasFontStyle = true;
-        } else if (propName == "font-weight") {
-          String v = propValue;
-          v.toLowerCase();
-          v.trim();
-
-          if (v == "bold" || v == "bolder" || v == "700" || v == "800" || v == "900") {
-            style.fontWeight = CssFontWeight::Bold;
-          } else {
-            style.fontWeight = CssFontWeight::Normal;
-          }
-          style.hasFontWeight = true;
-        } else if (propName == "text-indent") {
-          String v = propValue;
-          v.trim();
-          v.toLowerCase();
-
-          int16_t factor = 1;
-          if (v.length() >= 2 && v.substring(v.length() - 2) == String("em")) {
-            factor = 16;
-            v = v.substring(0, v.length() - 2);
-          } else if (v.length() >= 2 && v.substring(v.length() - 2) == String("px")) {
-            v = v.substring(0, v.length() - 2);
-          }
-          v.trim();
-          float indentVal = 0.0f;
-          if (v.length() > 0) {
-            bool parsed = false;
-            indentVal = parseSimpleFloat(v.c_str(), &parsed) * factor;
-            if (!parsed)
-              indentVal = 0.0f;
-          }
-          style.textIndent = indentVal;
-          style.hasTextIndent = (indentVal > 0);
-        }
-      }
-    }
-
-    propStart = propEnd + 1;
-  }
-
+  CssStyle style;
+  parseDeclarations(styleAttr.c_str(), styleAttr.length(), style);
   return style;
 }
@@ -4,7 +4,7 @@
 #include <Arduino.h>
 #include <SD.h>
 
-#include <map>
+#include <cstdint>
 #include <vector>
 
 #include "CssStyle.h"
@@ -12,19 +12,44 @@
 /**
  * CssParser - Simple CSS parser for extracting supported properties
  *
- * This parser extracts CSS rules and maps class selectors to their
- * supported style properties. It handles:
+ * This parser extracts CSS rules with supported style properties and
+ * compiles their selectors for matching. It handles:
+ * - Element selectors (p)
  * - Class selectors (.classname)
  * - Element.class selectors (p.classname)
+ * - Descendant selectors (div.chapter p)
  * - Multiple selectors separated by commas
  *
+ * Tag and class names are interned to 16-bit ids and each rule is filed
+ * under the class (or, without one, the tag) of its rightmost compound, so
+ * resolving an element only probes the buckets of its own names. Matching
+ * rules cascade by specificity, then source order.
+ *
+ * parseFile() reads the stylesheet in fixed-size chunks into one buffer and
+ * works on spans of it: comments and @-rules are skipped while scanning, a
+ * rule's declarations are parsed before its selectors, and only the names of
+ * selectors that are stored get interned.
+ *
  * Limitations:
- * - Does not support complex selectors (descendant, child, etc.)
- * - Does not support pseudo-classes or pseudo-elements
- * - Only extracts properties we actually use (text-align)
+ * - Selectors with ids, attributes, pseudo-classes, child/sibling
+ *   combinators, '*' or several classes in one compound are skipped
+ * - Only extracts properties we actually use (text-align, font-style,
+ *   font-weight, text-indent, margin-top/bottom and font-size)
  */
 class CssParser {
  public:
+  // Id of a name no selector mentions
+  static constexpr uint16_t kNoId = 0xFFFF;
+  // Classes of one element that take part in matching
+  static constexpr uint8_t kMaxElementClasses = 4;
+
+  // An element compiled for resolve(): its tag and class names as interned ids
+  struct Element {
+    uint16_t name = kNoId;
+    uint8_t classCount = 0;
+    uint16_t classes[kMaxElementClasses];
+  };
+
   CssParser();
   ~CssParser();
 
@@ -35,7 +60,20 @@ class CssParser {
   bool parseFile(const char* filepath);
 
   /**
-   * Get the style for a given class name
+   * Compile an element from its tag name and class attribute. Names that no
+   * selector mentions are dropped, so they cost nothing in resolve().
+   */
+  Element compileElement(const String& tagName, const String& classAttr) const;
+
+  /**
+   * Cascade the rules matching path[depth - 1], whose ancestors are
+   * path[0 .. depth - 1) (outermost first)
+   */
+  CssStyle resolve(const Element* path, size_t depth) const;
+
+  /**
+   * Get the style for a given class name (all rules whose rightmost
+   * compound has that class, ignoring tag names and ancestors)
    * Returns nullptr if no style is defined for this class
    */
   const CssStyle* getStyleForClass(const String& className) const;
@@ -48,52 +86,106 @@ class CssParser {
 
   /**
    * Parse an inline style attribute (e.g., "text-align: center; color: red;")
-   * Returns a CssStyle with the parsed properties
+   * Returns a CssStyle with the parsed properties. Needs no loaded stylesheet.
    */
-  CssStyle parseInlineStyle(const String& styleAttr) const;
+  static CssStyle parseInlineStyle(const String& styleAttr);
 
   /**
    * Check if any styles have been loaded
    */
   bool hasStyles() const {
-    return !styleMap_.empty();
+    return !rules_.empty();
   }
 
   /**
    * Get the number of loaded style rules
    */
   size_t getStyleCount() const {
-    return styleMap_.size();
+    return rules_.size();
   }
 
   /**
    * Clear all loaded styles
    */
-  void clear() {
-    styleMap_.clear();
-  }
+  void clear();
 
  private:
-  // Parse a single rule block (selector { properties })
-  void parseRule(const String& selector, const String& properties);
-
-  // Parse property value and update style
-  void parseProperty(const String& name, const String& value, CssStyle& style);
+  // One compound of a selector (e.g. "p.note"); kNoId matches any
+  struct Compound {
+    uint16_t name;
+    uint16_t classId;
+  };
+
+  // A compiled selector with its declaration block
+  struct Rule {
+    Compound subject;        // Rightmost compound
+    uint16_t ancestorStart;  // Into ancestors_, innermost first
+    uint8_t ancestorCount;
+    uint16_t specificity;  // Classes << 8 | tag names
+    uint16_t style;        // Into styles_
+  };
+
+  // Compounds per selector, and rules cascaded per element
+  static constexpr size_t kMaxCompounds = 8;
+  static constexpr size_t kMaxMatches = 16;
+
+  // parseFile() reads the stylesheet in chunks and collects one rule at a
+  // time; rules longer than kMaxRuleLength are skipped
+  static constexpr size_t kReadChunkSize = 512;
+  static constexpr size_t kMaxRuleLength = 4096;
+
+  // Parse a rule (selector list and declaration block, without the braces);
+  // its properties are parsed first, so rules without supported ones are
+  // dropped before anything is allocated
+  void parseRule(const char* selector, size_t selectorLength, const char* block, size_t blockLength);
+
+  // Compile one selector for `style`, which is stored at styles_[styleIndex]
+  // with the first selector that uses it; returns false if it uses
+  // unsupported syntax. Names are only interned once the whole selector is
+  // known to be supported.
+  bool addSelector(const char* selector, size_t length, uint16_t styleIndex, const CssStyle& style);
+
+  // Rebuild the per-class and per-tag rule buckets after parsing
+  void buildIndex();
+
+  bool matches(const Rule& rule, const Element* path, size_t depth) const;
+  static bool matchesCompound(const Compound& compound, const Element& element);
+
+  // Interned names: id of a name, or kNoId
+  uint16_t findName(const char* name, size_t length) const;
+  uint16_t internName(const char* name, size_t length);
+
+  // Parse "name: value; ..." declarations into `style`
+  static void parseDeclarations(const char* text, size_t length, CssStyle& style);
+
+  // Parse one property; name and value are trimmed and lower case
+  static void parseProperty(const char* name, char* value, CssStyle& style);
 
   // Parse text-align value
-  TextAlign parseTextAlign(const String& value);
+  static TextAlign parseTextAlign(const char* value);
 
   // Parse font-style value
-  CssFontStyle parseFontStyle(const String& value);
+  static CssFontStyle parseFontStyle(const char* value);
 
   // Parse font-weight value
-  CssFontWeight parseFontWeight(const String& value);
+  static CssFontWeight parseFontWeight(const char* value);
+
+  std::vector<String> names_;
+  std::vector<uint16_t> nameSlots_;  // Open addressing, 0 = empty, else 1 + id
+
+  std::vector<CssStyle> styles_;
+  std::vector<Rule> rules_;  // In source order
+  std::vector<Compound> ancestors_;
 
-  // Extract class name from a selector (e.g., ".foo" or "p.foo" -> "foo")
-  String extractClassName(const String& selector);
+  // Rules by the class of their subject: classRules_[classStart_[id] .. classStart_[id + 1]);
+  // rules whose subject has no class are filed by tag name the same way
+  std::vector<uint16_t> classStart_;
+  std::vector<uint16_t> classRules_;
+  std::vector<uint16_t> nameStart_;
+  std::vector<uint16_t> nameRules_;
 
-  // Map of class names to their styles
-  std::map<String, CssStyle> styleMap_;
+  // Merged style per class id, for getStyleForClass()
+  std::vector<CssStyle> classStyles_;
 };
 
 #endif
@@ -33,17 +33,13 @@ enum class CssFontWeight {
 /**
  * CssStyle - Represents supported CSS properties for a selector
  *
- * This structure holds the subset of CSS properties that the reader supports.
- * Currently supported:
+ * This structure holds the subset of CSS properties that the reader supports:
  * - text-align: left, right, center, justify
- *
- * Properties can be extended in the future to support:
  * - font-style: normal, italic
  * - font-weight: normal, bold
- *
- * Future extensions:
- * - text-indent
- * - margin-top/bottom (for paragraph spacing)
+ * - text-indent, margin-top, margin-bottom (in pixels at 16px per em, with
+ *   a flag for em lengths, which scale with the element's font size)
+ * - font-size (in percent of the body size)
  */
 struct CssStyle {
   TextAlign textAlign = TextAlign::Left;
@@ -58,6 +54,25 @@ struct CssStyle {
   // Text-indent support (in pixels)
   int16_t textIndent = 0;
   bool hasTextIndent = false;
+  bool textIndentEm = false;  // Given in em: relative to the element's font size
+
+  // Vertical block margins (in pixels)
+  int16_t marginTop = 0;
+  bool hasMarginTop = false;
+  bool marginTopEm = false;
+  int16_t marginBottom = 0;
+  bool hasMarginBottom = false;
+  bool marginBottomEm = false;
+
+  // Font size relative to the body text (100 = body size)
+  uint16_t fontSize = 100;
+  bool hasFontSize = false;
+
+  // True if no property is set
+  bool isEmpty() const {
+    return !hasTextAlign && !hasFontStyle && !hasFontWeight && !hasTextIndent && !hasMarginTop &&
+           !hasMarginBottom && !hasFontSize;
+  }
 
   // Merge another style into this one (other style takes precedence)
   void merge(const CssStyle& other) {
@@ -76,6 +91,21 @@ struct CssStyle {
     if (other.hasTextIndent) {
       textIndent = other.textIndent;
       hasTextIndent = true;
+      textIndentEm = other.textIndentEm;
+    }
+    if (other.hasMarginTop) {
+      marginTop = other.marginTop;
+      hasMarginTop = true;
+      marginTopEm = other.marginTopEm;
+    }
+    if (other.hasMarginBottom) {
+      marginBottom = other.marginBottom;
+      hasMarginBottom = true;
+      marginBottomEm = other.marginBottomEm;
+    }
+    if (other.hasFontSize) {
+      fontSize = other.fontSize;
+      hasFontSize = true;
     }
   }
 
@@ -87,6 +117,17 @@ struct CssStyle {
     hasFontStyle = false;
     fontWeight = CssFontWeight::Normal;
     hasFontWeight = false;
+    textIndent = 0;
+    hasTextIndent = false;
+    textIndentEm = false;
+    marginTop = 0;
+    hasMarginTop = false;
+    marginTopEm = false;
+    marginBottom = 0;
+    hasMarginBottom = false;
+    marginBottomEm = false;
+    fontSize = 100;
+    hasFontSize = false;
   }
 };
 
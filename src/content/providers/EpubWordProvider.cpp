@@ -7,6 +7,8 @@
 #include <cstdint>
 #include <vector>
 
+#include "../../text/hyphenation/LiangHyphenation.h"
+
 // #define EPUB_DEBUG_CLEAN_CACHE
 
 // Helper function to map language string to Language enum
@@ -19,8 +21,8 @@ static Language stringToLanguage(const String& langStr) {
   } else if ((lang.length() >= 2 && lang.substring(0, 2) == "de")) {
     return Language::GERMAN;
   } else {
-    // Default to english if unknown
-    return Language::ENGLISH;
+    // Unknown: patterns from the SD card if there are any (see getLanguage)
+    return Language::PATTERN_FILE;
   }
 }
 
@@ -54,7 +56,7 @@ EpubWordProvider::EpubWordProvider(const char* path, size_t bufSize)
 
     // Convert the XHTML file into a text file for the FileWordProvider
     String txtPath;
-    if (!convertXhtmlToTxt(xhtmlPath_, txtPath)) {
+    if (!convertXhtmlToTxt(xhtmlPath_, txtPath, &lastConversionTimings_)) {
       return;
     }
 
@@ -223,10 +225,15 @@ bool EpubWordProvider::convertXhtmlToTxt(const String& srcPath, String& outTxtPa
   // Perform the conversion using common logic
   t0 = millis();
   size_t bytesWritten = 0;
+  const uint32_t memoHitsBefore = styleMemoHits_;
+  const uint32_t memoMissesBefore = styleMemoMisses_;
   performXhtmlToTxtConversion(parser, out, &bytesWritten);
   unsigned long conversionMs = millis() - t0;
-  if (timings)
+  if (timings) {
     timings->conversion = conversionMs;
+    timings->styleMemoHits = styleMemoHits_ - memoHitsBefore;
+    timings->styleMemoMisses = styleMemoMisses_ - memoMissesBefore;
+  }
 
   // Cleanup and close (timed)
   t0 = millis();
@@ -253,83 +260,149 @@ bool EpubWordProvider::convertXhtmlToTxt(const String& srcPath, String& outTxtPa
   return true;
 }
 
-void EpubWordProvider::writeParagraphStyleToken(String& writeBuffer, const String& pendingParagraphClasses,
-                                                const String& pendingInlineStyle, bool& paragraphClassesWritten,
-                                                std::vector<char>& paragraphStyleEmitted) {
+// FNV-1a over a string and a separator, chained from `hash`
+static uint64_t hashStyleKey(uint64_t hash, const String& text) {
+  const char* bytes = text.c_str();
+  for (size_t i = 0; i < (size_t)text.length(); ++i) {
+    hash = (hash ^ (uint8_t)bytes[i]) * 1099511628211ull;
+  }
+  return (hash ^ 0xFF) * 1099511628211ull;
+}
+
+static constexpr uint64_t kStyleKeySeed = 14695981039346656037ull;
+
+// Pixels (at 16px per em) in a font of fontSize percent to quarter ems of the body font
+static uint8_t quarterEms(int32_t px, uint16_t fontSize) {
+  const int32_t quarters = (px * fontSize + 200) / 400;
+  if (quarters <= 0)
+    return 0;
+  return quarters > FileWordProvider::kMaxFormatValue ? FileWordProvider::kMaxFormatValue : (uint8_t)quarters;
+}
+
+EpubWordProvider::ResolvedStyle EpubWordProvider::makeResolvedStyle(const CssStyle& style, uint8_t headerLevel) {
+  ResolvedStyle resolved;
+  resolved.style = style;
+
+  // The HTML user agent sizes and margins of h1-h6, unless the book sets its own
+  if (headerLevel >= 1 && headerLevel <= 6) {
+    static const uint16_t kHeaderSizes[] = {200, 150, 117, 100, 83, 67};
+    static const int16_t kHeaderMargins[] = {11, 13, 16, 21, 27, 37};  // 0.67em .. 2.33em
+    CssStyle defaults;
+    defaults.fontSize = kHeaderSizes[headerLevel - 1];
+    defaults.hasFontSize = true;
+    defaults.marginTop = kHeaderMargins[headerLevel - 1];
+    defaults.hasMarginTop = true;
+    defaults.marginTopEm = true;
+    defaults.marginBottom = kHeaderMargins[headerLevel - 1];
+    defaults.hasMarginBottom = true;
+    defaults.marginBottomEm = true;
+    defaults.merge(style);
+    resolved.style = defaults;
+  }
+  const CssStyle& combined = resolved.style;
+
+  if (combined.hasTextAlign) {
+    switch (combined.textAlign) {
+      case TextAlign::Right:
+        resolved.alignToken = 'R';
+        break;
+      case TextAlign::Center:
+        resolved.alignToken = 'C';
+        break;
+      case TextAlign::Justify:
+        resolved.alignToken = 'J';
+        break;
+      default:
+        resolved.alignToken = 'L';
+        break;
+    }
+  }
+
+  // The format holds lengths in quarter ems of the body font and the size in
+  // tenths; em lengths are in the element's own font size, others in the body's
+  const uint16_t fontSize = combined.hasFontSize ? combined.fontSize : 100;
+  if (combined.hasFontSize) {
+    const uint16_t tenths = (uint16_t)((fontSize + 5) / 10);
+    const uint16_t maxTenths = FileWordProvider::kMaxFormatValue;
+    resolved.format.fontSize = (uint8_t)(tenths < 1 ? 1 : (tenths > maxTenths ? maxTenths : tenths));
+  }
+  if (combined.hasTextIndent) {
+    resolved.format.indent = quarterEms(combined.textIndent, combined.textIndentEm ? fontSize : 100);
+  }
+  if (combined.hasMarginTop) {
+    resolved.format.marginTop = quarterEms(combined.marginTop, combined.marginTopEm ? fontSize : 100);
+  }
+  if (combined.hasMarginBottom) {
+    resolved.format.marginBottom = quarterEms(combined.marginBottom, combined.marginBottomEm ? fontSize : 100);
+  }
+  return resolved;
+}
+
+EpubWordProvider::ResolvedStyle EpubWordProvider::resolveElementStyle(const CssParser& css,
+                                                                      const std::vector<CssParser::Element>& cssPath,
+                                                                      uint64_t key, const String& styleAttr,
+                                                                      uint8_t headerLevel) {
+  if (key == 0) {
+    key = 1;  // 0 marks empty slots
+  }
+  if (styleMemo_.empty()) {
+    styleMemo_.resize(kStyleMemoWays << kStyleMemoSetBits);
+  }
+  // The top bits of an FNV hash are the best mixed
+  StyleMemoEntry* set = &styleMemo_[(key >> (64 - kStyleMemoSetBits)) * kStyleMemoWays];
+  size_t way = 0;
+  while (way < kStyleMemoWays - 1 && set[way].key != key) {
+    way++;
+  }
+  // Move the hit (or the least recently used entry, to be replaced) to the front
+  const StyleMemoEntry found = set[way];
+  for (; way > 0; way--) {
+    set[way] = set[way - 1];
+  }
+  set[0] = found;
+  if (found.key == key) {
+    styleMemoHits_++;
+    return found.resolved;
+  }
+  styleMemoMisses_++;
+
+  // Stylesheet rules first; inline styles take precedence over them
+  CssStyle style = css.resolve(cssPath.data(), cssPath.size());
+  if (!styleAttr.isEmpty()) {
+    style.merge(CssParser::parseInlineStyle(styleAttr));
+  }
+
+  set[0].key = key;
+  set[0].resolved = makeResolvedStyle(style, headerLevel);
+  return set[0].resolved;
+}
+
+void EpubWordProvider::writeParagraphStyleToken(String& writeBuffer, const ResolvedStyle& pendingParagraphStyle,
+                                                bool paragraphStyled, bool& paragraphClassesWritten,
+                                                std::vector<char>& paragraphStyleEmitted, int& marginBottomAt) {
   // If this is the beginning of a paragraph and styles haven't been written yet,
   // write the style token in front of the text line.
-  // We check for either class-based styles or inline styles.
-  if ((!pendingParagraphClasses.isEmpty() || !pendingInlineStyle.isEmpty()) && !paragraphClassesWritten) {
+  if (paragraphStyled && !paragraphClassesWritten) {
     // Emit style properties for the paragraph using ESC + command byte format
+    // Format: ESC+'P' + indent, margins and font size (one token per line)
     // Alignment: ESC+'L'(left), ESC+'R'(right), ESC+'C'(center), ESC+'J'(justify)
     // Style: ESC+'B'(bold), ESC+'I'(italic), ESC+'X'(bold+italic)
-    const CssParser* css = epubReader_ ? epubReader_->getCssParser() : nullptr;
-
-    // Start with class-based styles
-    CssStyle combined;
-    if (css && !pendingParagraphClasses.isEmpty()) {
-      combined = css->getCombinedStyle(pendingParagraphClasses);
-    }
+    const CssStyle& combined = pendingParagraphStyle.style;
 
-    // Merge inline styles (inline styles take precedence over class styles)
-    if (css && !pendingInlineStyle.isEmpty()) {
-      CssStyle inlineStyle = css->parseInlineStyle(pendingInlineStyle);
-      combined.merge(inlineStyle);
+    marginBottomAt = -1;
+    if (pendingParagraphStyle.format != ParagraphFormat()) {
+      marginBottomAt = writeBuffer.length() + (int)FileWordProvider::kFormatMarginBottomOffset;
+      FileWordProvider::appendFormatToken(writeBuffer, pendingParagraphStyle.format);
     }
 
     // Only emit alignment tokens for paragraphs - NOT bold/italic
     // Bold/italic come from inline elements like <b>, <i>, <span>
-    String styleToken = "";
-    if (combined.hasTextAlign) {
-      char tok = 'L';
-      switch (combined.textAlign) {
-        case TextAlign::Left:
-          tok = 'L';
-          break;
-        case TextAlign::Right:
-          tok = 'R';
-          break;
-        case TextAlign::Center:
-          tok = 'C';
-          break;
-        case TextAlign::Justify:
-          tok = 'J';
-          break;
-        default:
-          tok = 'L';
-          break;
-      }
-      styleToken += (char)0x1B;  // ESC
-      styleToken += tok;
-      paragraphStyleEmitted.push_back(tok);
-    }
-
-    if (styleToken.length() > 0) {
-      writeBuffer += styleToken;
-    }
-    paragraphClassesWritten = true;
-
-    // If the combined paragraph style specifies a positive text-indent value,
-    // convert it to a number of spaces using a simple heuristic: spaces = (px + 2) / 4,
-    // clamped to [0, 12]. This maps typical indents to visible space counts while
-    // avoiding huge or tiny counts.
-    if (combined.hasTextIndent && combined.textIndent > 0.0f) {
-      // Avoid libm (roundf) on ESP32-C3: it has previously triggered illegal
-      // instruction faults in this project. We only need integer rounding.
-      const float scaled = combined.textIndent / 4.0f;
-      int spaces = (int)(scaled + 0.5f);
-      if (spaces < 0)
-        spaces = 0;
-      if (spaces > 12)
-        spaces = 12;
-
-      writeBuffer += (char)0x1B;  // ESC
-      writeBuffer += 'H';
-      for (int i = 0; i < spaces; ++i)
-        writeBuffer += '-';
+    if (pendingParagraphStyle.alignToken != '\0') {
       writeBuffer += (char)0x1B;  // ESC
-      writeBuffer += 'h';
+      writeBuffer += pendingParagraphStyle.alignToken;
+      paragraphStyleEmitted.push_back(pendingParagraphStyle.alignToken);
     }
+    paragraphClassesWritten = true;
 
     // Paragraph-level CSS may also include font-weight/font-style which we
     // treat as the base inline styling for this paragraph. Record the base
@@ -344,16 +417,23 @@ void EpubWordProvider::writeParagraphStyleToken(String& writeBuffer, const Strin
 
 void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File& out, size_t* outBytes) {
   const size_t FLUSH_THRESHOLD = 2048;
+  const size_t MAX_OPEN_LINE = 8192;
   if (outBytes)
     *outBytes = 0;
 
   String buffer;                     // Output buffer
   std::vector<String> elementStack;  // Track nested elements
+  // Nested elements compiled for stylesheet matching, and their style memo keys (parallel to elementStack
+  // when there is a stylesheet)
+  const CssParser* css = epubReader_ ? epubReader_->getCssParser() : nullptr;
+  std::vector<CssParser::Element> cssPath;
+  std::vector<uint64_t> cssKeys;
   // Track inline style element stack (store per-element flags in object state)
   std::vector<char> paragraphStyleEmitted;  // Track paragraph style tokens emitted (uppercase)
-  String pendingParagraphClasses;           // CSS classes for current block
-  String pendingInlineStyle;                // Inline style attribute for current block
+  ResolvedStyle pendingParagraphStyle;      // Resolved style for current block
+  bool pendingParagraphStyled = false;      // Does current block have classes, inline style or matched rules?
   bool paragraphClassesWritten = false;     // Have we written style token?
+  int marginBottomAt = -1;                  // Buffer offset of the margin-bottom byte of the line's format token
   bool lineHasContent = false;              // Does current line have visible content?
   bool lineHasNbsp = false;                 // Does current line have &nbsp;?
 
@@ -369,28 +449,52 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
         elementStack.push_back(name);
       }
 
+      // Resolve the stylesheet and inline style of blocks and inline style elements
+      const bool blockElement = isBlockElement(name);
+      const bool inlineStyleElement = isInlineStyleElement(name);
+      const bool styledElement = blockElement || inlineStyleElement;
+      String classAttr = parser.getAttribute("class");
+      String styleAttr = styledElement ? parser.getAttribute("style") : String("");
+      const uint8_t headerLevel = blockElement && isHeaderElement(name) ? (uint8_t)(name[1] - '0') : 0;
+      ResolvedStyle resolved;
+      if (css) {
+        cssPath.push_back(css->compileElement(name, classAttr));
+        const uint64_t parentKey = cssKeys.empty() ? kStyleKeySeed : cssKeys.back();
+        cssKeys.push_back(hashStyleKey(hashStyleKey(parentKey, name), classAttr));
+        if (styledElement) {
+          resolved = resolveElementStyle(*css, cssPath, hashStyleKey(cssKeys.back(), styleAttr), styleAttr,
+                                         headerLevel);
+        }
+        if (parser.isEmptyElement()) {
+          cssPath.pop_back();
+          cssKeys.pop_back();
+        }
+      } else if (styledElement && (headerLevel > 0 || !styleAttr.isEmpty())) {
+        // No stylesheet: header defaults and inline styles still apply
+        resolved = makeResolvedStyle(CssParser::parseInlineStyle(styleAttr), headerLevel);
+      }
+
       // Block elements: add newline before if current line has content
       // This ensures blockquotes, nested divs, etc. start on a new line
-      if (isBlockElement(name) && lineHasContent) {
+      if (blockElement && lineHasContent) {
         buffer += "\n";
         lineHasContent = false;
         lineHasNbsp = false;
       }
 
       // Capture CSS classes and inline styles for block elements
-      if (isBlockElement(name)) {
-        pendingParagraphClasses = parser.getAttribute("class");
-        pendingInlineStyle = parser.getAttribute("style");
+      if (blockElement) {
+        pendingParagraphStyle = resolved;
+        pendingParagraphStyled = !classAttr.isEmpty() || !styleAttr.isEmpty() || !resolved.style.isEmpty();
         paragraphClassesWritten = false;
+        marginBottomAt = -1;
       }
 
       // Handle inline style elements (b, strong, i, em, span)
-      if (isInlineStyleElement(name) && !parser.isEmptyElement()) {
-        String classAttr = parser.getAttribute("class");
-        String styleAttr = parser.getAttribute("style");
+      if (inlineStyleElement && !parser.isEmptyElement()) {
         // writeInlineStyleToken will push state into inlineStyleStack_ and
         // emit a combined token if necessary (supports bold+italic stacking)
-        (void)writeInlineStyleToken(buffer, name, classAttr, styleAttr);
+        (void)writeInlineStyleToken(buffer, name, resolved.style);
       }
 
       // Handle <br/> - only add newline if line has content
@@ -414,6 +518,14 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
             writeStyleResetToken(buffer, writtenInlineCombined_);
             writtenInlineCombined_ = '\0';
           }
+          // The block goes on: its bottom margin belongs to its last line, and
+          // its indent and top margin only to the first
+          if (marginBottomAt >= 0) {
+            buffer.setCharAt(marginBottomAt, '0');
+            marginBottomAt = -1;
+          }
+          pendingParagraphStyle.format.indent = 0;
+          pendingParagraphStyle.format.marginTop = 0;
           buffer += "\n";
           lineHasContent = false;
           lineHasNbsp = false;
@@ -461,9 +573,10 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
 
         lineHasContent = false;
         lineHasNbsp = false;
-        pendingParagraphClasses = "";
-        pendingInlineStyle = "";
+        pendingParagraphStyle = ResolvedStyle();
+        pendingParagraphStyled = false;
         paragraphClassesWritten = false;
+        marginBottomAt = -1;
         paragraphStyleEmitted.clear();
       }
 
@@ -471,6 +584,10 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
       if (!elementStack.empty()) {
         elementStack.pop_back();
       }
+      if (!cssPath.empty()) {
+        cssPath.pop_back();
+        cssKeys.pop_back();
+      }
     }
 
     // ========== TEXT NODE ==========
@@ -505,8 +622,8 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
       }
 
       // Write style token at start of paragraph and remember the emitted raw tokens
-      writeParagraphStyleToken(buffer, pendingParagraphClasses, pendingInlineStyle, paragraphClassesWritten,
-                               paragraphStyleEmitted);
+      writeParagraphStyleToken(buffer, pendingParagraphStyle, pendingParagraphStyled, paragraphClassesWritten,
+                               paragraphStyleEmitted, marginBottomAt);
 
       // Ensure inline style tokens (open/close) are emitted right before we write visible text
       ensureInlineStyleEmitted(buffer);
@@ -518,7 +635,12 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
 
     // Periodic flush to avoid excessive memory use and ensure data hits SD
     if (buffer.length() > FLUSH_THRESHOLD) {
+      // Hold back the open line while a <br/> may still clear its margin-bottom byte, unless the line alone
+      // grows past MAX_OPEN_LINE (its bottom margin then stays)
       size_t toWrite = buffer.length();
+      if (marginBottomAt >= 0 && toWrite - marginBottomAt < MAX_OPEN_LINE) {
+        toWrite = marginBottomAt - FileWordProvider::kFormatMarginBottomOffset;
+      }
       size_t written = out.write((const uint8_t*)buffer.c_str(), toWrite);
       if (outBytes)
         *outBytes += written;
@@ -526,7 +648,13 @@ void EpubWordProvider::performXhtmlToTxtConversion(SimpleXmlParser& parser, File
         Serial.printf("WARNING: partial write during conversion: attempted=%u wrote=%u\n", (unsigned)toWrite,
                       (unsigned)written);
       }
-      buffer = "";
+      if (toWrite < buffer.length()) {
+        buffer = buffer.substring(toWrite);
+        marginBottomAt -= (int)toWrite;
+      } else {
+        buffer = "";
+        marginBottomAt = -1;  // Written out: no longer patched at a <br/>
+      }
     }
   }
 
@@ -798,8 +926,7 @@ String EpubWordProvider::trimLeadingSpaces(const String& text) {
   }
   return text.substring(start);
 }
-char EpubWordProvider::writeInlineStyleToken(String& writeBuffer, const String& elementName, const String& classAttr,
-                                             const String& styleAttr) {
+char EpubWordProvider::writeInlineStyleToken(String& writeBuffer, const String& elementName, const CssStyle& cssStyle) {
   // Determine style flags for this element (from tag name, classes, inline styles)
   InlineStyleState state;
   // Tag name - these are explicit declarations
@@ -811,25 +938,14 @@ char EpubWordProvider::writeInlineStyleToken(String& writeBuffer, const String&
     state.hasItalic = true;
   }
 
-  // Check CSS classes and inline styles for additional styling
-  const CssParser* css = epubReader_ ? epubReader_->getCssParser() : nullptr;
-  if (css) {
-    CssStyle combined;
-    if (!classAttr.isEmpty()) {
-      combined = css->getCombinedStyle(classAttr);
-    }
-    if (!styleAttr.isEmpty()) {
-      CssStyle inlineStyle = css->parseInlineStyle(styleAttr);
-      combined.merge(inlineStyle);
-    }
-    if (combined.hasFontWeight) {
-      state.hasBold = true;
-      state.bold = (combined.fontWeight == CssFontWeight::Bold);
-    }
-    if (combined.hasFontStyle) {
-      state.hasItalic = true;
-      state.italic = (combined.fontStyle == CssFontStyle::Italic);
-    }
+  // Stylesheet and inline styles can override or add styling
+  if (cssStyle.hasFontWeight) {
+    state.hasBold = true;
+    state.bold = (cssStyle.fontWeight == CssFontWeight::Bold);
+  }
+  if (cssStyle.hasFontStyle) {
+    state.hasItalic = true;
+    state.italic = (cssStyle.fontStyle == CssFontStyle::Italic);
   }
 
   // Push this element's style onto the stack
@@ -1046,10 +1162,15 @@ bool EpubWordProvider::convertXhtmlStreamToTxt(const char* epubFilename, String&
   // Perform the conversion using common logic (timed)
   t0 = millis();
   size_t bytesWritten = 0;
+  const uint32_t memoHitsBefore = styleMemoHits_;
+  const uint32_t memoMissesBefore = styleMemoMisses_;
   performXhtmlToTxtConversion(parser, out, &bytesWritten);
   unsigned long conversionMs = millis() - t0;
-  if (timings)
+  if (timings) {
     timings->conversion = conversionMs;
+    timings->styleMemoHits = styleMemoHits_ - memoHitsBefore;
+    timings->styleMemoMisses = styleMemoMisses_ - memoMissesBefore;
+  }
 
   // Close parser and streaming in separate timed steps
   t0 = millis();
@@ -1141,9 +1262,11 @@ bool EpubWordProvider::openChapter(int chapterIndex) {
     // Print detailed breakdown for chapter-level conversion
     Serial.printf(
         "    Converted XHTML to TXT (streamed): %s  —  total = %lu ms  ( startStream = %lu, parserOpen = %lu, outOpen "
-        "= %lu, conversion = %lu, parserClose = %lu, endStream = %lu, closeOut = %lu )  —  %u bytes\n",
+        "= %lu, conversion = %lu, parserClose = %lu, endStream = %lu, closeOut = %lu )  —  %u bytes  —  style memo "
+        "%u hits, %u misses\n",
         txtPath.c_str(), t.total, t.startStream, t.parserOpen, t.outOpen, t.conversion, t.parserClose, t.endStream,
-        t.closeOut, (unsigned int)t.bytes);
+        t.closeOut, (unsigned int)t.bytes, (unsigned)t.styleMemoHits, (unsigned)t.styleMemoMisses);
+    lastConversionTimings_ = t;
   } else {
     // Extract XHTML file first, then convert from file
     String xhtmlPath = epubReader_->getFile(fullHref.c_str());
@@ -1157,9 +1280,10 @@ bool EpubWordProvider::openChapter(int chapterIndex) {
     // Print detailed breakdown for chapter-level conversion when using file-based conversion
     Serial.printf(
         "    Converted XHTML to TXT: %s  —  total = %lu ms  ( parserOpen = %lu, outOpen = %lu, conversion = %lu, "
-        "parserClose = %lu, closeOut = %lu )  —  %u bytes\n",
+        "parserClose = %lu, closeOut = %lu )  —  %u bytes  —  style memo %u hits, %u misses\n",
         txtPath.c_str(), t.total, t.parserOpen, t.outOpen, t.conversion, t.parserClose, t.closeOut,
-        (unsigned int)t.bytes);
+        (unsigned int)t.bytes, (unsigned)t.styleMemoHits, (unsigned)t.styleMemoMisses);
+    lastConversionTimings_ = t;
   }
   unsigned long conversionAndExtractMs = millis() - convStart;
   Serial.printf("  Chapter conversion + extract took  %lu ms\n", conversionAndExtractMs);
@@ -1342,7 +1466,41 @@ Language EpubWordProvider::getLanguage() const {
     return Language::BASIC;  // Default for non-EPUB files
   }
   String langStr = epubReader_->getLanguage();
-  return stringToLanguage(langStr);
+  Language language = stringToLanguage(langStr);
+  if (language == Language::PATTERN_FILE && getHyphenationPatternPath().length() == 0) {
+    // Default to english if unknown
+    return Language::ENGLISH;
+  }
+  return language;
+}
+
+String EpubWordProvider::getHyphenationPatternPath() const {
+  if (!isEpub_ || !epubReader_) {
+    return String("");
+  }
+  String tag = epubReader_->getLanguage();
+  tag.trim();
+  tag.toLowerCase();
+  if (tag.length() < 2) {
+    return String("");
+  }
+
+  const String directory = String(LiangHyphenation::kPatternDirectory) + "/";
+  String path = directory + tag + ".hyp";
+  if (SD.exists(path.c_str())) {
+    return path;
+  }
+  int dash = tag.indexOf('-');
+  if (dash < 0) {
+    dash = tag.indexOf('_');
+  }
+  if (dash > 0) {
+    path = directory + tag.substring(0, dash) + ".hyp";
+    if (SD.exists(path.c_str())) {
+      return path;
+    }
+  }
+  return String("");
 }
 
 String EpubWordProvider::getCoverImagePath() const {
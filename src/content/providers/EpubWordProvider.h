@@ -52,9 +52,14 @@ class EpubWordProvider : public WordProvider {
   }
   String getChapterName(int chapterIndex) override;
 
-  // Get the language of the EPUB for hyphenation
+  // Get the language of the EPUB for hyphenation. Languages without compiled-in
+  // patterns use Language::PATTERN_FILE when a pattern file for them is on the SD card.
   Language getLanguage() const;
 
+  // The .hyp file for the book's language ("/microreader/hyphenation/pt-br.hyp",
+  // then ".../pt.hyp"), or an empty string when there is none
+  String getHyphenationPatternPath() const;
+
   String getCoverImagePath() const;
 
   // Style support
@@ -68,6 +73,12 @@ class EpubWordProvider : public WordProvider {
     return TextAlign::Left;
   }
 
+  ParagraphFormat getParagraphFormat() override {
+    if (fileProvider_)
+      return fileProvider_->getParagraphFormat();
+    return ParagraphFormat();
+  }
+
   // Streaming conversion mode (true = extract to memory, false = extract to file first)
   void setUseStreamingConversion(bool enabled) {
     useStreamingConversion_ = enabled;
@@ -76,7 +87,7 @@ class EpubWordProvider : public WordProvider {
     return useStreamingConversion_;
   }
 
- private:
+  // Time spent in each conversion step (ms), output size and style memo use
   struct ConversionTimings {
     unsigned long startStream = 0;
     unsigned long parserOpen = 0;
@@ -87,7 +98,16 @@ class EpubWordProvider : public WordProvider {
     unsigned long closeOut = 0;
     unsigned long total = 0;
     size_t bytes = 0;
+    uint32_t styleMemoHits = 0;  // Element styles found in the per-book memo
+    uint32_t styleMemoMisses = 0;
   };
+
+  // Timings and style memo counts of the last chapter (or XHTML file) conversion
+  const ConversionTimings& getLastConversionTimings() const {
+    return lastConversionTimings_;
+  }
+
+ private:
   // Opens a specific chapter (spine item) for reading
   bool openChapter(int chapterIndex);
 
@@ -113,15 +133,33 @@ class EpubWordProvider : public WordProvider {
   // If outBytes is provided, it will be set to the number of bytes written to `out`.
   void performXhtmlToTxtConversion(SimpleXmlParser& parser, File& out, size_t* outBytes = nullptr);
 
-  // Emit style properties for a paragraph's classes and inline styles as an escaped token written to buffer
-  void writeParagraphStyleToken(String& writeBuffer, const String& pendingParagraphClasses,
-                                const String& pendingInlineStyle, bool& paragraphClassesWritten,
-                                std::vector<char>& paragraphStyleEmitted);
+  // An element's stylesheet and inline style merged, with the paragraph tokens it produces
+  struct ResolvedStyle {
+    CssStyle style;
+    char alignToken = '\0';  // ESC command for the alignment ('L','R','C','J') or '\0'
+    ParagraphFormat format;  // Written as one ESC+'P' token unless it is the default
+  };
+
+  // Complete a cascaded style with the defaults of header level 1-6 (0 for other elements) and derive
+  // its paragraph tokens
+  static ResolvedStyle makeResolvedStyle(const CssStyle& style, uint8_t headerLevel);
+
+  // Resolve the innermost element of `cssPath` with its style attribute through the per-book style memo.
+  // `key` identifies the element's tag, class and style attributes and those of its ancestors.
+  ResolvedStyle resolveElementStyle(const CssParser& css, const std::vector<CssParser::Element>& cssPath,
+                                    uint64_t key, const String& styleAttr, uint8_t headerLevel);
+
+  // Emit the style tokens of a paragraph as escaped tokens written to buffer. `paragraphStyled` is true if
+  // the block has a class or style attribute or matched any stylesheet rule. `marginBottomAt` is set to the
+  // buffer offset of the margin-bottom byte of the format token written, or -1 if there is none.
+  void writeParagraphStyleToken(String& writeBuffer, const ResolvedStyle& pendingParagraphStyle,
+                                bool paragraphStyled, bool& paragraphClassesWritten,
+                                std::vector<char>& paragraphStyleEmitted, int& marginBottomAt);
 
   // Emit inline style token (for bold/italic elements like <b>, <i>, <em>, <strong>, <span>)
+  // `cssStyle` is the element's resolved stylesheet and inline style.
   // Returns the uppercase command char emitted (e.g. 'B','I','X') or '\0' if none
-  char writeInlineStyleToken(String& writeBuffer, const String& elementName, const String& classAttr,
-                             const String& styleAttr);
+  char writeInlineStyleToken(String& writeBuffer, const String& elementName, const CssStyle& cssStyle);
 
   // Close an inline style element (called when an inline element ends)
   void closeInlineStyleElement(String& writeBuffer);
@@ -181,6 +219,19 @@ class EpubWordProvider : public WordProvider {
   SimpleXmlParser* parser_ = nullptr;
   int currentChapter_ = 0;  // Current chapter index (0-based)
 
+  // Per-book memo of resolved element styles: class attributes like "calibre3 calibre5" repeat thousands of
+  // times in a book. 32 sets of 4 entries, most recently used first; allocated on first use.
+  struct StyleMemoEntry {
+    uint64_t key = 0;  // 0 = empty
+    ResolvedStyle resolved;
+  };
+  static constexpr unsigned kStyleMemoSetBits = 5;
+  static constexpr size_t kStyleMemoWays = 4;
+  std::vector<StyleMemoEntry> styleMemo_;
+  uint32_t styleMemoHits_ = 0;
+  uint32_t styleMemoMisses_ = 0;
+  ConversionTimings lastConversionTimings_;
+
   // Underlying provider that reads the converted plain-text chapter files
   FileWordProvider* fileProvider_ = nullptr;
 
@@ -9,6 +9,8 @@
 // Alignment commands (start of line): ESC + 'L'(left), 'R'(right), 'C'(center), 'J'(justify)
 // Style commands (inline): ESC + 'B'(bold on), 'b'(bold off), 'I'(italic on), 'i'(italic off),
 //                          'X'(bold+italic on), 'x'(bold+italic off), 'H'(hidden on), 'h'(hidden off)
+// Format command (start of line): ESC + 'P' + indent, margin-top, margin-bottom, font size
+//                                 (one byte each, '0' + value; 6 bytes total)
 static constexpr char ESC_CHAR = '\x1B';
 
 // Helper functions for mapping ESC command chars to alignments / styles
@@ -137,6 +139,15 @@ static bool isEscCommandChar(char cmd) {
   return tryGetAlignmentStart(cmd, nullptr) || tryGetAlignmentEnd(cmd, nullptr) || tryGetStyleForward(cmd, nullptr);
 }
 
+void FileWordProvider::appendFormatToken(String& out, const ParagraphFormat& format) {
+  const uint8_t values[4] = {format.indent, format.marginTop, format.marginBottom, format.fontSize};
+  out += ESC_CHAR;
+  out += kFormatCommand;
+  for (uint8_t value : values) {
+    out += (char)('0' + (value > kMaxFormatValue ? kMaxFormatValue : value));
+  }
+}
+
 FileWordProvider::FileWordProvider(const char* path, size_t bufSize) : bufSize_(bufSize) {
   file_ = SD.open(path);
   if (!file_) {
@@ -204,8 +215,27 @@ bool FileWordProvider::ensureBufferForPos(size_t pos) {
   return true;
 }
 
-// Check if position has an ESC token (ESC + command byte = 2 bytes)
-// Returns 2 if valid ESC token, 0 otherwise
+size_t FileWordProvider::parseFormatToken(size_t pos, ParagraphFormat* outFormat) {
+  if (pos + kFormatTokenLength > fileSize_ || charAt(pos) != ESC_CHAR || charAt(pos + 1) != kFormatCommand)
+    return 0;
+  uint8_t values[4];
+  for (size_t i = 0; i < 4; i++) {
+    const uint8_t value = (uint8_t)(charAt(pos + 2 + i) - '0');
+    if (value > kMaxFormatValue)
+      return 0;
+    values[i] = value;
+  }
+  if (outFormat) {
+    outFormat->indent = values[0];
+    outFormat->marginTop = values[1];
+    outFormat->marginBottom = values[2];
+    outFormat->fontSize = values[3];
+  }
+  return kFormatTokenLength;
+}
+
+// Check if position has an ESC token (ESC + command byte = 2 bytes, or a format token)
+// Returns the token length if valid, 0 otherwise
 // If processStyle is false, only checks validity without modifying state.
 size_t FileWordProvider::parseEscTokenAtPos(size_t pos, TextAlign* outAlignment, bool processStyle) {
   if (pos + 1 >= fileSize_)
@@ -216,6 +246,10 @@ size_t FileWordProvider::parseEscTokenAtPos(size_t pos, TextAlign* outAlignment,
 
   char cmd = charAt(pos + 1);
 
+  if (cmd == kFormatCommand) {
+    return parseFormatToken(pos, processStyle ? &currentParagraphFormat_ : nullptr);
+  }
+
   TextAlign align;
   if (tryGetAlignmentStart(cmd, &align)) {
     if (outAlignment)
@@ -261,6 +295,12 @@ void FileWordProvider::parseEscTokenBackward(size_t pos) {
 
   char cmd = charAt(pos + 1);
 
+  // Backward scanning: the format token starts its line, so going back past it leaves the paragraph
+  if (cmd == kFormatCommand) {
+    currentParagraphFormat_ = ParagraphFormat();
+    return;
+  }
+
   TextAlign align;
   // Backward scanning: encountering a lowercase end token means we ENTER a paragraph alignment region
   if (tryGetAlignmentEnd(cmd, &align)) {
@@ -285,6 +325,12 @@ bool FileWordProvider::isAtEscTokenEnd(size_t pos, size_t& tokenStart) {
   if (pos == 0)
     return false;
 
+  // Last value byte of a format token (value bytes are never ESC)
+  if (pos + 1 >= kFormatTokenLength && parseFormatToken(pos + 1 - kFormatTokenLength, nullptr) > 0) {
+    tokenStart = pos + 1 - kFormatTokenLength;
+    return true;
+  }
+
   // Check if previous char is ESC
   char prevChar = charAt(pos - 1);
   if (prevChar != ESC_CHAR)
@@ -344,9 +390,10 @@ StyledWord FileWordProvider::getNextWord() {
   else if (c == '\n' || c == '\t') {
     token += c;
     index_++;
-    // Newline resets paragraph alignment
+    // Newline resets paragraph alignment and format
     if (c == '\n') {
       currentParagraphAlignment_ = TextAlign::None;
+      currentParagraphFormat_ = ParagraphFormat();
     }
   }
   // Case 3: Regular character - continue until boundary
@@ -395,7 +442,7 @@ StyledWord FileWordProvider::getPrevWord() {
   // Move to just before current position
   index_--;
 
-  // Skip backward over ESC tokens (fixed 2-byte format makes this simple)
+  // Skip backward over ESC tokens (fixed-length tokens make this simple)
   // Don't try to invert token meanings - just skip over them
   while (true) {
     // Check if we're at command byte of an ESC token
@@ -468,6 +515,7 @@ StyledWord FileWordProvider::getPrevWord() {
     token += c;
     if (c == '\n') {
       currentParagraphAlignment_ = TextAlign::None;
+      currentParagraphFormat_ = ParagraphFormat();
     }
   }
   // Case 3: Regular word - find start
@@ -640,6 +688,10 @@ TextAlign FileWordProvider::getParagraphAlignment() {
   return currentParagraphAlignment_;
 }
 
+ParagraphFormat FileWordProvider::getParagraphFormat() {
+  return currentParagraphFormat_;
+}
+
 void FileWordProvider::findParagraphBoundaries(size_t pos, size_t& outStart, size_t& outEnd) {
   // Paragraphs are delimited by newlines
   // Find start: scan backwards to find newline or beginning of file
@@ -664,8 +716,9 @@ void FileWordProvider::findParagraphBoundaries(size_t pos, size_t& outStart, siz
 }
 
 void FileWordProvider::computeParagraphAlignmentForPosition(size_t pos) {
-  // Default to None (no alignment)
+  // Default to None (no alignment) and the body text format
   currentParagraphAlignment_ = TextAlign::None;
+  currentParagraphFormat_ = ParagraphFormat();
   if (fileSize_ == 0)
     return;
 
@@ -673,44 +726,29 @@ void FileWordProvider::computeParagraphAlignmentForPosition(size_t pos) {
   if (pos >= fileSize_)
     pos = fileSize_ - 1;
 
-  // Walk left from current position until we find an ESC alignment token or newline
+  // Find the paragraph start (newline boundary), then scan forward over the
+  // tokens that start up to pos: the last alignment token wins
   size_t p = pos;
-  while (true) {
-    if (p == 0) {
-      // Reached start of file without finding newline or token
-      break;
-    }
-    // Check previous char for newline (paragraph boundary)
-    char prev = charAt(p - 1);
-    if (prev == '\n') {
-      // Found paragraph boundary; no alignment on this line
-      currentParagraphAlignment_ = TextAlign::None;
-      return;
+  while (p > 0 && charAt(p - 1) != '\n') {
+    p--;
+  }
+  while (p <= pos) {
+    if (charAt(p) != ESC_CHAR || p + 1 >= fileSize_) {
+      p++;
+      continue;
     }
-    // Check if we're at an ESC char
-    if (charAt(p - 1) == ESC_CHAR && p < fileSize_) {
-      char cmd = charAt(p);
-      TextAlign align;
-      if (tryGetAlignmentStart(cmd, &align)) {
-        currentParagraphAlignment_ = align;
-        return;
-      }
+    const char cmd = charAt(p + 1);
+    if (cmd == kFormatCommand) {
+      const size_t length = parseFormatToken(p, &currentParagraphFormat_);
+      p += length > 0 ? length : 1;
+      continue;
     }
-    // Also check if current position is at ESC char (e.g., when p indexes ESC)
-    if (charAt(p) == ESC_CHAR && p + 1 < fileSize_) {
-      char cmd = charAt(p + 1);
-      TextAlign align;
-      if (tryGetAlignmentStart(cmd, &align)) {
-        currentParagraphAlignment_ = align;
-        return;
-      }
+    TextAlign align;
+    if (tryGetAlignmentStart(cmd, &align)) {
+      currentParagraphAlignment_ = align;
     }
-    if (p == 0)
-      break;
-    p--;
+    p += 2;
   }
-  // If we fall out, no alignment found -> None
-  currentParagraphAlignment_ = TextAlign::None;
 }
 
 size_t FileWordProvider::findEscTokenStart(size_t trailingPos) {
@@ -750,7 +788,8 @@ void FileWordProvider::restoreStyleContext() {
       if (tryGetStyleForward(cmd, &style)) {
         currentInlineStyle_ = style;
       }
-      scanPos += 2;  // Skip ESC token
+      // Skip ESC token
+      scanPos += (cmd == kFormatCommand && parseFormatToken(scanPos, nullptr) > 0) ? kFormatTokenLength : 2;
     } else {
       scanPos++;
     }
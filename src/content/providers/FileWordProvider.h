@@ -34,6 +34,16 @@ class FileWordProvider : public WordProvider {
 
   // Paragraph alignment support
   TextAlign getParagraphAlignment() override;
+  ParagraphFormat getParagraphFormat() override;
+
+  // Paragraph format token: ESC + 'P' and one byte per ParagraphFormat field
+  // (indent, margin-top, margin-bottom, font size), each '0' + value. Written
+  // once at the start of a line, it holds until the next newline.
+  static constexpr char kFormatCommand = 'P';
+  static constexpr size_t kFormatTokenLength = 6;
+  static constexpr size_t kFormatMarginBottomOffset = 4;  // Byte of margin-bottom in the token
+  static constexpr uint8_t kMaxFormatValue = 74;          // Keeps the bytes in '0'..'z'
+  static void appendFormatToken(String& out, const ParagraphFormat& format);
 
  private:
   StyledWord scanWord(int direction);
@@ -54,25 +64,32 @@ class FileWordProvider : public WordProvider {
   // Current paragraph alignment (computed on position change). 'None' means no alignment.
   TextAlign currentParagraphAlignment_ = TextAlign::None;
 
+  // Current paragraph format (from the format token at the start of the line)
+  ParagraphFormat currentParagraphFormat_;
+
   // Current inline font style (updated when parsing [style=...] tokens)
   FontStyle currentInlineStyle_ = FontStyle::REGULAR;
 
   // Find paragraph boundaries containing the given position
   void findParagraphBoundaries(size_t pos, size_t& outStart, size_t& outEnd);
-  // Update the paragraph alignment cache for current position
-  // Compute paragraph alignment for a given position (sets currentParagraphAlignment_)
+  // Compute paragraph alignment and format for a given position (sets
+  // currentParagraphAlignment_ and currentParagraphFormat_)
   void computeParagraphAlignmentForPosition(size_t pos);
 
   // Parse and skip an ESC token starting at `pos` (forward direction).
-  // ESC format: ESC + command byte (2 bytes total, fixed length)
+  // ESC format: ESC + command byte (2 bytes total), or the 6-byte format token
   // Alignment: ESC+'L'(left), ESC+'R'(right), ESC+'C'(center), ESC+'J'(justify)
   // Style: ESC+'B'(bold), ESC+'b'(end bold), ESC+'I'(italic), ESC+'i'(end italic),
   //        ESC+'X'(bold+italic), ESC+'x'(end bold+italic)
-  // Returns 2 if valid ESC token found, 0 otherwise.
+  // Format: ESC+'P' + 4 value bytes
+  // Returns the token length if a valid ESC token is found, 0 otherwise.
   // If outAlignment is provided, writes the parsed alignment there.
   // If processStyle is false, only checks validity without modifying state.
   size_t parseEscTokenAtPos(size_t pos, TextAlign* outAlignment = nullptr, bool processStyle = true);
 
+  // Decode the format token starting at `pos`; returns kFormatTokenLength, or 0 if there is none
+  size_t parseFormatToken(size_t pos, ParagraphFormat* outFormat);
+
   // Check if there's a valid ESC token at pos (without modifying state)
   size_t checkEscTokenAtPos(size_t pos);
 
@@ -26,6 +26,27 @@ struct StyledWord {
   }
 };
 
+/**
+ * ParagraphFormat - Block layout of a paragraph, from its CSS
+ *
+ * Lengths are in quarters of an em of the body font, so layout can scale
+ * them with the font in use.
+ */
+struct ParagraphFormat {
+  uint8_t indent = 0;        // First-line indent
+  uint8_t marginTop = 0;     // Space above the paragraph
+  uint8_t marginBottom = 0;  // Space below the paragraph
+  uint8_t fontSize = 10;     // Font size in tenths of the body size
+
+  bool operator==(const ParagraphFormat& other) const {
+    return indent == other.indent && marginTop == other.marginTop && marginBottom == other.marginBottom &&
+           fontSize == other.fontSize;
+  }
+  bool operator!=(const ParagraphFormat& other) const {
+    return !(*this == other);
+  }
+};
+
 class WordProvider {
  public:
   virtual ~WordProvider() = default;
@@ -123,6 +144,11 @@ class WordProvider {
   virtual TextAlign getParagraphAlignment() {
     return TextAlign::Left;
   }
+
+  // Indent, margins and font size of the current paragraph - default body text
+  virtual ParagraphFormat getParagraphFormat() {
+    return ParagraphFormat();
+  }
 };
 
 #endif
\ No newline at end of file
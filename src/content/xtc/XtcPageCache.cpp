@@ -0,0 +1,157 @@
+#include "XtcPageCache.h"
+
+#include <cstdlib>
+
+XtcPageCache::XtcPageCache(XtcFile& file, size_t budgetBytes) : file_(file), budgetBytes_(budgetBytes) {}
+
+XtcPageCache::~XtcPageCache() { release(); }
+
+bool XtcPageCache::reset(uint32_t skipBytes, size_t pageBytes) {
+  release();
+  if (pageBytes == 0) {
+    return false;
+  }
+
+  size_t slots = budgetBytes_ / pageBytes;
+  if (slots > kMaxSlots) {
+    slots = kMaxSlots;
+  }
+  // Settle for fewer slots when the heap is fragmented
+  while (slots > 0) {
+    data_ = static_cast<uint8_t*>(malloc(slots * pageBytes));
+    if (data_) {
+      break;
+    }
+    slots--;
+  }
+  if (!data_) {
+    Serial.printf("XtcPageCache: No room for a %u byte page\n", (unsigned)pageBytes);
+    return false;
+  }
+
+  skipBytes_ = skipBytes;
+  pageBytes_ = pageBytes;
+  slotCount_ = static_cast<uint8_t>(slots);
+  Serial.printf("XtcPageCache: %u slots of %u bytes\n", (unsigned)slotCount_, (unsigned)pageBytes_);
+  return true;
+}
+
+void XtcPageCache::release() {
+  free(data_);
+  data_ = nullptr;
+  skipBytes_ = 0;
+  pageBytes_ = 0;
+  slotCount_ = 0;
+  for (Slot& slot : slots_) {
+    slot = Slot();
+  }
+  current_ = kNoPage;
+}
+
+const uint8_t* XtcPageCache::getPage(uint32_t pageIndex) {
+  if (!data_ || pageIndex >= file_.getPageCount()) {
+    return nullptr;
+  }
+  current_ = pageIndex;
+
+  int slot = findSlot(pageIndex);
+  if (slot < 0) {
+    slot = chooseSlot();
+    if (!assign(slot, pageIndex)) {
+      return nullptr;
+    }
+  }
+  if (!fill(slot, pageBytes_)) {
+    return nullptr;
+  }
+  return data_ + (size_t)slot * pageBytes_;
+}
+
+bool XtcPageCache::readAhead(size_t maxBytes) {
+  if (!data_ || current_ == kNoPage) {
+    return false;
+  }
+
+  // The pages after the current one, as many as there are other slots
+  for (uint32_t ahead = 1; ahead < slotCount_; ++ahead) {
+    const uint32_t page = current_ + ahead;
+    if (page >= file_.getPageCount()) {
+      return false;
+    }
+    int slot = findSlot(page);
+    if (slot >= 0 && slots_[slot].loaded == pageBytes_) {
+      continue;
+    }
+    if (slot < 0) {
+      slot = chooseSlot();
+      if (!assign(slot, page)) {
+        return false;
+      }
+    }
+    return fill(slot, maxBytes);
+  }
+  return false;
+}
+
+bool XtcPageCache::isCached(uint32_t pageIndex) const {
+  const int slot = findSlot(pageIndex);
+  return slot >= 0 && slots_[slot].loaded == pageBytes_;
+}
+
+int XtcPageCache::findSlot(uint32_t pageIndex) const {
+  for (uint8_t i = 0; i < slotCount_; ++i) {
+    if (slots_[i].page == pageIndex) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int XtcPageCache::chooseSlot() const {
+  int best = -1;
+  uint32_t bestScore = 0;
+  for (uint8_t i = 0; i < slotCount_; ++i) {
+    const uint32_t page = slots_[i].page;
+    if (page == kNoPage) {
+      return i;
+    }
+    if (page == current_) {
+      continue;
+    }
+    // Pages behind rank above every page ahead
+    const uint32_t score = page < current_ ? 0x80000000u + (current_ - page) : page - current_;
+    if (best < 0 || score > bestScore) {
+      best = i;
+      bestScore = score;
+    }
+  }
+  return best;
+}
+
+bool XtcPageCache::assign(int slot, uint32_t pageIndex) {
+  uint32_t bitmapOffset = 0;
+  uint16_t width = 0;
+  uint16_t height = 0;
+  slots_[slot] = Slot();
+  if (!file_.getPageBitmapOffset(pageIndex, bitmapOffset, width, height)) {
+    return false;
+  }
+  slots_[slot].page = pageIndex;
+  slots_[slot].offset = bitmapOffset + skipBytes_;
+  return true;
+}
+
+bool XtcPageCache::fill(int slot, size_t maxBytes) {
+  Slot& s = slots_[slot];
+  const size_t want = (pageBytes_ - s.loaded < maxBytes) ? pageBytes_ - s.loaded : maxBytes;
+  if (want == 0) {
+    return true;
+  }
+  uint8_t* dest = data_ + (size_t)slot * pageBytes_ + s.loaded;
+  if (file_.readAt(s.offset + (uint32_t)s.loaded, dest, want) != want) {
+    s = Slot();
+    return false;
+  }
+  s.loaded += want;
+  return true;
+}
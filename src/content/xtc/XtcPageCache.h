@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "XtcFile.h"
+
+/**
+ * Read-ahead cache of XTC page bitmaps.
+ *
+ * Keeps the current page and the pages after it in fixed-size slots carved
+ * from one allocation within a RAM budget. getPage() makes a page current and
+ * reads whatever of it is not cached yet; readAhead() fills the next missing
+ * page a step at a time, so the reads can be spread over a panel refresh and
+ * idle loop ticks. Pages before the current one are dropped first, then the
+ * farthest ahead.
+ *
+ * Each slot holds `pageBytes` bytes starting `skipBytes` into a page's
+ * bitmap: the whole bitmap, or only the plane a viewer draws.
+ */
+class XtcPageCache {
+ public:
+  XtcPageCache(XtcFile& file, size_t budgetBytes);
+  ~XtcPageCache();
+
+  // Size the slots for the open file and drop all cached pages. Returns false
+  // if not even one page fits in the budget (or in memory).
+  bool reset(uint32_t skipBytes, size_t pageBytes);
+
+  // Free the slots
+  void release();
+
+  // The cached bytes of a page, which becomes the current page; nullptr if it
+  // cannot be read
+  const uint8_t* getPage(uint32_t pageIndex);
+
+  // Read up to maxBytes of the first page after the current one that is not
+  // cached completely; returns false when there was nothing left to read
+  bool readAhead(size_t maxBytes);
+
+  // Whether a page is cached completely
+  bool isCached(uint32_t pageIndex) const;
+
+  uint8_t getSlotCount() const {
+    return slotCount_;
+  }
+
+ private:
+  static constexpr uint32_t kNoPage = 0xFFFFFFFF;
+  static constexpr uint8_t kMaxSlots = 8;
+
+  struct Slot {
+    uint32_t page = kNoPage;
+    uint32_t offset = 0;  // Of the cached bytes in the file
+    size_t loaded = 0;
+  };
+
+  int findSlot(uint32_t pageIndex) const;
+
+  // Slot to reuse: an empty one, else the page farthest behind the current
+  // page, else the one farthest ahead. Never the current page.
+  int chooseSlot() const;
+
+  // Start caching a page in a slot; false if its page header is invalid
+  bool assign(int slot, uint32_t pageIndex);
+
+  // Read up to maxBytes more of a slot; drops it and returns false on a short read
+  bool fill(int slot, size_t maxBytes);
+
+  XtcFile& file_;
+  size_t budgetBytes_;
+  uint8_t* data_ = nullptr;
+  uint32_t skipBytes_ = 0;
+  size_t pageBytes_ = 0;
+  uint8_t slotCount_ = 0;
+  Slot slots_[kMaxSlots];
+  uint32_t current_ = kNoPage;
+};
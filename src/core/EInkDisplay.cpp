@@ -1,5 +1,6 @@
 #include "EInkDisplay.h"
 
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <vector>
@@ -120,11 +121,19 @@ EInkDisplay::EInkDisplay(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t
       _busy(busy),
       frameBuffer(nullptr),
       frameBufferActive(nullptr),
+      grayLsbPlane(nullptr),
+      grayMsbPlane(nullptr),
       customLutActive(false),
       bbep(nullptr),
       isScreenOn(false),
       inGrayscaleMode(false),
-      drawGrayscale(false) {
+      drawGrayscale(false),
+      previousFrameValid(false),
+      differentialPlanes(false),
+      refreshScheduler(DISPLAY_WIDTH_BYTES, DISPLAY_HEIGHT),
+      lastRefreshMode(FULL_REFRESH),
+      refreshWork(nullptr),
+      refreshWorkContext(nullptr) {
   Serial.printf("[%lu] EInkDisplay: Constructor called\n", millis());
   Serial.printf("[%lu]   SCLK=%d, MOSI=%d, CS=%d, DC=%d, RST=%d, BUSY=%d\n", millis(), sclk, mosi, cs, dc, rst, busy);
 
@@ -132,10 +141,13 @@ EInkDisplay::EInkDisplay(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t
   // bb_epaper uses the global SPI object; SD can reconfigure it.
   // Force a known-good transaction state when talking to the panel.
   bbepSpiSettings = SPISettings(12000000, MSBFIRST, SPI_MODE0);
+  // Differential plane writes talk to the controller directly; use the same bus settings.
+  spiSettings = bbepSpiSettings;
 #endif
 }
 
 EInkDisplay::~EInkDisplay() {
+  releaseGrayscalePlanes();
 #ifdef ARDUINO
   if (bbep) {
     delete bbep;
@@ -182,6 +194,9 @@ void EInkDisplay::begin() {
   int rcRefresh = bbep->refresh(REFRESH_FULL, true);
   bbepEndTransaction();
   Serial.printf("[%lu]   bb_epaper: writePlane rc=%d, refresh rc=%d\n", millis(), rcPlane, rcRefresh);
+  // Both controller planes and both framebuffers are now white
+  previousFrameValid = (rcPlane == BBEP_SUCCESS && rcRefresh == BBEP_SUCCESS);
+  ramLagRegion.clear();
   Serial.printf("[%lu]   bb_epaper display driver initialized\n", millis());
 #endif
 }
@@ -395,6 +410,18 @@ void EInkDisplay::writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_
   Serial.printf("[%lu]   %s RAM write complete (%lu ms)\n", millis(), bufferName, duration);
 }
 
+void EInkDisplay::writeRamRegion(uint8_t ramBuffer, const uint8_t* data, const DirtyRegion& region) {
+  const uint16_t firstByte = region.x / 8;
+  const uint16_t rowBytes = region.w / 8;
+
+  // setRamArea walks Y in reverse for the flipped gates, so rows go out top to bottom
+  setRamArea(region.x, region.y, region.w, region.h);
+  sendCommand(ramBuffer);
+  for (uint16_t row = region.y; row < region.y + region.h; ++row) {
+    sendData(data + row * DISPLAY_WIDTH_BYTES + firstByte, rowBytes);
+  }
+}
+
 void EInkDisplay::setFramebuffer(const uint8_t* bwBuffer) {
   memcpy(frameBuffer, bwBuffer, BUFFER_SIZE);
 }
@@ -432,6 +459,31 @@ void EInkDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) {
   writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE);
 }
 
+bool EInkDisplay::getGrayscalePlanes(uint8_t** lsbBuffer, uint8_t** msbBuffer) {
+  if (!grayLsbPlane || !grayMsbPlane) {
+    releaseGrayscalePlanes();
+    grayLsbPlane = static_cast<uint8_t*>(malloc(BUFFER_SIZE));
+    grayMsbPlane = static_cast<uint8_t*>(malloc(BUFFER_SIZE));
+    if (!grayLsbPlane || !grayMsbPlane) {
+      Serial.printf("[%lu] EInkDisplay: Not enough memory for grayscale planes\n", millis());
+      releaseGrayscalePlanes();
+      return false;
+    }
+  }
+  memset(grayLsbPlane, 0xFF, BUFFER_SIZE);
+  memset(grayMsbPlane, 0xFF, BUFFER_SIZE);
+  *lsbBuffer = grayLsbPlane;
+  *msbBuffer = grayMsbPlane;
+  return true;
+}
+
+void EInkDisplay::releaseGrayscalePlanes() {
+  free(grayLsbPlane);
+  free(grayMsbPlane);
+  grayLsbPlane = nullptr;
+  grayMsbPlane = nullptr;
+}
+
 void EInkDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
 #ifdef ARDUINO
   if (bbep) {
@@ -452,29 +504,152 @@ void EInkDisplay::displayBuffer(RefreshMode mode) {
   }
 
   if (!isScreenOn) {
+    // Controller RAM does not survive deep sleep
+    previousFrameValid = false;
     bbepBeginTransaction();
     bbep->wake();
     bbepEndTransaction();
     isScreenOn = true;
   }
 
+  RefreshScheduler::Waveform suggested = RefreshScheduler::FAST;
+  if (previousFrameValid) {
+    lastDirtyRegion = FrameDiff::computeDirtyRegion(frameBufferActive, frameBuffer, DISPLAY_WIDTH_BYTES, DISPLAY_HEIGHT);
+    suggested = refreshScheduler.assess(frameBufferActive, frameBuffer, lastDirtyRegion);
+  } else {
+    lastDirtyRegion.x = 0;
+    lastDirtyRegion.y = 0;
+    lastDirtyRegion.w = DISPLAY_WIDTH;
+    lastDirtyRegion.h = DISPLAY_HEIGHT;
+  }
+
+  if (mode == AUTO_REFRESH) {
+    // HALF_REFRESH is the whole-panel fast waveform; FAST_REFRESH below
+    // becomes a differential partial update
+    mode = suggested == RefreshScheduler::FULL ? FULL_REFRESH
+                                               : (suggested == RefreshScheduler::FAST ? HALF_REFRESH : FAST_REFRESH);
+    Serial.printf("[%lu]   Refresh scheduler: %lu flips, budget %lu%%, %u since full -> mode %d\n", millis(),
+                  (unsigned long)refreshScheduler.getLastFrameFlips(),
+                  (unsigned long)refreshScheduler.getMaxTileBudgetPercent(), refreshScheduler.getRefreshesSinceFull(),
+                  (int)mode);
+  }
+  lastRefreshMode = mode;
+
+  // ImageDecoder draws through bbep into its current buffer; keep it pointing
+  // at the frame being displayed.
   bbep->setBuffer(frameBuffer);
-  bbepBeginTransaction();
-  int rcPlane = bbep->writePlane(PLANE_DUPLICATE);
-  bbepEndTransaction();
-  if (rcPlane != BBEP_SUCCESS) {
-    Serial.printf("[%lu]   bb_epaper: writePlane failed rc=%d\n", millis(), rcPlane);
+
+  if (mode == FAST_REFRESH && previousFrameValid) {
+    if (lastDirtyRegion.isEmpty()) {
+      Serial.printf("[%lu]   Frame unchanged, skipping refresh\n", millis());
+      swapBuffers();
+      return;
+    }
+
+    // New frame to BW RAM, previous frame to RED RAM, so the partial waveform
+    // only drives pixels that differ. Also cover the area where RED RAM still
+    // holds the frame before last, or those pixels would be driven again.
+    DirtyRegion region = lastDirtyRegion;
+    region.unite(ramLagRegion);
+    Serial.printf("[%lu]   Differential update x=%u y=%u w=%u h=%u\n", millis(), region.x, region.y, region.w,
+                  region.h);
+    writeRamRegion(CMD_WRITE_RAM_BW, frameBuffer, region);
+    writeRamRegion(CMD_WRITE_RAM_RED, frameBufferActive, region);
+    ramLagRegion = lastDirtyRegion;
+
+    differentialPlanes = true;
+    refreshDisplay(mode, false);
+    differentialPlanes = false;
+  } else {
+    bbepBeginTransaction();
+    int rcPlane = bbep->writePlane(PLANE_DUPLICATE);
+    bbepEndTransaction();
+    if (rcPlane != BBEP_SUCCESS) {
+      Serial.printf("[%lu]   bb_epaper: writePlane failed rc=%d\n", millis(), rcPlane);
+    }
+    refreshDisplay(mode, false);
+    previousFrameValid = (rcPlane == BBEP_SUCCESS);
+    ramLagRegion.clear();
   }
-  refreshDisplay(mode, false);
 
   // Keep the existing double-buffer behavior so the next render happens into
-  // a fresh buffer.
+  // a fresh buffer; the front buffer is the frame now on the panel.
   swapBuffers();
 #else
   (void)mode;
 #endif
 }
 
+bool EInkDisplay::beginRegionUpdate() {
+  if (!previousFrameValid || !isScreenOn) {
+    return false;
+  }
+  memcpy(frameBuffer, frameBufferActive, BUFFER_SIZE);
+  return true;
+}
+
+void EInkDisplay::clearRegion(const DirtyRegion& region, uint8_t color) {
+  if (region.isEmpty() || region.x >= DISPLAY_WIDTH || region.y >= DISPLAY_HEIGHT) {
+    return;
+  }
+  const uint16_t firstByte = region.x / 8;
+  const uint16_t endByte = (region.x + region.w > DISPLAY_WIDTH) ? DISPLAY_WIDTH_BYTES : (region.x + region.w + 7) / 8;
+  const uint16_t endRow = (region.y + region.h > DISPLAY_HEIGHT) ? DISPLAY_HEIGHT : region.y + region.h;
+  for (uint16_t row = region.y; row < endRow; ++row) {
+    memset(frameBuffer + row * DISPLAY_WIDTH_BYTES + firstByte, color, endByte - firstByte);
+  }
+}
+
+void EInkDisplay::displayRegion(const DirtyRegion& region, RefreshMode mode) {
+#ifdef ARDUINO
+  if (!bbep) {
+    return;
+  }
+  if (mode != FAST_REFRESH || !previousFrameValid || !isScreenOn) {
+    // Only fast updates can be limited to a region
+    displayBuffer(mode);
+    return;
+  }
+  if (region.isEmpty() || region.x >= DISPLAY_WIDTH || region.y >= DISPLAY_HEIGHT) {
+    return;
+  }
+
+  // Byte align and clip to the panel
+  DirtyRegion r;
+  r.x = (uint16_t)(region.x & ~7);
+  r.y = region.y;
+  const uint16_t x1 = (region.x + region.w > DISPLAY_WIDTH) ? DISPLAY_WIDTH : (uint16_t)((region.x + region.w + 7) & ~7);
+  const uint16_t y1 = (region.y + region.h > DISPLAY_HEIGHT) ? DISPLAY_HEIGHT : region.y + region.h;
+  r.w = x1 - r.x;
+  r.h = y1 - r.y;
+
+  refreshScheduler.assess(frameBufferActive, frameBuffer, r);
+  lastRefreshMode = mode;
+
+  DirtyRegion ram = r;
+  ram.unite(ramLagRegion);
+  Serial.printf("[%lu]   Region update x=%u y=%u w=%u h=%u (%u bytes)\n", millis(), ram.x, ram.y, ram.w, ram.h,
+                (unsigned)(ram.w / 8) * ram.h);
+  writeRamRegion(CMD_WRITE_RAM_BW, frameBuffer, ram);
+  writeRamRegion(CMD_WRITE_RAM_RED, frameBufferActive, ram);
+  ramLagRegion = r;
+  lastDirtyRegion = r;
+
+  differentialPlanes = true;
+  refreshDisplay(mode, false);
+  differentialPlanes = false;
+
+  // The front buffer must match the panel again
+  for (uint16_t row = r.y; row < r.y + r.h; ++row) {
+    const uint32_t offset = row * DISPLAY_WIDTH_BYTES + r.x / 8;
+    memcpy(frameBufferActive + offset, frameBuffer + offset, r.w / 8);
+  }
+#else
+  (void)region;
+  (void)mode;
+#endif
+}
+
 void EInkDisplay::displayGrayBuffer(bool turnOffScreen) {
   // bb_epaper integration is BW-only for now.
   (void)turnOffScreen;
@@ -491,20 +666,34 @@ void EInkDisplay::refreshDisplay(RefreshMode mode, bool turnOffScreen) {
     refreshMode = REFRESH_FULL;
   } else if (mode == HALF_REFRESH) {
     refreshMode = bbep->hasFastRefresh() ? REFRESH_FAST : REFRESH_FULL;
+  } else if (differentialPlanes) {
+    // displayBuffer wrote separate old/new planes: partial refresh drives only
+    // the pixels that differ between them.
+    refreshMode = REFRESH_PARTIAL;
   } else {
-    // We currently write the same image to both controller planes (PLANE_DUPLICATE).
-    // Partial refresh relies on plane differences; duplicating makes the diff empty
-    // and can result in *no visible update* on some controllers.
-    // Use FAST refresh as a reliable baseline until we implement true old/new plane
-    // tracking for partial updates.
+    // Same image in both planes (PLANE_DUPLICATE): a partial refresh would see
+    // no difference and show nothing, so use FAST.
     refreshMode = bbep->hasFastRefresh() ? REFRESH_FAST : REFRESH_FULL;
   }
 
   bbepBeginTransaction();
-  int rc = bbep->refresh(refreshMode, true);
+  int rc = bbep->refresh(refreshMode, refreshWork == nullptr);
   bbepEndTransaction();
+  if (rc == BBEP_SUCCESS && refreshWork) {
+    // The bus is released while the waveform runs; BUSY needs a moment after
+    // the activation command before it is valid
+    delay(1);
+    while (digitalRead(_busy) == HIGH && refreshWork(refreshWorkContext)) {
+    }
+    waitWhileBusy();
+  }
   if (rc != BBEP_SUCCESS) {
     Serial.printf("[%lu]   bb_epaper: refresh failed mode=%d rc=%d\n", millis(), refreshMode, rc);
+  } else {
+    // A full refresh clears the ghosting budget; everything else counts toward it
+    refreshScheduler.onRefresh(refreshMode == REFRESH_FULL
+                                   ? RefreshScheduler::FULL
+                                   : (refreshMode == REFRESH_PARTIAL ? RefreshScheduler::PARTIAL : RefreshScheduler::FAST));
   }
 
   if (turnOffScreen) {
@@ -519,6 +708,11 @@ void EInkDisplay::refreshDisplay(RefreshMode mode, bool turnOffScreen) {
 #endif
 }
 
+void EInkDisplay::setRefreshWork(RefreshWork work, void* context) {
+  refreshWork = work;
+  refreshWorkContext = context;
+}
+
 void EInkDisplay::setCustomLUT(bool enabled, const unsigned char* lutData) {
   (void)enabled;
   (void)lutData;
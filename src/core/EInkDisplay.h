@@ -8,6 +8,9 @@
 #include "../../test/mocks/platform_stubs.h"
 #endif
 
+#include "FrameDiff.h"
+#include "RefreshScheduler.h"
+
 class BBEPAPER;
 
 class EInkDisplay {
@@ -22,7 +25,8 @@ class EInkDisplay {
   enum RefreshMode {
     FULL_REFRESH,  // Full refresh with complete waveform
     HALF_REFRESH,  // Half refresh (1720ms) - balanced quality and speed
-    FAST_REFRESH   // Fast refresh using custom LUT
+    FAST_REFRESH,  // Fast refresh using custom LUT
+    AUTO_REFRESH   // Let the ghosting scheduler pick partial, fast or full
   };
 
   // Initialize the display hardware and driver
@@ -41,13 +45,42 @@ class EInkDisplay {
   void swapBuffers();
   void setFramebuffer(const uint8_t* bwBuffer);
 
+  // Heap-allocated LSB/MSB planes for single-pass grayscale rendering, cleared
+  // to white. Allocated on first use (2 x BUFFER_SIZE) and kept until
+  // releaseGrayscalePlanes(); returns false if the allocation fails, in which
+  // case callers render each plane into the frame buffer instead.
+  bool getGrayscalePlanes(uint8_t** lsbBuffer, uint8_t** msbBuffer);
+  void releaseGrayscalePlanes();
+
   void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer);
   void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer);
   void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer);
 
+  // Send the back buffer to the panel and swap buffers. FAST_REFRESH updates
+  // are differential: the new frame and the previously displayed one are
+  // written to separate controller planes (only over the changed region) so
+  // the partial waveform drives just the pixels that differ. An unchanged
+  // frame skips the refresh entirely.
   void displayBuffer(RefreshMode mode = FAST_REFRESH);
   void displayGrayBuffer(bool turnOffScreen = false);
 
+  // Work to do while the panel runs a refresh waveform, when the SPI bus is
+  // free (e.g. reading the next page from the SD card). It is called until it
+  // returns false or the refresh ends; nullptr waits idly.
+  typedef bool (*RefreshWork)(void* context);
+  void setRefreshWork(RefreshWork work, void* context);
+
+  // Region-limited updates for screens that only redraw part of the frame
+  // (e.g. moving a menu cursor). beginRegionUpdate() makes the back buffer a
+  // copy of the frame on the panel; it returns false when that frame is not
+  // known, in which case the caller should redraw everything and use
+  // displayBuffer(). Then clear/redraw the changed area and send just that
+  // region with displayRegion(), which leaves both buffers holding the new
+  // frame (no swap).
+  bool beginRegionUpdate();
+  void clearRegion(const DirtyRegion& region, uint8_t color = 0xFF);
+  void displayRegion(const DirtyRegion& region, RefreshMode mode = FAST_REFRESH);
+
   void refreshDisplay(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
 
   bool supportsGrayscale() const;
@@ -70,6 +103,19 @@ class EInkDisplay {
     return bbep;
   }
 
+  // Region that differed from the previous frame on the last displayBuffer()
+  // (the full panel when no previous frame was known).
+  const DirtyRegion& getLastDirtyRegion() const {
+    return lastDirtyRegion;
+  }
+  // Mode actually used by the last displayBuffer() (AUTO_REFRESH resolved)
+  RefreshMode getLastRefreshMode() const {
+    return lastRefreshMode;
+  }
+  RefreshScheduler& getRefreshScheduler() {
+    return refreshScheduler;
+  }
+
   // Save the current framebuffer to a PBM file (desktop/test builds only)
   void saveFrameBufferAsPBM(const char* filename);
 
@@ -84,6 +130,10 @@ class EInkDisplay {
   uint8_t* frameBuffer;
   uint8_t* frameBufferActive;
 
+  // Grayscale planes (see getGrayscalePlanes)
+  uint8_t* grayLsbPlane;
+  uint8_t* grayMsbPlane;
+
   // SPI settings
   SPISettings spiSettings;
 
@@ -97,6 +147,22 @@ class EInkDisplay {
   bool inGrayscaleMode;
   bool drawGrayscale;
 
+  // Differential refresh state. The controller holds the new frame in BW RAM
+  // and the old one in RED RAM; `ramLagRegion` is where RED RAM still lags
+  // behind BW RAM after the last differential write and must be rewritten.
+  bool previousFrameValid;
+  bool differentialPlanes;
+  DirtyRegion lastDirtyRegion;
+  DirtyRegion ramLagRegion;
+
+  // Ghosting budget; picks the waveform for AUTO_REFRESH
+  RefreshScheduler refreshScheduler;
+  RefreshMode lastRefreshMode;
+
+  // See setRefreshWork
+  RefreshWork refreshWork;
+  void* refreshWorkContext;
+
   // Low-level display control
   void resetDisplay();
   void sendCommand(uint8_t command);
@@ -108,6 +174,8 @@ class EInkDisplay {
   // Low-level display operations
   void setRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
   void writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_t size);
+  // Write the rows/bytes of `data` (a full frame) covered by `region`
+  void writeRamRegion(uint8_t ramBuffer, const uint8_t* data, const DirtyRegion& region);
 
   void bbepBeginTransaction();
   void bbepEndTransaction();
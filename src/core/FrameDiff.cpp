@@ -0,0 +1,71 @@
+#include "FrameDiff.h"
+
+#include <cstring>
+
+void DirtyRegion::unite(const DirtyRegion& other) {
+  if (other.isEmpty()) {
+    return;
+  }
+  if (isEmpty()) {
+    *this = other;
+    return;
+  }
+  const uint16_t x1 = (x + w > other.x + other.w) ? x + w : other.x + other.w;
+  const uint16_t y1 = (y + h > other.y + other.h) ? y + h : other.y + other.h;
+  x = x < other.x ? x : other.x;
+  y = y < other.y ? y : other.y;
+  w = x1 - x;
+  h = y1 - y;
+}
+
+bool DirtyRegion::intersects(const DirtyRegion& other) const {
+  if (isEmpty() || other.isEmpty()) {
+    return false;
+  }
+  return x < other.x + other.w && other.x < x + w && y < other.y + other.h && other.y < y + h;
+}
+
+DirtyRegion FrameDiff::computeDirtyRegion(const uint8_t* oldFrame, const uint8_t* newFrame, uint16_t widthBytes,
+                                          uint16_t height) {
+  DirtyRegion region;
+  int firstRow = -1;
+  int lastRow = -1;
+  int minByte = widthBytes;
+  int maxByte = -1;
+
+  for (int row = 0; row < height; ++row) {
+    const uint8_t* a = oldFrame + row * widthBytes;
+    const uint8_t* b = newFrame + row * widthBytes;
+    // Most rows are unchanged on a page turn's margins and in menus
+    if (memcmp(a, b, widthBytes) == 0) {
+      continue;
+    }
+    if (firstRow < 0) {
+      firstRow = row;
+    }
+    lastRow = row;
+
+    // Only bytes outside the current column range can widen it
+    for (int i = 0; i < minByte; ++i) {
+      if (a[i] != b[i]) {
+        minByte = i;
+        break;
+      }
+    }
+    for (int i = widthBytes - 1; i > maxByte; --i) {
+      if (a[i] != b[i]) {
+        maxByte = i;
+        break;
+      }
+    }
+  }
+
+  if (firstRow < 0) {
+    return region;
+  }
+  region.x = (uint16_t)(minByte * 8);
+  region.y = (uint16_t)firstRow;
+  region.w = (uint16_t)((maxByte - minByte + 1) * 8);
+  region.h = (uint16_t)(lastRow - firstRow + 1);
+  return region;
+}
@@ -0,0 +1,40 @@
+#ifndef FRAME_DIFF_H
+#define FRAME_DIFF_H
+
+#include <cstdint>
+
+/**
+ * Rectangle of panel pixels that changed, either between two frames or while
+ * drawing. The x extent is byte aligned (multiples of 8) since controller RAM
+ * is addressed in bytes.
+ */
+struct DirtyRegion {
+  uint16_t x = 0;
+  uint16_t y = 0;
+  uint16_t w = 0;
+  uint16_t h = 0;
+
+  bool isEmpty() const {
+    return w == 0 || h == 0;
+  }
+  void clear() {
+    x = y = w = h = 0;
+  }
+  // Grow to the bounding box of this region and `other`.
+  void unite(const DirtyRegion& other);
+  bool intersects(const DirtyRegion& other) const;
+};
+
+/**
+ * Compares 1-bit panel frames (row-major, `widthBytes` bytes per row, MSB
+ * first). Kept free of display code so it can be tested on the host.
+ */
+class FrameDiff {
+ public:
+  // Bounding region of all bytes that differ between `oldFrame` and
+  // `newFrame`. Empty when the frames are identical.
+  static DirtyRegion computeDirtyRegion(const uint8_t* oldFrame, const uint8_t* newFrame, uint16_t widthBytes,
+                                        uint16_t height);
+};
+
+#endif
@@ -0,0 +1,90 @@
+#include "RefreshScheduler.h"
+
+RefreshScheduler::RefreshScheduler(uint16_t widthBytes, uint16_t height) : widthBytes_(widthBytes), height_(height) {
+  tilesX_ = (widthBytes + kTileWidthBytes - 1) / kTileWidthBytes;
+  tilesY_ = (height + kTileHeight - 1) / kTileHeight;
+  if (tilesX_ * tilesY_ > kMaxTiles) {
+    // Coarser rows rather than overflow; only reached for panels far larger than 800x480
+    tilesY_ = kMaxTiles / tilesX_;
+  }
+  reset();
+}
+
+void RefreshScheduler::reset() {
+  for (int i = 0; i < kMaxTiles; ++i) {
+    tileFlips_[i] = 0;
+  }
+  refreshesSinceFull_ = 0;
+}
+
+uint32_t RefreshScheduler::tilePixels(int tile) const {
+  const int tx = tile % tilesX_;
+  const int ty = tile / tilesX_;
+  const int bytes = (tx == tilesX_ - 1) ? widthBytes_ - tx * kTileWidthBytes : kTileWidthBytes;
+  const int rows = (ty == tilesY_ - 1) ? height_ - ty * kTileHeight : kTileHeight;
+  return (uint32_t)bytes * 8u * (uint32_t)rows;
+}
+
+RefreshScheduler::Waveform RefreshScheduler::assess(const uint8_t* oldFrame, const uint8_t* newFrame,
+                                                    const DirtyRegion& dirty) {
+  lastFrameFlips_ = 0;
+  if (!dirty.isEmpty()) {
+    const int firstByte = dirty.x / 8;
+    int endByte = (dirty.x + dirty.w + 7) / 8;
+    if (endByte > widthBytes_) {
+      endByte = widthBytes_;
+    }
+    int endRow = dirty.y + dirty.h;
+    if (endRow > height_) {
+      endRow = height_;
+    }
+    for (int row = dirty.y; row < endRow; ++row) {
+      int ty = row / kTileHeight;
+      if (ty >= tilesY_) {
+        ty = tilesY_ - 1;
+      }
+      const uint8_t* a = oldFrame + row * widthBytes_;
+      const uint8_t* b = newFrame + row * widthBytes_;
+      for (int i = firstByte; i < endByte; ++i) {
+        const uint8_t diff = (uint8_t)(a[i] ^ b[i]);
+        if (diff) {
+          const uint32_t n = (uint32_t)__builtin_popcount(diff);
+          tileFlips_[ty * tilesX_ + i / kTileWidthBytes] += n;
+          lastFrameFlips_ += n;
+        }
+      }
+    }
+  }
+
+  if (refreshesSinceFull_ + 1u >= config_.maxRefreshesBetweenFull ||
+      getMaxTileBudgetPercent() >= config_.fullBudgetPercent) {
+    return FULL;
+  }
+  const uint32_t panelPixels = (uint32_t)widthBytes_ * 8u * height_;
+  if (lastFrameFlips_ * 100u >= panelPixels * config_.fastFramePercent) {
+    return FAST;
+  }
+  return PARTIAL;
+}
+
+void RefreshScheduler::onRefresh(Waveform waveform) {
+  if (waveform == FULL) {
+    reset();
+    return;
+  }
+  if (refreshesSinceFull_ < 0xFFFF) {
+    ++refreshesSinceFull_;
+  }
+}
+
+uint32_t RefreshScheduler::getMaxTileBudgetPercent() const {
+  uint32_t maxPercent = 0;
+  const int tiles = tilesX_ * tilesY_;
+  for (int t = 0; t < tiles; ++t) {
+    const uint32_t percent = (uint32_t)(((uint64_t)tileFlips_[t] * 100u) / tilePixels(t));
+    if (percent > maxPercent) {
+      maxPercent = percent;
+    }
+  }
+  return maxPercent;
+}
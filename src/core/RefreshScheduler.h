@@ -0,0 +1,79 @@
+#ifndef REFRESH_SCHEDULER_H
+#define REFRESH_SCHEDULER_H
+
+#include <cstdint>
+
+#include "FrameDiff.h"
+
+/**
+ * Picks the e-ink waveform for each frame from a ghosting budget.
+ *
+ * The panel is split into tiles; every pixel that flips between the frame on
+ * the panel and the next one is charged to its tile. Partial updates leave a
+ * little ghosting behind for each flip, so once any tile has accumulated
+ * `fullBudgetPercent` of its pixel count in flips since the last full
+ * refresh, the next frame gets a full refresh. Frames that change a large
+ * part of the panel at once (images, new chapters) use the whole-panel fast
+ * waveform instead of a partial one. Light pages thus go many turns without
+ * a flash while heavy pages get cleaned sooner.
+ *
+ * Works on plain 1-bit frames so it can be driven from host tests.
+ */
+class RefreshScheduler {
+ public:
+  enum Waveform {
+    PARTIAL,  // Differential update of the changed pixels only
+    FAST,     // Whole-panel fast waveform
+    FULL      // Full waveform, clears ghosting
+  };
+
+  struct Config {
+    uint16_t fullBudgetPercent = 100;       // Per-tile flips (% of tile pixels) forcing a full refresh
+    uint16_t fastFramePercent = 10;         // Flips in one frame (% of panel pixels) selecting FAST
+    uint16_t maxRefreshesBetweenFull = 40;  // Full refresh at the latest after this many updates
+  };
+
+  // Tiles are 80x80 pixels (10 bytes wide)
+  static constexpr uint16_t kTileWidthBytes = 10;
+  static constexpr uint16_t kTileHeight = 80;
+  static constexpr int kMaxTiles = 64;
+
+  RefreshScheduler(uint16_t widthBytes, uint16_t height);
+
+  void setConfig(const Config& config) {
+    config_ = config;
+  }
+  const Config& getConfig() const {
+    return config_;
+  }
+
+  // Charge the flips between `oldFrame` (on the panel) and `newFrame` to the
+  // tiles and suggest a waveform. Only rows/bytes inside `dirty` are scanned.
+  Waveform assess(const uint8_t* oldFrame, const uint8_t* newFrame, const DirtyRegion& dirty);
+  // Record the waveform actually used; FULL clears the budget.
+  void onRefresh(Waveform waveform);
+  void reset();
+
+  // Highest accumulated tile flips as a percentage of the tile's pixels
+  uint32_t getMaxTileBudgetPercent() const;
+  uint32_t getLastFrameFlips() const {
+    return lastFrameFlips_;
+  }
+  uint16_t getRefreshesSinceFull() const {
+    return refreshesSinceFull_;
+  }
+
+ private:
+  uint32_t tilePixels(int tile) const;
+
+  uint16_t widthBytes_;
+  uint16_t height_;
+  int tilesX_;
+  int tilesY_;
+  Config config_;
+  uint32_t tileFlips_[kMaxTiles];
+  uint32_t lastFrameFlips_ = 0;
+  uint16_t refreshesSinceFull_ = 0;
+};
+
+#endif
@@ -0,0 +1,135 @@
+#include "GlyphCache.h"
+
+#include <cstdlib>
+
+GlyphCache::~GlyphCache() {
+  release();
+}
+
+bool GlyphCache::configure(uint16_t slotBytes, uint16_t slotCount) {
+  release();
+  if (slotBytes == 0 || slotCount == 0 || slotCount == kNone) {
+    return false;
+  }
+  uint16_t buckets = 1;
+  while (buckets < slotCount && buckets < 0x8000) {
+    buckets = (uint16_t)(buckets << 1);
+  }
+
+  // keys, then the 16-bit arrays, then the arena (keeps every array aligned)
+  const size_t keyBytes = (size_t)slotCount * sizeof(uint32_t);
+  const size_t linkBytes = ((size_t)slotCount * 3 + buckets) * sizeof(uint16_t);
+  block_ = malloc(keyBytes + linkBytes + (size_t)slotBytes * slotCount);
+  if (!block_) {
+    return false;
+  }
+  keys_ = static_cast<uint32_t*>(block_);
+  prev_ = reinterpret_cast<uint16_t*>(keys_ + slotCount);
+  next_ = prev_ + slotCount;
+  chain_ = next_ + slotCount;
+  buckets_ = chain_ + slotCount;
+  arena_ = reinterpret_cast<uint8_t*>(buckets_ + buckets);
+  slotBytes_ = slotBytes;
+  slotCount_ = slotCount;
+  bucketMask_ = (uint16_t)(buckets - 1);
+  clear();
+  return true;
+}
+
+void GlyphCache::release() {
+  free(block_);
+  block_ = nullptr;
+  keys_ = nullptr;
+  prev_ = next_ = chain_ = buckets_ = nullptr;
+  arena_ = nullptr;
+  slotBytes_ = 0;
+  slotCount_ = 0;
+  bucketMask_ = 0;
+  clear();
+}
+
+void GlyphCache::clear() {
+  if (buckets_) {
+    for (uint32_t b = 0; b <= bucketMask_; ++b) {
+      buckets_[b] = kNone;
+    }
+  }
+  used_ = 0;
+  head_ = kNone;
+  tail_ = kNone;
+}
+
+uint8_t* GlyphCache::find(uint32_t key) {
+  if (slotCount_ == 0) {
+    return nullptr;
+  }
+  for (uint16_t slot = buckets_[bucketOf(key)]; slot != kNone; slot = chain_[slot]) {
+    if (keys_[slot] == key) {
+      if (slot != head_) {
+        unlinkLru(slot);
+        pushFront(slot);
+      }
+      ++hits_;
+      return &arena_[(size_t)slot * slotBytes_];
+    }
+  }
+  ++misses_;
+  return nullptr;
+}
+
+uint8_t* GlyphCache::insert(uint32_t key) {
+  if (slotCount_ == 0) {
+    return nullptr;
+  }
+  uint16_t slot;
+  if (used_ < slotCount_) {
+    slot = used_++;
+  } else {
+    slot = tail_;
+    unlinkLru(slot);
+    unlinkChain(slot);
+    ++evictions_;
+  }
+  keys_[slot] = key;
+  const uint16_t bucket = bucketOf(key);
+  chain_[slot] = buckets_[bucket];
+  buckets_[bucket] = slot;
+  pushFront(slot);
+  return &arena_[(size_t)slot * slotBytes_];
+}
+
+void GlyphCache::unlinkLru(uint16_t slot) {
+  if (prev_[slot] != kNone) {
+    next_[prev_[slot]] = next_[slot];
+  } else {
+    head_ = next_[slot];
+  }
+  if (next_[slot] != kNone) {
+    prev_[next_[slot]] = prev_[slot];
+  } else {
+    tail_ = prev_[slot];
+  }
+}
+
+void GlyphCache::pushFront(uint16_t slot) {
+  prev_[slot] = kNone;
+  next_[slot] = head_;
+  if (head_ != kNone) {
+    prev_[head_] = slot;
+  }
+  head_ = slot;
+  if (tail_ == kNone) {
+    tail_ = slot;
+  }
+}
+
+void GlyphCache::unlinkChain(uint16_t slot) {
+  uint16_t* link = &buckets_[bucketOf(keys_[slot])];
+  while (*link != kNone) {
+    if (*link == slot) {
+      *link = chain_[slot];
+      return;
+    }
+    link = &chain_[*link];
+  }
+}
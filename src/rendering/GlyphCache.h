@@ -0,0 +1,82 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <cstdint>
+
+/**
+ * Fixed-size LRU cache of glyph bitmaps for fonts that are not in flash.
+ *
+ * The arena is `slotCount` slots of `slotBytes` each, allocated in one block
+ * by configure() (malloc, so running out of memory is a return value rather
+ * than a panic); entries are keyed by glyph index. Lookups go through a small
+ * chained hash table and hits are moved to the front of an intrusive LRU
+ * list, so both are O(1) and nothing is allocated while drawing.
+ */
+class GlyphCache {
+ public:
+  GlyphCache() = default;
+  ~GlyphCache();
+  GlyphCache(const GlyphCache&) = delete;
+  GlyphCache& operator=(const GlyphCache&) = delete;
+
+  // Allocate the arena. Returns false when the memory is not available.
+  bool configure(uint16_t slotBytes, uint16_t slotCount);
+  void release();
+  // Drop every entry but keep the arena
+  void clear();
+
+  // Cached bytes for `key` (made most recently used), or nullptr
+  uint8_t* find(uint32_t key);
+  // Slot to fill for `key`, evicting the least recently used entry. `key`
+  // must not be cached already.
+  uint8_t* insert(uint32_t key);
+
+  uint16_t getSlotBytes() const {
+    return slotBytes_;
+  }
+  uint16_t getSlotCount() const {
+    return slotCount_;
+  }
+  uint32_t getHits() const {
+    return hits_;
+  }
+  uint32_t getMisses() const {
+    return misses_;
+  }
+  uint32_t getEvictions() const {
+    return evictions_;
+  }
+  void resetStats() {
+    hits_ = misses_ = evictions_ = 0;
+  }
+
+ private:
+  static constexpr uint16_t kNone = 0xFFFF;
+
+  uint16_t bucketOf(uint32_t key) const {
+    return (uint16_t)((key * 2654435761u) >> 16) & bucketMask_;
+  }
+  void unlinkLru(uint16_t slot);
+  void pushFront(uint16_t slot);
+  void unlinkChain(uint16_t slot);
+
+  // Views into the single allocation `block_`
+  void* block_ = nullptr;
+  uint32_t* keys_ = nullptr;
+  uint16_t* prev_ = nullptr;  // LRU list, most recent at head_
+  uint16_t* next_ = nullptr;
+  uint16_t* chain_ = nullptr;  // next slot in the same hash bucket
+  uint16_t* buckets_ = nullptr;
+  uint8_t* arena_ = nullptr;
+  uint16_t bucketMask_ = 0;
+  uint16_t slotBytes_ = 0;
+  uint16_t slotCount_ = 0;
+  uint16_t used_ = 0;
+  uint16_t head_ = kNone;
+  uint16_t tail_ = kNone;
+  uint32_t hits_ = 0;
+  uint32_t misses_ = 0;
+  uint32_t evictions_ = 0;
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include "GlyphRle.h"
+
+namespace {
+
+// Nibble sink that only counts when there is no output buffer
+struct NibbleWriter {
+  uint8_t* out;
+  size_t nibbles = 0;
+
+  void put(uint8_t v) {
+    if (out) {
+      if ((nibbles & 1) == 0) {
+        out[nibbles >> 1] = (uint8_t)(v << 4);
+      } else {
+        out[nibbles >> 1] |= v;
+      }
+    }
+    ++nibbles;
+  }
+};
+
+void putRun(NibbleWriter& w, uint8_t symbol, int length) {
+  while (length > 0) {
+    if (symbol == GlyphRle::kSymbolWhite && length <= GlyphRle::kMaxWhiteRun) {
+      w.put((uint8_t)(length - 1));
+      return;
+    }
+    if (symbol == GlyphRle::kSymbolBlack && length <= GlyphRle::kMaxBlackRun) {
+      w.put((uint8_t)(7 + length));
+      return;
+    }
+    if (length == 1 && symbol == GlyphRle::kSymbolLightGray) {
+      w.put(12);
+      return;
+    }
+    if (length == 1 && symbol == GlyphRle::kSymbolGray) {
+      w.put(13);
+      return;
+    }
+    if (length == 1 && symbol == GlyphRle::kSymbolDarkGray) {
+      w.put(14);
+      return;
+    }
+    const int n = length < GlyphRle::kMaxEscapeRun ? length : GlyphRle::kMaxEscapeRun;
+    const uint8_t v = (uint8_t)((symbol << 5) | (n - 1));
+    w.put(GlyphRle::kEscape);
+    w.put((uint8_t)(v >> 4));
+    w.put((uint8_t)(v & 0x0F));
+    length -= n;
+  }
+}
+
+}  // namespace
+
+size_t GlyphRle::encodeGlyph(const uint8_t* bw, const uint8_t* lsb, const uint8_t* msb, uint8_t width, uint8_t height,
+                             uint8_t* out) {
+  NibbleWriter w{out};
+  const int stride = (width + 7) / 8;
+  int runSymbol = -1;
+  int runLength = 0;
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      const int i = y * stride + x / 8;
+      const int bit = 7 - (x & 7);
+      // Missing gray planes read as 0 so BW-only glyphs use the white and
+      // black codes; FONT_BITMAP_RLE_BW fonts never draw gray planes.
+      const uint8_t symbol = (uint8_t)((((bw[i] >> bit) & 1) << 2) | ((msb ? (msb[i] >> bit) & 1 : 0) << 1) |
+                                       (lsb ? (lsb[i] >> bit) & 1 : 0));
+      if (symbol == runSymbol) {
+        ++runLength;
+        continue;
+      }
+      if (runLength > 0) {
+        putRun(w, (uint8_t)runSymbol, runLength);
+      }
+      runSymbol = symbol;
+      runLength = 1;
+    }
+  }
+  if (runLength > 0) {
+    putRun(w, (uint8_t)runSymbol, runLength);
+  }
+  return (w.nibbles + 1) / 2;
+}
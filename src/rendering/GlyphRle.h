@@ -0,0 +1,83 @@
+#ifndef GLYPH_RLE_H
+#define GLYPH_RLE_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Run-length coded glyph bitmaps (SimpleGFXfont::bitmapFormat FONT_BITMAP_RLE_*).
+ *
+ * Every pixel gets a 3-bit symbol from its raw bits in the three planar
+ * bitmaps, (bw << 2) | (msb << 1) | lsb, where 0 bits mean "on" as in the
+ * planar format. A glyph's pixels are coded row-major without row padding as
+ * runs of one symbol, packed into nibbles (high nibble first). Each glyph
+ * starts on a byte boundary at its bitmapOffset.
+ *
+ *   0x0-0x7  white run (symbol 4) of 1-8 pixels
+ *   0x8-0xB  black run (symbol 0) of 1-4 pixels
+ *   0xC      one light gray pixel (symbol 5)
+ *   0xD      one gray pixel (symbol 2)
+ *   0xE      one dark gray pixel (symbol 3)
+ *   0xF      escape: the next two nibbles are (symbol << 5) | (length - 1)
+ *
+ * The short codes cover the five pixel classes generate_simplefont emits and
+ * the run lengths that dominate at reading sizes, so a font takes a little
+ * under half the bytes of its three planes.
+ */
+class GlyphRle {
+ public:
+  static constexpr uint8_t kSymbolBlack = 0;
+  static constexpr uint8_t kSymbolGray = 2;
+  static constexpr uint8_t kSymbolDarkGray = 3;
+  static constexpr uint8_t kSymbolWhite = 4;
+  static constexpr uint8_t kSymbolLightGray = 5;
+
+  static constexpr uint8_t kMaxWhiteRun = 8;
+  static constexpr uint8_t kMaxBlackRun = 4;
+  static constexpr uint8_t kMaxEscapeRun = 32;
+  static constexpr uint8_t kEscape = 0xF;
+
+  // Encode one glyph from planar bitmaps. `lsb`/`msb` may be null for fonts
+  // without grayscale (FONT_BITMAP_RLE_BW). Writes to `out` when non-null and
+  // returns the number of bytes.
+  static size_t encodeGlyph(const uint8_t* bw, const uint8_t* lsb, const uint8_t* msb, uint8_t width, uint8_t height,
+                            uint8_t* out);
+};
+
+// Sequential run decoder over one glyph's stream
+class GlyphRleReader {
+ public:
+  explicit GlyphRleReader(const uint8_t* data) : p_(data) {}
+
+  // Next run of `length` pixels with `symbol`
+  void next(uint8_t& symbol, uint8_t& length) {
+    // (symbol << 5) | (length - 1) of the short codes
+    static const uint8_t kShortCodes[15] = {0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+                                            0x00, 0x01, 0x02, 0x03, 0xA0, 0x40, 0x60};
+    const uint8_t code = nibble();
+    uint8_t v;
+    if (code != GlyphRle::kEscape) {
+      v = kShortCodes[code];
+    } else {
+      const uint8_t hi = nibble();
+      v = (uint8_t)((hi << 4) | nibble());
+    }
+    symbol = (uint8_t)(v >> 5);
+    length = (uint8_t)((v & 0x1F) + 1);
+  }
+
+ private:
+  uint8_t nibble() {
+    if (high_) {
+      high_ = false;
+      return (uint8_t)(*p_ >> 4);
+    }
+    high_ = true;
+    return (uint8_t)(*p_++ & 0x0F);
+  }
+
+  const uint8_t* p_;
+  bool high_ = true;
+};
+
+#endif
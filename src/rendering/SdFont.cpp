@@ -0,0 +1,265 @@
+#include "SdFont.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#pragma pack(push, 1)
+struct SdFontHeaderPacked {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t bitmapFormat;
+  uint8_t yAdvance;
+  uint8_t size;
+  uint8_t style;
+  uint8_t reserved1[3];
+  uint32_t glyphCount;
+  uint32_t glyphTableOffset;
+  uint32_t dataOffset;
+  uint32_t dataSize;
+  uint16_t maxGlyphBytes;
+  uint16_t kernIndexCount;  // 0 = no kerning table
+  char name[32];
+};
+
+struct SdFontGlyphPacked {
+  uint32_t codepoint;
+  uint32_t dataOffset;  // relative to the data section
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+  uint8_t reserved[3];
+};
+#pragma pack(pop)
+
+static_assert(sizeof(SdFontHeaderPacked) == 64, "SD font header layout");
+static_assert(sizeof(SdFontGlyphPacked) == 16, "SD font glyph layout");
+
+SdFont::SdFont(size_t cacheBytes) : cacheBytes_(cacheBytes) {
+  name_[0] = '\0';
+}
+
+SdFont::~SdFont() {
+  close();
+}
+
+bool SdFont::open(const char* path) {
+  close();
+
+  file_ = SD.open(path, FILE_READ);
+  if (!file_) {
+    Serial.printf("SdFont: cannot open %s\n", path);
+    return false;
+  }
+
+  SdFontHeaderPacked hdr{};
+  if (!file_.seek(0) || file_.read(reinterpret_cast<uint8_t*>(&hdr), sizeof(hdr)) != sizeof(hdr)) {
+    close();
+    return false;
+  }
+  const bool rle = hdr.bitmapFormat == FONT_BITMAP_RLE_BW || hdr.bitmapFormat == FONT_BITMAP_RLE_GRAY;
+  // GLYPH_INDEX_NONE is reserved, hence the strict bound on glyphCount
+  if (hdr.magic != kMagic || hdr.version != kVersion || !rle || hdr.glyphCount == 0 ||
+      hdr.glyphCount >= GLYPH_INDEX_NONE || hdr.style > (uint8_t)FontStyle::BOLD_ITALIC) {
+    Serial.printf("SdFont: %s is not a supported font file\n", path);
+    close();
+    return false;
+  }
+
+  const uint32_t blocks = ((hdr.glyphCount - 1) >> kBlockShift) + 1;
+  glyphs_ = static_cast<SimpleGFXglyph*>(malloc(hdr.glyphCount * sizeof(SimpleGFXglyph)));
+  blockBase_ = static_cast<uint32_t*>(malloc(blocks * sizeof(uint32_t)));
+  if (!glyphs_ || !blockBase_) {
+    Serial.printf("SdFont: out of memory for %u glyphs\n", (unsigned)hdr.glyphCount);
+    close();
+    return false;
+  }
+
+  font_.glyphCount = (uint16_t)hdr.glyphCount;
+  dataOffset_ = hdr.dataOffset;
+  dataSize_ = hdr.dataSize;
+  if (!readGlyphTable(hdr.glyphTableOffset, hdr.dataSize)) {
+    Serial.printf("SdFont: bad glyph table in %s\n", path);
+    close();
+    return false;
+  }
+
+  const uint32_t kerningOffset = hdr.glyphTableOffset + hdr.glyphCount * (uint32_t)sizeof(SdFontGlyphPacked);
+  if (hdr.kernIndexCount > 0 && !readKerning(kerningOffset, hdr.kernIndexCount)) {
+    Serial.printf("SdFont: bad kerning table in %s\n", path);
+    close();
+    return false;
+  }
+
+  // One slot holds the largest glyph; the header's value is only a hint
+  uint32_t maxGlyphBytes = 1;
+  for (uint16_t i = 0; i < font_.glyphCount; ++i) {
+    const uint32_t end = i + 1 < font_.glyphCount ? glyphDataOffset(i + 1) : dataSize_;
+    const uint32_t bytes = end - glyphDataOffset(i);
+    maxGlyphBytes = bytes > maxGlyphBytes ? bytes : maxGlyphBytes;
+  }
+  if (maxGlyphBytes > 0xFFFF) {
+    close();
+    return false;
+  }
+  size_t slots = cacheBytes_ / maxGlyphBytes;
+  slots = slots < 4 ? 4 : (slots > 0xFFFE ? 0xFFFE : slots);
+  if (!cache_.configure((uint16_t)maxGlyphBytes, (uint16_t)slots)) {
+    Serial.printf("SdFont: out of memory for glyph cache (%u x %u bytes)\n", (unsigned)slots,
+                  (unsigned)maxGlyphBytes);
+    close();
+    return false;
+  }
+
+  for (int i = 0; i < 256; ++i) {
+    latin1Index_[i] = GLYPH_INDEX_NONE;
+  }
+  for (uint16_t i = 0; i < font_.glyphCount && glyphs_[i].codepoint < 256; ++i) {
+    latin1Index_[glyphs_[i].codepoint] = i;
+  }
+
+  memcpy(name_, hdr.name, sizeof(name_));
+  name_[sizeof(name_) - 1] = '\0';
+
+  font_.bitmap = nullptr;
+  font_.bitmap_gray_lsb = nullptr;
+  font_.bitmap_gray_msb = nullptr;
+  font_.glyph = glyphs_;
+  font_.yAdvance = hdr.yAdvance;
+  font_.name = name_;
+  font_.size = hdr.size;
+  font_.style = (FontStyle)hdr.style;
+  font_.latin1Index = latin1Index_;
+  font_.bitmapFormat = (FontBitmapFormat)hdr.bitmapFormat;
+  font_.bitmapSource = this;
+  font_.kerning = kerningBlock_ ? &kerning_ : nullptr;
+  bytesRead_ = 0;
+  isOpen_ = true;
+  return true;
+}
+
+bool SdFont::readGlyphTable(uint32_t tableOffset, uint32_t dataSize) {
+  if (!file_.seek(tableOffset)) {
+    return false;
+  }
+  // Read the table in chunks; one entry per read is slow on SD
+  SdFontGlyphPacked chunk[32];
+  uint32_t prevCodepoint = 0;
+  uint32_t prevOffset = 0;
+  for (uint32_t i = 0; i < font_.glyphCount;) {
+    uint32_t n = font_.glyphCount - i;
+    n = n < 32 ? n : 32;
+    const size_t want = n * sizeof(SdFontGlyphPacked);
+    if (file_.read(reinterpret_cast<uint8_t*>(chunk), want) != want) {
+      return false;
+    }
+    for (uint32_t k = 0; k < n; ++k, ++i) {
+      const SdFontGlyphPacked& e = chunk[k];
+      // findGlyphIndex needs strictly sorted codepoints and glyph sizes come
+      // from the next offset, so both must increase
+      if ((i > 0 && e.codepoint <= prevCodepoint) || e.dataOffset < prevOffset || e.dataOffset > dataSize) {
+        return false;
+      }
+      if ((i & ((1u << kBlockShift) - 1)) == 0) {
+        blockBase_[i >> kBlockShift] = e.dataOffset;
+      }
+      const uint32_t relative = e.dataOffset - blockBase_[i >> kBlockShift];
+      if (relative > 0xFFFF) {
+        return false;
+      }
+      SimpleGFXglyph& g = glyphs_[i];
+      g.bitmapOffset = (uint16_t)relative;
+      g.codepoint = e.codepoint;
+      g.width = e.width;
+      g.height = e.height;
+      g.xAdvance = e.xAdvance;
+      g.xOffset = e.xOffset;
+      g.yOffset = e.yOffset;
+      prevCodepoint = e.codepoint;
+      prevOffset = e.dataOffset;
+    }
+  }
+  return true;
+}
+
+bool SdFont::readKerning(uint32_t offset, uint16_t indexCount) {
+  if (indexCount > font_.glyphCount) {
+    return false;
+  }
+  uint16_t pairCount = 0;
+  const size_t indexBytes = ((size_t)indexCount + 1) * sizeof(uint16_t);
+  // The last range start is the pair count; read it first to size the block
+  if (!file_.seek(offset + indexBytes - sizeof(uint16_t)) ||
+      file_.read(reinterpret_cast<uint8_t*>(&pairCount), sizeof(pairCount)) != sizeof(pairCount)) {
+    return false;
+  }
+  const size_t blockBytes = indexBytes + (size_t)pairCount * (sizeof(uint16_t) + sizeof(int8_t));
+  kerningBlock_ = malloc(blockBytes);
+  if (!kerningBlock_) {
+    return false;
+  }
+  uint16_t* index = static_cast<uint16_t*>(kerningBlock_);
+  uint16_t* second = index + indexCount + 1;
+  int8_t* adjust = reinterpret_cast<int8_t*>(second + pairCount);
+  if (!file_.seek(offset) ||
+      file_.read(static_cast<uint8_t*>(kerningBlock_), blockBytes) != blockBytes) {
+    return false;
+  }
+  // getKerning trusts the ranges, so check them once here
+  for (uint16_t i = 0; i < indexCount; ++i) {
+    if (index[i] > index[i + 1]) {
+      return false;
+    }
+  }
+  if (index[0] != 0) {
+    return false;
+  }
+  kerning_.index = index;
+  kerning_.second = second;
+  kerning_.adjust = adjust;
+  kerning_.indexCount = indexCount;
+  return true;
+}
+
+void SdFont::close() {
+  if (file_) {
+    file_.close();
+  }
+  isOpen_ = false;
+  cache_.release();
+  free(glyphs_);
+  glyphs_ = nullptr;
+  free(blockBase_);
+  blockBase_ = nullptr;
+  free(kerningBlock_);
+  kerningBlock_ = nullptr;
+  kerning_ = SimpleGFXkerning{};
+  font_ = SimpleGFXfont{};
+  dataOffset_ = 0;
+  dataSize_ = 0;
+  name_[0] = '\0';
+}
+
+const uint8_t* SdFont::getGlyphBitmap(uint16_t glyphIndex) {
+  if (!isOpen_ || glyphIndex >= font_.glyphCount) {
+    return nullptr;
+  }
+  const uint8_t* cached = cache_.find(glyphIndex);
+  if (cached) {
+    return cached;
+  }
+
+  const uint32_t start = glyphDataOffset(glyphIndex);
+  const uint32_t end = glyphIndex + 1 < font_.glyphCount ? glyphDataOffset(glyphIndex + 1) : dataSize_;
+  const size_t bytes = end - start;
+  uint8_t* slot = cache_.insert(glyphIndex);
+  if (!file_.seek(dataOffset_ + start) || file_.read(slot, bytes) != bytes) {
+    // The slot is already keyed to this glyph; drop everything rather than
+    // serve a half-read bitmap later
+    cache_.clear();
+    return nullptr;
+  }
+  bytesRead_ += bytes;
+  return slot;
+}
@@ -0,0 +1,89 @@
+#ifndef SD_FONT_H
+#define SD_FONT_H
+
+#include <Arduino.h>
+#include <SD.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "GlyphCache.h"
+#include "SimpleFont.h"
+
+/**
+ * Font loaded at runtime from a binary font file (.mrf) on the SD card.
+ *
+ * File layout (little endian, written by generate_simplefont --binary-out):
+ *   header       64 bytes, see SdFontHeaderPacked in SdFont.cpp
+ *   glyph table  glyphCount x 16 bytes: codepoint, data offset and the
+ *                SimpleGFXglyph metrics, sorted by codepoint
+ *   kerning      optional SimpleGFXkerning arrays: index (kernIndexCount + 1
+ *                x u16), second glyph (u16) and adjustment (i8) per pair
+ *   data         run-length coded glyph bitmaps (GlyphRle.h), contiguous in
+ *                glyph order
+ *
+ * open() keeps the glyph metrics resident (16 bytes per glyph plus a Latin-1
+ * index) so layout never touches the card. Bitmaps are read only when a
+ * glyph is drawn and kept in a GlyphCache of fixed size, so RAM stays bounded
+ * for fonts with tens of thousands of glyphs (CJK).
+ */
+class SdFont : public GlyphBitmapSource {
+ public:
+  static constexpr size_t kDefaultCacheBytes = 8 * 1024;
+  static constexpr uint32_t kMagic = 0x0046524D;  // "MRF\0"
+  static constexpr uint8_t kVersion = 1;
+
+  explicit SdFont(size_t cacheBytes = kDefaultCacheBytes);
+  ~SdFont() override;
+  SdFont(const SdFont&) = delete;
+  SdFont& operator=(const SdFont&) = delete;
+
+  bool open(const char* path);
+  void close();
+  bool isOpen() const {
+    return isOpen_;
+  }
+
+  // Font to hand to TextRenderer / FontFamily; nullptr until opened
+  const SimpleGFXfont* getFont() const {
+    return isOpen_ ? &font_ : nullptr;
+  }
+
+  const uint8_t* getGlyphBitmap(uint16_t glyphIndex) override;
+
+  const GlyphCache& getCache() const {
+    return cache_;
+  }
+  // Bitmap bytes read from the card since open()
+  uint32_t getBytesRead() const {
+    return bytesRead_;
+  }
+
+ private:
+  // Glyph bitmap offsets are stored as 16 bits in SimpleGFXglyph::bitmapOffset,
+  // relative to the start of their block of 2^kBlockShift glyphs.
+  static constexpr uint8_t kBlockShift = 6;
+
+  bool readGlyphTable(uint32_t tableOffset, uint32_t dataSize);
+  bool readKerning(uint32_t offset, uint16_t indexCount);
+  uint32_t glyphDataOffset(uint16_t glyphIndex) const {
+    return blockBase_[glyphIndex >> kBlockShift] + glyphs_[glyphIndex].bitmapOffset;
+  }
+
+  File file_;
+  bool isOpen_ = false;
+  size_t cacheBytes_;
+  SimpleGFXfont font_{};
+  SimpleGFXglyph* glyphs_ = nullptr;
+  uint32_t* blockBase_ = nullptr;  // data offset of each block's first glyph
+  SimpleGFXkerning kerning_{};
+  void* kerningBlock_ = nullptr;  // backs the kerning_ arrays
+  uint32_t dataOffset_ = 0;
+  uint32_t dataSize_ = 0;
+  uint16_t latin1Index_[256];
+  char name_[32];
+  GlyphCache cache_;
+  uint32_t bytesRead_ = 0;
+};
+
+#endif
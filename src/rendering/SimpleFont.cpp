@@ -1,8 +1,74 @@
 #include "SimpleFont.h"
 
+namespace {
+
+// Lazily built Latin-1 tables for fonts generated without one. A book uses
+// one family (four styles) plus the menu fonts, so a handful of slots keeps
+// every active font resident.
+constexpr int kLatin1Slots = 6;
+
+struct Latin1Slot {
+  const SimpleGFXfont* font;
+  uint16_t index[256];
+};
+
+Latin1Slot g_latin1Slots[kLatin1Slots];
+int g_latin1NextSlot = 0;
+const SimpleGFXfont* g_lastLatin1Font = nullptr;
+const uint16_t* g_lastLatin1Index = nullptr;
+
+const uint16_t* getLatin1Index(const SimpleGFXfont* font) {
+  if (font->latin1Index) {
+    return font->latin1Index;
+  }
+  if (font == g_lastLatin1Font) {
+    return g_lastLatin1Index;
+  }
+
+  Latin1Slot* slot = nullptr;
+  for (int i = 0; i < kLatin1Slots; ++i) {
+    if (g_latin1Slots[i].font == font) {
+      slot = &g_latin1Slots[i];
+      break;
+    }
+  }
+
+  if (!slot) {
+    slot = &g_latin1Slots[g_latin1NextSlot];
+    g_latin1NextSlot = (g_latin1NextSlot + 1) % kLatin1Slots;
+    slot->font = font;
+    for (int i = 0; i < 256; ++i) {
+      slot->index[i] = GLYPH_INDEX_NONE;
+    }
+    // Glyphs are sorted by codepoint, so the Latin-1 range is a prefix
+    for (uint16_t i = 0; i < font->glyphCount && font->glyph[i].codepoint < 256; ++i) {
+      slot->index[font->glyph[i].codepoint] = i;
+    }
+  }
+
+  g_lastLatin1Font = font;
+  g_lastLatin1Index = slot->index;
+  return slot->index;
+}
+
+}  // namespace
+
+int findGlyphIndex(const SimpleGFXfont* font, uint32_t codepoint) {
+  if (!font || !font->glyph || font->glyphCount == 0) {
+    return -1;
+  }
+
+  if (codepoint < 256) {
+    const uint16_t idx = getLatin1Index(font)[codepoint];
+    return idx == GLYPH_INDEX_NONE ? -1 : (int)idx;
+  }
+
+  return findGlyphIndexSearch(font, codepoint);
+}
+
 // Helper to find a glyph index by codepoint using binary search
 // The glyph array must be sorted by codepoint
-int findGlyphIndex(const SimpleGFXfont* font, uint32_t codepoint) {
+int findGlyphIndexSearch(const SimpleGFXfont* font, uint32_t codepoint) {
   if (!font || !font->glyph || font->glyphCount == 0) {
     return -1;
   }
@@ -26,6 +92,24 @@ int findGlyphIndex(const SimpleGFXfont* font, uint32_t codepoint) {
   return -1;  // Not found
 }
 
+int getKerning(const SimpleGFXfont* font, uint16_t first, uint16_t second) {
+  const SimpleGFXkerning* k = font->kerning;
+  if (!k || first >= k->indexCount) {
+    return 0;
+  }
+  uint16_t low = k->index[first];
+  uint16_t high = k->index[first + 1];
+  while (low < high) {
+    const uint16_t mid = (uint16_t)((low + high) >> 1);
+    if (k->second[mid] < second) {
+      low = (uint16_t)(mid + 1);
+    } else {
+      high = mid;
+    }
+  }
+  return (low < k->index[first + 1] && k->second[low] == second) ? k->adjust[low] : 0;
+}
+
 // Helper to get a font variant from a family (returns nullptr if not available)
 const SimpleGFXfont* getFontVariant(const FontFamily* family, FontStyle style) {
   if (!family) {
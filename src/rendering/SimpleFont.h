@@ -5,6 +5,22 @@
 // Enum for font styles (expandable for future styles)
 enum class FontStyle { REGULAR = 0, BOLD, ITALIC, BOLD_ITALIC, HIDDEN };
 
+// Glyph bitmap encoding (SimpleGFXfont::bitmapFormat)
+enum FontBitmapFormat : uint8_t {
+  FONT_BITMAP_PLANES = 0,  ///< 1-bit planes: bitmap (BW) plus optional gray lsb/msb
+  FONT_BITMAP_RLE_BW,      ///< Run-length coded (GlyphRle.h) in bitmap, no grayscale
+  FONT_BITMAP_RLE_GRAY     ///< Run-length coded with gray levels, gray pointers unused
+};
+
+// Supplies glyph bitmaps that are not in flash (fonts loaded from SD). The
+// returned bytes hold one glyph in the font's bitmapFormat and stay valid
+// until the next call; nullptr when the glyph cannot be read.
+class GlyphBitmapSource {
+ public:
+  virtual ~GlyphBitmapSource() = default;
+  virtual const uint8_t* getGlyphBitmap(uint16_t glyphIndex) = 0;
+};
+
 // Minimal font struct used by our TextRenderer
 typedef struct {
   uint16_t bitmapOffset;  ///< Pointer into font->bitmap
@@ -16,6 +32,16 @@ typedef struct {
   int8_t yOffset;    ///< Y dist from cursor pos to UL corner
 } SimpleGFXglyph;
 
+// Kerning pairs of a font, sorted by (first, second) glyph index. The pairs
+// of first glyph i are [index[i], index[i + 1]); glyphs from indexCount on
+// have none, so fonts only pay for the range that is actually kerned.
+typedef struct {
+  const uint16_t* index;   ///< indexCount + 1 range starts into second/adjust
+  const uint16_t* second;  ///< Second glyph index of each pair, ascending per range
+  const int8_t* adjust;    ///< Added to the first glyph's advance (pixels)
+  uint16_t indexCount;     ///< First glyphs covered by `index`
+} SimpleGFXkerning;
+
 typedef struct {
   const uint8_t* bitmap;           ///< Glyph bitmaps, concatenated
   const uint8_t* bitmap_gray_lsb;  ///< Glyph bitmaps, concatenated
@@ -27,8 +53,21 @@ typedef struct {
   const char* name;  ///< Font name (e.g., "NotoSans")
   uint8_t size;      ///< Font size in points (for reference)
   FontStyle style;   ///< Style of this font variant
+  // Optional 256-entry codepoint -> glyph index table for ASCII/Latin-1
+  // (GLYPH_INDEX_NONE = not in font). Emitted by generate_simplefont; built
+  // lazily at first use for fonts that don't carry one.
+  const uint16_t* latin1Index;
+  // Encoding of `bitmap`; fonts written before compression default to planes
+  FontBitmapFormat bitmapFormat;
+  // Runtime fonts fetch glyph bitmaps through this instead of `bitmap`
+  GlyphBitmapSource* bitmapSource;
+  // Optional kerning pairs (nullptr = advances only)
+  const SimpleGFXkerning* kerning;
 } SimpleGFXfont;
 
+// Marks a missing glyph in SimpleGFXfont::latin1Index
+constexpr uint16_t GLYPH_INDEX_NONE = 0xFFFF;
+
 // New: Font family struct to group style variants
 typedef struct {
   const char* familyName;           ///< Name of the font family (e.g., "NotoSans")
@@ -38,9 +77,17 @@ typedef struct {
   const SimpleGFXfont* boldItalic;  ///< Bold-italic variant (optional)
 } FontFamily;
 
-// Helper to find a glyph index by codepoint using binary search
+// Helper to find a glyph index by codepoint. Codepoints below 256 are a
+// single table load; everything else uses binary search.
 // Returns -1 if the glyph is not found
 int findGlyphIndex(const SimpleGFXfont* font, uint32_t codepoint);
 
+// Binary search over the whole glyph array (fallback of findGlyphIndex)
+int findGlyphIndexSearch(const SimpleGFXfont* font, uint32_t codepoint);
+
+// Advance adjustment for glyph `second` following glyph `first`: a binary
+// search over the pairs of `first`, 0 when the font has no such pair
+int getKerning(const SimpleGFXfont* font, uint16_t first, uint16_t second);
+
 // Helper to get a font variant from a family (returns nullptr if not available)
 const SimpleGFXfont* getFontVariant(const FontFamily* family, FontStyle style);
@@ -3,6 +3,7 @@
 #include <cstring>
 
 #include "../core/EInkDisplay.h"
+#include "GlyphRle.h"
 #include "SimpleFont.h"
 
 static constexpr int GLYPH_PADDING = 0;
@@ -63,6 +64,7 @@ static uint32_t decodeUtf8Codepoint(const unsigned char*& p) {
 }
 
 TextRenderer::TextRenderer(EInkDisplay& display) : display(display) {
+  invalidateWidthCache();
   Serial.printf("[%lu] TextRenderer: Constructor called\n", millis());
 }
 
@@ -117,6 +119,8 @@ void TextRenderer::drawPixel(int16_t x, int16_t y, bool state) {
   uint16_t byteIndex = rotatedY * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
   uint8_t bitPosition = 7 - (rotatedX % 8);  // MSB first
 
+  markDirty(rotatedX / 8, rotatedX / 8, rotatedY, rotatedY);
+
   // Set or clear the bit
   if (state) {
     frameBuffer[byteIndex] &= ~(1 << bitPosition);  // Clear bit
@@ -125,6 +129,15 @@ void TextRenderer::drawPixel(int16_t x, int16_t y, bool state) {
   }
 }
 
+void TextRenderer::markDirty(int byte0, int byte1, int y0, int y1) {
+  DirtyRegion r;
+  r.x = (uint16_t)(byte0 * 8);
+  r.y = (uint16_t)y0;
+  r.w = (uint16_t)((byte1 - byte0 + 1) * 8);
+  r.h = (uint16_t)(y1 - y0 + 1);
+  dirtyRegion.unite(r);
+}
+
 void TextRenderer::setFrameBuffer(uint8_t* buffer) {
   frameBuffer = buffer;
 }
@@ -133,6 +146,11 @@ void TextRenderer::setBitmapType(BitmapType type) {
   bitmapType = type;
 }
 
+void TextRenderer::setGrayscalePlanes(uint8_t* lsbBuffer, uint8_t* msbBuffer) {
+  lsbPlane = lsbBuffer;
+  msbPlane = msbBuffer;
+}
+
 void TextRenderer::setFont(const SimpleGFXfont* f) {
   currentFont = f;
   // Reset family and style when setting a single font directly
@@ -170,9 +188,11 @@ size_t TextRenderer::print(const char* s) {
   size_t written = 0;
   const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
 
+  // Kerning applies between glyphs of one print call, as in measureWidth
+  int prevGlyph = -1;
   while (*p) {
     uint32_t codepoint = decodeUtf8Codepoint(p);
-    drawChar(codepoint);
+    prevGlyph = drawChar(codepoint, prevGlyph);
     ++written;
   }
 
@@ -204,22 +224,38 @@ void TextRenderer::getTextBounds(const char* str, int16_t x, int16_t y, int16_t*
 
   if (currentFont) {
     const SimpleGFXfont* f = currentFont;
-    uint16_t totalWidth = 0;
     const unsigned char* p = reinterpret_cast<const unsigned char*>(str);
 
-    while (*p) {
-      uint32_t codepoint = decodeUtf8Codepoint(p);
-      int glyphIndex = findGlyphIndex(f, codepoint);
+    // FNV-1a over the string; stops early once it is too long to cache
+    uint32_t hash = 2166136261u;
+    size_t len = 0;
+    while (p[len] && len <= kWidthCacheMaxLen) {
+      hash ^= p[len];
+      hash *= 16777619u;
+      ++len;
+    }
 
-      if (glyphIndex >= 0) {
-        const SimpleGFXglyph* glyph = &f->glyph[glyphIndex];
-        totalWidth += glyph->xAdvance + GLYPH_PADDING;
+    if (len <= kWidthCacheMaxLen) {
+      hash ^= (uint32_t)currentStyle;
+      hash *= 16777619u;
+      WidthCacheEntry& e = widthCache[hash & (kWidthCacheEntries - 1)];
+      if (e.font == f && e.style == (uint8_t)currentStyle && e.len == len && memcmp(e.text, str, len) == 0) {
+        width = e.width;
+        ++widthCacheHits;
       } else {
-        totalWidth += FALLBACK_GLYPH_WIDTH;
+        width = measureWidth(p);
+        ++widthCacheMisses;
+        e.font = f;
+        e.width = width;
+        e.style = (uint8_t)currentStyle;
+        e.len = (uint8_t)len;
+        memcpy(e.text, str, len);
+        e.text[len] = '\0';
       }
+    } else {
+      width = measureWidth(p);
     }
 
-    width = totalWidth;
     height = (f->yAdvance > 0) ? f->yAdvance : 10;
   }
 
@@ -233,93 +269,444 @@ void TextRenderer::getTextBounds(const char* str, int16_t x, int16_t y, int16_t*
     *h = height;
 }
 
-void TextRenderer::drawChar(uint32_t codepoint) {
-  if (!currentFont) {
-    return;
-  }
-
+uint16_t TextRenderer::measureWidth(const unsigned char* p) const {
   const SimpleGFXfont* f = currentFont;
+  int totalWidth = 0;
+  int prevGlyph = -1;
 
-  // For hidden text, advance cursor without drawing
-  if (currentStyle == FontStyle::HIDDEN) {
+  while (*p) {
+    uint32_t codepoint = decodeUtf8Codepoint(p);
     int glyphIndex = findGlyphIndex(f, codepoint);
+
     if (glyphIndex >= 0) {
       const SimpleGFXglyph* glyph = &f->glyph[glyphIndex];
-      cursorX += glyph->xAdvance;
+      if (prevGlyph >= 0) {
+        totalWidth += getKerning(f, (uint16_t)prevGlyph, (uint16_t)glyphIndex);
+      }
+      totalWidth += glyph->xAdvance + GLYPH_PADDING;
     } else {
-      cursorX += FALLBACK_GLYPH_WIDTH;
+      totalWidth += FALLBACK_GLYPH_WIDTH;
     }
-    return;
+    prevGlyph = glyphIndex;
   }
 
-  int glyphIndex = findGlyphIndex(f, codepoint);
+  return totalWidth > 0 ? (uint16_t)totalWidth : 0;
+}
 
-  if (glyphIndex < 0) {
-    // Unsupported codepoint; advance by fallback amount
-    cursorX += FALLBACK_GLYPH_WIDTH;
-    return;
+void TextRenderer::invalidateWidthCache() {
+  memset(widthCache, 0, sizeof(widthCache));
+  widthCacheGeneration++;
+}
+
+// Glyph spans are at most 255 pixels; one leading and one trailing zero byte
+// let the merge loop read neighbours without bounds checks.
+static constexpr int kSpanBufBytes = 32 + 2;
+
+static inline uint8_t reverseBits8(uint8_t b) {
+  b = (uint8_t)((b & 0xF0) >> 4 | (b & 0x0F) << 4);
+  b = (uint8_t)((b & 0xCC) >> 2 | (b & 0x33) << 2);
+  b = (uint8_t)((b & 0xAA) >> 1 | (b & 0x55) << 1);
+  return b;
+}
+
+// "On" pixels (0 bits in font bitmaps) of one glyph row as panel-order bytes.
+// Padding bits past the glyph width are cleared. `reverse` mirrors the row
+// (the whole padded byte run, so the span then starts with the padding).
+static inline void gatherGlyphRow(const uint8_t* row, uint8_t rowStride, uint8_t tailMask, bool reverse,
+                                  uint8_t* out) {
+  if (!reverse) {
+    for (uint8_t i = 0; i < rowStride; ++i) {
+      out[i] = (uint8_t)~row[i];
+    }
+    out[rowStride - 1] &= tailMask;
+  } else {
+    for (uint8_t i = 0; i < rowStride; ++i) {
+      uint8_t b = (uint8_t)~row[rowStride - 1 - i];
+      if (i == 0) {
+        b &= tailMask;
+      }
+      out[i] = reverseBits8(b);
+    }
   }
+}
 
-  const SimpleGFXglyph* glyph = &f->glyph[glyphIndex];
+// "On" pixels of the 8 glyph columns of byte column `bx`, transposed into one
+// span per column (top to bottom, or bottom to top when `reverse`), packed
+// MSB first. Blank bytes are skipped, which is most of a glyph.
+static inline void gatherGlyphColumns8(const uint8_t* glyphBits, uint8_t rowStride, uint8_t h, uint8_t bx,
+                                       uint8_t colMask, bool reverse, uint8_t (*out)[kSpanBufBytes]) {
+  const uint8_t outBytes = (uint8_t)((h + 7) >> 3);
+  for (int c = 0; c < 8; ++c) {
+    for (int i = 0; i <= outBytes + 1; ++i) {
+      out[c][i] = 0;
+    }
+  }
+  const uint8_t* p = glyphBits + bx;
+  for (uint8_t yy = 0; yy < h; ++yy, p += rowStride) {
+    uint8_t on = (uint8_t)(~*p & colMask);
+    if (!on) {
+      continue;
+    }
+    const uint8_t j = reverse ? (uint8_t)(h - 1 - yy) : yy;
+    const uint8_t bit = (uint8_t)(0x80 >> (j & 7));
+    const uint8_t byte = (uint8_t)((j >> 3) + 1);  // +1: leading zero byte
+    for (int c = 0; on; ++c, on = (uint8_t)(on << 1)) {
+      if (on & 0x80) {
+        out[c][byte] |= bit;
+      }
+    }
+  }
+}
 
-  // Select the appropriate bitmap based on bitmapType
-  const uint8_t* bitmap = nullptr;
-  switch (bitmapType) {
-    case BITMAP_BW:
-      bitmap = f->bitmap;
-      break;
-    case BITMAP_GRAY_LSB:
-      bitmap = f->bitmap_gray_lsb;
-      break;
-    case BITMAP_GRAY_MSB:
-      bitmap = f->bitmap_gray_msb;
-      break;
+// Merge one panel-order span into a framebuffer row. `clearBuf`/`setBuf` hold
+// the span at [1..n] with zero bytes around it; destination bytes
+// [dStart, dEnd] are already clipped to the panel.
+static inline void mergeSpan(uint8_t* row, const uint8_t* clearBuf, const uint8_t* setBuf, int dStart, int dEnd,
+                             int srcBase, int shift) {
+  for (int d = dStart; d <= dEnd; ++d) {
+    const int k = d - srcBase;  // span bytes k-1 and k straddle destination byte d
+    const uint8_t clearBits = (uint8_t)(((clearBuf[k] << 8) | clearBuf[k + 1]) >> shift);
+    if (setBuf) {
+      const uint8_t setBits = (uint8_t)(((setBuf[k] << 8) | setBuf[k + 1]) >> shift);
+      row[d] = (uint8_t)((row[d] & ~clearBits) | setBits);
+    } else {
+      row[d] &= (uint8_t)~clearBits;
+    }
   }
+}
 
-  // If the selected bitmap doesn't exist, skip rendering
-  if (!bitmap) {
-    cursorX += glyph->xAdvance + GLYPH_PADDING;
+// Grayscale planes only write pixels covered by a gray level: black where the
+// plane's own bitmap is on, white elsewhere.
+static inline void grayMasks(const uint8_t* planeBuf, const uint8_t* lsbBuf, const uint8_t* msbBuf,
+                             uint8_t* clearBuf, uint8_t* setBuf, int spanBytes) {
+  for (int b = 1; b <= spanBytes; ++b) {
+    const uint8_t sel = (uint8_t)(lsbBuf[b] | msbBuf[b]);
+    const uint8_t on = planeBuf[b];
+    clearBuf[b] = (uint8_t)(sel & on);
+    setBuf[b] = (uint8_t)(sel & ~on);
+  }
+}
+
+// Clear (black) or set (white) panel pixels [x0, x1) of one framebuffer row
+static inline void fillRowBits(uint8_t* row, int x0, int x1, bool black) {
+  const int b0 = x0 >> 3;
+  const int b1 = (x1 - 1) >> 3;
+  const uint8_t head = (uint8_t)(0xFF >> (x0 & 7));
+  const uint8_t tail = (uint8_t)(0xFF << (7 - ((x1 - 1) & 7)));
+  if (b0 == b1) {
+    const uint8_t mask = head & tail;
+    row[b0] = black ? (uint8_t)(row[b0] & ~mask) : (uint8_t)(row[b0] | mask);
     return;
   }
+  const uint8_t fill = black ? 0x00 : 0xFF;
+  row[b0] = black ? (uint8_t)(row[b0] & ~head) : (uint8_t)(row[b0] | head);
+  for (int b = b0 + 1; b < b1; ++b) {
+    row[b] = fill;
+  }
+  row[b1] = black ? (uint8_t)(row[b1] & ~tail) : (uint8_t)(row[b1] | tail);
+}
 
-  uint16_t bitmapOffset = glyph->bitmapOffset;
-  uint8_t w = glyph->width;
-  uint8_t h = glyph->height;
-  int8_t xOffset = glyph->xOffset;
-  int8_t yOffset = glyph->yOffset;
+template <TextRenderer::Orientation O>
+void TextRenderer::blitGlyph(const SimpleGFXglyph* glyph, const SimpleGFXfont* font, const uint8_t* glyphBits) {
+  constexpr bool kRowsAreSpans = (O == LandscapeClockwise || O == LandscapeCounterClockwise);
+  constexpr bool kReverse = (O == LandscapeClockwise || O == PortraitInverted);
+  constexpr int kPanelW = EInkDisplay::DISPLAY_WIDTH;
+  constexpr int kPanelH = EInkDisplay::DISPLAY_HEIGHT;
 
-  // Calculate row stride in bytes (width rounded up to byte boundary)
-  uint8_t rowStride = (w + 7) / 8;
+  const uint8_t w = glyph->width;
+  const uint8_t h = glyph->height;
+  if (w == 0 || h == 0) {
+    return;
+  }
+  const uint8_t rowStride = (uint8_t)((w + 7) / 8);
+  const uint8_t tailMask = (w & 7) ? (uint8_t)(0xFF << (8 - (w & 7))) : 0xFF;
+  const int gx0 = cursorX + glyph->xOffset;  // logical top-left
+  const int gy0 = cursorY + glyph->yOffset;
+
+  // Span geometry in panel space: each span covers `spanBits` panel pixels of
+  // one panel row starting at `spanX`; span i lands on row rowBase + i*rowStep.
+  int spanCount, spanBits, spanX, rowBase, rowStep;
+  if (kRowsAreSpans) {
+    spanCount = h;
+    spanBits = rowStride * 8;  // includes zeroed padding
+    if (O == LandscapeCounterClockwise) {
+      spanX = gx0;
+      rowBase = gy0;
+      rowStep = 1;
+    } else {
+      spanX = (kPanelW - 1) - (gx0 + spanBits - 1);
+      rowBase = (kPanelH - 1) - gy0;
+      rowStep = -1;
+    }
+  } else {
+    spanCount = w;
+    spanBits = h;
+    if (O == Portrait) {
+      spanX = gy0;
+      rowBase = (kPanelH - 1) - gx0;
+      rowStep = -1;
+    } else {
+      spanX = (kPanelW - 1) - (gy0 + h - 1);
+      rowBase = gx0;
+      rowStep = 1;
+    }
+  }
 
-  // Cache the grayscale bitmap pointers outside the loop for better performance
-  const uint8_t* bitmap_lsb = f->bitmap_gray_lsb;
-  const uint8_t* bitmap_msb = f->bitmap_gray_msb;
-  bool isGrayscale = (bitmapType != BITMAP_BW);
+  // Clip once: visible span indices and destination bytes
+  int first = 0, last = spanCount - 1;
+  if (rowStep > 0) {
+    if (rowBase < 0) first = -rowBase;
+    if (rowBase + last >= kPanelH) last = kPanelH - 1 - rowBase;
+  } else {
+    if (rowBase >= kPanelH) first = rowBase - (kPanelH - 1);
+    if (rowBase - last < 0) last = rowBase;
+  }
+  const int xStart = spanX < 0 ? 0 : spanX;
+  const int xEnd = (spanX + spanBits > kPanelW) ? kPanelW : spanX + spanBits;  // exclusive
+  if (first > last || xStart >= xEnd) {
+    return;
+  }
+  const int dStart = xStart >> 3;
+  const int dEnd = (xEnd - 1) >> 3;
+  const int srcBase = spanX >> 3;  // floor, also for negative spanX
+  const int shift = spanX & 7;
+  const int spanBytes = (spanBits + 7) >> 3;
+
+  // Which bitmaps to read and which planes to write. Every bitmap is gathered
+  // at most once per span, whatever the number of planes written from it.
+  const bool rle = font->bitmapFormat != FONT_BITMAP_PLANES;
+  const bool hasGray = rle ? font->bitmapFormat == FONT_BITMAP_RLE_GRAY
+                           : (font->bitmap_gray_lsb && font->bitmap_gray_msb);
+  const bool writeBw = (bitmapType == BITMAP_BW || bitmapType == BITMAP_ALL_PLANES);
+  const bool writeLsb = hasGray && (bitmapType == BITMAP_GRAY_LSB || (bitmapType == BITMAP_ALL_PLANES && lsbPlane));
+  const bool writeMsb = hasGray && (bitmapType == BITMAP_GRAY_MSB || (bitmapType == BITMAP_ALL_PLANES && msbPlane));
+  if (!writeBw && !writeLsb && !writeMsb) {
+    return;
+  }
+  const bool readGray = writeLsb || writeMsb;
 
-  // Render each pixel in the glyph
-  for (uint8_t yy = 0; yy < h; yy++) {
-    for (uint8_t xx = 0; xx < w; xx++) {
-      int16_t px = cursorX + xOffset + xx;
-      int16_t py = cursorY + yOffset + yy;
+  if (rowStep > 0) {
+    markDirty(dStart, dEnd, rowBase + first, rowBase + last);
+  } else {
+    markDirty(dStart, dEnd, rowBase - last, rowBase - first);
+  }
 
-      // Calculate bitmap byte and bit positions for current pixel
-      uint16_t byteIndex = bitmapOffset + (yy * rowStride) + (xx / 8);
-      uint8_t bitMask = 1 << (7 - (xx % 8));
+  const int rowOffset = rowBase * EInkDisplay::DISPLAY_WIDTH_BYTES;
+  const int rowAdvance = rowStep * EInkDisplay::DISPLAY_WIDTH_BYTES;
+  uint8_t* const bwRows = frameBuffer + rowOffset;
+  uint8_t* const lsbRows = writeLsb ? (bitmapType == BITMAP_ALL_PLANES ? lsbPlane : frameBuffer) + rowOffset : nullptr;
+  uint8_t* const msbRows = writeMsb ? (bitmapType == BITMAP_ALL_PLANES ? msbPlane : frameBuffer) + rowOffset : nullptr;
+
+  if (rle) {
+    // Decode runs straight into the planes: a glyph row is part of a panel
+    // row in landscape and part of a panel column in portrait. Runs whose
+    // symbol writes none of the selected planes are only skipped over.
+    GlyphRleReader reader(glyphBits);
+
+    // What each symbol does to the selected planes (0: nothing)
+    enum : uint8_t { kBwInk = 1, kLsb = 2, kLsbBlack = 4, kMsb = 8, kMsbBlack = 16 };
+    uint8_t actions[8];
+    for (uint8_t symbol = 0; symbol < 8; ++symbol) {
+      const bool gray = (symbol & 3) != 3;  // lsb or msb on
+      uint8_t a = 0;
+      if (writeBw && !(symbol & 4)) {
+        a |= kBwInk;
+      }
+      if (writeLsb && gray) {
+        a |= (symbol & 1) ? kLsb : kLsb | kLsbBlack;
+      }
+      if (writeMsb && gray) {
+        a |= (symbol & 2) ? kMsb : kMsb | kMsbBlack;
+      }
+      actions[symbol] = a;
+    }
 
-      if (isGrayscale) {
-        // skip writing over black/white pixels
-        if ((bitmap_lsb[byteIndex] & bitMask) == 0 || (bitmap_msb[byteIndex] & bitMask) == 0) {
-          drawPixel(px, py, (bitmap[byteIndex] & bitMask) == 0);
+    uint8_t action = 0;
+    auto paint = [&](int offset, int x0, int x1) {
+      if (action & kBwInk) {
+        fillRowBits(bwRows + offset, x0, x1, true);
+      }
+      if (action & kLsb) {
+        fillRowBits(lsbRows + offset, x0, x1, action & kLsbBlack);
+      }
+      if (action & kMsb) {
+        fillRowBits(msbRows + offset, x0, x1, action & kMsbBlack);
+      }
+    };
+
+    int xx = 0, yy = 0;
+    while (yy < h && !(kRowsAreSpans && yy > last)) {
+      uint8_t symbol, length;
+      reader.next(symbol, length);
+      action = actions[symbol];
+      if (!action) {
+        xx += length;
+        while (xx >= w) {
+          xx -= w;
+          ++yy;
         }
-      } else {
-        // Check if pixel is set (0 = pixel on in our bitmap format)
-        if ((bitmap[byteIndex] & bitMask) == 0) {
-          drawPixel(px, py, true);
+        continue;
+      }
+
+      for (int remaining = length; remaining > 0;) {
+        const int n = (remaining < w - xx) ? remaining : w - xx;
+        if (kRowsAreSpans) {
+          if (yy >= first && yy <= last) {
+            int x0 = kReverse ? spanX + spanBits - xx - n : spanX + xx;
+            int x1 = x0 + n;
+            x0 = x0 < 0 ? 0 : x0;
+            x1 = x1 > kPanelW ? kPanelW : x1;
+            if (x0 < x1) {
+              paint(yy * rowAdvance, x0, x1);
+            }
+          }
+        } else {
+          const int x = kReverse ? spanX + (h - 1 - yy) : spanX + yy;
+          if (x >= 0 && x < kPanelW) {
+            const int s0 = xx > first ? xx : first;
+            const int s1 = (xx + n - 1 < last) ? xx + n - 1 : last;
+            for (int span = s0; span <= s1; ++span) {
+              paint(span * rowAdvance, x, x + 1);
+            }
+          }
+        }
+        remaining -= n;
+        xx += n;
+        if (xx == w) {
+          xx = 0;
+          ++yy;
         }
       }
     }
+    return;
+  }
+
+  const uint8_t* glyphLsb = readGray ? font->bitmap_gray_lsb + glyph->bitmapOffset : nullptr;
+  const uint8_t* glyphMsb = readGray ? font->bitmap_gray_msb + glyph->bitmapOffset : nullptr;
+
+  // Span buffers: [0] and [n+1] stay zero, span bytes live at [1..n]
+  uint8_t clearBuf[kSpanBufBytes] = {0};
+  uint8_t setBuf[kSpanBufBytes] = {0};
+
+  // Write one span (given the gathered "on" bits of each bitmap) to every
+  // selected plane.
+  auto emit = [&](int span, const uint8_t* onBw, const uint8_t* onLsb, const uint8_t* onMsb) {
+    const int offset = span * rowAdvance;
+    if (writeBw) {
+      mergeSpan(bwRows + offset, onBw, nullptr, dStart, dEnd, srcBase, shift);
+    }
+    if (writeLsb) {
+      grayMasks(onLsb, onLsb, onMsb, clearBuf, setBuf, spanBytes);
+      mergeSpan(lsbRows + offset, clearBuf, setBuf, dStart, dEnd, srcBase, shift);
+    }
+    if (writeMsb) {
+      grayMasks(onMsb, onLsb, onMsb, clearBuf, setBuf, spanBytes);
+      mergeSpan(msbRows + offset, clearBuf, setBuf, dStart, dEnd, srcBase, shift);
+    }
+  };
+
+  if (kRowsAreSpans) {
+    uint8_t bwBuf[kSpanBufBytes] = {0};
+    uint8_t lsbBuf[kSpanBufBytes] = {0};
+    uint8_t msbBuf[kSpanBufBytes] = {0};
+
+    for (int yy = first; yy <= last; ++yy) {
+      if (writeBw) {
+        gatherGlyphRow(glyphBits + yy * rowStride, rowStride, tailMask, kReverse, bwBuf + 1);
+      }
+      if (readGray) {
+        gatherGlyphRow(glyphLsb + yy * rowStride, rowStride, tailMask, kReverse, lsbBuf + 1);
+        gatherGlyphRow(glyphMsb + yy * rowStride, rowStride, tailMask, kReverse, msbBuf + 1);
+      }
+      emit(yy, bwBuf, lsbBuf, msbBuf);
+    }
+    return;
+  }
+
+  // Portrait orientations: glyph columns become panel rows. Transpose eight
+  // columns at a time so every glyph byte is read once per bitmap.
+  uint8_t bwCols[8][kSpanBufBytes];
+  uint8_t lsbCols[8][kSpanBufBytes];
+  uint8_t msbCols[8][kSpanBufBytes];
+
+  for (int bx = first >> 3; bx <= (last >> 3); ++bx) {
+    const uint8_t colMask = (bx == rowStride - 1) ? tailMask : 0xFF;
+    if (writeBw) {
+      gatherGlyphColumns8(glyphBits, rowStride, h, (uint8_t)bx, colMask, kReverse, bwCols);
+    }
+    if (readGray) {
+      gatherGlyphColumns8(glyphLsb, rowStride, h, (uint8_t)bx, colMask, kReverse, lsbCols);
+      gatherGlyphColumns8(glyphMsb, rowStride, h, (uint8_t)bx, colMask, kReverse, msbCols);
+    }
+    const int xxFirst = (bx * 8 > first) ? bx * 8 : first;
+    const int xxLast = (bx * 8 + 7 < last) ? bx * 8 + 7 : last;
+    for (int xx = xxFirst; xx <= xxLast; ++xx) {
+      emit(xx, bwCols[xx & 7], lsbCols[xx & 7], msbCols[xx & 7]);
+    }
+  }
+}
+
+int TextRenderer::drawChar(uint32_t codepoint, int prevGlyph) {
+  if (!currentFont) {
+    return -1;
+  }
+
+  const SimpleGFXfont* f = currentFont;
+  int glyphIndex = findGlyphIndex(f, codepoint);
+  if (glyphIndex >= 0 && prevGlyph >= 0) {
+    cursorX += getKerning(f, (uint16_t)prevGlyph, (uint16_t)glyphIndex);
+  }
+
+  // For hidden text, advance cursor without drawing
+  if (currentStyle == FontStyle::HIDDEN) {
+    if (glyphIndex >= 0) {
+      const SimpleGFXglyph* glyph = &f->glyph[glyphIndex];
+      cursorX += glyph->xAdvance;
+    } else {
+      cursorX += FALLBACK_GLYPH_WIDTH;
+    }
+    return glyphIndex;
+  }
+
+  if (glyphIndex < 0) {
+    // Unsupported codepoint; advance by fallback amount
+    cursorX += FALLBACK_GLYPH_WIDTH;
+    return -1;
+  }
+
+  const SimpleGFXglyph* glyph = &f->glyph[glyphIndex];
+
+  // Planes whose bitmap the font lacks are skipped inside blitGlyph. Runtime
+  // fonts fetch the glyph (usually from their cache) only when drawing.
+  const uint8_t* glyphBits = nullptr;
+  if (frameBuffer) {
+    if (f->bitmapSource) {
+      // Blank glyphs (spaces) have no bitmap to fetch
+      if (glyph->width && glyph->height) {
+        glyphBits = f->bitmapSource->getGlyphBitmap((uint16_t)glyphIndex);
+      }
+    } else if (f->bitmap) {
+      glyphBits = f->bitmap + glyph->bitmapOffset;
+    }
+  }
+  if (glyphBits) {
+    switch (orientation) {
+      case Portrait:
+        blitGlyph<Portrait>(glyph, f, glyphBits);
+        break;
+      case LandscapeClockwise:
+        blitGlyph<LandscapeClockwise>(glyph, f, glyphBits);
+        break;
+      case PortraitInverted:
+        blitGlyph<PortraitInverted>(glyph, f, glyphBits);
+        break;
+      case LandscapeCounterClockwise:
+        blitGlyph<LandscapeCounterClockwise>(glyph, f, glyphBits);
+        break;
+    }
   }
 
   // Advance cursor by xAdvance
   cursorX += glyph->xAdvance + GLYPH_PADDING;
+  return glyphIndex;
 }
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "../core/FrameDiff.h"
 #include "SimpleFont.h"
 
 class EInkDisplay;  // Forward declaration
@@ -25,9 +26,10 @@ class TextRenderer {
 
   // Bitmap selection for font rendering
   enum BitmapType {
-    BITMAP_BW,        // Use the main black & white bitmap
-    BITMAP_GRAY_LSB,  // Use the grayscale LSB bitmap
-    BITMAP_GRAY_MSB   // Use the grayscale MSB bitmap
+    BITMAP_BW,         // Use the main black & white bitmap
+    BITMAP_GRAY_LSB,   // Use the grayscale LSB bitmap
+    BITMAP_GRAY_MSB,   // Use the grayscale MSB bitmap
+    BITMAP_ALL_PLANES  // BW plus both gray planes in one pass (setGrayscalePlanes)
   };
 
   // Constructor
@@ -49,18 +51,55 @@ class TextRenderer {
   // Select which bitmap data to use from the font
   void setBitmapType(BitmapType type);
 
+  // Extra planes written in BITMAP_ALL_PLANES mode. Either may be null, in
+  // which case that plane is skipped.
+  void setGrayscalePlanes(uint8_t* lsbBuffer, uint8_t* msbBuffer);
+
   // Minimal API used by the rest of the project
   void setFont(const SimpleGFXfont* f = nullptr);
   void setFontFamily(FontFamily* family);
+  FontFamily* getFontFamily() const {
+    return currentFamily;
+  }
   void setFontStyle(FontStyle style);
   void setTextColor(uint16_t c);
   void setCursor(int16_t x, int16_t y);
   size_t print(const char* s);
   size_t print(const String& s);
 
-  // Measure text bounds for layout
+  // Measure text bounds for layout, kerning included. Widths of short strings
+  // are served from a small word-width cache keyed by (font, style, text).
   void getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
 
+  // Word-width cache. Entries are keyed by font pointer, so switching fonts
+  // never returns stale widths; call invalidate when a font's glyph data is
+  // replaced in place (e.g. a font loaded at runtime reusing the same struct).
+  void invalidateWidthCache();
+  // Bumped by invalidateWidthCache(); with the font family it tells whether
+  // widths measured earlier are still valid
+  uint32_t getWidthCacheGeneration() const {
+    return widthCacheGeneration;
+  }
+  uint32_t getWidthCacheHits() const {
+    return widthCacheHits;
+  }
+  uint32_t getWidthCacheMisses() const {
+    return widthCacheMisses;
+  }
+  void resetWidthCacheStats() {
+    widthCacheHits = 0;
+    widthCacheMisses = 0;
+  }
+
+  // Panel region touched by drawing since the last reset (panel coordinates,
+  // byte aligned). Lets screens send only what they redrew.
+  void resetDirtyRegion() {
+    dirtyRegion.clear();
+  }
+  const DirtyRegion& getDirtyRegion() const {
+    return dirtyRegion;
+  }
+
   // Color constants (0 = black, 1 = white for 1-bit display)
   static const uint16_t COLOR_BLACK = 0;
   static const uint16_t COLOR_WHITE = 1;
@@ -71,15 +110,53 @@ class TextRenderer {
   FontFamily* currentFamily = nullptr;
   FontStyle currentStyle = FontStyle::REGULAR;
   uint8_t* frameBuffer = nullptr;
+  uint8_t* lsbPlane = nullptr;
+  uint8_t* msbPlane = nullptr;
   BitmapType bitmapType = BITMAP_BW;
   Orientation orientation = Portrait;
   int16_t cursorX = 0;
   int16_t cursorY = 0;
   uint16_t textColor = COLOR_BLACK;
+  DirtyRegion dirtyRegion;
+
+  // Grow the dirty region by panel rows [y0, y1] and bytes [byte0, byte1]
+  void markDirty(int byte0, int byte1, int y0, int y1);
+
+  // Direct-mapped word-width cache (~3 KB). Strings longer than
+  // kWidthCacheMaxLen bytes are always measured.
+  static constexpr uint8_t kWidthCacheMaxLen = 15;
+  static constexpr uint16_t kWidthCacheEntries = 128;  // power of two
+  struct WidthCacheEntry {
+    const SimpleGFXfont* font;
+    uint16_t width;
+    uint8_t style;
+    uint8_t len;
+    char text[kWidthCacheMaxLen + 1];
+  };
+  WidthCacheEntry widthCache[kWidthCacheEntries];
+  uint32_t widthCacheGeneration = 0;
+  uint32_t widthCacheHits = 0;
+  uint32_t widthCacheMisses = 0;
+
+  // Sum of glyph advances for `str` in the current font
+  uint16_t measureWidth(const unsigned char* str) const;
 
   // Draw a single Unicode codepoint. Accepts a full Unicode codepoint
   // (decoded from UTF-8) so the renderer can support multi-byte UTF-8 input.
-  void drawChar(uint32_t codepoint);
+  // `prevGlyph` is the glyph drawn just before (-1 for none) for kerning;
+  // returns this codepoint's glyph index, or -1.
+  int drawChar(uint32_t codepoint, int prevGlyph);
+
+  // Blit one glyph into the framebuffer a panel row at a time. The glyph is
+  // clipped once; each panel row span is assembled as whole bytes and merged
+  // with masks instead of going through drawPixel. Specialized per
+  // orientation since portrait modes map glyph columns to panel rows.
+  // Writes every plane selected by bitmapType, reading each font bitmap once.
+  // Run-length coded fonts are decoded run by run straight into the planes.
+  // `glyphBits` is the glyph's (BW or run-length) bitmap, from flash or from
+  // the font's bitmap source.
+  template <Orientation O>
+  void blitGlyph(const SimpleGFXglyph* glyph, const SimpleGFXfont* font, const uint8_t* glyphBits);
 };
 
 #endif
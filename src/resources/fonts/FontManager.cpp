@@ -1,9 +1,15 @@
 #include "FontManager.h"
 
+#include <SD.h>
+
+#include <algorithm>
+#include <cstring>
+
 #include "FontDefinitions.h"
 #include "other/MenuFontBig.h"
 #include "other/MenuFontSmall.h"
 #include "other/MenuHeader.h"
+#include "rendering/SdFont.h"
 
 // Font family (default to Bookerly26)
 static FontFamily* currentFamily = &bookerly26Family;
@@ -17,6 +23,72 @@ void setCurrentFontFamily(FontFamily* family) {
     currentFamily = family;
 }
 
+// SD fonts: one family resident, styles in FontFamily order
+static SdFont sdFonts[4];
+static char sdFamilyName[32];
+static FontFamily sdFamily = {sdFamilyName, nullptr, nullptr, nullptr, nullptr};
+static const char* const kSdStyleSuffixes[4] = {"", "-Bold", "-Italic", "-BoldItalic"};
+
+std::vector<String> listSdFontFamilies() {
+  std::vector<String> names;
+  File dir = SD.open(SD_FONT_DIR);
+  if (!dir || !dir.isDirectory()) {
+    return names;
+  }
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    String name = String(f.name());
+    const bool isFile = !f.isDirectory();
+    f.close();
+    const int slash = name.lastIndexOf('/');
+    if (slash >= 0) {
+      name = name.substring(slash + 1);
+    }
+    if (!isFile || !name.endsWith(".mrf")) {
+      continue;
+    }
+    name = name.substring(0, name.length() - 4);
+    bool styled = false;
+    for (int i = 1; i < 4; ++i) {
+      styled = styled || name.endsWith(kSdStyleSuffixes[i]);
+    }
+    if (!styled && name.length() > 0 && name.length() < (int)sizeof(sdFamilyName)) {
+      names.push_back(name);
+    }
+  }
+  dir.close();
+  std::sort(names.begin(), names.end(), [](const String& a, const String& b) { return strcmp(a.c_str(), b.c_str()) < 0; });
+  return names;
+}
+
+FontFamily* loadSdFontFamily(const String& name) {
+  if (name.length() == 0 || name.length() >= (int)sizeof(sdFamilyName)) {
+    return nullptr;
+  }
+  if (sdFamily.regular && name == sdFamilyName) {
+    return &sdFamily;
+  }
+  // Never leave the current family pointing at a closed font
+  if (currentFamily == &sdFamily) {
+    currentFamily = &bookerly26Family;
+  }
+  const SimpleGFXfont** variants[4] = {&sdFamily.regular, &sdFamily.bold, &sdFamily.italic, &sdFamily.boldItalic};
+  for (int i = 0; i < 4; ++i) {
+    sdFonts[i].close();
+    *variants[i] = nullptr;
+    String path = String(SD_FONT_DIR) + "/" + name + kSdStyleSuffixes[i] + ".mrf";
+    if ((i == 0 || SD.exists(path.c_str())) && sdFonts[i].open(path.c_str())) {
+      *variants[i] = sdFonts[i].getFont();
+    } else if (i == 0) {
+      sdFamilyName[0] = '\0';
+      return nullptr;
+    }
+  }
+  strncpy(sdFamilyName, name.c_str(), sizeof(sdFamilyName) - 1);
+  sdFamilyName[sizeof(sdFamilyName) - 1] = '\0';
+  Serial.printf("FontManager: loaded SD font family %s\n", sdFamilyName);
+  return &sdFamily;
+}
+
 // Simple fonts
 static const SimpleGFXfont* mainFont = &MenuFontSmall;
 static const SimpleGFXfont* titleFont = &MenuHeader;
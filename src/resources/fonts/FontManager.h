@@ -1,14 +1,31 @@
 #pragma once
 
+#include <Arduino.h>
+
+#include <vector>
+
 #include "rendering/SimpleFont.h"
 
 // Font family
 FontFamily* getCurrentFontFamily();
 void setCurrentFontFamily(FontFamily* family);
 
+// Fonts loaded at runtime (see rendering/SdFont.h). A family is the files
+// <Name>.mrf plus optional <Name>-Bold.mrf, <Name>-Italic.mrf and
+// <Name>-BoldItalic.mrf in this directory.
+constexpr const char* SD_FONT_DIR = "/microreader/fonts";
+
+// Names of the families in SD_FONT_DIR that have a regular style
+std::vector<String> listSdFontFamilies();
+
+// Load a family from SD_FONT_DIR, replacing the previously loaded one (only
+// one SD family is resident). Returns nullptr if its regular style fails to
+// load. Callers should invalidate TextRenderer's width cache afterwards.
+FontFamily* loadSdFontFamily(const String& name);
+
 // Simple fonts
 const SimpleGFXfont* getMainFont();
 void setMainFont(const SimpleGFXfont* font);
 
 const SimpleGFXfont* getTitleFont();
-void setTitleFont(const SimpleGFXfont* font);
\ No newline at end of file
+void setTitleFont(const SimpleGFXfont* font);
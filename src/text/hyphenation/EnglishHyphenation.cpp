@@ -1,6 +1,6 @@
 #include "EnglishHyphenation.h"
 
-#include "Liang/hyph-en-us.h"
+#include "Liang/hyph-en-us-trie.h"
 #include "Liang/hyphenation.h"
 
 std::vector<size_t> EnglishHyphenation::hyphenate(const std::string& word, size_t minWordLength, size_t minLeft,
@@ -8,12 +8,13 @@ std::vector<size_t> EnglishHyphenation::hyphenate(const std::string& word, size_
   const int MAX_POSITIONS = 32;
   size_t out_positions[MAX_POSITIONS];
 
-  // Do not hyphenate words shorter than the minimum word length
-  if (word.length() < minWordLength) {
+  // Do not hyphenate words shorter than the minimum word length (in characters)
+  if (word.length() < minWordLength || liang_char_count(word.c_str()) < minWordLength) {
     return std::vector<size_t>();
   }
 
-  int count = liang_hyphenate(word.c_str(), minLeft, minRight, '.', out_positions, MAX_POSITIONS, en_us_patterns);
+  int count = liang_hyphenate(word.c_str(), minLeft, minRight, '.', out_positions, MAX_POSITIONS, en_us_trie,
+                              &en_us_exceptions);
 
   std::vector<size_t> positions;
   if (count > 0) {
@@ -8,8 +8,8 @@ std::vector<size_t> GermanHyphenation::hyphenate(const std::string& word, size_t
   const int MAX_POSITIONS = 32;
   size_t out_positions[MAX_POSITIONS];
 
-  // Do not hyphenate words shorter than the minimum word length
-  if (word.length() < minWordLength) {
+  // Do not hyphenate words shorter than the minimum word length (in characters)
+  if (word.length() < minWordLength || liang_char_count(word.c_str()) < minWordLength) {
     return std::vector<size_t>();
   }
 
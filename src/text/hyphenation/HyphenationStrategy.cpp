@@ -2,32 +2,93 @@
 
 #include "EnglishHyphenation.h"
 #include "GermanHyphenation.h"
+#include "LiangHyphenation.h"
 
 // Implementation of the base class method
 std::vector<int> HyphenationStrategy::findHyphenPositions(const std::string& word, size_t minWordLength, size_t minLeft,
                                                           size_t minRight) {
-  std::vector<int> positions;
+  HyphenPositions found;
+  findHyphenPositions(word.c_str(), word.length(), found, minWordLength, minLeft, minRight);
+  return std::vector<int>(found.begin(), found.end());
+}
+
+void HyphenationStrategy::computeHyphenPositions(const char* word, size_t length, HyphenPositions& out,
+                                                 size_t minWordLength, size_t minLeft, size_t minRight) {
+  out.clear();
 
   // First, find existing hyphens in the text
-  for (size_t i = 0; i < word.length(); i++) {
+  for (size_t i = 0; i < length; i++) {
     if (word[i] == '-') {
-      positions.push_back(static_cast<int>(i));
+      out.push_back(static_cast<int>(i));
     }
   }
 
   // Add algorithmic hyphenation positions for words without existing hyphens
-  if (positions.empty()) {
+  if (out.empty()) {
     // Use the language-specific hyphenation strategy (call member, not global hyphenate)
-    std::vector<size_t> algorithmicPositions = this->hyphenate(word, minWordLength, minLeft, minRight);
+    std::vector<size_t> algorithmicPositions =
+        this->hyphenate(std::string(word, length), minWordLength, minLeft, minRight);
 
     // Store as negative values to indicate these are algorithmic positions
     // (need hyphen insertion). Offset by -1 so position 0 becomes -1, etc.
     for (size_t bytePos : algorithmicPositions) {
-      positions.push_back(-(static_cast<int>(bytePos) + 1));
+      out.push_back(-(static_cast<int>(bytePos) + 1));
+    }
+  }
+}
+
+void HyphenationStrategy::findHyphenPositions(const char* word, size_t length, HyphenPositions& out,
+                                              size_t minWordLength, size_t minLeft, size_t minRight) {
+  if (length > kMemoMaxWordLength) {
+    memoMisses_++;
+    computeHyphenPositions(word, length, out, minWordLength, minLeft, minRight);
+    return;
+  }
+
+  // FNV-1a over the word, then the minima
+  uint64_t key = 14695981039346656037ull;
+  for (size_t i = 0; i < length; i++) {
+    key = (key ^ (uint8_t)word[i]) * 1099511628211ull;
+  }
+  key = (key ^ ((minWordLength & 0xFF) | (minLeft & 0xFF) << 8 | (minRight & 0xFF) << 16)) * 1099511628211ull;
+
+  MemoEntry* set = &memo_[(size_t)(key >> 32) % kMemoSets * kMemoWays];
+  MemoEntry* victim = set;
+  for (size_t way = 0; way < kMemoWays; way++) {
+    MemoEntry& entry = set[way];
+    if (entry.lastUse != 0 && entry.key == key && entry.length == length) {
+      memoHits_++;
+      entry.lastUse = ++memoClock_;
+      out.clear();
+      for (int pos = 0; pos < (int)length; pos++) {
+        if ((entry.mask >> pos) & 1) {
+          out.push_back(entry.existing ? pos : -(pos + 1));
+        }
+      }
+      return;
+    }
+    if (entry.lastUse < victim->lastUse) {
+      victim = &entry;
     }
   }
 
-  return positions;
+  memoMisses_++;
+  computeHyphenPositions(word, length, out, minWordLength, minLeft, minRight);
+
+  victim->key = key;
+  victim->length = (uint8_t)length;
+  victim->existing = !out.empty() && out[0] >= 0;
+  victim->mask = 0;
+  for (int pos : out) {
+    victim->mask |= 1ull << (pos >= 0 ? pos : -(pos + 1));
+  }
+  victim->lastUse = ++memoClock_;
+}
+
+void HyphenationStrategy::clearMemo() {
+  for (MemoEntry& entry : memo_) {
+    entry.lastUse = 0;
+  }
 }
 
 /**
@@ -36,6 +97,7 @@ std::vector<int> HyphenationStrategy::findHyphenPositions(const std::string& wor
 HyphenationStrategy* createHyphenationStrategy(Language language) {
   switch (language) {
     case Language::BASIC:
+    case Language::PATTERN_FILE:  // needs a file, see below
       return new ExistingHyphensOnly();
     case Language::ENGLISH:
       return new EnglishHyphenation();
@@ -46,3 +108,8 @@ HyphenationStrategy* createHyphenationStrategy(Language language) {
       return new NoHyphenation();
   }
 }
+
+HyphenationStrategy* createHyphenationStrategy(const char* patternFile) {
+  HyphenationStrategy* strategy = patternFile ? LiangHyphenation::loadFromFile(patternFile) : nullptr;
+  return strategy ? strategy : new ExistingHyphensOnly();
+}
@@ -1,6 +1,7 @@
 #ifndef HYPHENATION_STRATEGY_H
 #define HYPHENATION_STRATEGY_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -8,13 +9,52 @@
  * Supported languages for hyphenation
  */
 enum class Language {
-  NONE,     // No hyphenation at all
-  BASIC,    // Only split on existing hyphens in text
-  ENGLISH,  // English hyphenation (not yet implemented)
-  GERMAN,   // German hyphenation
+  NONE,          // No hyphenation at all
+  BASIC,         // Only split on existing hyphens in text
+  ENGLISH,       // English hyphenation (not yet implemented)
+  GERMAN,        // German hyphenation
+  PATTERN_FILE,  // Liang patterns loaded from the SD card (LiangHyphenation)
   // Add more languages here as needed
 };
 
+/**
+ * Hyphen positions in the findHyphenPositions encoding, held inline so that
+ * looking them up does not allocate.
+ */
+class HyphenPositions {
+ public:
+  static constexpr size_t kCapacity = 32;
+
+  size_t size() const {
+    return size_;
+  }
+  bool empty() const {
+    return size_ == 0;
+  }
+  int operator[](size_t i) const {
+    return positions_[i];
+  }
+  const int* begin() const {
+    return positions_;
+  }
+  const int* end() const {
+    return positions_ + size_;
+  }
+  void clear() {
+    size_ = 0;
+  }
+  // Positions past kCapacity are dropped
+  void push_back(int position) {
+    if (size_ < kCapacity) {
+      positions_[size_++] = position;
+    }
+  }
+
+ private:
+  int positions_[kCapacity];
+  size_t size_ = 0;
+};
+
 /**
  * Abstract interface for language-specific hyphenation strategies.
  * Each language implementation should provide its own algorithm
@@ -53,10 +93,51 @@ class HyphenationStrategy {
   std::vector<int> findHyphenPositions(const std::string& word, size_t minWordLength = 6, size_t minLeft = 3,
                                        size_t minRight = 3);
 
+  /**
+   * Same as above without allocating. Results for recent words are kept in a
+   * small LRU memo keyed by a hash of the word and the minima, so words that
+   * are laid out again (backward paging, relayout) are not hyphenated again.
+   */
+  void findHyphenPositions(const char* word, size_t length, HyphenPositions& out, size_t minWordLength = 6,
+                           size_t minLeft = 3, size_t minRight = 3);
+
   /**
    * Get the language this strategy handles
    */
   virtual Language getLanguage() const = 0;
+
+  uint32_t getMemoHits() const {
+    return memoHits_;
+  }
+  uint32_t getMemoMisses() const {
+    return memoMisses_;
+  }
+  void resetMemoStats() {
+    memoHits_ = 0;
+    memoMisses_ = 0;
+  }
+  void clearMemo();
+
+  // Words longer than kMemoMaxWordLength bytes are not memoized (positions are a 64-bit mask)
+  static constexpr size_t kMemoMaxWordLength = 64;
+  static constexpr size_t kMemoSets = 16;
+  static constexpr size_t kMemoWays = 4;
+
+ private:
+  void computeHyphenPositions(const char* word, size_t length, HyphenPositions& out, size_t minWordLength,
+                              size_t minLeft, size_t minRight);
+
+  struct MemoEntry {
+    uint64_t key = 0;       // hash of the word and the minima
+    uint64_t mask = 0;      // bit i: a position at byte i
+    uint32_t lastUse = 0;   // 0: unused
+    uint8_t length = 0;
+    bool existing = false;  // positions are existing hyphens, not algorithmic
+  };
+  MemoEntry memo_[kMemoSets * kMemoWays];
+  uint32_t memoClock_ = 0;
+  uint32_t memoHits_ = 0;
+  uint32_t memoMisses_ = 0;
 };
 
 /**
@@ -102,4 +183,10 @@ class ExistingHyphensOnly : public HyphenationStrategy {
  */
 HyphenationStrategy* createHyphenationStrategy(Language language);
 
+/**
+ * Create a LiangHyphenation strategy from a .hyp pattern file. Falls back to
+ * splitting on existing hyphens only when the file cannot be loaded.
+ */
+HyphenationStrategy* createHyphenationStrategy(const char* patternFile);
+
 #endif
@@ -0,0 +1,2461 @@
+#ifndef HYPH_EN_US_TRIE_H
+#define HYPH_EN_US_TRIE_H
+
+#include "liang_hyphenation_patterns.h"
+
+// Generated by scripts/generate_hyphenation_trie.py from hyph-en-us.h.
+// 4938 patterns, 14 exceptions, 8399 trie nodes, 61505 bytes. Do not edit.
+
+static const std::uint32_t en_us_trie_nodes[] = {
+    283, 7191, 13081, 19477, 24848, 28951, 34841, 41233,
+    45586, 50194, 54810, 61444, 62479, 66327, 72210, 76825,
+    83225, 89619, 94465, 94744, 100887, 106774, 112406, 118022,
+    119567, 123403, 126225, 130569, 132876, 135940, 136965, 138245,
+    139533, 142850, 143364, 144388, 145413, 146689, 146946, 147459,
+    148229, 149507, 150278, 151812, 152837, 154119, 155910, 157444,
+    158466, 158978, 159489, 159752, 161799, 163592, 165633, 165889,
+    166152, 168196, 169221, 170496, 170497, 170760, 172805, 174091,
+    176896, 176904, 178945, 179213, 182540, 185610, 188167, 189956,
+    190980, 192001, 192259, 193026, 193546, 196098, 196608, 196620,
+    199680, 199680, 199688, 201728, 201728, 201733, 203008, 203009,
+    203274, 205824, 205827, 206593, 206851, 207624, 209664, 209664,
+    209666, 210188, 213251, 214026, 216583, 218382, 221953, 222212,
+    223232, 223246, 226816, 226821, 228096, 228102, 229642, 232192,
+    232193, 232460, 235520, 235520, 235522, 236050, 240640, 240644,
+    241664, 241680, 245760, 245760, 245766, 247296, 247296, 247312,
+    251392, 251398, 252931, 253698, 254217, 256512, 256512, 256514,
+    257035, 259843, 260618, 263176, 265226, 267781, 269063, 270849,
+    271111, 272897, 273154, 273673, 275977, 278284, 281354, 283914,
+    286465, 286733, 290061, 293386, 295942, 297477, 298756, 299777,
+    300035, 300809, 303104, 303104, 303114, 305668, 306688, 306696,
+    308742, 310272, 310272, 310275, 311040, 311044, 312064, 312066,
+    312583, 314368, 314376, 316416, 316416, 316426, 318979, 319747,
+    320525, 323844, 324865, 325124, 326154, 328704, 328709, 329985,
+    330241, 330502, 332032, 332034, 332558, 336128, 336141, 339456,
+    339456, 339468, 342528, 342530, 343041, 343297, 343562, 346112,
+    346114, 346625, 346883, 347653, 348929, 349186, 349702, 351238,
+    352778, 355336, 357383, 359175, 360969, 363264, 363264, 363265,
+    363520, 363530, 366087, 367888, 371978, 374533, 375809, 376073,
+    378383, 382217, 384512, 384515, 385280, 385281, 385536, 385539,
+    386307, 387075, 387841, 388097, 388357, 389632, 389640, 391680,
+    391680, 391687, 393472, 393474, 393984, 393986, 394500, 395521,
+    395780, 396800, 396800, 396811, 399617, 399875, 400643, 401420,
+    404481, 404739, 405504, 405520, 409600, 409601, 409861, 411139,
+    411904, 411919, 415749, 417024, 417027, 417798, 419340, 422401,
+    422656, 422662, 424203, 427010, 427520, 427531, 430336, 430336,
+    430346, 432896, 432896, 432897, 433155, 433934, 437511, 439296,
+    439298, 439808, 439814, 441344, 441356, 444416, 444423, 446214,
+    447761, 452097, 452361, 454658, 455180, 458240, 458244, 459265,
+    459521, 459778, 460304, 464386, 464896, 464897, 465161, 467462,
+    469001, 471296, 471296, 471298, 471809, 472069, 473350, 474888,
+    476933, 478213, 479489, 479752, 481793, 482056, 484096, 484098,
+    484620, 487687, 489484, 492549, 493832, 495872, 495885, 499207,
+    500997, 502278, 503811, 504581, 505857, 506113, 506379, 509184,
+    509184, 509195, 512000, 512000, 512010, 514569, 516864, 516868,
+    517888, 517888, 517900, 520963, 521732, 522755, 523528, 525577,
+    527872, 527875, 528656, 532739, 533508, 534530, 535058, 539650,
+    540165, 541442, 541967, 545792, 545798, 547331, 548100, 549125,
+    550415, 554245, 555524, 556552, 558598, 560136, 562179, 562944,
+    562947, 563713, 563978, 566528, 566537, 568832, 568848, 572928,
+    572928, 572933, 574221, 577539, 578308, 579332, 580352, 580361,
+    582662, 584193, 584448, 584459, 587277, 590601, 592896, 592898,
+    593413, 594706, 599296, 599298, 599808, 599825, 604160, 604160,
+    604168, 606225, 610564, 611585, 611840, 611854, 615424, 615429,
+    616707, 617476, 618507, 621312, 621316, 622339, 623105, 623367,
+    625155, 625926, 627462, 628995, 629762, 630274, 630789, 632064,
+    632064, 632077, 635397, 636680, 638723, 639493, 640782, 644361,
+    646662, 648193, 648448, 648449, 648705, 648971, 651784, 653837,
+    657159, 658944, 658944, 658954, 661504, 661504, 661511, 663297,
+    663559, 665344, 665346, 665857, 666115, 666880, 666882, 667396,
+    668416, 668416, 668421, 669696, 669699, 670466, 670980, 672001,
+    672258, 672769, 673025, 673281, 673536, 673539, 674304, 674307,
+    675072, 675076, 676097, 676352, 676352, 676356, 677379, 678149,
+    679429, 680709, 681988, 683015, 684802, 685312, 685314, 685824,
+    685828, 686851, 687616, 687616, 687619, 688385, 688642, 689153,
+    689409, 689665, 689921, 690177, 690436, 691458, 691972, 692993,
+    693249, 693505, 693761, 694019, 694786, 695297, 695553, 695813,
+    697089, 697345, 697601, 697859, 698628, 699649, 699905, 700161,
+    700418, 700930, 701440, 701441, 701696, 701698, 702211, 702977,
+    703233, 703488, 703489, 703745, 704001, 704257, 704513, 704769,
+    705025, 705282, 705794, 706305, 706561, 706821, 708098, 708610,
+    709122, 709634, 710149, 711425, 711681, 711937, 712193, 712449,
+    712707, 713477, 714756, 715780, 716803, 717570, 718082, 718593,
+    718849, 719105, 719362, 719873, 720129, 720388, 721409, 721665,
+    721921, 722178, 722691, 723458, 723969, 724228, 725251, 726018,
+    726531, 727297, 727553, 727812, 728832, 728833, 729090, 729601,
+    729856, 729857, 730114, 730624, 730627, 731396, 732417, 732679,
+    734464, 734465, 734721, 734978, 735489, 735745, 736001, 736256,
+    736256, 736258, 736769, 737026, 737537, 737793, 738049, 738305,
+    738562, 739074, 739585, 739843, 740609, 740865, 741122, 741633,
+    741889, 742150, 743681, 743937, 744193, 744449, 744706, 745217,
+    745473, 745730, 746243, 747008, 747008, 747008, 747010, 747522,
+    748032, 748032, 748032, 748032, 748032, 748032, 748033, 748289,
+    748546, 749057, 749313, 749571, 750337, 750594, 751106, 751618,
+    752128, 752129, 752388, 753413, 754690, 755204, 756226, 756737,
+    756996, 758020, 759044, 760066, 760586, 763137, 763393, 763650,
+    764168, 766213, 767491, 768258, 768770, 769282, 769795, 770560,
+    770564, 771585, 771840, 771841, 772106, 774657, 774913, 775170,
+    775684, 776706, 777222, 778753, 779011, 779776, 779776, 779778,
+    780290, 780800, 780802, 781313, 781572, 782593, 782848, 782849,
+    783105, 783361, 783618, 784129, 784385, 784644, 785670, 787202,
+    787719, 789508, 790529, 790785, 791043, 791812, 792832, 792832,
+    792834, 793345, 793601, 793856, 793857, 794114, 794626, 795138,
+    795651, 796418, 796929, 797184, 797185, 797440, 797442, 797953,
+    798208, 798208, 798209, 798465, 798720, 798721, 798977, 799233,
+    799489, 799747, 800515, 801281, 801537, 801792, 801793, 802050,
+    802560, 802562, 803075, 803842, 804354, 804864, 804866, 805378,
+    805891, 806657, 806912, 806913, 807168, 807169, 807426, 807936,
+    807938, 808451, 809220, 810244, 811266, 811779, 812546, 813057,
+    813313, 813569, 813825, 814080, 814081, 814337, 814593, 814848,
+    814854, 816384, 816388, 817409, 817665, 817921, 818177, 818433,
+    818688, 818688, 818688, 818689, 818945, 819201, 819457, 819713,
+    819969, 820227, 820997, 822272, 822272, 822274, 822785, 823041,
+    823296, 823296, 823299, 824069, 825345, 825601, 825858, 826371,
+    827137, 827393, 827649, 827907, 828672, 828674, 829184, 829186,
+    829700, 830720, 830721, 830979, 831745, 832000, 832000, 832002,
+    832518, 834053, 835328, 835330, 835841, 836098, 836608, 836609,
+    836865, 837121, 837376, 837378, 837888, 837893, 839169, 839427,
+    840193, 840449, 840704, 840704, 840705, 840962, 841474, 841984,
+    841985, 842240, 842241, 842497, 842754, 843265, 843524, 844548,
+    845570, 846081, 846337, 846593, 846849, 847106, 847618, 848132,
+    849156, 850180, 851201, 851458, 851969, 852226, 852737, 852993,
+    853248, 853248, 853248, 853249, 853506, 854019, 854784, 854786,
+    855298, 855809, 856066, 856576, 856576, 856576, 856577, 856832,
+    856832, 856833, 857088, 857089, 857347, 858115, 858881, 859136,
+    859137, 859393, 859648, 859650, 860162, 860676, 861696, 861697,
+    861953, 862209, 862466, 862979, 863748, 864771, 865536, 865540,
+    866566, 868098, 868609, 868864, 868864, 868865, 869120, 869120,
+    869120, 869121, 869379, 870144, 870145, 870401, 870657, 870913,
+    871169, 871427, 872193, 872449, 872706, 873218, 873729, 873984,
+    873984, 873988, 875009, 875264, 875264, 875264, 875264, 875265,
+    875520, 875520, 875520, 875523, 876289, 876546, 877057, 877313,
+    877568, 877568, 877569, 877824, 877825, 878080, 878082, 878594,
+    879108, 880131, 880897, 881152, 881152, 881152, 881152, 881153,
+    881408, 881409, 881667, 882433, 882688, 882689, 882945, 883200,
+    883201, 883457, 883712, 883714, 884224, 884225, 884481, 884737,
+    884994, 885505, 885762, 886278, 887811, 888580, 889603, 890370,
+    890881, 891136, 891138, 891649, 891905, 892161, 892420, 893442,
+    893956, 894977, 895234, 895745, 896000, 896000, 896002, 896513,
+    896774, 898306, 898817, 899073, 899328, 899329, 899584, 899586,
+    900096, 900097, 900352, 900353, 900609, 900864, 900865, 901120,
+    901124, 902145, 902401, 902657, 902913, 903172, 904192, 904194,
+    904706, 905216, 905217, 905472, 905472, 905473, 905729, 905987,
+    906753, 907011, 907777, 908033, 908289, 908550, 910088, 912128,
+    912138, 914690, 915204, 916225, 916481, 916738, 917251, 918016,
+    918018, 918534, 920065, 920322, 920833, 921090, 921600, 921602,
+    922113, 922369, 922631, 924424, 926464, 926467, 927233, 927490,
+    928002, 928513, 928768, 928768, 928769, 929024, 929024, 929025,
+    929282, 929792, 929793, 930049, 930304, 930306, 930819, 931585,
+    931841, 932097, 932352, 932354, 932865, 933121, 933377, 933633,
+    933892, 934913, 935169, 935434, 937984, 937992, 940032, 940034,
+    940548, 941569, 941827, 942593, 942849, 943105, 943363, 944131,
+    944898, 945415, 947201, 947457, 947714, 948228, 949249, 949508,
+    950529, 950784, 950785, 951042, 951554, 952069, 953344, 953345,
+    953604, 954625, 954881, 955136, 955137, 955392, 955392, 955393,
+    955648, 955651, 956418, 956932, 957956, 958977, 959232, 959233,
+    959489, 959744, 959747, 960512, 960512, 960513, 960768, 960770,
+    961281, 961536, 961537, 961793, 962050, 962561, 962819, 963585,
+    963840, 963842, 964353, 964610, 965120, 965121, 965377, 965633,
+    965890, 966400, 966401, 966659, 967425, 967680, 967680, 967687,
+    969473, 969729, 969987, 970757, 972033, 972289, 972545, 972801,
+    973057, 973314, 973825, 974080, 974082, 974596, 975616, 975617,
+    975874, 976385, 976641, 976896, 976896, 976897, 977152, 977153,
+    977409, 977665, 977922, 978433, 978688, 978691, 979458, 979970,
+    980481, 980737, 980994, 981504, 981504, 981504, 981505, 981762,
+    982277, 983554, 984065, 984321, 984580, 985600, 985601, 985857,
+    986112, 986113, 986369, 986626, 987136, 987137, 987394, 987906,
+    988416, 988417, 988675, 989440, 989441, 989697, 989952, 989952,
+    989952, 989954, 990465, 990723, 991490, 992000, 992002, 992513,
+    992770, 993283, 994048, 994048, 994048, 994048, 994049, 994307,
+    995072, 995074, 995585, 995840, 995845, 997122, 997634, 998144,
+    998145, 998401, 998656, 998657, 998912, 998913, 999168, 999168,
+    999169, 999424, 999425, 999681, 999937, 1000194, 1000705, 1000961,
+    1001217, 1001472, 1001478, 1003011, 1003781, 1005057, 1005313, 1005569,
+    1005825, 1006082, 1006593, 1006849, 1007107, 1007873, 1008129, 1008385,
+    1008640, 1008646, 1010177, 1010433, 1010688, 1010689, 1010945, 1011201,
+    1011457, 1011712, 1011713, 1011969, 1012225, 1012481, 1012740, 1013762,
+    1014274, 1014784, 1014785, 1015041, 1015297, 1015553, 1015810, 1016321,
+    1016578, 1017090, 1017602, 1018114, 1018628, 1019650, 1020161, 1020417,
+    1020673, 1020930, 1021440, 1021441, 1021699, 1022464, 1022464, 1022465,
+    1022722, 1023233, 1023488, 1023489, 1023747, 1024512, 1024512, 1024513,
+    1024771, 1025537, 1025793, 1026051, 1026817, 1027075, 1027841, 1028096,
+    1028097, 1028353, 1028613, 1029889, 1030145, 1030400, 1030403, 1031169,
+    1031425, 1031682, 1032194, 1032708, 1033730, 1034240, 1034242, 1034757,
+    1036033, 1036290, 1036800, 1036801, 1037057, 1037313, 1037569, 1037828,
+    1038849, 1039106, 1039616, 1039616, 1039617, 1039873, 1040130, 1040642,
+    1041152, 1041152, 1041153, 1041409, 1041665, 1041924, 1042944, 1042945,
+    1043202, 1043713, 1043970, 1044480, 1044484, 1045507, 1046272, 1046278,
+    1047809, 1048064, 1048065, 1048321, 1048577, 1048832, 1048834, 1049346,
+    1049860, 1050881, 1051137, 1051393, 1051649, 1051904, 1051906, 1052417,
+    1052673, 1052931, 1053697, 1053958, 1055493, 1056768, 1056768, 1056768,
+    1056771, 1057538, 1058050, 1058561, 1058816, 1058816, 1058818, 1059328,
+    1059328, 1059331, 1060097, 1060353, 1060608, 1060611, 1061377, 1061632,
+    1061633, 1061889, 1062145, 1062401, 1062659, 1063426, 1063937, 1064196,
+    1065217, 1065476, 1066497, 1066754, 1067265, 1067521, 1067776, 1067779,
+    1068545, 1068801, 1069056, 1069058, 1069572, 1070592, 1070593, 1070849,
+    1071105, 1071362, 1071874, 1072389, 1073665, 1073926, 1075458, 1075969,
+    1076232, 1078274, 1078786, 1079296, 1079299, 1080065, 1080323, 1081091,
+    1081858, 1082368, 1082369, 1082624, 1082625, 1082881, 1083137, 1083393,
+    1083650, 1084161, 1084416, 1084416, 1084417, 1084672, 1084672, 1084672,
+    1084673, 1084928, 1084928, 1084928, 1084928, 1084929, 1085185, 1085440,
+    1085441, 1085697, 1085952, 1085952, 1085954, 1086464, 1086468, 1087488,
+    1087489, 1087745, 1088000, 1088001, 1088256, 1088256, 1088257, 1088512,
+    1088513, 1088769, 1089024, 1089025, 1089280, 1089280, 1089282, 1089793,
+    1090050, 1090561, 1090817, 1091073, 1091331, 1092099, 1092865, 1093123,
+    1093889, 1094145, 1094400, 1094402, 1094912, 1094913, 1095169, 1095425,
+    1095682, 1096193, 1096449, 1096705, 1096963, 1097729, 1097989, 1099266,
+    1099781, 1101059, 1101826, 1102337, 1102592, 1102593, 1102849, 1103104,
+    1103109, 1104385, 1104646, 1106179, 1106947, 1107715, 1108480, 1108480,
+    1108484, 1109508, 1110529, 1110784, 1110785, 1111043, 1111809, 1112064,
+    1112066, 1112577, 1112838, 1114369, 1114626, 1115139, 1115905, 1116161,
+    1116418, 1116928, 1116929, 1117186, 1117697, 1117952, 1117956, 1118977,
+    1119234, 1119745, 1120003, 1120771, 1121540, 1122561, 1122818, 1123328,
+    1123329, 1123586, 1124098, 1124608, 1124608, 1124608, 1124608, 1124609,
+    1124866, 1125379, 1126145, 1126402, 1126912, 1126913, 1127168, 1127169,
+    1127426, 1127938, 1128448, 1128449, 1128708, 1129729, 1129985, 1130240,
+    1130242, 1130752, 1130754, 1131264, 1131264, 1131265, 1131521, 1131777,
+    1132034, 1132544, 1132547, 1133314, 1133824, 1133825, 1134085, 1135363,
+    1136129, 1136388, 1137411, 1138179, 1138945, 1139203, 1139968, 1139971,
+    1140737, 1140994, 1141505, 1141767, 1143553, 1143809, 1144065, 1144324,
+    1145344, 1145344, 1145344, 1145346, 1145856, 1145858, 1146375, 1148161,
+    1148419, 1149185, 1149440, 1149442, 1149952, 1149953, 1150208, 1150209,
+    1150464, 1150465, 1150721, 1150977, 1151232, 1151233, 1151489, 1151749,
+    1153026, 1153538, 1154049, 1154306, 1154816, 1154817, 1155073, 1155329,
+    1155589, 1156868, 1157889, 1158144, 1158145, 1158400, 1158401, 1158658,
+    1159168, 1159168, 1159168, 1159168, 1159169, 1159427, 1160193, 1160448,
+    1160450, 1160961, 1161219, 1161989, 1163266, 1163778, 1164290, 1164801,
+    1165057, 1165313, 1165571, 1166338, 1166849, 1167104, 1167104, 1167106,
+    1167617, 1167877, 1169153, 1169410, 1169921, 1170176, 1170177, 1170434,
+    1170945, 1171200, 1171202, 1171714, 1172226, 1172737, 1172992, 1172993,
+    1173248, 1173252, 1174277, 1175553, 1175809, 1176064, 1176065, 1176321,
+    1176579, 1177346, 1177859, 1178625, 1178881, 1179138, 1179649, 1179904,
+    1179905, 1180160, 1180162, 1180674, 1181185, 1181441, 1181697, 1181953,
+    1182208, 1182209, 1182466, 1182976, 1182978, 1183492, 1184514, 1185025,
+    1185280, 1185281, 1185537, 1185793, 1186048, 1186050, 1186561, 1186818,
+    1187328, 1187328, 1187329, 1187585, 1187842, 1188357, 1189635, 1190401,
+    1190657, 1190915, 1191681, 1191937, 1192193, 1192449, 1192704, 1192705,
+    1192960, 1192962, 1193473, 1193729, 1193986, 1194496, 1194497, 1194753,
+    1195010, 1195521, 1195777, 1196033, 1196293, 1197570, 1198080, 1198081,
+    1198336, 1198336, 1198337, 1198593, 1198850, 1199362, 1199872, 1199872,
+    1199873, 1200128, 1200128, 1200128, 1200128, 1200129, 1200385, 1200642,
+    1201153, 1201410, 1201921, 1202177, 1202433, 1202688, 1202689, 1202944,
+    1202946, 1203458, 1203969, 1204225, 1204483, 1205249, 1205506, 1206017,
+    1206273, 1206531, 1207297, 1207553, 1207808, 1207809, 1208065, 1208321,
+    1208576, 1208577, 1208834, 1209347, 1210115, 1210881, 1211137, 1211393,
+    1211649, 1211905, 1212161, 1212417, 1212673, 1212929, 1213184, 1213185,
+    1213442, 1213955, 1214721, 1214978, 1215489, 1215746, 1216257, 1216515,
+    1217281, 1217547, 1220353, 1220611, 1221377, 1221632, 1221636, 1222656,
+    1222656, 1222659, 1223426, 1223940, 1224964, 1225985, 1226242, 1226754,
+    1227266, 1227777, 1228033, 1228290, 1228801, 1229060, 1230081, 1230341,
+    1231618, 1232130, 1232641, 1232897, 1233154, 1233664, 1233665, 1233921,
+    1234177, 1234432, 1234434, 1234946, 1235459, 1236226, 1236736, 1236736,
+    1236736, 1236740, 1237764, 1238785, 1239047, 1240833, 1241089, 1241346,
+    1241857, 1242113, 1242370, 1242883, 1243649, 1243904, 1243905, 1244163,
+    1244931, 1245696, 1245696, 1245699, 1246466, 1246977, 1247235, 1248002,
+    1248515, 1249281, 1249538, 1250049, 1250305, 1250560, 1250562, 1251072,
+    1251074, 1251587, 1252353, 1252609, 1252866, 1253376, 1253377, 1253632,
+    1253633, 1253888, 1253891, 1254656, 1254657, 1254913, 1255169, 1255428,
+    1256449, 1256708, 1257731, 1258496, 1258496, 1258496, 1258497, 1258752,
+    1258754, 1259266, 1259776, 1259778, 1260291, 1261057, 1261320, 1263362,
+    1263872, 1263873, 1264131, 1264902, 1266432, 1266435, 1267200, 1267200,
+    1267200, 1267200, 1267201, 1267459, 1268227, 1268994, 1269505, 1269761,
+    1270019, 1270785, 1271042, 1271554, 1272069, 1273345, 1273601, 1273856,
+    1273857, 1274114, 1274624, 1274625, 1274882, 1275393, 1275648, 1275649,
+    1275905, 1276161, 1276417, 1276673, 1276933, 1278209, 1278465, 1278730,
+    1281283, 1282054, 1283585, 1283840, 1283841, 1284097, 1284352, 1284352,
+    1284353, 1284609, 1284865, 1285121, 1285376, 1285377, 1285632, 1285632,
+    1285633, 1285888, 1285888, 1285889, 1286144, 1286147, 1286915, 1287683,
+    1288450, 1288962, 1289474, 1289985, 1290242, 1290752, 1290753, 1291011,
+    1291781, 1293057, 1293314, 1293827, 1294592, 1294593, 1294849, 1295106,
+    1295617, 1295874, 1296386, 1296896, 1296897, 1297154, 1297666, 1298177,
+    1298433, 1298691, 1299456, 1299461, 1300737, 1300996, 1302018, 1302532,
+    1303553, 1303809, 1304066, 1304577, 1304832, 1304835, 1305603, 1306372,
+    1307395, 1308161, 1308420, 1309441, 1309696, 1309696, 1309698, 1310212,
+    1311232, 1311233, 1311488, 1311488, 1311489, 1311747, 1312513, 1312772,
+    1313793, 1314051, 1314818, 1315329, 1315588, 1316612, 1317632, 1317634,
+    1318144, 1318148, 1319172, 1320195, 1320960, 1320961, 1321217, 1321474,
+    1321985, 1322241, 1322498, 1323010, 1323520, 1323521, 1323778, 1324291,
+    1325056, 1325057, 1325316, 1326340, 1327361, 1327616, 1327618, 1328129,
+    1328386, 1328898, 1329409, 1329665, 1329923, 1330692, 1331714, 1332226,
+    1332738, 1333250, 1333763, 1334530, 1335040, 1335041, 1335300, 1336320,
+    1336321, 1336576, 1336580, 1337602, 1338114, 1338625, 1338881, 1339136,
+    1339140, 1340161, 1340417, 1340673, 1340928, 1340928, 1340930, 1341443,
+    1342209, 1342471, 1344259, 1345025, 1345280, 1345282, 1345793, 1346049,
+    1346305, 1346562, 1347073, 1347329, 1347590, 1349122, 1349632, 1349632,
+    1349633, 1349888, 1349889, 1350144, 1350147, 1350912, 1350917, 1352194,
+    1352705, 1352963, 1353728, 1353729, 1353984, 1353988, 1355011, 1355779,
+    1356547, 1357314, 1357827, 1358593, 1358848, 1358849, 1359104, 1359106,
+    1359618, 1360130, 1360641, 1360896, 1360899, 1361668, 1362695, 1364482,
+    1364996, 1366018, 1366529, 1366785, 1367041, 1367296, 1367296, 1367298,
+    1367812, 1368836, 1369856, 1369856, 1369857, 1370114, 1370625, 1370882,
+    1371395, 1372161, 1372418, 1372928, 1372929, 1373184, 1373184, 1373184,
+    1373185, 1373441, 1373697, 1373953, 1374208, 1374209, 1374465, 1374722,
+    1375234, 1375745, 1376001, 1376257, 1376513, 1376769, 1377029, 1378304,
+    1378307, 1379073, 1379330, 1379841, 1380099, 1380868, 1381890, 1382404,
+    1383425, 1383684, 1384706, 1385218, 1385728, 1385732, 1386753, 1387012,
+    1388033, 1388288, 1388289, 1388544, 1388545, 1388800, 1388800, 1388807,
+    1390592, 1390595, 1391361, 1391623, 1393409, 1393669, 1394947, 1395713,
+    1395969, 1396224, 1396225, 1396481, 1396736, 1396736, 1396738, 1397248,
+    1397249, 1397504, 1397505, 1397760, 1397761, 1398016, 1398016, 1398016,
+    1398018, 1398529, 1398785, 1399040, 1399042, 1399553, 1399809, 1400064,
+    1400065, 1400321, 1400582, 1402114, 1402626, 1403139, 1403909, 1405186,
+    1405698, 1406209, 1406464, 1406464, 1406465, 1406723, 1407488, 1407488,
+    1407491, 1408258, 1408769, 1409024, 1409026, 1409540, 1410561, 1410821,
+    1412096, 1412097, 1412358, 1413890, 1414401, 1414656, 1414656, 1414656,
+    1414656, 1414658, 1415171, 1415939, 1416704, 1416709, 1417984, 1417986,
+    1418499, 1419264, 1419267, 1420033, 1420289, 1420545, 1420801, 1421057,
+    1421314, 1421828, 1422850, 1423360, 1423366, 1424897, 1425152, 1425153,
+    1425410, 1425921, 1426180, 1427201, 1427456, 1427456, 1427456, 1427457,
+    1427713, 1427968, 1427969, 1428225, 1428481, 1428739, 1429507, 1430274,
+    1430784, 1430785, 1431042, 1431553, 1431813, 1433091, 1433860, 1434887,
+    1436674, 1437185, 1437440, 1437440, 1437441, 1437696, 1437697, 1437952,
+    1437953, 1438209, 1438464, 1438464, 1438464, 1438464, 1438464, 1438465,
+    1438721, 1438981, 1440256, 1440256, 1440256, 1440257, 1440512, 1440512,
+    1440512, 1440515, 1441280, 1441280, 1441280, 1441281, 1441538, 1442052,
+    1443072, 1443072, 1443074, 1443585, 1443841, 1444096, 1444098, 1444609,
+    1444864, 1444864, 1444864, 1444864, 1444867, 1445636, 1446657, 1446913,
+    1447168, 1447169, 1447427, 1448193, 1448448, 1448448, 1448449, 1448705,
+    1448961, 1449217, 1449473, 1449729, 1449985, 1450242, 1450753, 1451009,
+    1451265, 1451521, 1451779, 1452546, 1453056, 1453056, 1453057, 1453315,
+    1454081, 1454336, 1454337, 1454594, 1455105, 1455361, 1455616, 1455617,
+    1455873, 1456132, 1457153, 1457410, 1457920, 1457920, 1457920, 1457921,
+    1458176, 1458176, 1458177, 1458434, 1458944, 1458945, 1459202, 1459716,
+    1460737, 1460992, 1460992, 1460993, 1461250, 1461766, 1463297, 1463553,
+    1463809, 1464066, 1464577, 1464835, 1465600, 1465603, 1466369, 1466626,
+    1467138, 1467649, 1467904, 1467905, 1468162, 1468673, 1468930, 1469443,
+    1470213, 1471488, 1471493, 1472768, 1472768, 1472768, 1472768, 1472768,
+    1472768, 1472770, 1473282, 1473795, 1474561, 1474817, 1475073, 1475329,
+    1475585, 1475841, 1476096, 1476096, 1476096, 1476100, 1477122, 1477638,
+    1479170, 1479682, 1480194, 1480706, 1481216, 1481217, 1481472, 1481473,
+    1481732, 1482755, 1483520, 1483521, 1483779, 1484547, 1485313, 1485568,
+    1485570, 1486080, 1486084, 1487105, 1487363, 1488130, 1488641, 1488896,
+    1488898, 1489409, 1489665, 1489920, 1489921, 1490177, 1490433, 1490689,
+    1490946, 1491457, 1491715, 1492481, 1492736, 1492737, 1492992, 1492992,
+    1492993, 1493249, 1493506, 1494016, 1494017, 1494273, 1494528, 1494529,
+    1494785, 1495040, 1495041, 1495296, 1495297, 1495553, 1495809, 1496064,
+    1496064, 1496065, 1496320, 1496321, 1496577, 1496832, 1496832, 1496832,
+    1496833, 1497088, 1497090, 1497601, 1497856, 1497856, 1497856, 1497857,
+    1498114, 1498624, 1498625, 1498882, 1499393, 1499648, 1499648, 1499648,
+    1499648, 1499648, 1499649, 1499905, 1500162, 1500672, 1500673, 1500929,
+    1501184, 1501184, 1501184, 1501185, 1501440, 1501440, 1501441, 1501697,
+    1501953, 1502209, 1502464, 1502464, 1502465, 1502720, 1502720, 1502720,
+    1502720, 1502722, 1503232, 1503234, 1503744, 1503745, 1504001, 1504256,
+    1504257, 1504513, 1504768, 1504768, 1504768, 1504768, 1504771, 1505536,
+    1505536, 1505538, 1506049, 1506305, 1506561, 1506816, 1506816, 1506816,
+    1506816, 1506817, 1507072, 1507073, 1507328, 1507328, 1507328, 1507329,
+    1507585, 1507840, 1507840, 1507840, 1507840, 1507841, 1508096, 1508096,
+    1508097, 1508352, 1508352, 1508353, 1508610, 1509120, 1509122, 1509632,
+    1509632, 1509632, 1509633, 1509889, 1510144, 1510144, 1510144, 1510144,
+    1510145, 1510401, 1510657, 1510914, 1511424, 1511425, 1511681, 1511937,
+    1512193, 1512449, 1512704, 1512705, 1512961, 1513217, 1513472, 1513473,
+    1513729, 1513985, 1514240, 1514242, 1514753, 1515009, 1515264, 1515265,
+    1515520, 1515521, 1515777, 1516033, 1516288, 1516288, 1516289, 1516545,
+    1516800, 1516800, 1516801, 1517057, 1517313, 1517569, 1517825, 1518080,
+    1518080, 1518081, 1518337, 1518593, 1518851, 1519616, 1519616, 1519616,
+    1519618, 1520129, 1520385, 1520641, 1520896, 1520896, 1520896, 1520897,
+    1521154, 1521664, 1521664, 1521665, 1521920, 1521921, 1522177, 1522432,
+    1522432, 1522432, 1522433, 1522688, 1522688, 1522688, 1522689, 1522945,
+    1523201, 1523456, 1523458, 1523969, 1524225, 1524480, 1524480, 1524480,
+    1524481, 1524736, 1524736, 1524736, 1524737, 1524993, 1525249, 1525505,
+    1525761, 1526017, 1526274, 1526785, 1527042, 1527553, 1527809, 1528065,
+    1528321, 1528576, 1528577, 1528833, 1529088, 1529089, 1529345, 1529600,
+    1529600, 1529600, 1529601, 1529856, 1529856, 1529857, 1530114, 1530624,
+    1530625, 1530880, 1530881, 1531137, 1531394, 1531904, 1531905, 1532161,
+    1532417, 1532673, 1532929, 1533185, 1533440, 1533441, 1533696, 1533697,
+    1533953, 1534208, 1534209, 1534466, 1534977, 1535232, 1535233, 1535489,
+    1535745, 1536001, 1536257, 1536513, 1536769, 1537025, 1537280, 1537281,
+    1537538, 1538049, 1538306, 1538816, 1538817, 1539073, 1539329, 1539585,
+    1539841, 1540097, 1540352, 1540352, 1540352, 1540352, 1540352, 1540353,
+    1540609, 1540865, 1541121, 1541377, 1541632, 1541632, 1541633, 1541888,
+    1541889, 1542145, 1542401, 1542657, 1542912, 1542913, 1543170, 1543681,
+    1543936, 1543937, 1544192, 1544192, 1544192, 1544193, 1544449, 1544704,
+    1544704, 1544705, 1544961, 1545216, 1545217, 1545473, 1545728, 1545728,
+    1545728, 1545728, 1545728, 1545729, 1545984, 1545984, 1545984, 1545985,
+    1546241, 1546496, 1546496, 1546497, 1546752, 1546752, 1546752, 1546753,
+    1547009, 1547264, 1547264, 1547264, 1547265, 1547520, 1547521, 1547776,
+    1547776, 1547776, 1547776, 1547776, 1547778, 1548288, 1548289, 1548544,
+    1548545, 1548801, 1549057, 1549312, 1549313, 1549568, 1549568, 1549568,
+    1549568, 1549569, 1549825, 1550082, 1550593, 1550849, 1551104, 1551104,
+    1551105, 1551361, 1551616, 1551617, 1551873, 1552129, 1552385, 1552642,
+    1553153, 1553409, 1553665, 1553920, 1553921, 1554176, 1554176, 1554177,
+    1554432, 1554433, 1554688, 1554688, 1554689, 1554944, 1554946, 1555457,
+    1555712, 1555712, 1555713, 1555968, 1555968, 1555969, 1556225, 1556481,
+    1556737, 1556992, 1556993, 1557249, 1557504, 1557505, 1557760, 1557761,
+    1558016, 1558017, 1558276, 1559296, 1559296, 1559296, 1559296, 1559296,
+    1559296, 1559296, 1559296, 1559297, 1559553, 1559809, 1560064, 1560065,
+    1560320, 1560322, 1560832, 1560833, 1561089, 1561345, 1561601, 1561856,
+    1561857, 1562114, 1562624, 1562625, 1562881, 1563136, 1563137, 1563392,
+    1563392, 1563392, 1563393, 1563650, 1564161, 1564416, 1564417, 1564672,
+    1564673, 1564929, 1565184, 1565184, 1565186, 1565697, 1565952, 1565953,
+    1566208, 1566208, 1566208, 1566208, 1566209, 1566464, 1566465, 1566720,
+    1566720, 1566720, 1566720, 1566721, 1566976, 1566977, 1567232, 1567232,
+    1567232, 1567232, 1567232, 1567232, 1567232, 1567233, 1567488, 1567489,
+    1567745, 1568001, 1568256, 1568257, 1568512, 1568513, 1568769, 1569025,
+    1569282, 1569793, 1570048, 1570051, 1570817, 1571072, 1571072, 1571072,
+    1571072, 1571072, 1571073, 1571329, 1571584, 1571585, 1571840, 1571840,
+    1571841, 1572096, 1572097, 1572353, 1572608, 1572608, 1572608, 1572608,
+    1572609, 1572865, 1573120, 1573121, 1573376, 1573377, 1573633, 1573888,
+    1573888, 1573888, 1573889, 1574147, 1574913, 1575168, 1575169, 1575424,
+    1575424, 1575424, 1575424, 1575424, 1575424, 1575424, 1575425, 1575680,
+    1575681, 1575937, 1576192, 1576192, 1576193, 1576448, 1576448, 1576449,
+    1576705, 1576961, 1577217, 1577473, 1577728, 1577729, 1577984, 1577984,
+    1577984, 1577984, 1577984, 1577984, 1577984, 1577984, 1577984, 1577984,
+    1577985, 1578240, 1578240, 1578241, 1578497, 1578752, 1578752, 1578753,
+    1579008, 1579009, 1579264, 1579264, 1579265, 1579521, 1579777, 1580032,
+    1580033, 1580289, 1580544, 1580546, 1581056, 1581058, 1581568, 1581569,
+    1581824, 1581825, 1582081, 1582336, 1582336, 1582337, 1582593, 1582848,
+    1582849, 1583105, 1583360, 1583360, 1583361, 1583617, 1583873, 1584128,
+    1584128, 1584128, 1584128, 1584128, 1584129, 1584384, 1584384, 1584384,
+    1584385, 1584641, 1584896, 1584897, 1585153, 1585408, 1585409, 1585664,
+    1585664, 1585664, 1585665, 1585920, 1585921, 1586178, 1586688, 1586688,
+    1586689, 1586945, 1587200, 1587201, 1587457, 1587712, 1587712, 1587714,
+    1588225, 1588482, 1588992, 1588992, 1588992, 1588995, 1589761, 1590016,
+    1590017, 1590273, 1590530, 1591040, 1591041, 1591296, 1591297, 1591553,
+    1591808, 1591808, 1591809, 1592064, 1592065, 1592320, 1592321, 1592576,
+    1592576, 1592576, 1592576, 1592576, 1592576, 1592577, 1592832, 1592833,
+    1593088, 1593088, 1593088, 1593089, 1593345, 1593600, 1593601, 1593857,
+    1594113, 1594370, 1594881, 1595138, 1595648, 1595648, 1595648, 1595648,
+    1595649, 1595904, 1595904, 1595904, 1595904, 1595905, 1596161, 1596416,
+    1596416, 1596417, 1596673, 1596929, 1597184, 1597184, 1597184, 1597184,
+    1597184, 1597185, 1597442, 1597953, 1598210, 1598721, 1598976, 1598976,
+    1598976, 1598976, 1598976, 1598977, 1599232, 1599233, 1599489, 1599744,
+    1599744, 1599744, 1599744, 1599744, 1599745, 1600001, 1600256, 1600256,
+    1600257, 1600512, 1600513, 1600768, 1600768, 1600768, 1600768, 1600769,
+    1601026, 1601537, 1601792, 1601793, 1602048, 1602048, 1602048, 1602048,
+    1602049, 1602305, 1602561, 1602818, 1603329, 1603584, 1603584, 1603586,
+    1604096, 1604097, 1604353, 1604609, 1604864, 1604865, 1605120, 1605122,
+    1605632, 1605632, 1605632, 1605632, 1605632, 1605634, 1606145, 1606401,
+    1606658, 1607168, 1607168, 1607169, 1607424, 1607424, 1607424, 1607424,
+    1607425, 1607681, 1607936, 1607936, 1607936, 1607936, 1607936, 1607937,
+    1608193, 1608449, 1608705, 1608961, 1609218, 1609729, 1609984, 1609985,
+    1610240, 1610242, 1610752, 1610752, 1610754, 1611267, 1612033, 1612288,
+    1612289, 1612544, 1612544, 1612544, 1612544, 1612544, 1612544, 1612545,
+    1612800, 1612800, 1612800, 1612801, 1613056, 1613058, 1613568, 1613569,
+    1613824, 1613825, 1614080, 1614080, 1614082, 1614592, 1614592, 1614592,
+    1614593, 1614848, 1614849, 1615105, 1615360, 1615361, 1615617, 1615872,
+    1615872, 1615874, 1616385, 1616640, 1616640, 1616640, 1616640, 1616641,
+    1616896, 1616898, 1617408, 1617408, 1617408, 1617408, 1617409, 1617665,
+    1617921, 1618176, 1618176, 1618176, 1618176, 1618177, 1618433, 1618688,
+    1618689, 1618945, 1619200, 1619201, 1619456, 1619457, 1619713, 1619968,
+    1619968, 1619969, 1620224, 1620225, 1620480, 1620481, 1620738, 1621248,
+    1621248, 1621249, 1621505, 1621760, 1621760, 1621760, 1621760, 1621761,
+    1622017, 1622273, 1622529, 1622785, 1623040, 1623041, 1623296, 1623296,
+    1623297, 1623554, 1624064, 1624065, 1624320, 1624320, 1624320, 1624321,
+    1624577, 1624833, 1625088, 1625089, 1625344, 1625344, 1625346, 1625856,
+    1625856, 1625856, 1625857, 1626112, 1626113, 1626369, 1626624, 1626626,
+    1627136, 1627137, 1627393, 1627649, 1627904, 1627906, 1628417, 1628674,
+    1629185, 1629441, 1629696, 1629697, 1629952, 1629952, 1629952, 1629952,
+    1629952, 1629953, 1630208, 1630208, 1630208, 1630208, 1630208, 1630208,
+    1630210, 1630720, 1630720, 1630720, 1630720, 1630720, 1630720, 1630721,
+    1630977, 1631232, 1631234, 1631744, 1631745, 1632001, 1632256, 1632256,
+    1632256, 1632256, 1632257, 1632512, 1632512, 1632512, 1632512, 1632512,
+    1632512, 1632512, 1632512, 1632512, 1632512, 1632513, 1632768, 1632768,
+    1632768, 1632768, 1632769, 1633024, 1633024, 1633024, 1633024, 1633025,
+    1633281, 1633536, 1633537, 1633792, 1633793, 1634048, 1634048, 1634049,
+    1634304, 1634304, 1634304, 1634305, 1634562, 1635073, 1635329, 1635584,
+    1635585, 1635840, 1635841, 1636097, 1636352, 1636353, 1636608, 1636608,
+    1636608, 1636608, 1636609, 1636864, 1636864, 1636864, 1636864, 1636864,
+    1636864, 1636865, 1637120, 1637120, 1637121, 1637376, 1637377, 1637634,
+    1638146, 1638656, 1638657, 1638912, 1638913, 1639168, 1639169, 1639424,
+    1639425, 1639681, 1639937, 1640194, 1640704, 1640704, 1640704, 1640705,
+    1640962, 1641473, 1641728, 1641729, 1641984, 1641984, 1641984, 1641985,
+    1642240, 1642240, 1642240, 1642240, 1642240, 1642240, 1642240, 1642241,
+    1642497, 1642752, 1642752, 1642752, 1642753, 1643009, 1643264, 1643265,
+    1643520, 1643520, 1643520, 1643521, 1643776, 1643777, 1644033, 1644288,
+    1644289, 1644544, 1644547, 1645313, 1645568, 1645569, 1645825, 1646082,
+    1646592, 1646593, 1646848, 1646849, 1647104, 1647105, 1647360, 1647361,
+    1647617, 1647873, 1648129, 1648385, 1648644, 1649664, 1649666, 1650176,
+    1650177, 1650433, 1650690, 1651201, 1651456, 1651456, 1651456, 1651457,
+    1651715, 1652480, 1652480, 1652480, 1652480, 1652480, 1652481, 1652737,
+    1652992, 1652992, 1652992, 1652993, 1653249, 1653505, 1653760, 1653760,
+    1653761, 1654017, 1654274, 1654784, 1654785, 1655040, 1655041, 1655297,
+    1655552, 1655552, 1655553, 1655808, 1655809, 1656064, 1656065, 1656321,
+    1656577, 1656833, 1657089, 1657345, 1657601, 1657857, 1658114, 1658625,
+    1658882, 1659393, 1659648, 1659649, 1659904, 1659905, 1660161, 1660416,
+    1660417, 1660673, 1660928, 1660929, 1661185, 1661440, 1661440, 1661442,
+    1661954, 1662464, 1662464, 1662465, 1662720, 1662720, 1662721, 1662976,
+    1662976, 1662977, 1663232, 1663234, 1663746, 1664257, 1664512, 1664512,
+    1664512, 1664512, 1664512, 1664512, 1664512, 1664512, 1664513, 1664768,
+    1664768, 1664768, 1664768, 1664768, 1664768, 1664769, 1665024, 1665025,
+    1665281, 1665536, 1665537, 1665792, 1665793, 1666048, 1666049, 1666305,
+    1666560, 1666560, 1666560, 1666560, 1666561, 1666817, 1667072, 1667072,
+    1667072, 1667073, 1667328, 1667328, 1667328, 1667331, 1668098, 1668608,
+    1668610, 1669120, 1669120, 1669121, 1669377, 1669632, 1669633, 1669888,
+    1669888, 1669888, 1669888, 1669888, 1669888, 1669889, 1670145, 1670401,
+    1670657, 1670912, 1670913, 1671169, 1671425, 1671681, 1671936, 1671938,
+    1672449, 1672704, 1672705, 1672960, 1672960, 1672961, 1673216, 1673216,
+    1673216, 1673217, 1673472, 1673472, 1673472, 1673472, 1673472, 1673472,
+    1673472, 1673472, 1673473, 1673728, 1673730, 1674240, 1674240, 1674240,
+    1674240, 1674241, 1674496, 1674499, 1675264, 1675265, 1675521, 1675777,
+    1676032, 1676032, 1676032, 1676032, 1676032, 1676032, 1676032, 1676033,
+    1676288, 1676288, 1676288, 1676288, 1676288, 1676289, 1676544, 1676545,
+    1676800, 1676801, 1677056, 1677056, 1677057, 1677313, 1677568, 1677569,
+    1677824, 1677824, 1677824, 1677825, 1678080, 1678081, 1678336, 1678336,
+    1678337, 1678593, 1678848, 1678848, 1678848, 1678850, 1679360, 1679360,
+    1679361, 1679616, 1679618, 1680128, 1680128, 1680129, 1680385, 1680641,
+    1680897, 1681152, 1681153, 1681408, 1681408, 1681409, 1681664, 1681664,
+    1681665, 1681921, 1682176, 1682176, 1682176, 1682177, 1682432, 1682433,
+    1682688, 1682688, 1682688, 1682688, 1682688, 1682688, 1682689, 1682945,
+    1683202, 1683713, 1683970, 1684481, 1684736, 1684737, 1684993, 1685248,
+    1685248, 1685250, 1685761, 1686017, 1686273, 1686529, 1686784, 1686785,
+    1687040, 1687040, 1687040, 1687040, 1687042, 1687552, 1687552, 1687554,
+    1688064, 1688064, 1688065, 1688320, 1688321, 1688577, 1688833, 1689088,
+    1689089, 1689344, 1689344, 1689345, 1689600, 1689600, 1689600, 1689600,
+    1689601, 1689856, 1689857, 1690113, 1690368, 1690368, 1690368, 1690368,
+    1690369, 1690624, 1690625, 1690881, 1691136, 1691137, 1691392, 1691393,
+    1691649, 1691904, 1691904, 1691905, 1692160, 1692160, 1692160, 1692160,
+    1692160, 1692160, 1692160, 1692161, 1692418, 1692929, 1693184, 1693185,
+    1693440, 1693441, 1693697, 1693952, 1693953, 1694209, 1694464, 1694464,
+    1694465, 1694720, 1694721, 1694977, 1695232, 1695232, 1695233, 1695488,
+    1695488, 1695489, 1695745, 1696000, 1696000, 1696000, 1696000, 1696000,
+    1696001, 1696257, 1696512, 1696514, 1697024, 1697024, 1697026, 1697536,
+    1697536, 1697536, 1697536, 1697536, 1697538, 1698048, 1698048, 1698048,
+    1698048, 1698048, 1698049, 1698305, 1698560, 1698560, 1698560, 1698560,
+    1698560, 1698561, 1698817, 1699072, 1699072, 1699072, 1699072, 1699073,
+    1699329, 1699584, 1699586, 1700096, 1700098, 1700608, 1700608, 1700608,
+    1700608, 1700608, 1700608, 1700608, 1700608, 1700608, 1700608, 1700608,
+    1700608, 1700609, 1700864, 1700864, 1700864, 1700865, 1701121, 1701377,
+    1701632, 1701633, 1701888, 1701888, 1701889, 1702145, 1702400, 1702400,
+    1702400, 1702400, 1702401, 1702656, 1702656, 1702656, 1702656, 1702656,
+    1702656, 1702657, 1702912, 1702913, 1703168, 1703168, 1703168, 1703168,
+    1703168, 1703168, 1703169, 1703424, 1703424, 1703425, 1703680, 1703680,
+    1703680, 1703681, 1703937, 1704193, 1704448, 1704449, 1704705, 1704961,
+    1705216, 1705216, 1705216, 1705217, 1705473, 1705728, 1705728, 1705730,
+    1706241, 1706496, 1706497, 1706753, 1707009, 1707264, 1707265, 1707520,
+    1707521, 1707776, 1707776, 1707776, 1707776, 1707776, 1707776, 1707779,
+    1708544, 1708544, 1708544, 1708544, 1708545, 1708800, 1708800, 1708800,
+    1708800, 1708800, 1708801, 1709057, 1709312, 1709312, 1709312, 1709312,
+    1709312, 1709312, 1709312, 1709313, 1709568, 1709568, 1709568, 1709568,
+    1709569, 1709826, 1710336, 1710336, 1710336, 1710337, 1710592, 1710592,
+    1710592, 1710592, 1710593, 1710848, 1710849, 1711104, 1711105, 1711360,
+    1711361, 1711617, 1711872, 1711872, 1711872, 1711872, 1711872, 1711872,
+    1711873, 1712130, 1712640, 1712640, 1712640, 1712641, 1712897, 1713152,
+    1713153, 1713408, 1713408, 1713409, 1713666, 1714177, 1714432, 1714432,
+    1714433, 1714689, 1714944, 1714944, 1714945, 1715200, 1715200, 1715200,
+    1715200, 1715202, 1715713, 1715969, 1716224, 1716226, 1716736, 1716737,
+    1716992, 1716993, 1717248, 1717249, 1717504, 1717504, 1717505, 1717760,
+    1717761, 1718016, 1718016, 1718016, 1718017, 1718273, 1718530, 1719041,
+    1719296, 1719296, 1719298, 1719808, 1719808, 1719809, 1720064, 1720065,
+    1720321, 1720577, 1720832, 1720834, 1721344, 1721344, 1721345, 1721600,
+    1721601, 1721856, 1721856, 1721856, 1721856, 1721857, 1722114, 1722624,
+    1722624, 1722624, 1722624, 1722624, 1722625, 1722880, 1722880, 1722881,
+    1723136, 1723137, 1723392, 1723392, 1723392, 1723393, 1723648, 1723649,
+    1723905, 1724161, 1724417, 1724672, 1724672, 1724672, 1724673, 1724929,
+    1725185, 1725440, 1725440, 1725441, 1725697, 1725954, 1726464, 1726464,
+    1726465, 1726721, 1726976, 1726977, 1727232, 1727232, 1727233, 1727488,
+    1727489, 1727744, 1727744, 1727745, 1728001, 1728256, 1728256, 1728256,
+    1728257, 1728512, 1728512, 1728512, 1728512, 1728513, 1728768, 1728769,
+    1729024, 1729025, 1729280, 1729280, 1729280, 1729280, 1729280, 1729281,
+    1729536, 1729537, 1729792, 1729793, 1730049, 1730304, 1730305, 1730560,
+    1730560, 1730560, 1730561, 1730816, 1730817, 1731072, 1731072, 1731073,
+    1731328, 1731329, 1731585, 1731840, 1731840, 1731840, 1731840, 1731841,
+    1732096, 1732097, 1732352, 1732352, 1732352, 1732353, 1732609, 1732865,
+    1733120, 1733120, 1733120, 1733120, 1733120, 1733120, 1733120, 1733120,
+    1733120, 1733120, 1733121, 1733377, 1733633, 1733889, 1734144, 1734144,
+    1734145, 1734400, 1734401, 1734657, 1734913, 1735169, 1735424, 1735425,
+    1735681, 1735936, 1735936, 1735937, 1736192, 1736193, 1736448, 1736449,
+    1736704, 1736704, 1736705, 1736961, 1737217, 1737472, 1737473, 1737729,
+    1737984, 1737984, 1737985, 1738240, 1738240, 1738240, 1738240, 1738241,
+    1738496, 1738496, 1738496, 1738497, 1738752, 1738752, 1738753, 1739009,
+    1739265, 1739520, 1739521, 1739776, 1739776, 1739776, 1739776, 1739776,
+    1739776, 1739776, 1739777, 1740032, 1740034, 1740545, 1740800, 1740800,
+    1740801, 1741056, 1741056, 1741057, 1741312, 1741312, 1741312, 1741313,
+    1741568, 1741569, 1741824, 1741825, 1742080, 1742080, 1742081, 1742336,
+    1742338, 1742849, 1743105, 1743360, 1743363, 1744129, 1744385, 1744641,
+    1744898, 1745409, 1745664, 1745665, 1745920, 1745920, 1745920, 1745920,
+    1745922, 1746432, 1746432, 1746433, 1746688, 1746688, 1746692, 1747712,
+    1747713, 1747969, 1748224, 1748224, 1748224, 1748225, 1748481, 1748736,
+    1748736, 1748737, 1748993, 1749248, 1749249, 1749505, 1749761, 1750016,
+    1750017, 1750274, 1750785, 1751040, 1751043, 1751810, 1752320, 1752320,
+    1752321, 1752577, 1752833, 1753088, 1753089, 1753344, 1753345, 1753600,
+    1753602, 1754112, 1754112, 1754113, 1754368, 1754369, 1754625, 1754880,
+    1754881, 1755138, 1755648, 1755650, 1756161, 1756419, 1757188, 1758209,
+    1758465, 1758721, 1758977, 1759232, 1759233, 1759488, 1759489, 1759746,
+    1760256, 1760257, 1760512, 1760513, 1760768, 1760768, 1760768, 1760769,
+    1761025, 1761281, 1761536, 1761536, 1761537, 1761793, 1762049, 1762305,
+    1762560, 1762560, 1762560, 1762560, 1762561, 1762817, 1763072, 1763073,
+    1763329, 1763585, 1763840, 1763841, 1764096, 1764096, 1764096, 1764096,
+    1764096, 1764097, 1764353, 1764609, 1764865, 1765120, 1765120, 1765120,
+    1765121, 1765376, 1765378, 1765890, 1766400, 1766400, 1766401, 1766656,
+    1766656, 1766657, 1766912, 1766913, 1767168, 1767168, 1767168, 1767169,
+    1767424, 1767424, 1767424, 1767424, 1767425, 1767680, 1767680, 1767681,
+    1767936, 1767936, 1767937, 1768192, 1768192, 1768192, 1768192, 1768194,
+    1768704, 1768704, 1768704, 1768704, 1768705, 1768960, 1768960, 1768960,
+    1768961, 1769216, 1769217, 1769472, 1769472, 1769473, 1769730, 1770240,
+    1770240, 1770240, 1770240, 1770240, 1770240, 1770240, 1770240, 1770241,
+    1770496, 1770496, 1770497, 1770752, 1770752, 1770752, 1770752, 1770752,
+    1770753, 1771008, 1771009, 1771265, 1771520, 1771520, 1771521, 1771776,
+    1771777, 1772033, 1772288, 1772289, 1772544, 1772544, 1772545, 1772801,
+    1773056, 1773057, 1773312, 1773313, 1773569, 1773824, 1773824, 1773825,
+    1774080, 1774081, 1774337, 1774593, 1774851, 1775616, 1775616, 1775617,
+    1775873, 1776130, 1776641, 1776898, 1777408, 1777408, 1777408, 1777408,
+    1777408, 1777410, 1777920, 1777921, 1778176, 1778177, 1778433, 1778688,
+    1778688, 1778688, 1778689, 1778944, 1778944, 1778944, 1778945, 1779200,
+    1779201, 1779456, 1779457, 1779712, 1779714, 1780224, 1780225, 1780481,
+    1780737, 1780992, 1780993, 1781248, 1781248, 1781248, 1781248, 1781248,
+    1781249, 1781504, 1781504, 1781505, 1781760, 1781760, 1781760, 1781760,
+    1781761, 1782017, 1782272, 1782273, 1782529, 1782784, 1782784, 1782785,
+    1783040, 1783042, 1783552, 1783553, 1783809, 1784065, 1784321, 1784577,
+    1784833, 1785088, 1785088, 1785089, 1785344, 1785345, 1785600, 1785601,
+    1785856, 1785858, 1786368, 1786370, 1786881, 1787136, 1787136, 1787136,
+    1787136, 1787136, 1787136, 1787137, 1787392, 1787392, 1787392, 1787392,
+    1787393, 1787649, 1787904, 1787905, 1788160, 1788161, 1788416, 1788417,
+    1788673, 1788929, 1789184, 1789185, 1789440, 1789440, 1789441, 1789696,
+    1789696, 1789698, 1790208, 1790208, 1790208, 1790209, 1790465, 1790720,
+    1790721, 1790976, 1790977, 1791232, 1791234, 1791746, 1792256, 1792257,
+    1792513, 1792769, 1793024, 1793024, 1793024, 1793025, 1793280, 1793280,
+    1793280, 1793280, 1793281, 1793536, 1793536, 1793537, 1793793, 1794049,
+    1794305, 1794560, 1794562, 1795072, 1795073, 1795329, 1795585, 1795840,
+    1795840, 1795841, 1796096, 1796096, 1796097, 1796352, 1796352, 1796353,
+    1796608, 1796608, 1796608, 1796608, 1796608, 1796609, 1796865, 1797122,
+    1797633, 1797889, 1798144, 1798145, 1798400, 1798401, 1798657, 1798912,
+    1798912, 1798912, 1798912, 1798912, 1798912, 1798912, 1798912, 1798913,
+    1799169, 1799425, 1799681, 1799937, 1800192, 1800192, 1800193, 1800448,
+    1800448, 1800449, 1800705, 1800961, 1801216, 1801218, 1801728, 1801728,
+    1801728, 1801729, 1801984, 1801984, 1801984, 1801985, 1802240, 1802240,
+    1802240, 1802240, 1802241, 1802496, 1802496, 1802497, 1802752, 1802756,
+    1803777, 1804032, 1804032, 1804032, 1804032, 1804033, 1804288, 1804288,
+    1804291, 1805056, 1805056, 1805057, 1805312, 1805313, 1805570, 1806080,
+    1806081, 1806338, 1806849, 1807106, 1807616, 1807619, 1808384, 1808384,
+    1808384, 1808385, 1808640, 1808641, 1808896, 1808897, 1809152, 1809152,
+    1809155, 1809921, 1810176, 1810177, 1810432, 1810433, 1810688, 1810689,
+    1810944, 1810945, 1811200, 1811200, 1811200, 1811202, 1811712, 1811713,
+    1811968, 1811969, 1812225, 1812480, 1812480, 1812484, 1813505, 1813761,
+    1814017, 1814273, 1814530, 1815041, 1815297, 1815552, 1815554, 1816064,
+    1816064, 1816064, 1816065, 1816321, 1816576, 1816577, 1816832, 1816835,
+    1817601, 1817858, 1818368, 1818368, 1818369, 1818624, 1818624, 1818625,
+    1818881, 1819137, 1819393, 1819648, 1819649, 1819904, 1819904, 1819905,
+    1820161, 1820417, 1820672, 1820672, 1820674, 1821184, 1821184, 1821185,
+    1821441, 1821696, 1821696, 1821696, 1821696, 1821696, 1821696, 1821697,
+    1821952, 1821952, 1821952, 1821952, 1821952, 1821953, 1822208, 1822208,
+    1822209, 1822464, 1822465, 1822721, 1822976, 1822977, 1823232, 1823233,
+    1823488, 1823488, 1823488, 1823490, 1824001, 1824259, 1825024, 1825024,
+    1825024, 1825024, 1825024, 1825025, 1825280, 1825280, 1825280, 1825280,
+    1825280, 1825281, 1825537, 1825794, 1826305, 1826561, 1826817, 1827073,
+    1827329, 1827584, 1827587, 1828353, 1828608, 1828608, 1828609, 1828865,
+    1829123, 1829889, 1830145, 1830400, 1830401, 1830656, 1830657, 1830912,
+    1830912, 1830912, 1830913, 1831169, 1831424, 1831425, 1831680, 1831680,
+    1831681, 1831936, 1831938, 1832449, 1832705, 1832960, 1832960, 1832960,
+    1832960, 1832961, 1833217, 1833472, 1833473, 1833730, 1834240, 1834242,
+    1834753, 1835008, 1835008, 1835010, 1835520, 1835521, 1835777, 1836033,
+    1836289, 1836544, 1836544, 1836544, 1836545, 1836801, 1837056, 1837057,
+    1837313, 1837569, 1837824, 1837825, 1838081, 1838337, 1838592, 1838592,
+    1838592, 1838594, 1839104, 1839104, 1839105, 1839360, 1839360, 1839360,
+    1839360, 1839360, 1839361, 1839617, 1839872, 1839872, 1839873, 1840128,
+    1840128, 1840129, 1840385, 1840642, 1841153, 1841409, 1841664, 1841666,
+    1842177, 1842433, 1842688, 1842688, 1842689, 1842944, 1842944, 1842944,
+    1842946, 1843457, 1843713, 1843968, 1843968, 1843968, 1843968, 1843968,
+    1843969, 1844225, 1844482, 1844993, 1845249, 1845505, 1845761, 1846017,
+    1846274, 1846785, 1847041, 1847296, 1847296, 1847296, 1847296, 1847297,
+    1847552, 1847552, 1847552, 1847552, 1847552, 1847552, 1847553, 1847808,
+    1847809, 1848064, 1848066, 1848576, 1848577, 1848834, 1849344, 1849344,
+    1849345, 1849600, 1849601, 1849857, 1850112, 1850112, 1850113, 1850369,
+    1850624, 1850624, 1850624, 1850625, 1850881, 1851136, 1851136, 1851136,
+    1851136, 1851137, 1851394, 1851905, 1852161, 1852418, 1852928, 1852929,
+    1853184, 1853184, 1853184, 1853185, 1853441, 1853696, 1853696, 1853697,
+    1853952, 1853953, 1854208, 1854208, 1854209, 1854465, 1854720, 1854720,
+    1854720, 1854720, 1854720, 1854720, 1854720, 1854720, 1854720, 1854720,
+    1854720, 1854720, 1854720, 1854721, 1854976, 1854977, 1855233, 1855488,
+    1855489, 1855745, 1856001, 1856258, 1856768, 1856768, 1856769, 1857024,
+    1857025, 1857281, 1857536, 1857536, 1857537, 1857793, 1858048, 1858048,
+    1858049, 1858304, 1858305, 1858561, 1858816, 1858816, 1858817, 1859073,
+    1859328, 1859329, 1859585, 1859840, 1859841, 1860096, 1860096, 1860096,
+    1860097, 1860352, 1860352, 1860352, 1860352, 1860352, 1860353, 1860609,
+    1860866, 1861376, 1861376, 1861376, 1861376, 1861376, 1861377, 1861632,
+    1861632, 1861633, 1861888, 1861889, 1862144, 1862144, 1862145, 1862400,
+    1862403, 1863169, 1863424, 1863425, 1863680, 1863681, 1863936, 1863936,
+    1863936, 1863936, 1863936, 1863937, 1864192, 1864193, 1864448, 1864449,
+    1864705, 1864961, 1865216, 1865217, 1865473, 1865728, 1865728, 1865728,
+    1865729, 1865984, 1865984, 1865985, 1866240, 1866241, 1866497, 1866752,
+    1866752, 1866752, 1866752, 1866753, 1867009, 1867264, 1867265, 1867520,
+    1867521, 1867777, 1868033, 1868289, 1868544, 1868544, 1868544, 1868544,
+    1868545, 1868800, 1868801, 1869056, 1869057, 1869313, 1869568, 1869568,
+    1869568, 1869569, 1869825, 1870081, 1870337, 1870592, 1870592, 1870592,
+    1870592, 1870592, 1870592, 1870592, 1870592, 1870592, 1870592, 1870593,
+    1870849, 1871105, 1871361, 1871617, 1871872, 1871872, 1871873, 1872128,
+    1872129, 1872386, 1872896, 1872897, 1873152, 1873152, 1873152, 1873153,
+    1873408, 1873408, 1873408, 1873409, 1873664, 1873664, 1873664, 1873664,
+    1873664, 1873664, 1873664, 1873665, 1873921, 1874176, 1874177, 1874432,
+    1874435, 1875201, 1875457, 1875712, 1875712, 1875712, 1875713, 1875968,
+    1875969, 1876224, 1876225, 1876481, 1876736, 1876738, 1877249, 1877504,
+    1877505, 1877761, 1878017, 1878272, 1878272, 1878272, 1878273, 1878529,
+    1878784, 1878784, 1878785, 1879041, 1879296, 1879297, 1879553, 1879808,
+    1879808, 1879808, 1879808, 1879810, 1880320, 1880320, 1880320, 1880322,
+    1880832, 1880832, 1880833, 1881089, 1881344, 1881344, 1881345, 1881600,
+    1881601, 1881856, 1881857, 1882112, 1882112, 1882113, 1882368, 1882369,
+    1882624, 1882625, 1882881, 1883137, 1883392, 1883392, 1883393, 1883649,
+    1883904, 1883905, 1884161, 1884417, 1884673, 1884929, 1885184, 1885185,
+    1885441, 1885696, 1885696, 1885698, 1886210, 1886720, 1886721, 1886978,
+    1887488, 1887490, 1888001, 1888256, 1888256, 1888256, 1888257, 1888512,
+    1888512, 1888513, 1888768, 1888768, 1888769, 1889025, 1889281, 1889536,
+    1889538, 1890051, 1890818, 1891328, 1891329, 1891585, 1891841, 1892096,
+    1892096, 1892096, 1892096, 1892097, 1892353, 1892608, 1892608, 1892609,
+    1892865, 1893121, 1893377, 1893632, 1893632, 1893633, 1893889, 1894144,
+    1894145, 1894400, 1894401, 1894657, 1894913, 1895169, 1895424, 1895425,
+    1895681, 1895937, 1896193, 1896448, 1896448, 1896448, 1896448, 1896449,
+    1896705, 1896960, 1896960, 1896961, 1897217, 1897472, 1897473, 1897728,
+    1897729, 1897985, 1898241, 1898497, 1898752, 1898752, 1898752, 1898752,
+    1898753, 1899008, 1899008, 1899010, 1899520, 1899520, 1899521, 1899777,
+    1900032, 1900032, 1900033, 1900289, 1900544, 1900544, 1900544, 1900545,
+    1900804, 1901825, 1902080, 1902080, 1902082, 1902593, 1902849, 1903104,
+    1903106, 1903617, 1903872, 1903874, 1904384, 1904385, 1904643, 1905409,
+    1905665, 1905920, 1905921, 1906177, 1906433, 1906688, 1906689, 1906945,
+    1907200, 1907200, 1907200, 1907200, 1907200, 1907200, 1907200, 1907201,
+    1907456, 1907457, 1907712, 1907713, 1907968, 1907969, 1908224, 1908225,
+    1908480, 1908480, 1908480, 1908480, 1908480, 1908481, 1908736, 1908736,
+    1908736, 1908737, 1908992, 1908992, 1908992, 1908993, 1909249, 1909505,
+    1909761, 1910016, 1910016, 1910016, 1910017, 1910272, 1910272, 1910272,
+    1910274, 1910784, 1910784, 1910784, 1910786, 1911297, 1911552, 1911552,
+    1911553, 1911808, 1911811, 1912577, 1912832, 1912833, 1913089, 1913344,
+    1913345, 1913601, 1913859, 1914624, 1914624, 1914625, 1914881, 1915137,
+    1915394, 1915907, 1916673, 1916928, 1916928, 1916928, 1916929, 1917184,
+    1917185, 1917440, 1917440, 1917441, 1917696, 1917696, 1917697, 1917953,
+    1918208, 1918208, 1918208, 1918209, 1918464, 1918464, 1918465, 1918720,
+    1918720, 1918721, 1918976, 1918976, 1918976, 1918976, 1918977, 1919233,
+    1919489, 1919744, 1919744, 1919744, 1919744, 1919745, 1920000, 1920000,
+    1920002, 1920512, 1920512, 1920513, 1920768, 1920768, 1920768, 1920768,
+    1920769, 1921025, 1921281, 1921536, 1921537, 1921792, 1921792, 1921792,
+    1921793, 1922048, 1922049, 1922305, 1922561, 1922816, 1922816, 1922816,
+    1922817, 1923073, 1923329, 1923586, 1924097, 1924352, 1924353, 1924608,
+    1924608, 1924608, 1924608, 1924609, 1924865, 1925121, 1925376, 1925376,
+    1925376, 1925376, 1925377, 1925632, 1925632, 1925633, 1925890, 1926400,
+    1926401, 1926656, 1926657, 1926913, 1927169, 1927424, 1927424, 1927424,
+    1927425, 1927680, 1927680, 1927681, 1927937, 1928192, 1928193, 1928449,
+    1928704, 1928704, 1928704, 1928704, 1928705, 1928960, 1928960, 1928960,
+    1928960, 1928961, 1929217, 1929473, 1929729, 1929984, 1929984, 1929984,
+    1929984, 1929984, 1929985, 1930240, 1930240, 1930241, 1930496, 1930497,
+    1930752, 1930752, 1930752, 1930752, 1930752, 1930752, 1930753, 1931009,
+    1931266, 1931777, 1932032, 1932032, 1932032, 1932032, 1932033, 1932288,
+    1932288, 1932289, 1932544, 1932544, 1932545, 1932801, 1933056, 1933056,
+    1933056, 1933057, 1933312, 1933313, 1933569, 1933825, 1934080, 1934081,
+    1934336, 1934336, 1934337, 1934593, 1934848, 1934853, 1936129, 1936385,
+    1936641, 1936897, 1937152, 1937154, 1937665, 1937920, 1937921, 1938176,
+    1938180, 1939200, 1939200, 1939202, 1939712, 1939712, 1939712, 1939712,
+    1939712, 1939712, 1939712, 1939712, 1939713, 1939968, 1939968, 1939968,
+    1939968, 1939968, 1939969, 1940225, 1940481, 1940736, 1940736, 1940736,
+    1940736, 1940736, 1940737, 1940992, 1940992, 1940992, 1940993, 1941248,
+    1941249, 1941504, 1941504, 1941504, 1941504, 1941505, 1941760, 1941762,
+    1942273, 1942529, 1942784, 1942785, 1943040, 1943040, 1943040, 1943040,
+    1943041, 1943297, 1943553, 1943808, 1943808, 1943808, 1943808, 1943808,
+    1943809, 1944065, 1944321, 1944578, 1945088, 1945088, 1945088, 1945089,
+    1945344, 1945344, 1945344, 1945344, 1945344, 1945345, 1945601, 1945857,
+    1946112, 1946113, 1946368, 1946369, 1946624, 1946624, 1946624, 1946625,
+    1946881, 1947137, 1947393, 1947648, 1947649, 1947904, 1947905, 1948160,
+    1948160, 1948160, 1948160, 1948160, 1948160, 1948160, 1948161, 1948416,
+    1948416, 1948416, 1948417, 1948672, 1948673, 1948928, 1948928, 1948929,
+    1949184, 1949185, 1949441, 1949696, 1949696, 1949696, 1949697, 1949953,
+    1950208, 1950209, 1950464, 1950464, 1950464, 1950464, 1950464, 1950465,
+    1950721, 1950977, 1951232, 1951233, 1951489, 1951744, 1951745, 1952000,
+    1952001, 1952257, 1952513, 1952768, 1952769, 1953024, 1953025, 1953280,
+    1953280, 1953281, 1953536, 1953536, 1953536, 1953537, 1953792, 1953793,
+    1954049, 1954305, 1954561, 1954817, 1955072, 1955072, 1955073, 1955328,
+    1955329, 1955584, 1955584, 1955584, 1955586, 1956096, 1956097, 1956352,
+    1956352, 1956353, 1956608, 1956608, 1956609, 1956865, 1957120, 1957121,
+    1957376, 1957376, 1957377, 1957632, 1957632, 1957632, 1957632, 1957633,
+    1957889, 1958144, 1958145, 1958401, 1958657, 1958913, 1959169, 1959424,
+    1959424, 1959425, 1959680, 1959681, 1959937, 1960192, 1960193, 1960448,
+    1960449, 1960704, 1960705, 1960960, 1960961, 1961217, 1961473, 1961728,
+    1961728, 1961729, 1961985, 1962240, 1962241, 1962497, 1962752, 1962752,
+    1962752, 1962752, 1962752, 1962752, 1962758, 1964289, 1964544, 1964545,
+    1964801, 1965057, 1965313, 1965569, 1965825, 1966080, 1966080, 1966080,
+    1966080, 1966080, 1966081, 1966336, 1966337, 1966593, 1966848, 1966849,
+    1967105, 1967361, 1967616, 1967617, 1967872, 1967872, 1967872, 1967873,
+    1968128, 1968130, 1968640, 1968640, 1968640, 1968640, 1968640, 1968640,
+    1968640, 1968640, 1968640, 1968640, 1968640, 1968640, 1968640, 1968640,
+    1968641, 1968896, 1968896, 1968896, 1968896, 1968896, 1968896, 1968897,
+    1969152, 1969152, 1969152, 1969152, 1969152, 1969152, 1969152, 1969153,
+    1969408, 1969409, 1969664, 1969664, 1969664, 1969664, 1969664, 1969664,
+    1969665, 1969920, 1969920, 1969920, 1969920, 1969920, 1969920, 1969921,
+    1970176, 1970176, 1970176, 1970176, 1970176, 1970176, 1970176, 1970176,
+    1970176, 1970176, 1970176, 1970176, 1970176, 1970176, 1970176, 1970176,
+    1970176, 1970176, 1970177, 1970433, 1970688, 1970688, 1970689, 1970944,
+    1970944, 1970944, 1970944, 1970944, 1970944, 1970944, 1970944, 1970945,
+    1971201, 1971456, 1971458, 1971968, 1971969, 1972225, 1972481, 1972736,
+    1972736, 1972736, 1972736, 1972736, 1972736, 1972737, 1972992, 1972993,
+    1973248, 1973248, 1973248, 1973248, 1973249, 1973504, 1973504, 1973504,
+    1973504, 1973504, 1973504, 1973505, 1973760, 1973760, 1973760, 1973761,
+    1974016, 1974017, 1974272, 1974273, 1974528, 1974528, 1974529, 1974784,
+    1974785, 1975040, 1975040, 1975040, 1975040, 1975040, 1975040, 1975040,
+    1975040, 1975040, 1975040, 1975041, 1975297, 1975553, 1975808, 1975808,
+    1975809, 1976064, 1976064, 1976064, 1976064, 1976064, 1976064, 1976064,
+    1976064, 1976064, 1976065, 1976320, 1976320, 1976320, 1976320, 1976320,
+    1976320, 1976321, 1976576, 1976576, 1976576, 1976576, 1976576, 1976576,
+    1976576, 1976576, 1976576, 1976576, 1976576, 1976576, 1976576, 1976576,
+    1976576, 1976577, 1976832, 1976834, 1977344, 1977345, 1977601, 1977856,
+    1977857, 1978112, 1978112, 1978112, 1978112, 1978112, 1978113, 1978368,
+    1978368, 1978368, 1978368, 1978368, 1978368, 1978369, 1978625, 1978880,
+    1978880, 1978880, 1978881, 1979136, 1979136, 1979136, 1979137, 1979394,
+    1979904, 1979904, 1979904, 1979904, 1979904, 1979904, 1979905, 1980162,
+    1980672, 1980672, 1980673, 1980928, 1980928, 1980928, 1980928, 1980928,
+    1980928, 1980928, 1980928, 1980929, 1981184, 1981184, 1981184, 1981184,
+    1981184, 1981185, 1981440, 1981440, 1981441, 1981696, 1981696, 1981697,
+    1981952, 1981952, 1981953, 1982209, 1982465, 1982720, 1982720, 1982720,
+    1982720, 1982720, 1982720, 1982720, 1982721, 1982976, 1982977, 1983232,
+    1983232, 1983233, 1983488, 1983488, 1983488, 1983488, 1983489, 1983744,
+    1983744, 1983745, 1984000, 1984000, 1984000, 1984000, 1984001, 1984257,
+    1984512, 1984513, 1984768, 1984768, 1984769, 1985024, 1985025, 1985280,
+    1985280, 1985280, 1985281, 1985537, 1985792, 1985792, 1985792, 1985792,
+    1985792, 1985793, 1986048, 1986049, 1986305, 1986561, 1986816, 1986816,
+    1986816, 1986816, 1986816, 1986816, 1986816, 1986816, 1986816, 1986816,
+    1986816, 1986817, 1987073, 1987328, 1987329, 1987585, 1987841, 1988097,
+    1988353, 1988608, 1988608, 1988608, 1988608, 1988608, 1988609, 1988864,
+    1988864, 1988864, 1988864, 1988864, 1988865, 1989120, 1989120, 1989120,
+    1989120, 1989120, 1989120, 1989120, 1989120, 1989120, 1989120, 1989120,
+    1989121, 1989376, 1989378, 1989888, 1989888, 1989888, 1989888, 1989888,
+    1989889, 1990144, 1990144, 1990144, 1990144, 1990144, 1990144, 1990144,
+    1990145, 1990400, 1990400, 1990400, 1990400, 1990401, 1990657, 1990913,
+    1991168, 1991168, 1991168, 1991168, 1991169, 1991424, 1991425, 1991680,
+    1991680, 1991680, 1991680, 1991680, 1991681, 1991936, 1991936, 1991937,
+    1992192, 1992192, 1992192, 1992192, 1992193, 1992448, 1992448, 1992448,
+    1992448, 1992448, 1992449, 1992704, 1992704, 1992704, 1992705, 1992960,
+    1992960, 1992960, 1992960, 1992960, 1992960, 1992960, 1992960, 1992961,
+    1993217, 1993473, 1993728, 1993728, 1993728, 1993728, 1993729, 1993985,
+    1994241, 1994496, 1994496, 1994496, 1994496, 1994496, 1994496, 1994496,
+    1994496, 1994497, 1994752, 1994752, 1994752, 1994752, 1994752, 1994752,
+    1994752, 1994753, 1995008, 1995008, 1995008, 1995008, 1995009, 1995264,
+    1995264, 1995264, 1995264, 1995264, 1995264, 1995264, 1995264, 1995264,
+    1995264, 1995264, 1995266, 1995776, 1995776, 1995776, 1995778, 1996289,
+    1996544, 1996545, 1996801, 1997057, 1997312, 1997312, 1997312, 1997313,
+    1997568, 1997569, 1997824, 1997824, 1997824, 1997824, 1997824, 1997824,
+    1997824, 1997825, 1998080, 1998080, 1998080, 1998081, 1998336, 1998336,
+    1998338, 1998848, 1998848, 1998848, 1998848, 1998848, 1998849, 1999104,
+    1999104, 1999104, 1999104, 1999104, 1999104, 1999104, 1999104, 1999104,
+    1999104, 1999104, 1999104, 1999104, 1999104, 1999105, 1999360, 1999361,
+    1999616, 1999616, 1999616, 1999617, 1999872, 1999872, 1999872, 1999872,
+    1999872, 1999872, 1999873, 2000128, 2000129, 2000385, 2000640, 2000640,
+    2000641, 2000896, 2000896, 2000896, 2000896, 2000896, 2000896, 2000896,
+    2000896, 2000896, 2000896, 2000897, 2001152, 2001152, 2001152, 2001152,
+    2001152, 2001153, 2001408, 2001409, 2001664, 2001664, 2001664, 2001664,
+    2001664, 2001664, 2001664, 2001664, 2001664, 2001665, 2001921, 2002176,
+    2002176, 2002176, 2002177, 2002432, 2002433, 2002688, 2002688, 2002688,
+    2002692, 2003713, 2003968, 2003968, 2003968, 2003968, 2003968, 2003968,
+    2003968, 2003968, 2003969, 2004224, 2004224, 2004224, 2004225, 2004480,
+    2004480, 2004480, 2004480, 2004481, 2004737, 2004992, 2004992, 2004992,
+    2004993, 2005248, 2005248, 2005248, 2005248, 2005248, 2005248, 2005248,
+    2005248, 2005248, 2005249, 2005504, 2005505, 2005761, 2006016, 2006016,
+    2006016, 2006016, 2006016, 2006017, 2006272, 2006272, 2006272, 2006272,
+    2006272, 2006273, 2006528, 2006528, 2006528, 2006528, 2006528, 2006529,
+    2006785, 2007040, 2007041, 2007296, 2007296, 2007296, 2007296, 2007296,
+    2007296, 2007296, 2007296, 2007296, 2007296, 2007296, 2007296, 2007296,
+    2007296, 2007296, 2007296, 2007296, 2007297, 2007552, 2007552, 2007552,
+    2007552, 2007552, 2007553, 2007808, 2007808, 2007808, 2007808, 2007808,
+    2007808, 2007809, 2008064, 2008064, 2008064, 2008065, 2008320, 2008320,
+    2008320, 2008321, 2008577, 2008832, 2008833, 2009088, 2009089, 2009346,
+    2009857, 2010112, 2010113, 2010368, 2010369, 2010625, 2010880, 2010880,
+    2010880, 2010880, 2010880, 2010880, 2010880, 2010880, 2010881, 2011136,
+    2011136, 2011136, 2011137, 2011392, 2011393, 2011648, 2011648, 2011648,
+    2011648, 2011648, 2011649, 2011904, 2011904, 2011904, 2011905, 2012160,
+    2012160, 2012160, 2012160, 2012161, 2012416, 2012416, 2012416, 2012416,
+    2012416, 2012416, 2012417, 2012672, 2012672, 2012672, 2012672, 2012672,
+    2012673, 2012928, 2012929, 2013184, 2013185, 2013440, 2013440, 2013441,
+    2013697, 2013953, 2014208, 2014208, 2014209, 2014464, 2014464, 2014464,
+    2014465, 2014720, 2014721, 2014976, 2014976, 2014977, 2015232, 2015232,
+    2015233, 2015488, 2015489, 2015745, 2016001, 2016256, 2016257, 2016512,
+    2016512, 2016512, 2016515, 2017281, 2017536, 2017536, 2017536, 2017536,
+    2017536, 2017536, 2017537, 2017792, 2017792, 2017792, 2017793, 2018049,
+    2018306, 2018816, 2018816, 2018816, 2018817, 2019072, 2019072, 2019073,
+    2019330, 2019840, 2019841, 2020097, 2020352, 2020352, 2020352, 2020352,
+    2020353, 2020608, 2020608, 2020608, 2020609, 2020864, 2020864, 2020864,
+    2020864, 2020865, 2021121, 2021376, 2021377, 2021632, 2021633, 2021889,
+    2022144, 2022145, 2022401, 2022657, 2022912, 2022912, 2022912, 2022912,
+    2022912, 2022912, 2022912, 2022912, 2022912, 2022913, 2023169, 2023425,
+    2023681, 2023936, 2023936, 2023936, 2023936, 2023937, 2024192, 2024192,
+    2024193, 2024448, 2024449, 2024705, 2024960, 2024960, 2024960, 2024960,
+    2024960, 2024960, 2024960, 2024960, 2024960, 2024962, 2025472, 2025472,
+    2025472, 2025472, 2025473, 2025729, 2025985, 2026240, 2026242, 2026753,
+    2027009, 2027265, 2027520, 2027521, 2027776, 2027777, 2028033, 2028288,
+    2028288, 2028289, 2028544, 2028545, 2028800, 2028800, 2028802, 2029312,
+    2029313, 2029569, 2029824, 2029824, 2029824, 2029824, 2029825, 2030080,
+    2030081, 2030337, 2030593, 2030848, 2030848, 2030848, 2030848, 2030849,
+    2031104, 2031105, 2031360, 2031360, 2031361, 2031617, 2031872, 2031872,
+    2031872, 2031872, 2031873, 2032128, 2032128, 2032129, 2032384, 2032384,
+    2032384, 2032385, 2032640, 2032640, 2032641, 2032897, 2033153, 2033408,
+    2033409, 2033665, 2033920, 2033920, 2033920, 2033920, 2033920, 2033921,
+    2034177, 2034432, 2034432, 2034432, 2034432, 2034433, 2034688, 2034688,
+    2034688, 2034688, 2034688, 2034688, 2034688, 2034688, 2034688, 2034688,
+    2034689, 2034944, 2034945, 2035200, 2035201, 2035456, 2035457, 2035712,
+    2035712, 2035712, 2035713, 2035968, 2035970, 2036480, 2036481, 2036736,
+    2036737, 2036992, 2036992, 2036993, 2037248, 2037249, 2037504, 2037504,
+    2037504, 2037504, 2037504, 2037505, 2037760, 2037760, 2037760, 2037760,
+    2037760, 2037760, 2037760, 2037760, 2037760, 2037760, 2037761, 2038016,
+    2038017, 2038272, 2038272, 2038272, 2038273, 2038529, 2038786, 2039296,
+    2039296, 2039296, 2039297, 2039552, 2039552, 2039552, 2039552, 2039552,
+    2039552, 2039553, 2039808, 2039809, 2040064, 2040064, 2040064, 2040064,
+    2040065, 2040320, 2040320, 2040321, 2040576, 2040576, 2040576, 2040576,
+    2040577, 2040832, 2040833, 2041089, 2041344, 2041345, 2041601, 2041856,
+    2041857, 2042113, 2042368, 2042368, 2042368, 2042369, 2042624, 2042624,
+    2042624, 2042624, 2042624, 2042624, 2042625, 2042880, 2042881, 2043137,
+    2043393, 2043648, 2043648, 2043649, 2043904, 2043904, 2043904, 2043905,
+    2044160, 2044161, 2044417, 2044672, 2044672, 2044673, 2044928, 2044928,
+    2044928, 2044928, 2044928, 2044929, 2045185, 2045440, 2045441, 2045697,
+    2045953, 2046208, 2046208, 2046209, 2046465, 2046720, 2046720, 2046721,
+    2046976, 2046976, 2046978, 2047489, 2047745, 2048000, 2048000, 2048000,
+    2048001, 2048256, 2048257, 2048513, 2048768, 2048768, 2048769, 2049024,
+    2049024, 2049024, 2049025, 2049280, 2049280, 2049281, 2049536, 2049536,
+    2049537, 2049794, 2050305, 2050561, 2050816, 2050816, 2050816, 2050816,
+    2050817, 2051072, 2051073, 2051328, 2051328, 2051328, 2051328, 2051328,
+    2051328, 2051328, 2051329, 2051584, 2051585, 2051841, 2052096, 2052096,
+    2052096, 2052096, 2052096, 2052096, 2052096, 2052098, 2052608, 2052609,
+    2052864, 2052864, 2052864, 2052864, 2052865, 2053120, 2053120, 2053121,
+    2053376, 2053377, 2053632, 2053633, 2053888, 2053888, 2053888, 2053889,
+    2054144, 2054144, 2054145, 2054400, 2054400, 2054400, 2054400, 2054401,
+    2054656, 2054657, 2054913, 2055168, 2055169, 2055424, 2055425, 2055680,
+    2055680, 2055680, 2055681, 2055937, 2056193, 2056448, 2056448, 2056449,
+    2056705, 2056960, 2056961, 2057216, 2057217, 2057473, 2057729, 2057986,
+    2058497, 2058753, 2059010, 2059520, 2059520, 2059520, 2059521, 2059776,
+    2059776, 2059777, 2060032, 2060032, 2060032, 2060033, 2060288, 2060288,
+    2060288, 2060288, 2060289, 2060544, 2060544, 2060544, 2060544, 2060546,
+    2061056, 2061056, 2061056, 2061056, 2061057, 2061313, 2061569, 2061825,
+    2062080, 2062081, 2062336, 2062336, 2062336, 2062337, 2062592, 2062592,
+    2062592, 2062592, 2062593, 2062848, 2062849, 2063105, 2063360, 2063360,
+    2063360, 2063361, 2063616, 2063616, 2063616, 2063619, 2064384, 2064385,
+    2064640, 2064640, 2064640, 2064640, 2064640, 2064640, 2064640, 2064640,
+    2064640, 2064640, 2064640, 2064640, 2064640, 2064640, 2064641, 2064896,
+    2064897, 2065154, 2065664, 2065664, 2065664, 2065664, 2065664, 2065664,
+    2065664, 2065664, 2065664, 2065664, 2065665, 2065920, 2065921, 2066177,
+    2066432, 2066432, 2066432, 2066433, 2066689, 2066944, 2066944, 2066944,
+    2066944, 2066944, 2066945, 2067200, 2067201, 2067456, 2067457, 2067712,
+    2067712, 2067712, 2067712, 2067712, 2067712, 2067712, 2067713, 2067968,
+    2067968, 2067968, 2067968, 2067968, 2067968, 2067968, 2067968, 2067968,
+    2067969, 2068224, 2068224, 2068224, 2068224, 2068224, 2068224, 2068224,
+    2068224, 2068224, 2068224, 2068226, 2068736, 2068737, 2068992, 2068992,
+    2068992, 2068993, 2069249, 2069505, 2069761, 2070016, 2070017, 2070272,
+    2070273, 2070529, 2070784, 2070785, 2071041, 2071297, 2071552, 2071552,
+    2071552, 2071552, 2071552, 2071552, 2071553, 2071808, 2071808, 2071809,
+    2072064, 2072064, 2072064, 2072065, 2072322, 2072832, 2072832, 2072832,
+    2072832, 2072833, 2073088, 2073088, 2073088, 2073088, 2073088, 2073089,
+    2073344, 2073344, 2073344, 2073345, 2073600, 2073600, 2073601, 2073858,
+    2074368, 2074368, 2074369, 2074625, 2074880, 2074881, 2075137, 2075392,
+    2075393, 2075649, 2075905, 2076161, 2076417, 2076672, 2076672, 2076672,
+    2076673, 2076928, 2076929, 2077184, 2077185, 2077440, 2077440, 2077440,
+    2077440, 2077441, 2077697, 2077952, 2077952, 2077953, 2078208, 2078208,
+    2078208, 2078208, 2078208, 2078208, 2078208, 2078209, 2078464, 2078464,
+    2078466, 2078976, 2078977, 2079232, 2079232, 2079233, 2079489, 2079745,
+    2080000, 2080000, 2080000, 2080001, 2080257, 2080513, 2080768, 2080768,
+    2080768, 2080769, 2081024, 2081024, 2081024, 2081024, 2081025, 2081280,
+    2081280, 2081280, 2081280, 2081280, 2081280, 2081280, 2081281, 2081537,
+    2081792, 2081792, 2081792, 2081793, 2082048, 2082048, 2082048, 2082049,
+    2082305, 2082561, 2082817, 2083072, 2083073, 2083329, 2083584, 2083585,
+    2083840, 2083841, 2084096, 2084096, 2084096, 2084096, 2084096, 2084096,
+    2084096, 2084097, 2084353, 2084609, 2084865, 2085122, 2085633, 2085888,
+    2085888, 2085888, 2085889, 2086144, 2086144, 2086144, 2086145, 2086401,
+    2086656, 2086656, 2086656, 2086656, 2086657, 2086913, 2087169, 2087424,
+    2087424, 2087424, 2087424, 2087424, 2087424, 2087425, 2087681, 2087937,
+    2088195, 2088961, 2089216, 2089217, 2089473, 2089729, 2089984, 2089986,
+    2090497, 2090752, 2090752, 2090752, 2090753, 2091009, 2091265, 2091520,
+    2091521, 2091777, 2092032, 2092032, 2092033, 2092288, 2092289, 2092545,
+    2092800, 2092800, 2092800, 2092800, 2092800, 2092800, 2092800, 2092800,
+    2092800, 2092800, 2092800, 2092801, 2093056, 2093056, 2093056, 2093056,
+    2093056, 2093056, 2093056, 2093056, 2093056, 2093056, 2093056, 2093056,
+    2093056, 2093056, 2093056, 2093057, 2093312, 2093312, 2093312, 2093313,
+    2093568, 2093568, 2093568, 2093568, 2093569, 2093825, 2094081, 2094336,
+    2094336, 2094336, 2094336, 2094336, 2094336, 2094337, 2094592, 2094593,
+    2094848, 2094848, 2094849, 2095105, 2095360, 2095361, 2095616, 2095616,
+    2095617, 2095872, 2095873, 2096128, 2096128, 2096128, 2096128, 2096129,
+    2096385, 2096641, 2096896, 2096896, 2096897, 2097152, 2097152, 2097152,
+    2097153, 2097408, 2097408, 2097408, 2097408, 2097408, 2097408, 2097408,
+    2097408, 2097408, 2097409, 2097665, 2097921, 2098176, 2098176, 2098176,
+    2098177, 2098432, 2098432, 2098433, 2098688, 2098688, 2098689, 2098945,
+    2099200, 2099200, 2099200, 2099201, 2099456, 2099457, 2099713, 2099968,
+    2099968, 2099969, 2100224, 2100224, 2100225, 2100481, 2100736, 2100737,
+    2100992, 2100992, 2100992, 2100992, 2100992, 2100992, 2100992, 2100992,
+    2100992, 2100992, 2100992, 2100992, 2100992, 2100992, 2100992, 2100992,
+    2100993, 2101248, 2101249, 2101504, 2101505, 2101761, 2102016, 2102016,
+    2102016, 2102016, 2102017, 2102273, 2102528, 2102528, 2102528, 2102528,
+    2102528, 2102528, 2102528, 2102528, 2102528, 2102528, 2102529, 2102784,
+    2102784, 2102785, 2103040, 2103040, 2103041, 2103296, 2103296, 2103296,
+    2103296, 2103296, 2103296, 2103296, 2103296, 2103297, 2103552, 2103553,
+    2103809, 2104064, 2104065, 2104320, 2104320, 2104320, 2104320, 2104320,
+    2104320, 2104320, 2104320, 2104320, 2104320, 2104321, 2104577, 2104832,
+    2104832, 2104833, 2105088, 2105088, 2105088, 2105088, 2105088, 2105088,
+    2105088, 2105088, 2105088, 2105088, 2105088, 2105089, 2105344, 2105344,
+    2105344, 2105345, 2105601, 2105856, 2105857, 2106112, 2106112, 2106112,
+    2106112, 2106112, 2106112, 2106113, 2106369, 2106624, 2106625, 2106881,
+    2107136, 2107136, 2107136, 2107137, 2107392, 2107392, 2107393, 2107648,
+    2107648, 2107648, 2107648, 2107648, 2107649, 2107904, 2107904, 2107904,
+    2107904, 2107904, 2107904, 2107904, 2107904, 2107904, 2107904, 2107904,
+    2107905, 2108160, 2108161, 2108416, 2108416, 2108416, 2108416, 2108416,
+    2108416, 2108417, 2108672, 2108673, 2108928, 2108928, 2108928, 2108929,
+    2109185, 2109440, 2109440, 2109440, 2109440, 2109440, 2109440, 2109440,
+    2109441, 2109696, 2109696, 2109696, 2109696, 2109697, 2109952, 2109952,
+    2109952, 2109952, 2109952, 2109953, 2110208, 2110208, 2110209, 2110465,
+    2110720, 2110720, 2110720, 2110720, 2110720, 2110720, 2110720, 2110720,
+    2110720, 2110720, 2110720, 2110720, 2110721, 2110977, 2111232, 2111232,
+    2111232, 2111232, 2111232, 2111232, 2111232, 2111232, 2111232, 2111232,
+    2111232, 2111232, 2111232, 2111232, 2111232, 2111233, 2111488, 2111488,
+    2111488, 2111488, 2111488, 2111488, 2111488, 2111489, 2111744, 2111745,
+    2112000, 2112000, 2112000, 2112000, 2112001, 2112257, 2112512, 2112512,
+    2112513, 2112769, 2113024, 2113024, 2113024, 2113024, 2113024, 2113024,
+    2113024, 2113024, 2113025, 2113280, 2113280, 2113280, 2113281, 2113536,
+    2113536, 2113536, 2113537, 2113793, 2114048, 2114049, 2114304, 2114304,
+    2114305, 2114560, 2114561, 2114816, 2114816, 2114816, 2114816, 2114817,
+    2115072, 2115072, 2115072, 2115073, 2115329, 2115584, 2115585, 2115840,
+    2115840, 2115840, 2115841, 2116096, 2116097, 2116352, 2116352, 2116352,
+    2116353, 2116608, 2116609, 2116865, 2117120, 2117120, 2117120, 2117120,
+    2117120, 2117120, 2117120, 2117120, 2117120, 2117120, 2117120, 2117121,
+    2117377, 2117633, 2117888, 2117888, 2117888, 2117890, 2118400, 2118400,
+    2118401, 2118656, 2118656, 2118656, 2118656, 2118657, 2118912, 2118912,
+    2118912, 2118913, 2119168, 2119169, 2119424, 2119424, 2119424, 2119424,
+    2119424, 2119424, 2119425, 2119680, 2119680, 2119680, 2119682, 2120192,
+    2120192, 2120193, 2120448, 2120448, 2120448, 2120448, 2120448, 2120448,
+    2120448, 2120449, 2120704, 2120704, 2120704, 2120705, 2120960, 2120960,
+    2120960, 2120961, 2121217, 2121472, 2121472, 2121472, 2121472, 2121472,
+    2121473, 2121729, 2121984, 2121985, 2122241, 2122497, 2122752, 2122752,
+    2122752, 2122752, 2122753, 2123008, 2123008, 2123008, 2123008, 2123009,
+    2123265, 2123520, 2123520, 2123520, 2123520, 2123520, 2123520, 2123520,
+    2123520, 2123521, 2123777, 2124032, 2124032, 2124032, 2124032, 2124032,
+    2124032, 2124032, 2124032, 2124032, 2124032, 2124032, 2124033, 2124288,
+    2124288, 2124288, 2124288, 2124288, 2124289, 2124544, 2124545, 2124800,
+    2124800, 2124800, 2124800, 2124800, 2124801, 2125057, 2125312, 2125312,
+    2125312, 2125312, 2125312, 2125312, 2125312, 2125312, 2125312, 2125312,
+    2125313, 2125568, 2125568, 2125568, 2125568, 2125568, 2125568, 2125568,
+    2125569, 2125825, 2126080, 2126080, 2126080, 2126080, 2126080, 2126081,
+    2126337, 2126592, 2126592, 2126592, 2126593, 2126848, 2126849, 2127105,
+    2127360, 2127362, 2127872, 2127872, 2127872, 2127872, 2127873, 2128128,
+    2128128, 2128129, 2128384, 2128385, 2128641, 2128896, 2128897, 2129152,
+    2129152, 2129152, 2129152, 2129152, 2129152, 2129152, 2129153, 2129409,
+    2129664, 2129664, 2129664, 2129664, 2129665, 2129920, 2129920, 2129920,
+    2129920, 2129920, 2129920, 2129920, 2129920, 2129920, 2129920, 2129921,
+    2130176, 2130176, 2130176, 2130176, 2130176, 2130177, 2130432, 2130432,
+    2130432, 2130433, 2130688, 2130688, 2130688, 2130689, 2130944, 2130944,
+    2130945, 2131200, 2131200, 2131201, 2131457, 2131712, 2131712, 2131712,
+    2131712, 2131713, 2131969, 2132224, 2132224, 2132224, 2132224, 2132224,
+    2132224, 2132224, 2132224, 2132225, 2132482, 2132992, 2132992, 2132992,
+    2132992, 2132993, 2133248, 2133249, 2133505, 2133760, 2133760, 2133761,
+    2134016, 2134017, 2134272, 2134272, 2134272, 2134272, 2134274, 2134784,
+    2134784, 2134784, 2134784, 2134785, 2135040, 2135040, 2135040, 2135040,
+    2135040, 2135040, 2135040, 2135040, 2135040, 2135040, 2135040, 2135041,
+    2135296, 2135296, 2135296, 2135296, 2135296, 2135296, 2135297, 2135552,
+    2135552, 2135552, 2135552, 2135552, 2135553, 2135808, 2135809, 2136064,
+    2136065, 2136320, 2136320, 2136320, 2136321, 2136576, 2136577, 2136832,
+    2136832, 2136834, 2137344, 2137345, 2137600, 2137602, 2138112, 2138112,
+    2138112, 2138112, 2138112, 2138112, 2138113, 2138368, 2138368, 2138368,
+    2138369, 2138624, 2138624, 2138624, 2138624, 2138625, 2138880, 2138880,
+    2138881, 2139137, 2139392, 2139392, 2139393, 2139648, 2139648, 2139648,
+    2139649, 2139905, 2140160, 2140160, 2140161, 2140416, 2140416, 2140416,
+    2140416, 2140416, 2140416, 2140417, 2140672, 2140672, 2140672, 2140672,
+    2140672, 2140673, 2140928, 2140928, 2140929, 2141184, 2141184, 2141184,
+    2141184, 2141184, 2141184, 2141184, 2141185, 2141440, 2141440, 2141440,
+    2141440, 2141440, 2141440, 2141441, 2141696, 2141696, 2141696, 2141697,
+    2141952, 2141952, 2141953, 2142208, 2142208, 2142209, 2142464, 2142465,
+    2142720, 2142720, 2142720, 2142720, 2142721, 2142976, 2142976, 2142976,
+    2142976, 2142976, 2142976, 2142976, 2142977, 2143232, 2143232, 2143233,
+    2143488, 2143488, 2143488, 2143488, 2143489, 2143744, 2143744, 2143744,
+    2143744, 2143745, 2144000, 2144000, 2144000, 2144000, 2144000, 2144000,
+    2144000, 2144001, 2144257, 2144512, 2144512, 2144512, 2144512, 2144512,
+    2144513, 2144768, 2144768, 2144768, 2144768, 2144768, 2144768, 2144768,
+    2144768, 2144768, 2144769, 2145025, 2145280, 2145280, 2145280, 2145280,
+    2145281, 2145537, 2145792, 2145792, 2145792, 2145793, 2146048, 2146048,
+    2146048, 2146049, 2146304, 2146304, 2146305, 2146560, 2146560, 2146560,
+    2146560, 2146560, 2146560, 2146561, 2146817, 2147072, 2147072, 2147072,
+    2147073, 2147328, 2147328, 2147328, 2147328, 2147329, 2147584, 2147584,
+    2147584, 2147585, 2147840, 2147841, 2148096, 2148096, 2148096, 2148097,
+    2148352, 2148352, 2148352, 2148353, 2148610, 2149120, 2149120, 2149120,
+    2149120, 2149121, 2149376, 2149376, 2149376, 2149376, 2149376, 2149376,
+    2149376, 2149376, 2149376, 2149376, 2149376, 2149376, 2149376, 2149376,
+    2149376, 2149376, 2149376, 2149376, 2149376, 2149376, 2149376, 2149376,
+    2149376, 2149376, 2149376, 2149376, 2149376, 2149377, 2149632, 2149632,
+    2149632, 2149633, 2149888, 2149888, 2149888, 2149888, 2149888, 2149889,
+    2150144, 2150144, 2150144, 2150144, 2150144, 2150144, 2150144,
+};
+static const std::uint8_t en_us_trie_labels[] = {
+    0, 46, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 97, 98, 99, 100,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114, 115, 116, 117,
+    118, 119, 121, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 97, 98, 100, 101,
+    102, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114, 115, 116, 117, 118, 119,
+    121, 97, 99, 101, 104, 105, 107, 108, 110, 111, 113, 114, 115, 116, 117, 121,
+    122, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 114, 115, 116, 117, 118, 119, 121, 97, 98, 99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 97, 98, 100, 101, 102, 104, 105, 108, 109, 110, 111, 112, 114, 115, 116,
+    117, 121, 97, 98, 100, 101, 103, 104, 105, 108, 109, 110, 111, 112, 114, 115,
+    116, 117, 119, 121, 97, 98, 101, 102, 104, 105, 107, 108, 109, 110, 111, 112,
+    114, 115, 116, 117, 119, 121, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+    107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+    97, 101, 111, 117, 97, 98, 101, 102, 104, 105, 107, 108, 109, 110, 111, 114,
+    115, 116, 119, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+    110, 111, 112, 114, 115, 116, 117, 118, 119, 121, 97, 98, 99, 101, 102, 104,
+    105, 107, 108, 109, 110, 111, 112, 114, 115, 116, 117, 119, 97, 98, 99, 100,
+    101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 121, 122, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 97, 98,
+    100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 114, 115, 116, 117,
+    119, 117, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+    111, 112, 114, 115, 116, 117, 118, 119, 121, 122, 97, 98, 99, 100, 101, 102,
+    103, 104, 105, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    121, 97, 98, 99, 100, 101, 102, 103, 104, 105, 108, 109, 110, 111, 112, 114,
+    115, 116, 117, 118, 119, 121, 122, 97, 98, 99, 100, 101, 102, 103, 105, 106,
+    107, 108, 109, 110, 111, 112, 114, 115, 116, 117, 118, 120, 122, 97, 101, 105,
+    111, 118, 121, 97, 98, 99, 101, 104, 105, 107, 108, 110, 111, 112, 114, 115,
+    116, 121, 97, 99, 101, 104, 105, 111, 112, 113, 116, 117, 120, 97, 98, 99,
+    100, 101, 103, 104, 105, 108, 109, 110, 111, 112, 114, 115, 116, 119, 97, 98,
+    101, 105, 108, 109, 111, 116, 122, 99, 100, 102, 108, 109, 110, 114, 115, 116,
+    117, 118, 119, 97, 101, 114, 117, 97, 101, 104, 105, 111, 101, 105, 111, 114,
+    117, 97, 98, 101, 103, 108, 110, 113, 114, 115, 116, 117, 118, 121, 101, 111,
+    97, 101, 105, 111, 97, 101, 105, 111, 100, 109, 110, 114, 115, 117, 105, 111,
+    97, 101, 105, 97, 101, 105, 111, 117, 101, 105, 111, 100, 102, 114, 115, 116,
+    117, 101, 105, 111, 114, 97, 101, 105, 111, 117, 99, 101, 104, 105, 112, 116,
+    121, 97, 101, 104, 105, 111, 114, 110, 112, 114, 115, 101, 105, 101, 105, 101,
+    46, 97, 101, 105, 108, 111, 114, 117, 97, 101, 104, 105, 114, 116, 117, 100,
+    101, 105, 108, 111, 114, 115, 117, 114, 102, 97, 101, 105, 108, 110, 111, 117,
+    121, 97, 101, 108, 111, 97, 99, 108, 110, 116, 101, 97, 100, 101, 105, 108,
+    109, 111, 121, 97, 101, 105, 111, 112, 97, 100, 101, 103, 105, 107, 110, 111,
+    115, 116, 117, 97, 101, 104, 105, 108, 111, 115, 117, 117, 97, 98, 99, 100,
+    101, 102, 105, 109, 111, 112, 113, 114, 115, 46, 97, 104, 105, 107, 108, 111,
+    112, 115, 116, 117, 121, 97, 101, 104, 105, 111, 114, 115, 116, 117, 121, 98,
+    103, 108, 110, 114, 115, 116, 97, 101, 105, 111, 97, 105, 108, 115, 105, 97,
+    101, 115, 105, 122, 46, 99, 100, 103, 108, 110, 114, 115, 116, 122, 101, 105,
+    46, 97, 100, 103, 108, 109, 110, 115, 116, 118, 119, 121, 98, 100, 101, 102,
+    108, 110, 111, 116, 97, 101, 105, 111, 117, 101, 100, 101, 108, 109, 110, 111,
+    114, 115, 116, 117, 105, 111, 117, 111, 108, 111, 114, 102, 103, 108, 109, 110,
+    114, 115, 116, 46, 115, 98, 99, 100, 103, 104, 108, 110, 112, 114, 115, 116,
+    118, 104, 105, 111, 46, 100, 105, 108, 110, 112, 114, 115, 116, 119, 46, 97,
+    101, 105, 111, 115, 116, 97, 99, 101, 102, 103, 105, 108, 109, 110, 111, 112,
+    115, 116, 122, 105, 97, 101, 105, 121, 97, 101, 103, 105, 108, 109, 110, 112,
+    114, 115, 117, 118, 119, 122, 97, 101, 105, 111, 117, 97, 101, 105, 114, 117,
+    119, 100, 102, 105, 108, 109, 110, 112, 114, 115, 116, 101, 46, 98, 99, 102,
+    103, 108, 109, 110, 114, 116, 118, 121, 97, 105, 46, 97, 98, 99, 100, 101,
+    102, 105, 108, 109, 110, 112, 113, 114, 115, 116, 118, 121, 97, 101, 105, 121,
+    46, 97, 99, 100, 101, 102, 103, 108, 109, 110, 111, 112, 114, 115, 116, 118,
+    97, 101, 105, 111, 117, 121, 46, 100, 101, 102, 103, 108, 109, 110, 111, 112,
+    114, 115, 117, 118, 119, 120, 97, 101, 105, 111, 117, 121, 112, 119, 121, 97,
+    104, 97, 99, 101, 103, 108, 109, 110, 111, 112, 110, 115, 98, 99, 100, 103,
+    108, 109, 110, 114, 115, 116, 118, 101, 105, 114, 97, 99, 101, 104, 105, 108,
+    111, 114, 116, 117, 97, 100, 101, 103, 105, 111, 114, 117, 99, 100, 102, 108,
+    109, 110, 112, 115, 116, 120, 101, 102, 105, 111, 117, 97, 101, 105, 110, 111,
+    117, 121, 101, 99, 100, 103, 109, 110, 114, 116, 117, 105, 108, 97, 101, 102,
+    105, 108, 111, 115, 116, 117, 97, 98, 101, 105, 110, 111, 112, 117, 121, 97,
+    99, 100, 101, 105, 110, 111, 115, 116, 117, 121, 122, 102, 103, 105, 108, 112,
+    114, 115, 116, 117, 119, 97, 101, 104, 105, 108, 111, 114, 115, 116, 117, 117,
+    97, 98, 99, 101, 104, 105, 109, 110, 111, 115, 116, 117, 119, 97, 99, 101,
+    104, 105, 107, 109, 111, 112, 115, 116, 117, 119, 97, 101, 104, 105, 110, 111,
+    114, 117, 121, 122, 99, 110, 112, 114, 115, 116, 97, 101, 105, 111, 117, 97,
+    101, 104, 105, 112, 99, 101, 115, 98, 99, 103, 105, 108, 109, 114, 116, 117,
+    46, 97, 98, 99, 100, 108, 109, 110, 114, 118, 101, 105, 108, 121, 97, 99,
+    100, 103, 108, 110, 115, 116, 97, 101, 105, 111, 117, 121, 110, 114, 115, 97,
+    101, 105, 111, 111, 121, 101, 103, 109, 110, 114, 115, 116, 102, 108, 109, 110,
+    114, 115, 116, 122, 46, 100, 101, 108, 110, 111, 114, 115, 116, 118, 101, 108,
+    111, 105, 111, 116, 46, 97, 99, 101, 108, 109, 110, 111, 114, 115, 117, 118,
+    122, 97, 101, 105, 111, 121, 97, 101, 105, 111, 46, 98, 101, 103, 105, 110,
+    111, 114, 115, 118, 97, 101, 105, 111, 117, 116, 104, 97, 101, 105, 110, 115,
+    116, 110, 114, 98, 99, 101, 103, 105, 108, 109, 110, 112, 114, 115, 116, 117,
+    122, 97, 99, 100, 108, 109, 110, 111, 112, 114, 115, 116, 117, 120, 97, 99,
+    103, 108, 109, 110, 111, 112, 114, 115, 116, 118, 97, 111, 101, 97, 100, 103,
+    108, 109, 110, 111, 114, 115, 117, 118, 101, 111, 104, 97, 101, 121, 103, 109,
+    110, 115, 116, 97, 112, 115, 108, 109, 110, 112, 115, 116, 101, 105, 108, 111,
+    114, 117, 97, 99, 101, 104, 105, 108, 111, 114, 116, 117, 97, 100, 101, 105,
+    108, 111, 114, 117, 100, 103, 108, 110, 114, 115, 116, 46, 97, 101, 102, 105,
+    108, 116, 97, 101, 104, 105, 108, 110, 111, 114, 117, 107, 97, 101, 102, 105,
+    108, 110, 111, 116, 117, 118, 97, 101, 105, 110, 111, 112, 117, 46, 97, 99,
+    100, 101, 102, 103, 105, 107, 108, 110, 111, 115, 116, 117, 121, 46, 103, 108,
+    109, 110, 112, 114, 115, 116, 117, 101, 104, 105, 114, 117, 117, 97, 100, 101,
+    103, 105, 109, 111, 114, 117, 46, 97, 99, 101, 102, 104, 105, 107, 108, 109,
+    111, 112, 115, 116, 117, 97, 101, 104, 105, 111, 114, 116, 117, 122, 101, 105,
+    111, 111, 97, 105, 111, 99, 110, 112, 114, 115, 119, 112, 100, 46, 98, 103,
+    105, 108, 100, 101, 103, 108, 110, 114, 115, 116, 46, 99, 108, 109, 110, 112,
+    115, 101, 121, 101, 111, 114, 115, 117, 118, 111, 99, 104, 108, 121, 98, 99,
+    100, 103, 105, 109, 110, 114, 115, 116, 118, 105, 101, 104, 105, 101, 105, 114,
+    97, 98, 99, 102, 103, 109, 110, 112, 114, 115, 118, 121, 114, 97, 101, 111,
+    97, 98, 99, 100, 102, 103, 107, 108, 109, 110, 111, 113, 115, 116, 118, 122,
+    97, 97, 101, 102, 105, 111, 101, 105, 111, 46, 97, 98, 99, 102, 103, 109,
+    110, 111, 112, 114, 115, 116, 117, 118, 97, 104, 105, 108, 114, 99, 101, 105,
+    97, 101, 104, 105, 114, 117, 97, 98, 99, 101, 102, 105, 109, 110, 111, 112,
+    115, 116, 101, 97, 98, 103, 109, 110, 115, 98, 99, 103, 104, 105, 108, 110,
+    112, 114, 115, 116, 97, 105, 46, 100, 103, 108, 109, 110, 111, 114, 115, 116,
+    118, 46, 97, 100, 103, 108, 110, 111, 115, 116, 122, 97, 97, 105, 111, 99,
+    100, 101, 103, 105, 107, 108, 109, 110, 114, 115, 116, 117, 118, 97, 101, 104,
+    105, 111, 116, 121, 104, 105, 100, 108, 109, 110, 112, 117, 98, 99, 103, 107,
+    108, 109, 110, 114, 115, 116, 117, 118, 97, 101, 104, 105, 111, 114, 117, 97,
+    101, 105, 116, 117, 119, 46, 97, 98, 99, 100, 103, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 118, 119, 105, 97, 101, 104, 105, 108, 111, 115, 117, 121,
+    97, 101, 97, 98, 100, 101, 102, 103, 107, 109, 110, 111, 115, 116, 101, 105,
+    108, 114, 101, 101, 101, 105, 98, 99, 100, 101, 103, 105, 108, 109, 110, 112,
+    114, 115, 116, 117, 118, 119, 105, 114, 117, 97, 99, 101, 105, 108, 109, 111,
+    112, 116, 97, 101, 105, 114, 115, 117, 97, 100, 101, 102, 105, 109, 110, 111,
+    116, 109, 112, 97, 100, 108, 114, 115, 116, 97, 101, 105, 108, 114, 117, 101,
+    104, 105, 108, 111, 114, 116, 117, 100, 101, 105, 111, 117, 108, 110, 114, 116,
+    118, 105, 97, 101, 105, 108, 110, 114, 117, 121, 97, 99, 100, 102, 103, 108,
+    110, 115, 116, 101, 105, 97, 100, 101, 102, 105, 108, 111, 112, 116, 117, 118,
+    121, 97, 98, 101, 105, 109, 111, 112, 97, 99, 100, 101, 103, 105, 107, 111,
+    115, 116, 117, 118, 100, 107, 112, 114, 115, 97, 101, 104, 105, 111, 114, 117,
+    121, 97, 101, 103, 105, 109, 110, 111, 112, 114, 115, 116, 117, 121, 97, 99,
+    105, 108, 111, 112, 116, 97, 101, 104, 105, 111, 98, 99, 101, 108, 110, 118,
+    101, 105, 111, 100, 101, 105, 110, 111, 105, 97, 99, 100, 103, 105, 108, 110,
+    112, 114, 116, 118, 121, 46, 97, 99, 100, 101, 107, 108, 110, 111, 114, 116,
+    46, 97, 101, 105, 108, 111, 115, 116, 117, 121, 97, 99, 100, 101, 103, 108,
+    110, 111, 116, 97, 105, 111, 117, 99, 100, 101, 103, 105, 108, 110, 112, 114,
+    115, 116, 117, 97, 101, 111, 97, 101, 105, 111, 101, 104, 105, 97, 101, 104,
+    105, 111, 114, 117, 119, 98, 101, 102, 108, 109, 110, 114, 115, 116, 97, 101,
+    105, 98, 99, 100, 102, 105, 108, 109, 110, 111, 112, 114, 115, 116, 117, 118,
+    122, 97, 105, 111, 101, 104, 105, 117, 97, 105, 46, 97, 98, 99, 100, 102,
+    103, 105, 108, 110, 111, 112, 114, 115, 116, 117, 118, 119, 117, 121, 101, 105,
+    108, 111, 117, 46, 97, 97, 98, 99, 100, 101, 103, 108, 109, 110, 111, 112,
+    113, 115, 116, 118, 46, 101, 104, 108, 114, 115, 101, 105, 111, 97, 101, 105,
+    121, 97, 101, 105, 111, 117, 98, 99, 101, 102, 107, 108, 109, 110, 111, 112,
+    114, 115, 116, 118, 120, 97, 101, 104, 105, 111, 101, 105, 111, 121, 97, 99,
+    101, 104, 105, 111, 112, 119, 97, 101, 104, 105, 114, 115, 97, 101, 103, 105,
+    109, 110, 115, 116, 101, 105, 111, 99, 110, 116, 115, 98, 99, 105, 108, 110,
+    112, 116, 117, 118, 119, 97, 101, 104, 105, 108, 111, 114, 117, 121, 46, 97,
+    99, 100, 103, 105, 108, 109, 110, 112, 114, 115, 117, 118, 119, 120, 46, 101,
+    105, 111, 119, 98, 99, 100, 103, 108, 110, 111, 114, 115, 116, 117, 118, 122,
+    101, 105, 121, 97, 101, 105, 111, 97, 101, 105, 111, 99, 102, 103, 108, 109,
+    110, 112, 114, 118, 97, 101, 104, 105, 108, 111, 117, 97, 99, 101, 104, 105,
+    108, 110, 112, 116, 117, 119, 46, 97, 98, 101, 104, 105, 108, 111, 114, 115,
+    117, 119, 121, 97, 98, 103, 105, 108, 109, 110, 112, 114, 105, 111, 99, 108,
+    110, 114, 116, 46, 98, 99, 100, 102, 103, 105, 108, 109, 110, 112, 114, 115,
+    116, 117, 118, 119, 120, 104, 114, 46, 97, 99, 100, 101, 103, 108, 109, 110,
+    111, 112, 114, 115, 116, 117, 120, 121, 46, 97, 101, 105, 108, 111, 115, 121,
+    97, 98, 99, 100, 101, 102, 103, 108, 109, 110, 111, 113, 115, 116, 117, 118,
+    122, 97, 101, 105, 111, 101, 98, 99, 100, 102, 103, 105, 108, 109, 110, 114,
+    115, 116, 117, 119, 97, 101, 105, 111, 117, 99, 104, 119, 101, 111, 114, 117,
+    97, 98, 100, 101, 102, 105, 109, 110, 112, 114, 115, 97, 104, 105, 111, 97,
+    108, 112, 101, 98, 99, 100, 110, 114, 116, 118, 101, 105, 108, 97, 105, 108,
+    114, 117, 121, 100, 101, 105, 111, 115, 117, 97, 110, 114, 97, 108, 104, 105,
+    108, 110, 114, 116, 118, 97, 99, 100, 101, 103, 105, 108, 109, 111, 115, 116,
+    117, 118, 97, 98, 105, 111, 112, 97, 101, 105, 115, 116, 117, 121, 122, 114,
+    115, 117, 101, 105, 108, 112, 116, 97, 98, 99, 100, 101, 102, 105, 108, 110,
+    111, 112, 115, 116, 117, 97, 99, 101, 105, 108, 112, 115, 116, 117, 97, 101,
+    105, 108, 111, 115, 109, 117, 101, 46, 98, 99, 103, 108, 109, 110, 112, 114,
+    116, 117, 46, 100, 103, 108, 110, 114, 115, 116, 97, 100, 102, 103, 107, 108,
+    110, 111, 112, 114, 115, 116, 118, 46, 105, 107, 108, 109, 114, 116, 98, 99,
+    103, 105, 108, 109, 114, 115, 116, 118, 97, 100, 101, 108, 114, 115, 118, 105,
+    100, 108, 110, 114, 115, 116, 122, 101, 105, 111, 107, 109, 118, 97, 105, 104,
+    108, 112, 116, 99, 103, 109, 112, 115, 99, 100, 114, 105, 117, 97, 99, 100,
+    109, 98, 97, 101, 117, 105, 97, 99, 114, 116, 101, 104, 111, 101, 114, 115,
+    116, 105, 97, 108, 111, 117, 98, 101, 112, 99, 100, 103, 105, 120, 100, 103,
+    109, 110, 115, 101, 105, 111, 116, 117, 97, 105, 111, 114, 99, 101, 105, 111,
+    115, 116, 117, 104, 105, 98, 114, 110, 112, 114, 116, 97, 108, 115, 109, 111,
+    112, 101, 119, 121, 104, 100, 116, 116, 97, 99, 103, 105, 116, 115, 116, 99,
+    112, 115, 116, 111, 100, 105, 110, 103, 110, 115, 114, 115, 105, 116, 109, 110,
+    112, 114, 116, 108, 105, 116, 101, 110, 114, 109, 111, 114, 115, 99, 116, 105,
+    99, 109, 114, 115, 114, 100, 101, 97, 103, 115, 117, 114, 104, 108, 101, 101,
+    115, 114, 115, 110, 111, 97, 98, 114, 110, 109, 112, 114, 115, 116, 98, 101,
+    110, 118, 108, 111, 109, 112, 99, 101, 107, 115, 117, 114, 105, 114, 108, 114,
+    99, 109, 116, 103, 105, 110, 112, 118, 103, 110, 111, 116, 103, 108, 110, 114,
+    103, 114, 116, 109, 115, 110, 114, 116, 111, 99, 101, 110, 100, 116, 97, 99,
+    100, 116, 116, 104, 116, 100, 116, 101, 111, 116, 108, 115, 101, 99, 110, 116,
+    118, 101, 109, 115, 103, 116, 113, 115, 119, 100, 105, 108, 109, 110, 114, 110,
+    104, 105, 97, 112, 108, 110, 108, 109, 110, 110, 112, 113, 117, 105, 97, 99,
+    100, 101, 107, 111, 117, 101, 97, 110, 114, 99, 98, 108, 108, 110, 114, 97,
+    116, 97, 108, 111, 108, 98, 114, 111, 114, 101, 101, 110, 111, 111, 105, 108,
+    109, 105, 114, 97, 99, 101, 111, 116, 117, 101, 119, 97, 117, 99, 109, 105,
+    105, 98, 110, 108, 111, 117, 103, 110, 101, 108, 46, 121, 105, 111, 101, 110,
+    98, 100, 114, 105, 110, 111, 97, 101, 101, 105, 103, 46, 115, 116, 122, 98,
+    103, 114, 115, 116, 110, 114, 99, 102, 108, 110, 110, 114, 101, 103, 108, 114,
+    116, 101, 105, 108, 111, 101, 110, 115, 117, 105, 108, 99, 101, 102, 109, 110,
+    111, 112, 115, 116, 117, 108, 105, 97, 116, 97, 99, 103, 110, 112, 116, 117,
+    118, 97, 105, 111, 114, 119, 97, 108, 114, 114, 116, 97, 114, 101, 105, 108,
+    110, 116, 99, 108, 114, 115, 101, 101, 99, 100, 108, 109, 110, 112, 116, 117,
+    118, 119, 97, 104, 105, 114, 97, 101, 110, 115, 105, 108, 97, 101, 109, 110,
+    111, 122, 105, 100, 110, 111, 97, 101, 97, 104, 98, 110, 105, 97, 98, 99,
+    116, 105, 99, 104, 104, 101, 114, 114, 109, 98, 99, 108, 112, 99, 103, 110,
+    114, 115, 118, 101, 111, 46, 97, 98, 99, 102, 111, 116, 103, 109, 112, 115,
+    111, 107, 97, 101, 104, 97, 101, 108, 114, 104, 117, 105, 100, 105, 101, 104,
+    103, 110, 110, 114, 101, 103, 111, 99, 114, 121, 121, 99, 100, 108, 101, 105,
+    107, 103, 101, 97, 100, 101, 105, 98, 105, 111, 115, 104, 114, 110, 116, 107,
+    116, 97, 101, 105, 105, 117, 105, 111, 105, 117, 112, 116, 105, 114, 119, 105,
+    111, 105, 110, 114, 105, 108, 97, 100, 101, 103, 109, 114, 117, 105, 114, 117,
+    122, 110, 116, 46, 110, 115, 110, 115, 110, 110, 103, 105, 105, 98, 97, 46,
+    97, 100, 101, 105, 110, 97, 104, 111, 117, 110, 116, 116, 115, 114, 102, 97,
+    105, 105, 116, 101, 105, 115, 116, 97, 101, 105, 111, 116, 105, 108, 104, 101,
+    97, 108, 111, 100, 101, 105, 116, 121, 101, 111, 116, 121, 97, 104, 105, 97,
+    97, 97, 109, 110, 117, 46, 101, 46, 108, 99, 101, 105, 116, 97, 97, 115,
+    116, 97, 98, 110, 97, 100, 108, 109, 110, 114, 101, 110, 111, 116, 122, 46,
+    104, 105, 98, 114, 114, 105, 97, 97, 105, 97, 101, 103, 111, 113, 110, 101,
+    104, 105, 116, 105, 114, 97, 109, 99, 109, 103, 114, 110, 105, 111, 101, 97,
+    101, 103, 116, 97, 104, 105, 108, 98, 111, 101, 115, 101, 97, 101, 105, 115,
+    116, 97, 100, 116, 118, 102, 110, 115, 116, 99, 101, 112, 115, 100, 98, 110,
+    114, 99, 109, 111, 114, 116, 105, 116, 97, 101, 105, 105, 121, 97, 105, 115,
+    105, 114, 104, 111, 103, 100, 107, 121, 97, 105, 111, 101, 98, 98, 102, 108,
+    105, 111, 97, 105, 108, 111, 46, 105, 102, 105, 111, 46, 105, 111, 97, 111,
+    116, 117, 97, 105, 117, 104, 109, 110, 115, 46, 99, 105, 111, 116, 117, 105,
+    111, 105, 116, 98, 97, 101, 116, 110, 102, 101, 97, 101, 97, 101, 105, 103,
+    108, 101, 116, 105, 116, 105, 46, 97, 100, 115, 101, 101, 97, 105, 111, 105,
+    97, 105, 100, 112, 116, 111, 103, 105, 97, 110, 98, 102, 108, 112, 109, 112,
+    119, 112, 98, 108, 97, 101, 116, 108, 101, 98, 112, 101, 101, 112, 116, 105,
+    101, 101, 111, 101, 100, 105, 97, 99, 101, 105, 107, 116, 112, 115, 116, 101,
+    104, 105, 117, 101, 105, 111, 108, 110, 116, 100, 110, 97, 115, 97, 98, 102,
+    109, 116, 97, 117, 108, 109, 110, 114, 101, 97, 101, 108, 114, 115, 108, 97,
+    98, 99, 109, 116, 122, 108, 110, 105, 108, 105, 105, 121, 97, 116, 121, 114,
+    99, 108, 110, 116, 114, 115, 108, 114, 98, 99, 110, 116, 46, 115, 108, 114,
+    114, 108, 98, 102, 103, 115, 100, 101, 104, 121, 100, 110, 97, 46, 99, 110,
+    116, 119, 120, 97, 98, 99, 100, 103, 110, 114, 115, 98, 99, 101, 103, 109,
+    110, 111, 115, 116, 118, 97, 111, 97, 99, 103, 112, 104, 97, 100, 103, 99,
+    103, 110, 108, 116, 99, 101, 103, 110, 115, 122, 105, 103, 110, 105, 108, 110,
+    109, 110, 104, 105, 97, 101, 109, 114, 115, 116, 119, 99, 101, 108, 111, 115,
+    116, 117, 122, 103, 115, 118, 119, 97, 104, 97, 102, 46, 114, 97, 101, 111,
+    111, 116, 105, 110, 108, 110, 116, 101, 110, 105, 101, 111, 104, 105, 116, 105,
+    98, 110, 114, 116, 108, 104, 46, 97, 99, 105, 108, 109, 110, 113, 115, 116,
+    97, 99, 101, 110, 111, 116, 117, 118, 105, 111, 98, 99, 114, 117, 101, 101,
+    108, 119, 116, 97, 103, 97, 114, 117, 99, 110, 114, 97, 101, 99, 100, 103,
+    109, 110, 115, 117, 105, 105, 108, 110, 97, 101, 105, 114, 105, 97, 105, 111,
+    114, 114, 98, 110, 111, 111, 121, 99, 100, 110, 114, 116, 110, 97, 101, 105,
+    111, 97, 109, 108, 111, 101, 105, 114, 112, 115, 97, 108, 110, 114, 100, 108,
+    110, 118, 99, 103, 101, 108, 110, 116, 46, 108, 114, 101, 110, 108, 97, 105,
+    116, 97, 104, 111, 108, 115, 116, 114, 97, 116, 105, 111, 100, 109, 114, 115,
+    101, 110, 115, 121, 46, 97, 101, 104, 105, 115, 117, 101, 104, 105, 108, 121,
+    97, 100, 101, 103, 110, 116, 116, 103, 115, 110, 114, 119, 111, 100, 116, 97,
+    101, 105, 116, 116, 97, 115, 108, 108, 108, 105, 101, 105, 105, 115, 97, 46,
+    105, 111, 101, 111, 105, 111, 110, 115, 104, 105, 122, 105, 121, 97, 99, 105,
+    111, 121, 100, 109, 121, 105, 104, 105, 111, 121, 114, 117, 110, 117, 111, 119,
+    114, 105, 111, 110, 115, 101, 46, 103, 115, 108, 108, 100, 115, 97, 98, 103,
+    115, 98, 114, 46, 99, 116, 110, 111, 109, 110, 114, 115, 97, 100, 105, 105,
+    111, 46, 100, 105, 110, 112, 121, 110, 115, 101, 116, 102, 101, 114, 116, 97,
+    97, 108, 104, 109, 116, 117, 114, 97, 99, 100, 103, 105, 107, 116, 97, 108,
+    116, 97, 100, 108, 112, 116, 115, 99, 110, 97, 100, 114, 97, 111, 105, 108,
+    111, 112, 97, 114, 97, 98, 101, 110, 111, 121, 112, 101, 97, 110, 111, 104,
+    101, 97, 110, 101, 108, 111, 112, 114, 101, 115, 101, 104, 110, 114, 116, 117,
+    105, 115, 101, 97, 101, 97, 101, 97, 121, 100, 110, 97, 105, 116, 117, 101,
+    112, 115, 101, 101, 110, 112, 114, 110, 111, 115, 105, 107, 116, 116, 114, 101,
+    104, 111, 101, 99, 105, 116, 101, 115, 105, 114, 117, 114, 97, 110, 116, 105,
+    105, 110, 109, 112, 114, 115, 121, 117, 111, 100, 110, 112, 121, 99, 97, 121,
+    101, 117, 108, 109, 111, 114, 105, 110, 97, 115, 97, 101, 111, 116, 117, 101,
+    109, 119, 111, 101, 97, 100, 97, 101, 110, 116, 46, 99, 116, 99, 114, 101,
+    114, 99, 101, 98, 114, 116, 98, 108, 110, 116, 105, 114, 116, 101, 105, 114,
+    98, 100, 109, 114, 103, 114, 118, 97, 98, 111, 115, 116, 122, 97, 113, 121,
+    114, 103, 114, 110, 116, 100, 108, 110, 116, 105, 110, 101, 108, 117, 118, 101,
+    108, 101, 114, 115, 114, 97, 101, 105, 108, 111, 117, 46, 97, 111, 115, 116,
+    99, 115, 116, 101, 117, 46, 104, 115, 101, 114, 97, 101, 105, 104, 105, 104,
+    105, 111, 114, 114, 99, 101, 108, 97, 101, 105, 98, 99, 101, 100, 102, 108,
+    115, 105, 100, 115, 116, 122, 105, 103, 110, 101, 108, 103, 114, 115, 104, 114,
+    97, 111, 98, 100, 115, 116, 97, 115, 109, 105, 121, 97, 101, 97, 101, 105,
+    108, 114, 115, 46, 98, 103, 109, 110, 116, 114, 115, 105, 97, 99, 103, 108,
+    109, 110, 111, 115, 109, 110, 97, 121, 97, 100, 108, 46, 108, 110, 114, 108,
+    111, 116, 114, 116, 114, 110, 113, 117, 97, 101, 115, 116, 103, 115, 105, 100,
+    116, 121, 108, 111, 46, 100, 101, 103, 104, 121, 115, 104, 105, 110, 97, 105,
+    111, 105, 101, 121, 110, 110, 111, 100, 101, 116, 99, 103, 105, 101, 97, 101,
+    105, 97, 110, 97, 105, 114, 115, 105, 100, 115, 105, 116, 116, 46, 101, 103,
+    97, 46, 99, 101, 111, 116, 104, 114, 97, 101, 103, 105, 111, 99, 113, 115,
+    97, 101, 101, 114, 115, 103, 109, 114, 115, 116, 105, 105, 111, 115, 116, 117,
+    121, 97, 101, 105, 101, 102, 108, 97, 104, 114, 98, 105, 111, 112, 97, 101,
+    105, 107, 103, 112, 46, 104, 105, 101, 108, 116, 119, 97, 99, 103, 108, 110,
+    116, 108, 110, 115, 113, 117, 119, 116, 110, 100, 110, 100, 97, 111, 105, 101,
+    105, 111, 117, 101, 103, 105, 100, 101, 105, 109, 97, 105, 111, 46, 101, 111,
+    116, 97, 110, 116, 98, 97, 105, 110, 116, 101, 103, 110, 97, 110, 114, 105,
+    101, 115, 114, 114, 104, 105, 110, 112, 100, 97, 98, 105, 110, 107, 114, 115,
+    116, 110, 116, 97, 101, 111, 101, 116, 97, 104, 108, 105, 110, 100, 97, 100,
+    105, 108, 116, 46, 105, 117, 104, 103, 105, 108, 118, 99, 101, 116, 101, 104,
+    105, 116, 108, 110, 118, 46, 105, 121, 114, 111, 116, 111, 46, 97, 100, 101,
+    105, 115, 116, 110, 115, 116, 97, 101, 104, 114, 97, 103, 105, 108, 97, 100,
+    101, 103, 105, 116, 117, 116, 101, 108, 116, 104, 98, 114, 110, 114, 108, 111,
+    115, 101, 101, 101, 103, 105, 111, 121, 97, 111, 101, 112, 104, 102, 115, 114,
+    116, 97, 97, 101, 110, 114, 115, 114, 115, 117, 118, 114, 97, 114, 97, 116,
+    117, 46, 97, 116, 101, 105, 116, 105, 99, 105, 107, 99, 101, 105, 108, 109,
+    99, 116, 97, 111, 115, 116, 101, 114, 115, 97, 101, 105, 110, 116, 117, 105,
+    110, 115, 98, 101, 102, 116, 122, 104, 99, 114, 101, 114, 97, 117, 107, 97,
+    101, 97, 105, 105, 111, 101, 111, 97, 101, 105, 114, 46, 107, 112, 116, 119,
+    105, 101, 110, 98, 108, 110, 114, 97, 111, 98, 110, 116, 97, 118, 104, 112,
+    109, 98, 110, 112, 97, 108, 105, 114, 105, 114, 105, 101, 103, 46, 116, 104,
+    105, 111, 114, 114, 116, 110, 117, 115, 116, 97, 118, 108, 101, 108, 101, 115,
+    105, 111, 97, 101, 105, 111, 121, 97, 101, 105, 111, 97, 99, 101, 116, 97,
+    110, 101, 108, 101, 98, 116, 101, 115, 100, 103, 111, 99, 101, 105, 97, 98,
+    114, 98, 101, 102, 110, 112, 101, 111, 109, 110, 102, 110, 116, 101, 105, 114,
+    101, 100, 101, 116, 105, 98, 114, 108, 110, 105, 108, 97, 101, 102, 108, 97,
+    100, 97, 101, 105, 111, 108, 114, 101, 108, 99, 111, 116, 114, 99, 103, 115,
+    97, 116, 114, 116, 110, 111, 114, 101, 115, 116, 121, 105, 111, 105, 110, 98,
+    101, 101, 102, 101, 103, 116, 109, 111, 116, 101, 110, 115, 101, 110, 115, 101,
+    114, 115, 116, 105, 97, 99, 100, 102, 103, 108, 110, 111, 115, 116, 118, 105,
+    103, 110, 114, 108, 98, 109, 110, 115, 104, 108, 116, 101, 108, 99, 110, 114,
+    116, 97, 99, 100, 110, 101, 103, 110, 105, 114, 99, 110, 105, 111, 110, 115,
+    117, 99, 111, 115, 117, 101, 100, 109, 114, 116, 117, 112, 117, 101, 105, 109,
+    97, 101, 105, 105, 100, 116, 100, 114, 97, 101, 110, 115, 116, 110, 115, 46,
+    103, 108, 110, 97, 105, 115, 119, 117, 97, 99, 108, 110, 111, 116, 117, 105,
+    101, 102, 117, 101, 104, 101, 116, 104, 105, 121, 109, 108, 101, 111, 114, 101,
+    116, 117, 97, 104, 111, 97, 105, 110, 108, 114, 115, 101, 105, 99, 102, 115,
+    115, 97, 108, 104, 116, 99, 100, 110, 114, 97, 115, 116, 108, 101, 108, 115,
+    105, 100, 97, 101, 116, 97, 110, 109, 97, 101, 116, 121, 117, 97, 100, 101,
+    105, 101, 104, 114, 114, 101, 105, 100, 118, 97, 105, 97, 99, 116, 110, 97,
+    105, 109, 110, 111, 116, 117, 118, 101, 105, 114, 110, 114, 115, 99, 101, 108,
+    110, 115, 122, 98, 110, 114, 110, 97, 105, 121, 97, 101, 105, 99, 110, 114,
+    111, 46, 100, 111, 110, 104, 117, 110, 115, 97, 99, 101, 103, 110, 105, 109,
+    46, 109, 116, 110, 101, 121, 105, 121, 115, 97, 110, 114, 100, 108, 110, 114,
+    116, 115, 121, 99, 101, 102, 108, 109, 110, 114, 115, 116, 118, 101, 110, 115,
+    99, 102, 103, 108, 115, 116, 117, 98, 98, 109, 109, 111, 114, 101, 99, 114,
+    101, 114, 116, 105, 115, 118, 46, 114, 116, 110, 118, 105, 111, 104, 108, 105,
+    102, 116, 111, 101, 105, 111, 101, 103, 104, 105, 111, 114, 101, 104, 99, 101,
+    105, 105, 116, 97, 101, 105, 98, 103, 102, 110, 110, 97, 101, 98, 116, 109,
+    108, 97, 101, 110, 108, 110, 114, 118, 119, 114, 105, 111, 114, 116, 101, 105,
+    97, 101, 105, 121, 105, 116, 105, 117, 116, 105, 111, 117, 105, 111, 117, 46,
+    112, 115, 116, 101, 105, 114, 116, 97, 101, 105, 111, 104, 114, 116, 99, 110,
+    115, 116, 110, 108, 98, 103, 108, 97, 97, 101, 105, 111, 101, 110, 114, 116,
+    97, 105, 105, 97, 105, 111, 112, 97, 100, 101, 103, 104, 108, 46, 99, 104,
+    112, 97, 101, 105, 117, 101, 105, 111, 116, 111, 101, 105, 97, 46, 100, 113,
+    103, 115, 99, 110, 114, 110, 111, 116, 114, 108, 114, 116, 121, 99, 115, 116,
+    118, 117, 108, 111, 114, 108, 112, 101, 105, 101, 101, 101, 105, 112, 97, 101,
+    105, 116, 109, 116, 101, 105, 105, 111, 112, 115, 104, 114, 121, 97, 101, 117,
+    97, 110, 114, 116, 110, 99, 102, 111, 115, 111, 118, 110, 115, 115, 116, 99,
+    114, 115, 118, 97, 98, 110, 99, 103, 98, 110, 111, 111, 98, 100, 101, 103,
+    108, 115, 118, 101, 105, 111, 104, 108, 110, 108, 110, 112, 107, 116, 99, 105,
+    105, 108, 110, 114, 115, 121, 99, 118, 103, 99, 107, 114, 116, 97, 101, 109,
+    111, 116, 99, 100, 97, 97, 105, 117, 111, 110, 112, 116, 118, 100, 105, 115,
+    105, 111, 114, 101, 110, 117, 101, 105, 102, 112, 117, 97, 116, 115, 119, 111,
+    116, 101, 108, 114, 101, 102, 118, 97, 101, 105, 111, 97, 99, 100, 101, 103,
+    105, 116, 97, 116, 46, 108, 111, 118, 104, 116, 109, 101, 105, 114, 118, 110,
+    111, 112, 118, 101, 108, 110, 114, 99, 101, 105, 110, 101, 121, 97, 101, 103,
+    110, 97, 101, 105, 116, 110, 115, 116, 116, 118, 108, 110, 108, 110, 116, 108,
+    101, 116, 97, 97, 100, 105, 117, 118, 46, 97, 103, 104, 99, 100, 105, 99,
+    105, 110, 99, 110, 111, 114, 101, 111, 99, 108, 110, 111, 121, 107, 110, 114,
+    116, 97, 105, 99, 115, 108, 110, 115, 116, 97, 97, 101, 103, 108, 105, 101,
+    114, 103, 108, 109, 110, 112, 114, 116, 100, 114, 119, 101, 46, 97, 99, 101,
+    102, 110, 114, 101, 99, 109, 110, 112, 114, 97, 105, 121, 99, 112, 108, 108,
+    115, 116, 105, 101, 109, 99, 111, 105, 104, 108, 111, 105, 111, 111, 108, 97,
+    101, 105, 107, 108, 111, 105, 111, 100, 116, 97, 101, 108, 97, 99, 101, 105,
+    114, 101, 121, 105, 117, 110, 105, 99, 101, 105, 99, 100, 116, 101, 116, 105,
+    101, 105, 46, 101, 105, 115, 97, 97, 99, 100, 101, 116, 101, 99, 100, 103,
+    105, 110, 118, 46, 115, 104, 108, 110, 97, 105, 116, 99, 108, 110, 100, 103,
+    107, 111, 114, 108, 115, 98, 110, 116, 107, 111, 117, 105, 110, 121, 117, 108,
+    112, 117, 97, 101, 105, 111, 99, 110, 97, 101, 109, 111, 112, 116, 108, 97,
+    97, 101, 110, 46, 100, 115, 116, 101, 114, 111, 114, 99, 111, 97, 98, 121,
+    97, 111, 121, 97, 105, 105, 114, 116, 97, 98, 99, 105, 115, 118, 97, 102,
+    109, 97, 99, 109, 118, 102, 108, 109, 110, 112, 115, 118, 105, 115, 104, 115,
+    105, 114, 105, 105, 46, 101, 105, 110, 111, 121, 115, 97, 101, 104, 114, 97,
+    105, 97, 100, 105, 116, 108, 114, 110, 101, 98, 116, 101, 114, 115, 118, 99,
+    101, 115, 116, 110, 105, 109, 101, 115, 116, 105, 101, 110, 105, 103, 109, 97,
+    101, 98, 116, 104, 101, 110, 105, 97, 110, 115, 97, 105, 101, 105, 114, 117,
+    108, 98, 105, 108, 110, 114, 116, 114, 109, 110, 115, 118, 119, 97, 101, 115,
+    114, 97, 110, 111, 105, 117, 46, 103, 108, 115, 101, 97, 101, 114, 97, 102,
+    110, 111, 116, 122, 105, 111, 115, 101, 105, 101, 101, 104, 105, 100, 110, 112,
+    105, 97, 114, 97, 99, 105, 108, 101, 114, 114, 98, 116, 46, 108, 110, 108,
+    110, 111, 115, 122, 102, 103, 109, 110, 117, 105, 117, 101, 117, 105, 111, 117,
+    111, 105, 105, 105, 105, 100, 46, 108, 111, 121, 111, 117, 100, 101, 105, 109,
+    115, 116, 46, 116, 101, 121, 108, 110, 101, 105, 110, 105, 97, 99, 100, 103,
+    108, 114, 117, 111, 105, 111, 117, 105, 114, 121, 105, 99, 114, 97, 101, 116,
+    118, 105, 97, 105, 121, 97, 101, 108, 101, 111, 116, 46, 116, 116, 101, 101,
+    114, 116, 110, 107, 116, 118, 108, 116, 101, 108, 100, 103, 101, 104, 115, 110,
+    101, 101, 112, 116, 101, 101, 111, 117, 105, 111, 108, 105, 101, 105, 110, 99,
+    100, 105, 114, 101, 109, 116, 102, 116, 97, 111, 116, 97, 104, 99, 101, 115,
+    100, 114, 99, 97, 109, 97, 99, 111, 115, 97, 114, 114, 105, 99, 111, 110,
+    108, 104, 101, 116, 109, 101, 105, 105, 121, 101, 109, 97, 101, 97, 109, 116,
+    116, 112, 99, 97, 111, 97, 108, 114, 103, 110, 111, 97, 105, 99, 116, 118,
+    98, 116, 105, 109, 109, 105, 105, 121, 101, 114, 109, 111, 116, 103, 109, 116,
+    100, 107, 111, 97, 111, 114, 101, 111, 108, 105, 105, 116, 110, 116, 121, 101,
+    104, 101, 99, 97, 97, 111, 97, 116, 97, 99, 97, 101, 105, 101, 116, 101,
+    111, 97, 102, 116, 101, 101, 116, 108, 97, 101, 105, 110, 121, 116, 97, 109,
+    116, 105, 101, 99, 105, 116, 117, 116, 100, 101, 102, 108, 105, 105, 103, 105,
+    110, 98, 101, 101, 97, 111, 103, 107, 97, 105, 111, 115, 98, 116, 101, 101,
+    114, 100, 97, 97, 108, 105, 100, 97, 116, 105, 103, 108, 100, 111, 117, 116,
+    98, 102, 110, 46, 97, 114, 110, 101, 115, 108, 105, 114, 110, 110, 100, 116,
+    46, 118, 99, 46, 116, 97, 99, 105, 111, 116, 97, 121, 111, 105, 110, 101,
+    121, 99, 105, 105, 115, 115, 119, 116, 101, 115, 101, 105, 101, 104, 105, 122,
+    99, 104, 111, 114, 111, 114, 108, 100, 101, 110, 114, 98, 111, 114, 108, 97,
+    117, 97, 105, 116, 115, 116, 101, 105, 101, 103, 105, 108, 97, 101, 110, 115,
+    116, 115, 108, 110, 116, 97, 105, 110, 116, 46, 110, 97, 112, 108, 111, 104,
+    111, 46, 97, 110, 116, 109, 110, 114, 109, 110, 117, 105, 112, 103, 115, 97,
+    116, 102, 98, 110, 111, 97, 110, 121, 114, 117, 114, 101, 101, 97, 105, 97,
+    110, 105, 121, 97, 103, 114, 122, 101, 102, 122, 97, 114, 116, 114, 98, 104,
+    111, 118, 97, 100, 104, 112, 100, 100, 116, 99, 105, 116, 111, 108, 100, 104,
+    113, 101, 105, 101, 101, 105, 100, 111, 101, 110, 109, 110, 116, 97, 105, 99,
+    115, 122, 121, 114, 109, 101, 105, 115, 118, 108, 112, 116, 110, 109, 105, 105,
+    112, 111, 105, 101, 46, 115, 118, 101, 105, 117, 99, 114, 116, 109, 46, 99,
+    97, 105, 122, 97, 101, 114, 99, 114, 114, 111, 99, 110, 116, 116, 46, 105,
+    116, 97, 105, 111, 99, 108, 111, 101, 103, 116, 117, 105, 109, 121, 105, 117,
+    98, 110, 97, 105, 101, 118, 110, 98, 118, 115, 116, 110, 110, 108, 97, 105,
+    109, 110, 101, 113, 99, 108, 110, 114, 115, 114, 105, 105, 99, 105, 114, 99,
+    108, 105, 109, 114, 116, 116, 46, 122, 110, 114, 105, 100, 46, 115, 114, 122,
+    116, 114, 111, 114, 97, 116, 108, 101, 108, 46, 114, 46, 115, 101, 111, 101,
+    114, 114, 117, 114, 101, 115, 99, 108, 101, 110, 105, 102, 110, 46, 115, 99,
+    115, 115, 105, 121, 101, 109, 115, 109, 112, 99, 97, 111, 109, 110, 97, 97,
+    105, 111, 101, 105, 101, 105, 101, 101, 103, 116, 105, 100, 105, 97, 114, 97,
+    101, 46, 97, 114, 105, 103, 104, 105, 98, 46, 97, 97, 114, 101, 105, 104,
+    115, 122, 105, 97, 111, 116, 101, 99, 120, 111, 105, 116, 114, 115, 104, 103,
+    101, 97, 114, 108, 99, 116, 105, 101, 99, 100, 104, 98, 98, 97, 108, 115,
+    100, 105, 101, 108, 111, 110, 46, 111, 97, 99, 101, 116, 115, 116, 110, 107,
+    110, 114, 101, 97, 115, 116, 122, 116, 114, 117, 101, 110, 114, 99, 116, 118,
+    110, 101, 110, 116, 110, 117, 97, 99, 114, 114, 101, 98, 110, 103, 109, 110,
+    111, 117, 114, 100, 100, 108, 101, 111, 105, 97, 99, 102, 103, 115, 105, 108,
+    116, 108, 111, 103, 105, 98, 103, 101, 115, 104, 101, 116, 104, 117, 101, 105,
+    46, 108, 110, 116, 110, 114, 97, 101, 108, 116, 105, 105, 101, 101, 115, 101,
+    101, 114, 101, 116, 121, 116, 97, 99, 110, 116, 115, 122, 118, 110, 115, 122,
+    116, 121, 122, 99, 116, 101, 97, 46, 110, 101, 105, 100, 104, 105, 105, 116,
+    111, 46, 101, 111, 122, 122, 117, 97, 104, 115, 118, 100, 110, 115, 109, 105,
+    121, 46, 101, 111, 122, 101, 114, 110, 115, 101, 101, 101, 101, 104, 110, 116,
+    105, 121, 116, 112, 97, 97, 117, 100, 114, 101, 108, 108, 115, 101, 105, 122,
+    122, 114, 116, 99, 115, 101, 110, 101, 108, 105, 111, 117, 110, 101, 116, 116,
+    116, 118, 105, 97, 116, 46, 101, 46, 97, 97, 97, 97, 97, 99, 108, 110,
+    114, 115, 117, 105, 101, 111, 110, 46, 97, 105, 116, 101, 97, 116, 98, 101,
+    121, 116, 97, 101, 105, 100, 97, 108, 114, 105, 97, 115, 97, 110, 105, 101,
+    105, 121, 114, 116, 114, 97, 102, 100, 116, 101, 101, 117, 110, 46, 118, 110,
+    110, 112, 105, 110, 101, 108, 110, 115, 46, 121, 97, 105, 97, 105, 105, 108,
+    97, 107, 108, 101, 109, 109, 116, 108, 46, 46, 115, 46, 101, 111, 116, 97,
+    110, 109, 105, 121, 110, 46, 101, 115, 116, 97, 99, 101, 101, 108, 116, 101,
+    101, 110, 108, 118, 105, 108, 101, 105, 101, 97, 97, 110, 116, 46, 105, 98,
+    111, 46, 114, 105, 111, 111, 114, 46, 114, 114, 116, 97, 108, 97, 101, 111,
+    99, 114, 97, 104, 117, 116, 103, 101, 101, 108, 116, 115, 99, 114, 122, 46,
+    116, 101, 117, 116, 112, 100, 103, 101, 97, 108, 115, 97, 105, 46, 105, 101,
+    101, 109, 121, 105, 110, 112, 103, 110, 105, 121, 97, 115, 122, 115, 114, 105,
+    110, 122, 121, 101, 115, 122, 103, 97, 99, 101, 111, 97, 110, 99, 101, 117,
+    101, 97, 105, 108, 105, 105, 121, 98, 97, 101, 116, 97, 105, 101, 108, 115,
+    116, 114, 105, 114, 121, 97, 97, 101, 99, 115, 116, 121, 101, 97, 115, 122,
+    99, 101, 108, 115, 46, 46, 110, 121, 101, 105, 97, 105, 115, 115, 105, 105,
+    115, 99, 111, 114, 105, 114, 97, 116, 105, 116, 104, 105, 108, 109, 101, 46,
+    111, 115, 108, 115, 114, 116, 99, 114, 99, 116, 122, 98, 114, 105, 99, 105,
+    101, 101, 105, 114, 46, 99, 122, 46, 97, 111, 114, 111, 112, 115, 108, 101,
+    114, 105, 103, 108, 110, 99, 115, 122, 103, 113, 115, 122, 108, 98, 114, 108,
+    109, 99, 105, 105, 111, 98, 115, 114, 101, 103, 112, 108, 101, 101, 115, 101,
+    103, 103, 115, 116, 109, 99, 116, 116, 114, 97, 101, 100, 108, 105, 116, 116,
+    101, 116, 105, 111, 101, 122, 115, 114, 116, 101, 110, 101, 114, 116, 115, 99,
+    116, 101, 46, 111, 103, 46, 104, 101, 105, 101, 105, 111, 101, 105, 104, 97,
+    115, 114, 46, 97, 105, 110, 101, 111, 108, 116, 121, 105, 105, 121, 109, 111,
+    105, 110, 102, 97, 110, 114, 103, 109, 105, 105, 103, 108, 104, 116, 97, 121,
+    103, 110, 105, 111, 114, 121, 118, 112, 105, 111, 121, 101, 116, 108, 116, 101,
+    46, 115, 116, 111, 115, 46, 97, 101, 100, 105, 101, 110, 115, 116, 110, 105,
+    114, 116, 105, 110, 116, 97, 108, 121, 98, 103, 108, 109, 105, 108, 115, 114,
+    105, 121, 105, 108, 97, 99, 101, 110, 104, 46, 98, 103, 115, 97, 101, 105,
+    110, 122, 105, 111, 46, 97, 103, 116, 101, 105, 100, 101, 97, 97, 116, 97,
+    114, 97, 98, 99, 116, 46, 101, 112, 116, 97, 105, 101, 105, 111, 109, 97,
+    97, 97, 101, 101, 112, 115, 101, 116, 111, 97, 101, 105, 105, 101, 101, 100,
+    97, 108, 115, 114, 101, 105, 110, 105, 116, 97, 108, 101, 117, 103, 111, 105,
+    110, 116, 117, 111, 101, 97, 114, 121, 102, 108, 111, 105, 108, 101, 101, 103,
+    114, 114, 103, 114, 97, 112, 108, 109, 101, 97, 115, 116, 99, 114, 115, 97,
+    101, 110, 115, 105, 105, 97, 114, 114, 122, 105, 105, 108, 108, 114, 108, 108,
+    103, 46, 115, 100, 101, 114, 99, 116, 110, 122, 110, 101, 46, 101, 105, 98,
+    100, 114, 99, 114, 108, 116, 108, 110, 117, 117, 104, 115, 103, 116, 97, 105,
+    108, 114, 46, 115, 116, 108, 115, 97, 108, 99, 101, 101, 111, 108, 108, 116,
+    46, 103, 116, 105, 114, 46, 97, 104, 100, 117, 114, 105, 108, 121, 116, 117,
+    112, 108, 121, 110, 108, 105, 46, 116, 101, 105, 114, 115, 101, 114, 111, 114,
+    116, 101, 111, 116, 111, 100, 116, 121, 114, 112, 104, 112, 115, 116, 108, 116,
+    100, 110, 100, 108, 101, 111, 110, 115, 100, 116, 46, 100, 115, 122, 97, 46,
+    97, 115, 111, 101, 103, 99, 104, 97, 108, 104, 100, 109, 98, 99, 116, 105,
+    121, 101, 105, 105, 100, 114, 105, 103, 101, 116, 108, 116, 104, 103, 46, 116,
+    110, 114, 110, 121, 110, 97, 105, 112, 100, 116, 116, 46, 105, 110, 111, 97,
+    107, 103, 107, 97, 101, 97, 101, 100, 116, 121, 98, 100, 114, 105, 105, 114,
+    109, 110, 105, 101, 108, 110, 111, 110, 97, 105, 103, 110, 101, 97, 116, 114,
+    122, 104, 99, 114, 115, 116, 101, 104, 105, 114, 103, 114, 116, 110, 115, 97,
+    101, 99, 101, 115, 122, 105, 46, 101, 101, 97, 115, 116, 115, 46, 97, 107,
+    101, 105, 111, 101, 101, 105, 97, 99, 46, 111, 105, 108, 46, 109, 101, 105,
+    110, 46, 46, 114, 97, 103, 108, 116, 101, 122, 99, 114, 104, 105, 116, 116,
+    101, 99, 105, 108, 101, 105, 115, 105, 101, 105, 105, 121, 104, 105, 111, 112,
+    105, 98, 115, 115, 97, 108, 97, 110, 111, 103, 46, 116, 100, 115, 121, 101,
+    108, 110, 122, 114, 105, 101, 114, 103, 104, 114, 98, 115, 115, 97, 121, 103,
+    111, 104, 98, 114, 115, 115, 103, 114, 98, 46, 116, 114, 108, 105, 110, 114,
+    115, 101, 101, 46, 110, 114, 105, 105, 101, 103, 110, 97, 108, 101, 101, 122,
+    101, 118, 101, 105, 109, 101, 46, 105, 108, 110, 115, 101, 105, 101, 104, 101,
+    105, 114, 105, 46, 100, 110, 115, 116, 122, 116, 112, 101, 100, 98, 101, 114,
+    101, 103, 114, 105, 104, 110, 115, 105, 101, 110, 110, 97, 97, 101, 116, 122,
+    100, 116, 115, 100, 101, 98, 108, 114, 114, 116, 97, 111, 110, 46, 114, 114,
+    115, 101, 114, 111, 105, 101, 98, 108, 108, 114, 101, 105, 118, 105, 104, 116,
+    108, 114, 115, 101, 109, 101, 105, 101, 105, 121, 110, 105, 101, 114, 101, 105,
+    108, 108, 114, 99, 114, 105, 98, 104, 109, 111, 108, 116, 115, 97, 109, 111,
+    110, 116, 97, 99, 100, 112, 114, 115, 118, 101, 110, 111, 108, 115, 103, 110,
+    103, 117, 116, 114, 114, 101, 114, 98, 99, 122, 104, 105, 115, 97, 115, 46,
+    101, 108, 97, 115, 116, 111, 118, 110, 116, 101, 116, 103, 116, 97, 111, 97,
+    122, 46, 108, 114, 114, 103, 105, 98, 101, 114, 114, 115, 110, 46, 100, 110,
+    114, 103, 97, 98, 99, 115, 111, 46, 115, 46, 116, 110, 105, 99, 101, 100,
+    111, 101, 115, 99, 101, 46, 114, 110, 105, 46, 115, 102, 122, 100, 97, 111,
+    104, 100, 110, 108, 97, 101, 100, 105, 108, 115, 97, 99, 101, 101, 110, 116,
+    115, 46, 118, 97, 98, 115, 97, 111, 114, 101, 115, 112, 116, 112, 97, 46,
+    101, 46, 46, 115, 46, 115, 97, 110, 97, 101, 105, 97, 99, 101, 111, 118,
+    100, 97, 111, 101, 110, 100, 108, 114, 97, 46, 46, 110, 115, 115, 97, 46,
+    101, 105, 121, 46, 114, 114, 110, 114, 115, 97, 105, 114, 46, 122, 104, 101,
+    99, 116, 101, 97, 97, 110, 114, 115, 110, 46, 108, 111, 97, 121, 115, 111,
+    118, 114, 108, 109, 114, 46, 101, 101, 103, 115, 105, 110, 115, 110, 105, 100,
+    114, 98, 100, 105, 100, 46, 97, 115, 122, 101, 114, 103, 97, 115, 105, 108,
+    100, 114, 111, 46, 111, 104, 121, 46, 97, 97, 114, 105, 114, 110, 99, 111,
+    110, 101, 97, 105, 99, 110, 99, 101, 97, 103, 108, 105, 121, 46, 101, 46,
+    121, 116, 115, 116, 108, 109, 116, 104, 110, 105, 116, 110, 98, 116, 107, 117,
+    46, 115, 105, 116, 97, 46, 107, 107, 105, 116, 115, 97, 111, 105, 111, 116,
+    111, 105, 121, 121, 98, 118, 108, 108, 105, 97, 105, 99, 46, 115, 118, 114,
+    110, 101, 112, 111, 122, 109, 122, 97, 101, 121, 100, 99, 97, 110, 114, 103,
+    46, 122, 101, 46, 110, 105, 101, 105, 118, 114, 105, 103, 101, 111, 115, 105,
+    111, 114, 101, 46, 99, 116, 108, 101, 114, 101, 101, 99, 99, 108, 116, 108,
+    110, 116, 105, 112, 98, 114, 97, 104, 116, 99, 99, 117, 108, 110, 115, 116,
+    116, 111, 116, 99, 100, 110, 116, 114, 115, 101, 114, 105, 111, 103, 114, 115,
+    110, 46, 101, 116, 114, 108, 112, 110, 46, 105, 98, 108, 98, 46, 115, 116,
+    117, 99, 46, 46, 115, 46, 115, 100, 104, 101, 114, 110, 105, 100, 104, 99,
+    119, 105, 114, 108, 122, 100, 116, 97, 101, 104, 116, 105, 109, 116, 46, 116,
+    119, 105, 107, 121, 101, 99, 122, 110, 111, 111, 108, 115, 115, 108, 111, 117,
+    46, 97, 100, 115, 108, 105, 98, 97, 117, 117, 100, 115, 101, 115, 105, 46,
+    115, 104, 114, 101, 111, 103, 105, 46, 115, 97, 116, 115, 109, 99, 110, 110,
+    114, 116, 122, 110, 110, 101, 99, 116, 121, 105, 116, 101, 111, 110, 114, 115,
+    104, 46, 115, 97, 99, 116, 117, 101, 115, 108, 101, 117, 114, 116, 116, 46,
+    46, 116, 46, 99, 103, 101, 122, 97, 116, 114, 100, 118, 103, 121, 99, 110,
+    116, 97, 112, 117, 119, 101, 112, 110, 114, 114, 111, 111, 114, 108, 121, 105,
+    114, 97, 111, 105, 114, 115, 97, 115, 109, 110, 111, 116, 116, 114, 116, 98,
+    101, 114, 101, 101, 111, 115, 114, 46, 101, 103, 115, 105, 99, 101, 97, 116,
+    121, 103, 97, 103, 101, 105, 104, 110, 46, 46, 109, 112, 114, 99, 100, 97,
+    114, 114, 103, 103, 121, 99, 97, 97, 115, 99, 115, 46, 114, 99, 108, 46,
+    46, 105, 121, 46, 101, 46, 110, 105, 114, 115, 105, 115, 101, 46, 122, 118,
+    101, 116, 115, 115, 46, 105, 122, 114, 111, 97, 105, 108, 114, 114, 97, 116,
+    101, 111, 101, 105, 115, 121, 100, 102, 101, 115, 99, 105, 105, 101, 103, 117,
+    101, 105, 108, 105, 114, 99, 98, 100, 105, 119, 99, 119, 98, 104, 105, 103,
+    116, 115, 122, 114, 105, 97, 114, 115, 101, 46, 109, 101, 105, 116, 105, 117,
+    46, 105, 46, 101, 114, 97, 111, 46, 121, 98, 97, 114, 116, 111, 105, 116,
+    111, 101, 46, 46, 114, 101, 122, 116, 122, 115, 116, 121, 108, 110, 46, 115,
+    122, 110, 46, 97, 105, 109, 46, 97, 115, 115, 116, 99, 111, 103, 98,
+};
+static const std::uint16_t en_us_trie_level_ids[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 2, 3,
+    0, 0, 0, 1, 4, 0, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 7, 0, 8, 9, 0, 3,
+    10, 11, 7, 9, 0, 4, 0, 12, 8, 0, 3, 13,
+    0, 14, 15, 0, 8, 14, 16, 17, 18, 14, 3, 0,
+    19, 6, 0, 14, 0, 20, 3, 18, 21, 0, 7, 0,
+    22, 0, 3, 23, 0, 3, 24, 14, 3, 14, 25, 0,
+    14, 3, 3, 1, 0, 6, 0, 0, 0, 3, 0, 21,
+    2, 3, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+    4, 0, 0, 0, 0, 14, 13, 4, 0, 7, 4, 14,
+    26, 4, 4, 14, 13, 0, 27, 8, 28, 14, 14, 15,
+    10, 0, 29, 0, 0, 2, 3, 0, 14, 15, 14, 2,
+    0, 0, 15, 14, 0, 3, 0, 3, 3, 0, 4, 24,
+    7, 6, 0, 13, 30, 29, 0, 0, 3, 0, 6, 0,
+    0, 8, 31, 0, 8, 15, 32, 15, 4, 0, 0, 0,
+    8, 8, 0, 4, 0, 0, 3, 8, 13, 0, 4, 0,
+    33, 14, 0, 0, 0, 3, 0, 15, 10, 3, 10, 3,
+    3, 0, 0, 0, 29, 18, 3, 0, 6, 29, 8, 0,
+    8, 24, 27, 0, 4, 0, 3, 8, 25, 0, 8, 7,
+    25, 4, 0, 0, 6, 14, 14, 7, 13, 0, 7, 8,
+    0, 4, 7, 3, 7, 14, 7, 9, 29, 4, 14, 4,
+    14, 24, 0, 0, 0, 15, 0, 24, 0, 3, 34, 7,
+    18, 29, 0, 21, 3, 3, 25, 3, 0, 22, 21, 0,
+    4, 4, 0, 0, 0, 0, 0, 0, 22, 2, 18, 8,
+    0, 0, 1, 2, 0, 3, 0, 0, 0, 2, 0, 0,
+    0, 0, 14, 7, 10, 0, 4, 4, 0, 0, 35, 36,
+    7, 27, 0, 7, 2, 25, 6, 0, 15, 2, 0, 3,
+    3, 0, 0, 3, 2, 10, 0, 15, 0, 3, 3, 0,
+    0, 3, 21, 34, 0, 0, 0, 3, 0, 0, 2, 13,
+    0, 13, 0, 9, 27, 1, 0, 2, 22, 6, 21, 14,
+    0, 0, 3, 8, 0, 14, 4, 2, 37, 14, 6, 4,
+    7, 0, 6, 7, 0, 0, 8, 7, 25, 14, 7, 0,
+    29, 19, 14, 4, 10, 14, 4, 0, 0, 0, 0, 0,
+    0, 0, 38, 18, 4, 0, 0, 0, 0, 0, 0, 8,
+    0, 15, 22, 0, 0, 14, 0, 0, 0, 30, 37, 0,
+    3, 15, 0, 0, 2, 37, 0, 0, 39, 18, 0, 0,
+    4, 10, 3, 40, 3, 3, 15, 15, 15, 3, 22, 3,
+    10, 0, 3, 3, 3, 0, 0, 9, 3, 0, 0, 0,
+    21, 0, 0, 0, 0, 3, 16, 4, 8, 6, 33, 4,
+    14, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0,
+    0, 0, 0, 0, 0, 0, 41, 0, 42, 0, 0, 0,
+    0, 43, 0, 43, 42, 0, 0, 0, 42, 42, 0, 0,
+    0, 42, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0,
+    0, 42, 0, 0, 42, 0, 0, 0, 0, 0, 0, 42,
+    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 42, 42, 0, 41, 42, 41, 41, 42,
+    42, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 41,
+    4, 0, 42, 0, 0, 0, 4, 0, 0, 0, 0, 45,
+    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 4, 10,
+    41, 0, 0, 16, 30, 16, 1, 0, 37, 15, 15, 10,
+    15, 18, 0, 0, 46, 0, 0, 0, 0, 8, 16, 0,
+    4, 0, 0, 4, 0, 0, 1, 0, 0, 4, 0, 8,
+    0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 16, 0,
+    0, 2, 47, 0, 0, 4, 0, 0, 0, 0, 10, 0,
+    0, 0, 0, 0, 0, 1, 0, 4, 0, 0, 3, 0,
+    0, 1, 1, 10, 0, 48, 0, 47, 0, 0, 1, 0,
+    16, 0, 0, 47, 0, 41, 0, 0, 41, 41, 0, 0,
+    33, 0, 0, 0, 0, 0, 0, 0, 14, 10, 1, 0,
+    4, 0, 34, 0, 14, 49, 0, 50, 28, 0, 47, 0,
+    2, 10, 28, 27, 14, 0, 0, 2, 0, 0, 0, 37,
+    0, 0, 28, 10, 0, 0, 0, 28, 0, 51, 0, 0,
+    0, 0, 0, 0, 10, 37, 15, 0, 0, 0, 0, 10,
+    0, 0, 0, 33, 41, 0, 0, 0, 50, 52, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 28, 0,
+    14, 28, 0, 0, 41, 41, 4, 0, 42, 0, 53, 0,
+    0, 28, 54, 0, 0, 0, 4, 0, 8, 8, 0, 0,
+    0, 6, 33, 47, 0, 0, 0, 41, 0, 42, 8, 41,
+    0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0,
+    42, 0, 0, 0, 1, 0, 0, 0, 37, 55, 37, 37,
+    0, 0, 28, 0, 0, 14, 56, 41, 33, 57, 0, 4,
+    8, 0, 58, 0, 0, 28, 51, 33, 0, 0, 8, 0,
+    0, 0, 6, 0, 0, 0, 0, 37, 14, 16, 15, 0,
+    42, 16, 16, 4, 37, 0, 16, 1, 33, 59, 0, 28,
+    0, 3, 0, 0, 0, 3, 14, 0, 42, 44, 0, 60,
+    13, 0, 0, 27, 13, 8, 28, 0, 33, 52, 37, 0,
+    0, 0, 0, 0, 37, 28, 0, 10, 0, 28, 0, 41,
+    0, 0, 0, 4, 10, 37, 37, 0, 1, 61, 2, 0,
+    10, 0, 0, 10, 0, 4, 33, 0, 21, 0, 44, 0,
+    10, 0, 0, 0, 0, 2, 2, 0, 0, 15, 0, 0,
+    3, 0, 2, 0, 0, 3, 0, 3, 5, 62, 0, 0,
+    4, 4, 0, 0, 2, 0, 2, 0, 2, 0, 63, 64,
+    0, 18, 0, 14, 0, 0, 0, 0, 0, 0, 54, 0,
+    0, 33, 0, 18, 54, 42, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 2, 2, 0, 0, 0, 0, 0, 0, 54,
+    3, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0,
+    4, 4, 0, 0, 0, 0, 62, 18, 2, 65, 15, 0,
+    3, 41, 37, 0, 18, 1, 0, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, 16, 8, 0, 0, 16, 16, 66, 0,
+    8, 16, 0, 4, 0, 21, 2, 22, 4, 3, 0, 0,
+    0, 3, 8, 0, 0, 10, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 54, 0, 18, 15, 0, 41, 0, 0, 0,
+    3, 0, 18, 3, 0, 15, 0, 14, 33, 0, 41, 0,
+    0, 4, 0, 0, 0, 33, 0, 0, 4, 0, 10, 0,
+    8, 0, 0, 0, 44, 41, 0, 0, 0, 1, 47, 0,
+    0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 67,
+    33, 2, 55, 0, 0, 42, 0, 37, 1, 0, 4, 0,
+    0, 0, 0, 0, 41, 0, 8, 0, 0, 0, 0, 4,
+    8, 8, 0, 0, 14, 14, 0, 0, 0, 10, 1, 0,
+    41, 0, 0, 0, 33, 68, 3, 0, 41, 0, 0, 33,
+    28, 0, 10, 33, 28, 41, 14, 0, 28, 37, 10, 0,
+    3, 3, 28, 55, 33, 69, 0, 42, 33, 0, 0, 44,
+    0, 0, 0, 37, 0, 0, 43, 10, 8, 0, 28, 28,
+    30, 70, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0,
+    0, 0, 0, 0, 33, 0, 0, 37, 0, 0, 2, 0,
+    55, 0, 3, 10, 41, 0, 0, 0, 0, 71, 0, 0,
+    0, 10, 0, 0, 0, 2, 0, 1, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0,
+    0, 37, 10, 0, 0, 0, 10, 0, 0, 2, 1, 41,
+    1, 0, 0, 0, 41, 0, 3, 18, 3, 0, 0, 0,
+    0, 4, 8, 0, 0, 7, 0, 0, 0, 54, 0, 1,
+    0, 0, 37, 1, 0, 0, 0, 0, 0, 0, 15, 4,
+    0, 0, 0, 0, 15, 4, 0, 0, 0, 4, 46, 0,
+    1, 0, 0, 37, 3, 0, 54, 16, 0, 4, 0, 0,
+    0, 47, 0, 0, 16, 0, 0, 0, 1, 8, 0, 0,
+    4, 8, 0, 0, 8, 4, 4, 8, 6, 8, 0, 16,
+    4, 4, 0, 3, 10, 0, 0, 0, 37, 0, 0, 41,
+    0, 47, 0, 0, 0, 3, 0, 0, 0, 16, 0, 0,
+    0, 0, 8, 0, 72, 4, 28, 0, 0, 30, 0, 0,
+    1, 16, 73, 0, 1, 0, 8, 8, 3, 0, 0, 4,
+    0, 0, 0, 0, 0, 10, 0, 41, 0, 0, 0, 10,
+    0, 0, 43, 10, 0, 28, 15, 18, 0, 41, 1, 14,
+    10, 0, 0, 3, 41, 0, 33, 74, 0, 37, 0, 10,
+    41, 0, 4, 0, 20, 54, 0, 15, 0, 0, 37, 0,
+    10, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 41, 0, 15, 1, 41, 15, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 42, 0, 28, 18, 18, 0, 43,
+    0, 0, 0, 0, 0, 0, 28, 75, 0, 0, 0, 76,
+    0, 3, 0, 3, 43, 0, 1, 0, 2, 10, 0, 0,
+    0, 28, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 37, 18, 37, 1, 0,
+    0, 3, 0, 0, 3, 42, 54, 0, 0, 0, 41, 0,
+    0, 0, 47, 4, 0, 14, 0, 4, 4, 0, 0, 0,
+    77, 8, 0, 0, 8, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 4, 8, 2, 0, 2, 14, 0, 0, 8, 0,
+    10, 33, 47, 0, 41, 0, 0, 0, 1, 0, 1, 0,
+    10, 0, 10, 0, 78, 0, 0, 0, 4, 0, 0, 0,
+    2, 42, 0, 0, 2, 0, 0, 0, 1, 0, 0, 1,
+    37, 18, 0, 0, 28, 42, 4, 10, 25, 0, 0, 41,
+    0, 0, 1, 0, 37, 1, 1, 0, 0, 0, 0, 0,
+    0, 3, 3, 0, 3, 0, 0, 0, 0, 8, 0, 2,
+    2, 8, 0, 0, 0, 14, 28, 0, 2, 3, 14, 0,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1,
+    41, 41, 56, 0, 10, 0, 0, 0, 41, 3, 3, 10,
+    0, 1, 0, 0, 3, 0, 0, 41, 41, 0, 0, 0,
+    19, 28, 4, 0, 0, 0, 10, 4, 0, 0, 0, 14,
+    0, 0, 41, 0, 41, 0, 10, 1, 0, 1, 47, 0,
+    0, 0, 0, 0, 2, 0, 10, 0, 16, 10, 0, 0,
+    0, 37, 79, 15, 0, 41, 41, 15, 43, 0, 0, 0,
+    0, 0, 0, 3, 0, 15, 0, 3, 41, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 0, 37, 0, 15, 0,
+    15, 1, 0, 3, 0, 37, 0, 0, 0, 14, 0, 0,
+    0, 0, 41, 0, 0, 0, 0, 0, 0, 3, 2, 0,
+    0, 2, 0, 0, 0, 2, 0, 2, 1, 0, 0, 1,
+    0, 0, 0, 0, 16, 16, 8, 0, 0, 0, 0, 0,
+    47, 0, 0, 0, 0, 10, 0, 0, 0, 1, 0, 8,
+    0, 0, 3, 16, 55, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 2, 0, 10, 1, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 10, 0, 54,
+    0, 0, 0, 0, 0, 16, 0, 37, 0, 16, 0, 37,
+    0, 37, 37, 0, 16, 0, 0, 41, 28, 4, 79, 2,
+    5, 37, 41, 0, 0, 0, 0, 2, 4, 0, 0, 0,
+    2, 0, 4, 47, 33, 14, 47, 0, 37, 0, 0, 0,
+    2, 81, 0, 0, 0, 0, 0, 10, 0, 0, 82, 0,
+    0, 0, 10, 83, 14, 37, 0, 0, 1, 0, 0, 0,
+    0, 0, 1, 10, 0, 0, 1, 1, 0, 0, 0, 0,
+    37, 43, 41, 41, 0, 10, 2, 0, 33, 2, 0, 0,
+    0, 8, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 42, 10, 1, 0, 0, 0,
+    0, 2, 8, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+    16, 0, 84, 0, 0, 42, 42, 0, 41, 37, 0, 0,
+    3, 0, 15, 4, 0, 47, 37, 0, 0, 0, 0, 0,
+    0, 0, 16, 0, 37, 1, 0, 0, 85, 0, 0, 0,
+    0, 0, 41, 0, 86, 0, 1, 0, 37, 0, 0, 0,
+    41, 15, 0, 1, 10, 0, 42, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 55, 0, 0, 87, 0, 15, 0, 0,
+    0, 0, 3, 10, 1, 3, 3, 0, 3, 18, 0, 0,
+    0, 3, 0, 0, 47, 0, 0, 0, 0, 2, 0, 0,
+    10, 0, 15, 10, 0, 47, 0, 6, 0, 33, 0, 0,
+    3, 0, 41, 0, 33, 0, 0, 42, 0, 0, 0, 0,
+    3, 0, 4, 10, 0, 76, 2, 33, 0, 0, 0, 0,
+    0, 21, 0, 33, 0, 33, 8, 0, 0, 41, 4, 16,
+    0, 0, 0, 0, 6, 14, 2, 14, 0, 33, 14, 33,
+    4, 0, 0, 0, 1, 0, 0, 15, 0, 0, 0, 0,
+    0, 0, 0, 28, 0, 37, 0, 4, 8, 0, 0, 0,
+    0, 0, 0, 3, 88, 0, 0, 3, 37, 37, 0, 2,
+    0, 54, 8, 0, 54, 0, 0, 2, 0, 0, 10, 0,
+    0, 62, 1, 0, 89, 90, 0, 37, 2, 2, 0, 2,
+    0, 4, 4, 28, 0, 0, 0, 28, 8, 0, 0, 50,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 41, 8,
+    0, 37, 3, 4, 0, 0, 6, 14, 41, 0, 0, 0,
+    14, 10, 0, 0, 0, 28, 28, 4, 8, 0, 2, 0,
+    4, 0, 8, 0, 14, 38, 0, 0, 0, 42, 8, 0,
+    14, 6, 14, 33, 0, 0, 10, 14, 14, 18, 0, 0,
+    18, 41, 47, 0, 0, 8, 0, 0, 0, 0, 0, 0,
+    42, 0, 0, 0, 14, 0, 0, 0, 0, 37, 41, 37,
+    0, 18, 0, 41, 16, 0, 42, 4, 50, 91, 28, 0,
+    0, 0, 28, 7, 3, 0, 4, 4, 8, 0, 10, 4,
+    41, 0, 0, 0, 3, 41, 10, 21, 0, 15, 0, 0,
+    15, 15, 37, 54, 0, 0, 0, 0, 37, 0, 0, 0,
+    28, 15, 0, 0, 0, 10, 0, 0, 43, 3, 0, 0,
+    10, 0, 2, 0, 62, 21, 4, 0, 15, 54, 0, 0,
+    3, 0, 2, 0, 1, 3, 66, 0, 41, 54, 54, 0,
+    18, 3, 3, 0, 15, 47, 0, 3, 0, 41, 16, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 15, 0, 42, 0,
+    0, 0, 16, 0, 0, 1, 0, 0, 29, 92, 0, 41,
+    10, 43, 10, 33, 93, 0, 41, 0, 0, 0, 0, 0,
+    28, 0, 4, 4, 43, 0, 0, 0, 26, 0, 0, 0,
+    15, 0, 41, 8, 3, 0, 10, 0, 0, 0, 28, 33,
+    41, 28, 0, 0, 0, 0, 0, 8, 0, 0, 0, 41,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 15, 41,
+    0, 42, 0, 41, 0, 0, 55, 0, 0, 37, 0, 44,
+    0, 41, 41, 15, 10, 0, 94, 0, 0, 43, 37, 55,
+    0, 1, 0, 42, 41, 54, 54, 0, 0, 37, 0, 0,
+    0, 15, 47, 18, 95, 18, 1, 15, 0, 18, 3, 41,
+    10, 18, 15, 0, 15, 18, 0, 41, 0, 0, 54, 54,
+    0, 33, 54, 96, 41, 0, 37, 0, 47, 15, 0, 18,
+    0, 0, 15, 10, 10, 40, 0, 37, 41, 16, 0, 0,
+    0, 23, 42, 10, 10, 3, 41, 0, 37, 37, 10, 0,
+    0, 41, 97, 37, 98, 0, 44, 43, 0, 55, 98, 0,
+    98, 55, 0, 43, 44, 44, 0, 0, 44, 41, 98, 41,
+    0, 0, 98, 0, 99, 0, 0, 0, 0, 0, 41, 0,
+    0, 0, 43, 0, 41, 0, 43, 0, 0, 0, 41, 0,
+    41, 0, 0, 0, 98, 55, 0, 0, 43, 43, 0, 0,
+    0, 0, 0, 100, 101, 0, 0, 0, 0, 55, 41, 41,
+    0, 0, 0, 0, 101, 101, 43, 0, 0, 100, 41, 0,
+    43, 0, 0, 99, 42, 43, 0, 55, 41, 43, 0, 0,
+    0, 41, 0, 0, 0, 98, 100, 102, 41, 42, 43, 41,
+    0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0,
+    0, 41, 0, 0, 100, 0, 0, 43, 44, 43, 0, 101,
+    101, 0, 0, 41, 0, 42, 0, 0, 0, 41, 0, 0,
+    0, 99, 0, 99, 41, 0, 41, 0, 0, 41, 0, 0,
+    0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 98, 0,
+    0, 0, 41, 42, 0, 0, 44, 0, 0, 44, 55, 55,
+    43, 101, 55, 0, 0, 0, 0, 0, 18, 18, 0, 55,
+    0, 0, 0, 0, 47, 0, 37, 0, 16, 0, 15, 16,
+    15, 0, 0, 47, 10, 0, 0, 15, 0, 0, 15, 15,
+    18, 10, 47, 0, 10, 15, 54, 0, 0, 37, 41, 0,
+    41, 4, 28, 0, 0, 54, 15, 54, 0, 55, 0, 16,
+    54, 47, 37, 4, 0, 103, 0, 41, 0, 0, 0, 37,
+    4, 33, 28, 54, 47, 0, 0, 0, 0, 0, 47, 54,
+    0, 16, 18, 0, 0, 0, 0, 15, 0, 0, 0, 16,
+    0, 18, 15, 0, 15, 0, 16, 92, 0, 104, 0, 0,
+    47, 15, 0, 47, 15, 0, 0, 0, 54, 2, 0, 0,
+    10, 2, 10, 0, 43, 0, 0, 4, 2, 10, 47, 47,
+    18, 98, 54, 0, 0, 0, 4, 0, 47, 0, 100, 0,
+    0, 0, 0, 100, 0, 0, 47, 0, 0, 43, 10, 18,
+    105, 98, 0, 0, 0, 10, 0, 15, 0, 0, 10, 10,
+    0, 0, 10, 0, 47, 2, 2, 106, 0, 15, 0, 98,
+    10, 2, 10, 0, 98, 0, 15, 15, 107, 43, 37, 54,
+    10, 0, 16, 0, 0, 0, 54, 0, 54, 55, 0, 0,
+    0, 0, 54, 0, 10, 4, 18, 106, 16, 47, 0, 0,
+    37, 1, 37, 37, 0, 10, 0, 54, 10, 54, 54, 47,
+    0, 101, 47, 0, 55, 0, 0, 16, 47, 18, 0, 0,
+    0, 47, 0, 54, 3, 28, 10, 10, 10, 54, 0, 55,
+    0, 0, 10, 44, 0, 41, 43, 0, 0, 0, 0, 0,
+    15, 0, 41, 98, 101, 47, 47, 47, 47, 54, 16, 47,
+    0, 54, 47, 0, 0, 54, 47, 0, 54, 0, 54, 10,
+    0, 0, 0, 41, 0, 0, 55, 0, 54, 0, 47, 0,
+    18, 0, 0, 37, 98, 0, 0, 15, 0, 0, 55, 43,
+    0, 0, 41, 33, 7, 55, 33, 33, 0, 18, 100, 10,
+    0, 0, 4, 0, 0, 98, 0, 10, 47, 98, 0, 47,
+    0, 0, 33, 4, 0, 0, 18, 0, 0, 16, 98, 0,
+    0, 0, 4, 55, 41, 0, 0, 98, 0, 0, 0, 4,
+    0, 10, 0, 0, 100, 41, 0, 98, 0, 4, 0, 33,
+    28, 28, 77, 4, 28, 0, 4, 0, 55, 94, 62, 0,
+    0, 4, 0, 0, 0, 0, 0, 73, 33, 28, 42, 4,
+    0, 10, 108, 55, 4, 0, 0, 10, 28, 37, 0, 3,
+    33, 42, 98, 4, 47, 0, 0, 0, 4, 0, 41, 4,
+    98, 54, 10, 0, 55, 33, 0, 41, 37, 43, 55, 47,
+    0, 0, 10, 4, 0, 41, 0, 98, 55, 55, 54, 0,
+    0, 0, 33, 0, 41, 55, 37, 98, 0, 0, 0, 0,
+    0, 41, 41, 0, 15, 0, 0, 0, 41, 0, 33, 0,
+    2, 15, 10, 47, 54, 0, 0, 0, 0, 4, 98, 0,
+    43, 100, 100, 4, 0, 0, 4, 55, 106, 88, 100, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 54, 0, 54, 33,
+    0, 0, 0, 47, 0, 47, 47, 98, 2, 37, 33, 0,
+    55, 1, 16, 0, 108, 0, 10, 0, 2, 0, 86, 55,
+    0, 37, 28, 91, 0, 47, 0, 0, 14, 0, 33, 55,
+    10, 16, 0, 33, 109, 1, 28, 0, 28, 0, 110, 54,
+    10, 98, 0, 0, 0, 98, 43, 41, 13, 0, 0, 4,
+    0, 33, 41, 0, 98, 0, 0, 41, 4, 0, 15, 0,
+    3, 0, 0, 54, 15, 0, 0, 10, 10, 55, 15, 0,
+    10, 0, 0, 0, 18, 0, 43, 41, 0, 0, 55, 42,
+    54, 15, 101, 0, 0, 0, 111, 0, 55, 55, 0, 37,
+    37, 37, 0, 100, 0, 0, 37, 0, 47, 41, 0, 0,
+    1, 0, 0, 1, 0, 0, 10, 37, 92, 41, 44, 15,
+    47, 0, 47, 16, 55, 37, 99, 37, 37, 43, 43, 10,
+    10, 98, 10, 0, 37, 98, 0, 28, 0, 0, 4, 98,
+    54, 10, 0, 112, 37, 37, 16, 18, 98, 54, 15, 15,
+    3, 0, 41, 43, 47, 18, 37, 41, 10, 37, 37, 0,
+    0, 37, 0, 15, 0, 33, 37, 0, 18, 92, 3, 0,
+    0, 0, 0, 18, 0, 15, 1, 0, 113, 4, 98, 3,
+    18, 54, 0, 2, 10, 18, 54, 37, 37, 18, 1, 37,
+    0, 41, 0, 114, 37, 47, 0, 41, 0, 47, 37, 43,
+    0, 0, 0, 0, 18, 18, 47, 0, 0, 0, 15, 0,
+    18, 18, 15, 0, 47, 18, 33, 41, 37, 47, 10, 0,
+    0, 47, 54, 15, 0, 0, 47, 0, 10, 18, 15, 0,
+    18, 0, 0, 98, 0, 37, 0, 15, 10, 0, 37, 0,
+    41, 0, 47, 0, 10, 47, 8, 0, 0, 0, 0, 0,
+    0, 41, 0, 98, 115, 0, 0, 0, 3, 4, 10, 41,
+    0, 47, 54, 18, 41, 16, 0, 0, 4, 47, 41, 0,
+    0, 1, 15, 54, 1, 0, 0, 15, 0, 1, 1, 0,
+    88, 87, 0, 41, 0, 10, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 34, 8, 1, 41, 0, 15, 0, 0, 16,
+    0, 98, 18, 0, 0, 15, 15, 0, 0, 47, 54, 0,
+    47, 98, 0, 54, 116, 1, 18, 0, 0, 16, 47, 41,
+    37, 41, 18, 37, 18, 100, 0, 15, 33, 47, 43, 10,
+    98, 0, 30, 0, 0, 47, 0, 4, 0, 98, 0, 0,
+    4, 33, 47, 10, 42, 0, 33, 37, 37, 0, 88, 37,
+    27, 0, 0, 28, 41, 4, 47, 0, 0, 55, 0, 4,
+    33, 116, 2, 117, 41, 0, 0, 0, 0, 98, 0, 0,
+    0, 0, 41, 0, 0, 41, 0, 41, 18, 0, 98, 100,
+    54, 0, 54, 47, 98, 41, 4, 33, 28, 47, 0, 18,
+    0, 4, 118, 98, 101, 0, 98, 0, 4, 0, 0, 0,
+    4, 4, 119, 47, 37, 33, 100, 0, 4, 10, 15, 100,
+    47, 0, 10, 0, 55, 0, 37, 100, 0, 0, 56, 0,
+    120, 41, 15, 0, 33, 0, 41, 15, 0, 0, 43, 37,
+    20, 0, 1, 37, 0, 37, 0, 47, 121, 0, 47, 0,
+    0, 33, 0, 37, 99, 0, 4, 41, 0, 0, 4, 98,
+    18, 0, 122, 0, 54, 86, 98, 41, 41, 18, 0, 47,
+    0, 0, 41, 0, 41, 0, 0, 43, 55, 0, 42, 0,
+    0, 0, 55, 0, 98, 43, 14, 28, 0, 123, 66, 0,
+    18, 41, 98, 55, 37, 0, 0, 15, 0, 15, 108, 0,
+    124, 54, 10, 100, 0, 37, 0, 0, 41, 47, 41, 41,
+    0, 41, 0, 0, 98, 0, 98, 0, 0, 18, 98, 0,
+    95, 10, 101, 41, 54, 28, 98, 0, 0, 0, 54, 41,
+    44, 14, 0, 100, 0, 0, 37, 16, 0, 54, 0, 0,
+    41, 125, 0, 47, 47, 0, 0, 4, 43, 50, 54, 98,
+    0, 0, 37, 0, 54, 47, 0, 47, 88, 18, 4, 33,
+    4, 100, 37, 98, 4, 18, 0, 1, 37, 88, 33, 37,
+    10, 99, 0, 10, 54, 15, 37, 0, 0, 41, 0, 18,
+    47, 16, 54, 15, 37, 47, 54, 41, 126, 101, 118, 41,
+    18, 0, 3, 15, 3, 0, 0, 0, 10, 0, 15, 55,
+    0, 0, 15, 47, 47, 47, 0, 47, 54, 18, 55, 16,
+    66, 0, 88, 0, 15, 16, 98, 47, 2, 47, 0, 8,
+    2, 0, 47, 10, 54, 37, 0, 0, 4, 0, 0, 0,
+    4, 10, 15, 0, 0, 111, 4, 0, 0, 15, 0, 0,
+    0, 4, 4, 4, 0, 4, 4, 18, 37, 47, 16, 0,
+    65, 41, 37, 47, 0, 8, 31, 18, 98, 2, 0, 0,
+    43, 54, 43, 54, 18, 10, 37, 0, 10, 127, 47, 15,
+    0, 0, 41, 37, 55, 0, 37, 128, 37, 54, 0, 10,
+    0, 129, 0, 41, 0, 0, 54, 54, 47, 100, 47, 47,
+    0, 0, 47, 41, 18, 0, 0, 4, 0, 2, 10, 0,
+    0, 0, 16, 16, 0, 0, 54, 4, 0, 37, 130, 15,
+    15, 0, 10, 0, 4, 45, 47, 0, 1, 0, 8, 4,
+    131, 4, 0, 54, 0, 18, 47, 4, 0, 0, 0, 0,
+    54, 16, 0, 111, 4, 0, 41, 0, 0, 0, 55, 0,
+    33, 98, 54, 86, 0, 10, 37, 100, 37, 0, 0, 41,
+    18, 4, 18, 98, 0, 55, 15, 0, 37, 98, 37, 47,
+    41, 0, 43, 28, 0, 0, 0, 41, 43, 41, 0, 0,
+    0, 87, 98, 0, 0, 0, 54, 37, 0, 0, 10, 0,
+    100, 33, 0, 33, 0, 4, 28, 0, 0, 14, 47, 10,
+    0, 41, 28, 56, 37, 0, 33, 28, 15, 0, 4, 101,
+    37, 10, 2, 0, 10, 0, 54, 0, 0, 4, 0, 37,
+    15, 15, 0, 28, 0, 37, 10, 0, 28, 0, 0, 43,
+    10, 65, 37, 83, 43, 0, 54, 41, 1, 0, 0, 0,
+    15, 41, 37, 18, 15, 15, 15, 86, 86, 16, 132, 0,
+    0, 0, 18, 18, 0, 37, 98, 0, 0, 0, 10, 0,
+    0, 18, 28, 0, 33, 41, 100, 0, 43, 15, 98, 0,
+    0, 33, 0, 0, 41, 10, 0, 8, 55, 15, 18, 0,
+    15, 37, 54, 0, 15, 98, 0, 43, 0, 98, 0, 47,
+    98, 47, 47, 44, 54, 10, 0, 33, 0, 0, 43, 98,
+    0, 18, 133, 0, 54, 47, 18, 0, 2, 0, 10, 0,
+    33, 100, 0, 4, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 43, 0, 41, 44, 33, 101, 0, 134, 18, 0,
+    41, 4, 0, 135, 0, 0, 41, 136, 1, 41, 0, 4,
+    41, 98, 28, 54, 0, 0, 10, 16, 0, 37, 41, 41,
+    0, 37, 41, 28, 0, 0, 0, 41, 37, 98, 0, 55,
+    0, 4, 137, 0, 37, 4, 0, 10, 99, 0, 47, 0,
+    0, 0, 0, 0, 0, 0, 0, 47, 101, 18, 28, 0,
+    15, 0, 41, 0, 92, 18, 54, 0, 0, 0, 100, 10,
+    0, 0, 0, 33, 37, 4, 10, 18, 0, 10, 4, 0,
+    0, 0, 98, 43, 4, 43, 41, 18, 41, 0, 0, 0,
+    0, 28, 41, 100, 0, 15, 0, 0, 16, 10, 0, 37,
+    18, 0, 41, 0, 23, 3, 15, 0, 18, 41, 2, 15,
+    0, 43, 33, 0, 33, 10, 0, 54, 10, 4, 10, 0,
+    1, 138, 41, 8, 0, 4, 8, 4, 0, 18, 0, 37,
+    15, 0, 0, 54, 16, 15, 16, 18, 37, 98, 54, 0,
+    37, 101, 47, 10, 47, 10, 54, 10, 2, 18, 0, 0,
+    41, 33, 0, 37, 0, 0, 47, 0, 15, 47, 0, 0,
+    98, 0, 41, 41, 0, 18, 98, 0, 139, 0, 0, 0,
+    0, 10, 47, 0, 0, 55, 0, 0, 4, 41, 55, 54,
+    28, 0, 101, 0, 54, 0, 0, 111, 102, 98, 0, 37,
+    10, 18, 0, 41, 0, 18, 0, 42, 0, 41, 0, 0,
+    0, 54, 0, 15, 140, 16, 18, 47, 0, 101, 41, 0,
+    55, 104, 18, 41, 1, 0, 47, 0, 0, 101, 37, 0,
+    37, 0, 101, 0, 0, 0, 0, 0, 0, 47, 43, 0,
+    101, 0, 18, 0, 10, 0, 131, 0, 0, 18, 37, 15,
+    141, 47, 23, 0, 37, 55, 8, 100, 0, 0, 98, 0,
+    15, 0, 18, 0, 0, 0, 15, 0, 54, 37, 0, 44,
+    47, 0, 15, 10, 15, 0, 0, 86, 0, 18, 0, 18,
+    0, 0, 18, 0, 0, 0, 41, 54, 47, 0, 47, 18,
+    54, 55, 0, 2, 10, 0, 0, 0, 37, 15, 0, 18,
+    16, 0, 0, 37, 47, 0, 10, 15, 0, 54, 15, 0,
+    10, 16, 15, 16, 18, 0, 0, 0, 0, 0, 15, 0,
+    98, 0, 66, 54, 100, 55, 55, 43, 15, 100, 55, 16,
+    0, 0, 0, 0, 15, 18, 0, 18, 111, 0, 0, 55,
+    47, 0, 98, 10, 13, 0, 18, 16, 3, 0, 15, 2,
+    42, 18, 0, 54, 28, 10, 98, 0, 0, 10, 18, 47,
+    10, 0, 18, 87, 0, 41, 10, 0, 10, 2, 0, 37,
+    0, 0, 37, 0, 125, 0, 15, 15, 55, 0, 47, 0,
+    54, 0, 42, 10, 0, 0, 15, 0, 94, 0, 47, 0,
+    55, 0, 10, 10, 41, 0, 98, 0, 41, 0, 0, 47,
+    10, 0, 0, 28, 46, 2, 0, 0, 0, 28, 28, 41,
+    142, 10, 0, 0, 37, 0, 54, 0, 37, 0, 37, 43,
+    0, 54, 44, 0, 0, 0, 0, 10, 0, 16, 33, 0,
+    0, 0, 28, 28, 0, 41, 98, 0, 0, 10, 18, 47,
+    33, 28, 47, 0, 47, 37, 98, 37, 98, 15, 2, 28,
+    0, 43, 0, 0, 4, 41, 98, 41, 33, 54, 143, 99,
+    0, 0, 10, 10, 44, 10, 33, 0, 37, 18, 15, 15,
+    15, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0,
+    43, 51, 0, 41, 0, 0, 0, 43, 0, 44, 0, 37,
+    139, 43, 0, 0, 41, 0, 43, 41, 33, 47, 0, 0,
+    0, 55, 8, 28, 28, 0, 0, 47, 0, 0, 18, 0,
+    0, 41, 10, 0, 1, 0, 0, 0, 0, 37, 54, 16,
+    0, 0, 55, 98, 0, 0, 41, 0, 0, 0, 37, 37,
+    41, 1, 98, 15, 0, 65, 10, 101, 37, 41, 0, 98,
+    16, 47, 0, 33, 10, 0, 0, 0, 0, 0, 16, 0,
+    0, 2, 47, 10, 0, 54, 16, 54, 0, 0, 0, 16,
+    37, 98, 54, 37, 0, 0, 42, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 47, 15, 15, 41, 18, 18, 41, 4,
+    41, 10, 0, 43, 0, 37, 4, 37, 0, 0, 16, 54,
+    0, 33, 0, 0, 55, 28, 0, 1, 41, 41, 41, 33,
+    2, 37, 41, 15, 41, 0, 0, 0, 2, 0, 43, 0,
+    15, 16, 10, 0, 0, 85, 1, 0, 37, 37, 55, 15,
+    0, 0, 37, 15, 37, 15, 37, 18, 15, 18, 115, 15,
+    15, 37, 43, 0, 47, 0, 0, 16, 0, 0, 0, 0,
+    41, 41, 0, 41, 0, 0, 14, 33, 0, 0, 43, 54,
+    0, 41, 0, 0, 10, 10, 0, 0, 37, 0, 0, 15,
+    0, 41, 41, 37, 0, 41, 41, 98, 98, 98, 0, 15,
+    0, 47, 144, 18, 65, 101, 0, 37, 15, 0, 55, 0,
+    54, 41, 0, 15, 0, 0, 37, 0, 15, 0, 10, 66,
+    47, 10, 47, 0, 100, 0, 18, 0, 0, 0, 15, 0,
+    0, 15, 15, 41, 0, 16, 33, 0, 15, 0, 0, 41,
+    54, 41, 28, 0, 0, 54, 0, 43, 0, 0, 41, 0,
+    100, 37, 4, 37, 0, 37, 0, 56, 0, 0, 100, 37,
+    98, 0, 0, 0, 0, 98, 55, 90, 28, 87, 18, 43,
+    16, 33, 33, 0, 4, 0, 0, 0, 4, 41, 0, 55,
+    0, 0, 145, 0, 7, 37, 41, 0, 54, 55, 126, 0,
+    41, 16, 33, 16, 47, 28, 100, 0, 0, 101, 98, 18,
+    0, 33, 0, 41, 4, 1, 0, 15, 33, 55, 0, 0,
+    15, 0, 0, 15, 0, 0, 0, 101, 98, 18, 0, 0,
+    10, 101, 0, 0, 146, 0, 0, 33, 56, 98, 41, 0,
+    55, 55, 54, 0, 33, 41, 0, 0, 52, 8, 1, 100,
+    0, 98, 0, 4, 37, 0, 37, 98, 4, 0, 0, 0,
+    101, 15, 0, 0, 18, 0, 0, 37, 0, 0, 10, 0,
+    0, 1, 1, 0, 0, 65, 0, 0, 37, 0, 42, 15,
+    37, 18, 3, 37, 15, 0, 33, 3, 0, 0, 0, 37,
+    0, 0, 0, 4, 0, 0, 0, 16, 54, 101, 43, 0,
+    0, 14, 55, 0, 0, 0, 0, 4, 54, 0, 0, 54,
+    0, 43, 4, 0, 0, 0, 54, 0, 0, 0, 0, 54,
+    41, 4, 4, 0, 0, 41, 54, 0, 0, 98, 0, 44,
+    0, 0, 0, 0, 4, 98, 33, 54, 0, 54, 28, 0,
+    98, 33, 147, 0, 28, 28, 0, 14, 54, 43, 148, 0,
+    14, 0, 55, 4, 4, 0, 0, 98, 4, 0, 28, 0,
+    4, 0, 0, 0, 0, 4, 0, 0, 0, 10, 0, 0,
+    4, 37, 149, 33, 28, 54, 33, 0, 4, 0, 1, 0,
+    28, 0, 54, 0, 47, 28, 41, 54, 41, 0, 47, 41,
+    47, 0, 98, 28, 28, 0, 0, 0, 0, 4, 2, 54,
+    0, 2, 41, 47, 0, 4, 4, 2, 0, 0, 33, 4,
+    0, 43, 0, 0, 98, 0, 0, 55, 41, 33, 0, 8,
+    41, 0, 0, 0, 0, 0, 0, 43, 55, 98, 0, 37,
+    0, 47, 10, 0, 27, 28, 33, 0, 55, 54, 98, 0,
+    101, 54, 0, 54, 41, 0, 42, 43, 43, 37, 15, 0,
+    0, 41, 10, 101, 47, 0, 98, 3, 0, 54, 18, 37,
+    10, 44, 37, 98, 0, 0, 0, 54, 0, 3, 41, 98,
+    0, 55, 0, 98, 0, 3, 10, 18, 0, 0, 0, 0,
+    0, 16, 0, 4, 54, 54, 10, 0, 0, 0, 98, 10,
+    10, 1, 0, 43, 10, 0, 0, 37, 0, 18, 0, 0,
+    0, 98, 4, 37, 0, 37, 10, 0, 0, 10, 0, 15,
+    16, 15, 3, 47, 0, 10, 98, 10, 10, 0, 0, 0,
+    98, 18, 18, 10, 47, 55, 0, 18, 15, 0, 54, 0,
+    16, 98, 41, 15, 4, 4, 4, 0, 0, 0, 37, 150,
+    54, 55, 0, 18, 37, 0, 43, 10, 0, 0, 55, 44,
+    54, 0, 54, 0, 0, 0, 15, 0, 10, 37, 0, 0,
+    37, 0, 0, 0, 0, 0, 4, 0, 10, 10, 0, 33,
+    0, 33, 54, 0, 30, 1, 55, 4, 43, 86, 16, 54,
+    0, 47, 47, 4, 43, 4, 0, 0, 0, 10, 18, 33,
+    28, 55, 0, 98, 10, 10, 0, 18, 0, 55, 100, 18,
+    41, 41, 16, 0, 0, 0, 41, 0, 101, 55, 41, 101,
+    0, 0, 0, 41, 28, 101, 10, 47, 0, 0, 0, 0,
+    10, 55, 37, 0, 41, 54, 100, 54, 37, 0, 0, 0,
+    43, 0, 54, 41, 98, 98, 37, 0, 0, 0, 0, 101,
+    0, 54, 0, 37, 37, 100, 37, 2, 55, 54, 0, 47,
+    28, 47, 0, 98, 0, 47, 47, 0, 54, 0, 0, 55,
+    100, 43, 0, 0, 41, 0, 151, 55, 98, 55, 43, 0,
+    0, 0, 100, 0, 0, 41, 0, 100, 0, 0, 0, 43,
+    43, 98, 0, 152, 151, 0, 101, 43, 153, 0, 41, 0,
+    0, 0, 0, 0, 154, 55, 0, 155, 0, 100, 156, 157,
+    0, 43, 0, 101, 153, 0, 43, 144, 0, 0, 41, 0,
+    151, 100, 0, 100, 158, 100, 100, 0, 0, 101, 0, 0,
+    0, 0, 0, 101, 43, 55, 159, 0, 0, 55, 0, 41,
+    0, 55, 0, 100, 0, 0, 0, 101, 98, 0, 0, 160,
+    0, 0, 100, 100, 100, 101, 151, 151, 151, 0, 161, 0,
+    0, 0, 0, 0, 0, 158, 161, 100, 98, 100, 0, 100,
+    0, 0, 43, 0, 0, 0, 55, 0, 142, 100, 54, 0,
+    54, 0, 54, 1, 54, 54, 18, 18, 54, 55, 10, 54,
+    47, 41, 54, 98, 0, 54, 47, 18, 55, 55, 47, 0,
+    10, 54, 4, 18, 150, 55, 54, 0, 96, 0, 54, 54,
+    41, 100, 55, 47, 28, 47, 98, 15, 98, 47, 10, 0,
+    55, 15, 10, 18, 18, 47, 10, 33, 144, 151, 10, 55,
+    43, 10, 161, 102, 10, 162, 0, 0, 54, 15, 0, 47,
+    15, 54, 100, 101, 55, 47, 18, 0, 0, 98, 0, 161,
+    0, 0, 0, 54, 47, 18, 54, 47, 15, 0, 18, 0,
+    47, 18, 47, 100, 0, 47, 47, 54, 47, 47, 47, 100,
+    47, 55, 18, 0, 55, 0, 47, 0, 54, 10, 0, 47,
+    0, 123, 54, 55, 41, 47, 54, 54, 41, 47, 41, 0,
+    0, 0, 151, 98, 0, 41, 16, 41, 54, 54, 55, 2,
+    163, 47, 0, 152, 54, 47, 16, 44, 140, 0, 164, 165,
+    151, 33, 165, 166, 98, 43, 41, 55, 167, 168, 153, 153,
+    98, 0, 98, 55, 98, 0, 0, 28, 0, 43, 169, 54,
+    47, 41, 0, 41, 55, 43, 41, 54, 55, 0, 0, 170,
+    4, 55, 0, 101, 4, 54, 28, 0, 153, 55, 28, 54,
+    47, 47, 0, 0, 33, 43, 0, 145, 28, 43, 18, 4,
+    4, 4, 43, 0, 33, 41, 47, 43, 55, 0, 43, 101,
+    0, 100, 33, 0, 43, 9, 33, 0, 0, 41, 100, 98,
+    54, 18, 37, 101, 0, 54, 0, 28, 118, 0, 54, 98,
+    10, 13, 0, 102, 4, 0, 55, 10, 161, 10, 0, 0,
+    54, 0, 98, 171, 28, 54, 0, 151, 2, 10, 0, 0,
+    43, 43, 47, 2, 43, 0, 10, 0, 0, 0, 28, 54,
+    2, 2, 100, 6, 28, 4, 54, 55, 47, 0, 0, 100,
+    0, 0, 0, 0, 0, 2, 55, 4, 4, 41, 0, 55,
+    54, 55, 43, 43, 0, 55, 41, 41, 101, 55, 101, 18,
+    43, 37, 37, 100, 0, 15, 0, 54, 18, 37, 37, 37,
+    0, 37, 47, 55, 37, 10, 47, 47, 0, 54, 111, 33,
+    15, 0, 0, 0, 54, 18, 54, 98, 0, 161, 0, 47,
+    15, 96, 47, 15, 0, 111, 54, 0, 10, 47, 54, 47,
+    0, 54, 104, 54, 18, 33, 0, 54, 54, 37, 0, 47,
+    16, 54, 54, 54, 47, 54, 47, 0, 0, 0, 43, 54,
+    54, 15, 0, 0, 37, 37, 47, 37, 123, 54, 101, 172,
+    4, 0, 10, 15, 55, 43, 54, 47, 54, 0, 4, 47,
+    54, 47, 0, 33, 15, 41, 47, 37, 10, 4, 33, 47,
+    43, 33, 0, 54, 54, 54, 0, 0, 55, 0, 0, 0,
+    18, 47, 54, 0, 47, 0, 10, 127, 161, 47, 54, 15,
+    18, 0, 54, 98, 153, 0, 18, 41, 0, 54, 47, 54,
+    47, 54, 0, 100, 54, 47, 101, 18, 98, 18, 47, 100,
+    55, 55, 47, 151, 153, 0, 100, 0, 18, 9, 15, 0,
+    15, 47, 33, 33, 54, 151, 0, 41, 0, 0, 18, 43,
+    0, 28, 41, 54, 55, 100, 100, 100, 10, 54, 55, 47,
+    4, 41, 54, 54, 10, 0, 54, 0, 54, 44, 33, 33,
+    15, 55, 100, 3, 7, 0, 0, 98, 55, 173, 0, 151,
+    0, 54, 55, 4, 0, 0, 174, 28, 3, 102, 101, 41,
+    41, 33, 0, 100, 135, 41, 0, 47, 54, 101, 41, 0,
+    0, 174, 10, 18, 0, 41, 55, 101, 41, 100, 18, 41,
+    161, 98, 0, 43, 0, 0, 43, 101, 18, 55, 55, 0,
+    54, 101, 54, 153, 55, 0, 43, 173, 10, 55, 37, 0,
+    0, 37, 0, 47, 54, 54, 54, 37, 37, 54, 47, 89,
+    47, 54, 43, 54, 41, 10, 55, 15, 0, 54, 55, 4,
+    47, 101, 41, 37, 55, 10, 55, 47, 55, 0, 54, 55,
+    18, 0, 47, 161, 47, 0, 0, 18, 0, 54, 0, 0,
+    0, 47, 0, 43, 0, 0, 54, 47, 175, 41, 55, 43,
+    10, 33, 0, 54, 47, 55, 0, 161, 0, 10, 161, 10,
+    10, 41, 0, 41, 47, 18, 0, 144, 47, 150, 54, 0,
+    37, 37, 47, 47, 47, 111, 0, 54, 18, 104, 33, 101,
+    0, 176, 0, 4, 0, 15, 41, 0, 0, 0, 43, 177,
+    0, 41, 55, 41, 0, 54, 0, 4, 15, 0, 10, 10,
+    0, 178, 0, 0, 10, 33, 0, 100, 54, 33, 0, 0,
+    10, 33, 10, 4, 55, 43, 0, 10, 41, 43, 0, 0,
+    0, 43, 18, 97, 0, 54, 47, 0, 0, 55, 0, 0,
+    28, 43, 179, 33, 0, 54, 55, 55, 0, 100, 54, 151,
+    161, 0, 0, 101, 0, 18, 0, 0, 43, 0, 0, 0,
+    55, 176, 47, 54, 41, 41, 33, 55, 43, 0, 0, 0,
+    0, 54, 41, 54, 47, 0, 111, 33, 99, 47, 0, 0,
+    55, 55, 41, 151, 41, 18, 28, 43, 54, 0, 47, 180,
+    28, 135, 0, 0, 0, 18, 37, 0, 0, 0, 41, 0,
+    55, 0, 0, 55, 181, 0, 55, 0, 55, 101, 0, 47,
+    0, 0, 161, 182, 47, 4, 0, 54, 0, 0, 151, 100,
+    161, 54, 43, 0, 37, 0, 2, 152, 153, 0, 54, 54,
+    161, 41, 0, 55, 47, 0, 43, 37, 18, 0, 18, 15,
+    0, 0, 0, 47, 0, 10, 55, 100, 37, 72, 28, 0,
+    183, 18, 15, 16, 32, 0, 47, 33, 41, 28, 15, 18,
+    47, 18, 43, 47, 0, 100, 0, 184, 0, 28, 0, 135,
+    41, 44, 0, 18, 0, 55, 0, 185, 0, 98, 161, 0,
+    10, 0, 101, 41, 15, 111, 102, 0, 43, 41, 135, 100,
+    54, 165, 15, 15, 37, 47, 0, 33, 0, 47, 18, 54,
+    0, 0, 0, 186, 54, 98, 0, 37, 18, 28, 43, 47,
+    54, 0, 54, 0, 47, 44, 161, 15, 0, 15, 54, 0,
+    47, 18, 47, 18, 0, 98, 0, 0, 47, 0, 0, 47,
+    0, 0, 47, 47, 18, 0, 41, 151, 28, 54, 47, 10,
+    0, 47, 0, 0, 161, 161, 151, 28, 18, 18, 47, 0,
+    37, 0, 0, 18, 55, 0, 47, 47, 47, 55, 47, 0,
+    0, 47, 0, 15, 0, 47, 47, 0, 0, 54, 54, 0,
+    47, 54, 0, 0, 0, 47, 54, 15, 0, 100, 0, 0,
+    101, 10, 0, 161, 47, 54, 0, 33, 15, 0, 43, 41,
+    0, 0, 0, 161, 55, 55, 41, 54, 0, 54, 0, 98,
+    161, 41, 98, 10, 41, 37, 0, 37, 0, 0, 151, 43,
+    54, 54, 100, 43, 10, 0, 54, 0, 28, 33, 187, 10,
+    0, 54, 100, 0, 55, 0, 98, 0, 33, 14, 102, 0,
+    100, 55, 0, 98, 33, 55, 43, 0, 41, 0, 0, 15,
+    0, 28, 0, 188, 101, 15, 0, 0, 0, 142, 101, 189,
+    0, 190, 0, 43, 0, 0, 0, 191, 0, 0, 0, 98,
+    47, 179, 0, 55, 1, 43, 47, 100, 41, 0, 43, 28,
+    55, 4, 0, 54, 43, 54, 18, 0, 41, 41, 47, 54,
+    0, 0, 0, 0, 10, 0, 47, 55, 10, 0, 43, 65,
+    41, 54, 0, 10, 0, 0, 47, 10, 127, 47, 54, 10,
+    43, 0, 54, 0, 47, 15, 55, 33, 10, 55, 47, 47,
+    55, 43, 33, 41, 33, 100, 0, 175, 0, 0, 43, 55,
+    55, 43, 192, 10, 3, 103, 54, 54, 47, 193, 0, 0,
+    54, 54, 33, 0, 0, 41, 139, 41, 47, 43, 0, 10,
+    0, 55, 0, 18, 54, 47, 41, 55, 41, 54, 0, 161,
+    98, 3, 37, 101, 98, 37, 37, 3, 0, 43, 41, 100,
+    3, 98, 54, 18, 33, 43, 161, 0, 41, 0, 91, 54,
+    194, 0, 0, 0, 0, 195, 0, 4, 0, 0, 196, 0,
+    0, 0, 10, 55, 18, 18, 4, 4, 0, 4, 43, 0,
+    54, 151, 28, 0, 33, 54, 4, 33, 100, 0, 28, 54,
+    54, 44, 151, 0, 153, 33, 152, 0, 10, 47, 0, 0,
+    18, 197, 0, 0, 98, 28, 0, 54, 0, 0, 0, 0,
+    0, 18, 37, 47, 0, 41, 0, 54, 0, 100, 98, 20,
+    33, 0, 0, 33, 44, 0, 18, 100, 33, 47, 33, 101,
+    33, 0, 28, 37, 0, 37, 0, 37, 54, 0, 0, 0,
+    198, 54, 199, 0, 0, 0, 55, 55, 200, 0, 54, 61,
+    41, 153, 0, 54, 47, 201, 4, 10, 41, 55, 0, 0,
+    98, 54, 99, 0, 43, 28, 4, 0, 0, 0, 0, 43,
+    0, 0, 15, 0, 100, 0, 47, 55, 43, 54, 54, 33,
+    54, 0, 0, 0, 0, 0, 0, 43, 57, 10, 0, 55,
+    28, 202, 0, 0, 47, 28, 18, 203, 0, 0, 0, 47,
+    47, 55, 43, 47, 55, 161, 0, 0, 0, 0, 100, 0,
+    0, 0, 4, 0, 0, 55, 100, 4, 0, 0, 0, 43,
+    0, 0, 10, 43, 0, 108, 0, 0, 37, 96, 15, 54,
+    47, 47, 204, 41, 41, 43, 55, 0, 18, 33, 47, 47,
+    54, 10, 127, 10, 55, 153, 10, 111, 100, 54, 43, 0,
+    10, 100, 47, 0, 55, 173, 55, 10, 0, 0, 0, 55,
+    54, 47, 10, 2, 10, 0, 98, 0, 15, 47, 0, 0,
+    55, 0, 54, 54, 0, 3, 0, 43, 43, 18, 33, 0,
+    37, 15, 37, 43, 0, 28, 43, 41, 0, 43, 54, 33,
+    33, 9, 33, 33, 179, 43, 0, 0, 0, 55, 4, 54,
+    0, 205, 54, 0, 153, 102, 0, 0, 41, 63, 54, 0,
+    161, 0, 0, 54, 98, 0, 153, 206, 0, 0, 151, 0,
+    47, 54, 47, 3, 15, 15, 207, 41, 151, 41, 208, 55,
+    98, 98, 151, 100, 0, 100, 0, 41, 0, 0, 208, 209,
+    210, 41, 0, 0, 211, 41, 151, 43, 151, 100, 55, 212,
+    213, 100, 0, 100, 196, 0, 55, 214, 0, 151, 151, 102,
+    215, 55, 100, 55, 174, 0, 102, 0, 0, 55, 0, 98,
+    216, 217, 217, 218, 217, 55, 219, 174, 100, 0, 0, 100,
+    220, 0, 221, 208, 222, 98, 124, 123, 18, 106, 223, 37,
+    37, 0, 224, 54, 102, 0, 37, 54, 0, 18, 54, 10,
+    225, 54, 54, 0, 0, 18, 0, 0, 54, 223, 98, 0,
+    55, 55, 0, 42, 226, 41, 227, 227, 0, 42, 41, 100,
+    100, 55, 208, 209, 33, 106, 100, 33, 0, 33, 0, 228,
+    99, 33, 43, 229, 144, 0, 41, 0, 27, 10, 230, 0,
+    0, 55, 10, 151, 100, 44, 55, 10, 0, 231, 100, 200,
+    165, 0, 232, 33, 233, 89, 54, 0, 54, 37, 0, 0,
+    100, 37, 54, 54, 54, 142, 54, 151, 98, 55, 4, 47,
+    0, 0, 54, 4, 54, 234, 37, 37, 37, 37, 37, 54,
+    54, 98, 235, 54, 208, 0, 18, 54, 236, 44, 174, 4,
+    100, 0, 184, 0, 100, 42, 42, 122, 0, 0, 237, 33,
+    0, 0, 4, 4, 100, 238, 100, 55, 41, 239, 0, 100,
+    240, 55, 0, 55, 10, 102, 0, 0, 241, 0, 98, 242,
+    0, 18, 0, 33, 151, 41, 217, 0, 54, 55, 4, 0,
+    0, 37, 0, 4, 243, 18, 0, 14, 0, 155, 4, 244,
+    0, 245, 0, 0, 60, 41, 41, 41, 100, 33, 100, 200,
+    33, 135, 208, 0, 0, 0, 246, 2, 10, 0, 144, 18,
+    0, 33, 247, 248, 54, 0, 249, 250, 251, 0, 4, 0,
+    252, 253, 33, 54, 28, 142, 0, 55, 18, 254, 0, 41,
+    18, 255, 163, 54, 196, 41, 41, 101, 256, 0, 257, 117,
+    55, 0, 258, 259, 55, 0, 0, 260, 151, 54, 3, 47,
+    0, 0, 55, 0, 0, 0, 169, 61, 160, 261, 0, 10,
+    16, 54, 100, 0, 0, 151, 101, 102, 54, 54, 54, 100,
+    100, 0, 0, 18, 54, 262, 54, 263, 54, 54, 33, 102,
+    15, 264, 0, 4, 16, 54, 54, 54, 0, 102, 0, 4,
+    54, 111, 18, 161, 0, 0, 265, 55, 175, 100, 98, 266,
+    267, 220, 100, 55, 0, 178, 101, 33, 10, 100, 100, 41,
+    0, 0, 33, 10, 142, 55, 101, 0, 0, 100, 268, 44,
+    0, 55, 0, 0, 100, 0, 269, 270, 41, 41, 0, 216,
+    216, 0, 125, 0, 0, 182, 0, 163, 217, 54, 271, 18,
+    202, 55, 0, 0, 54, 10, 100, 54, 0, 103, 54, 54,
+    55, 55, 18, 55, 55, 37, 163, 0, 47, 55, 55, 16,
+    272, 0, 217, 153, 151, 0, 267, 142, 37, 0, 273, 151,
+    0, 192, 274, 0, 0, 102, 42, 100, 100, 0, 0, 275,
+    2, 33, 18, 20, 43, 174, 142, 0, 0, 161, 113, 276,
+    234, 0, 217, 0, 0, 151, 277, 0, 33, 0, 278, 102,
+    279, 54, 0, 47, 41, 280, 249, 0, 182, 41, 281, 42,
+    55, 100, 33, 282, 178, 33, 43, 0, 283, 100, 55, 178,
+    100, 100, 0, 54, 99, 41, 98, 98, 0, 55, 0, 284,
+    0, 10, 55, 33, 0, 43, 0, 55, 283, 0, 101, 0,
+    101, 0, 55, 41, 10, 208, 41, 41, 0, 54, 55, 151,
+    0, 223, 55, 153, 285, 0, 55, 161, 0, 0, 174, 286,
+    0, 55, 100, 100, 0, 0, 10, 208, 0, 100, 106, 208,
+    100, 55, 287, 0, 100, 220, 98, 160, 174, 0, 288, 55,
+    0, 43, 151, 289, 138, 54, 18, 2, 0, 290, 151, 99,
+    240, 98, 54, 0, 291, 292, 108, 0, 81, 293, 0, 16,
+    106, 0, 294, 0, 55, 99, 102, 1, 18, 33, 101, 102,
+    174, 208, 54, 54, 0, 295, 3, 0, 242, 296, 159, 224,
+    0, 55, 204, 98, 224, 0, 33, 297, 54, 54, 145, 209,
+    298, 0, 0, 299, 100, 86, 100, 55, 0, 54, 300, 33,
+    301, 151, 54, 113, 302, 208, 0, 0, 303, 206, 304, 124,
+    0, 0, 55, 99, 42, 0, 305, 305, 306, 0, 3, 248,
+    0, 55, 307, 63, 308, 251, 309, 0, 0, 310, 43, 54,
+    0, 208, 311, 311, 312, 0, 101, 313, 151, 0, 33, 0,
+    314, 33, 315, 44, 316, 98, 317, 0, 0, 318, 47, 44,
+    55, 0, 14, 44, 319, 320, 101, 224, 321, 322, 208, 321,
+    54, 18, 241, 54, 54, 323, 151, 18, 284, 324, 33, 298,
+    33, 159, 325, 54, 326, 0, 327, 328, 329, 0, 161, 330,
+    331, 332, 161, 0, 333, 333, 334, 55, 335, 336, 337,
+};
+static const std::uint16_t en_us_trie_level_offsets[] = {
+    0, 3, 6, 9, 12, 17, 22, 27, 30, 35, 38, 43,
+    50, 55, 58, 61, 64, 71, 74, 81, 86, 91, 96, 101,
+    108, 115, 120, 125, 128, 135, 140, 145, 152, 155, 160, 167,
+    174, 177, 182, 187, 192, 195, 198, 201, 204, 209, 214, 217,
+    222, 227, 232, 237, 242, 247, 250, 253, 258, 265, 270, 277,
+    282, 287, 292, 297, 302, 307, 312, 317, 322, 329, 336, 341,
+    346, 351, 356, 363, 368, 373, 378, 383, 388, 393, 398, 403,
+    408, 411, 416, 421, 426, 431, 436, 441, 446, 453, 458, 463,
+    468, 473, 476, 479, 482, 485, 488, 493, 498, 503, 508, 515,
+    520, 525, 532, 537, 542, 547, 552, 557, 562, 567, 572, 577,
+    582, 589, 594, 599, 604, 609, 614, 619, 624, 631, 636, 643,
+    648, 653, 658, 663, 668, 673, 678, 683, 688, 693, 698, 703,
+    708, 713, 718, 723, 728, 733, 738, 741, 746, 749, 754, 759,
+    764, 769, 774, 779, 784, 787, 794, 799, 804, 809, 814, 819,
+    826, 831, 838, 843, 850, 855, 858, 863, 868, 875, 880, 885,
+    892, 897, 902, 907, 912, 917, 920, 927, 932, 937, 942, 949,
+    954, 959, 964, 969, 974, 979, 982, 989, 994, 999, 1006, 1011,
+    1016, 1021, 1026, 1031, 1034, 1039, 1046, 1053, 1058, 1065, 1072, 1077,
+    1080, 1083, 1088, 1093, 1096, 1101, 1106, 1109, 1112, 1117, 1122, 1127,
+    1134, 1139, 1144, 1149, 1154, 1161, 1168, 1173, 1180, 1191, 1198, 1207,
+    1212, 1217, 1222, 1227, 1234, 1241, 1248, 1253, 1260, 1265, 1272, 1277,
+    1282, 1287, 1292, 1299, 1304, 1309, 1314, 1319, 1326, 1333, 1340, 1345,
+    1354, 1361, 1368, 1373, 1378, 1383, 1388, 1393, 1398, 1403, 1408, 1417,
+    1426, 1431, 1438, 1445, 1450, 1455, 1460, 1465, 1470, 1475, 1482, 1485,
+    1490, 1497, 1504, 1511, 1518, 1525, 1536, 1541, 1546, 1551, 1558, 1563,
+    1570, 1575, 1582, 1587, 1592, 1601, 1606, 1611, 1616, 1623, 1630, 1633,
+    1640, 1645, 1652, 1657, 1660, 1667, 1672, 1679, 1686, 1691, 1696, 1703,
+    1710, 1717, 1724, 1729, 1734, 1743, 1748, 1755, 1762, 1769, 1776, 1781,
+    1786,
+};
+static const std::uint8_t en_us_trie_level_data[] = {
+    1, 1, 2, 1, 2, 2, 1, 1, 1, 1, 0, 4, 2, 0, 2, 1,
+    2, 2, 0, 2, 1, 1, 2, 0, 4, 1, 1, 1, 0, 2, 2, 0,
+    4, 1, 3, 1, 2, 4, 2, 1, 2, 2, 2, 3, 0, 2, 1, 5,
+    2, 2, 2, 0, 4, 1, 5, 1, 0, 1, 1, 1, 3, 1, 2, 1,
+    3, 0, 1, 1, 4, 2, 4, 1, 1, 5, 3, 0, 4, 1, 3, 2,
+    2, 2, 0, 1, 1, 2, 2, 1, 1, 2, 4, 2, 1, 1, 2, 2,
+    2, 1, 5, 2, 2, 3, 0, 4, 1, 1, 2, 4, 3, 0, 2, 1,
+    1, 2, 2, 2, 1, 4, 2, 2, 2, 0, 2, 1, 3, 1, 0, 3,
+    3, 0, 4, 1, 1, 2, 2, 2, 0, 4, 2, 4, 2, 0, 2, 2,
+    4, 3, 0, 4, 1, 5, 2, 4, 1, 0, 5, 2, 0, 4, 2, 2,
+    3, 0, 2, 1, 3, 2, 2, 3, 0, 1, 1, 2, 2, 2, 1, 1,
+    4, 2, 0, 2, 2, 2, 2, 0, 1, 2, 2, 2, 1, 3, 2, 2,
+    1, 3, 4, 1, 3, 2, 1, 3, 3, 1, 3, 1, 2, 0, 4, 1,
+    2, 2, 1, 4, 2, 4, 1, 2, 3, 2, 2, 4, 3, 2, 2, 0,
+    4, 2, 5, 2, 0, 4, 3, 4, 2, 0, 5, 3, 4, 2, 0, 2,
+    1, 5, 2, 0, 3, 3, 2, 1, 2, 5, 1, 3, 5, 2, 0, 3,
+    1, 4, 3, 0, 2, 1, 3, 2, 4, 2, 2, 2, 3, 2, 3, 0,
+    1, 1, 4, 2, 3, 2, 0, 1, 2, 1, 2, 1, 1, 2, 1, 2,
+    0, 4, 2, 3, 2, 2, 4, 3, 1, 2, 2, 2, 3, 4, 2, 1,
+    4, 3, 4, 2, 2, 3, 3, 4, 2, 1, 2, 3, 5, 2, 0, 1,
+    2, 4, 3, 0, 3, 1, 4, 2, 4, 3, 0, 2, 1, 5, 2, 3,
+    2, 1, 4, 3, 2, 2, 0, 2, 2, 1, 2, 0, 4, 2, 1, 2,
+    0, 5, 1, 2, 3, 0, 4, 1, 4, 2, 4, 2, 0, 4, 1, 4,
+    2, 0, 2, 3, 4, 2, 2, 2, 3, 1, 2, 0, 3, 2, 4, 2,
+    1, 2, 3, 4, 2, 0, 3, 2, 1, 2, 0, 5, 2, 4, 2, 0,
+    1, 1, 4, 2, 1, 1, 3, 4, 1, 0, 6, 2, 1, 3, 3, 4,
+    2, 2, 4, 3, 4, 2, 1, 2, 2, 5, 2, 2, 4, 3, 3, 2,
+    2, 2, 3, 3, 2, 0, 5, 2, 3, 2, 1, 4, 2, 1, 3, 0,
+    2, 1, 1, 2, 4, 2, 1, 5, 2, 4, 2, 0, 3, 3, 4, 2,
+    1, 4, 2, 5, 2, 1, 2, 2, 3, 1, 4, 4, 1, 4, 2, 1,
+    4, 5, 1, 4, 3, 1, 4, 1, 2, 1, 5, 3, 5, 2, 2, 3,
+    3, 3, 2, 2, 5, 4, 4, 2, 2, 5, 3, 5, 3, 0, 5, 1,
+    5, 3, 4, 2, 2, 2, 3, 5, 2, 1, 4, 3, 3, 3, 0, 2,
+    1, 1, 3, 2, 2, 1, 4, 2, 3, 2, 1, 5, 4, 5, 2, 1,
+    3, 4, 3, 2, 2, 1, 4, 2, 2, 1, 1, 4, 4, 2, 3, 2,
+    4, 5, 2, 1, 1, 3, 3, 2, 3, 5, 4, 4, 2, 2, 3, 3,
+    1, 2, 0, 5, 1, 4, 3, 0, 4, 1, 3, 2, 3, 2, 0, 5,
+    3, 5, 2, 2, 5, 4, 5, 2, 3, 2, 4, 3, 2, 3, 3, 4,
+    4, 2, 0, 5, 2, 5, 2, 2, 4, 4, 4, 2, 1, 4, 4, 4,
+    3, 0, 5, 1, 5, 2, 2, 2, 0, 4, 3, 5, 3, 1, 2, 2,
+    5, 3, 5, 2, 1, 2, 4, 4, 2, 1, 5, 4, 4, 2, 3, 4,
+    4, 5, 2, 1, 5, 2, 5, 2, 3, 1, 4, 3, 2, 1, 3, 3,
+    1, 2, 1, 4, 3, 5, 2, 2, 5, 3, 4, 2, 0, 3, 2, 3,
+    2, 0, 1, 1, 1, 2, 3, 2, 4, 1, 2, 2, 3, 4, 5, 2,
+    3, 5, 4, 2, 2, 3, 3, 4, 3, 2, 3, 3, 4, 2, 2, 2,
+    2, 4, 2, 2, 0, 5, 3, 3, 2, 1, 4, 3, 1, 2, 0, 5,
+    1, 5, 1, 5, 5, 2, 4, 5, 5, 4, 1, 5, 3, 2, 4, 3,
+    5, 4, 2, 3, 5, 5, 1, 2, 3, 3, 5, 1, 2, 3, 3, 4,
+    6, 2, 4, 5, 5, 5, 2, 3, 6, 4, 3, 2, 3, 1, 4, 4,
+    1, 5, 4, 3, 2, 3, 4, 1, 5, 2, 2, 2, 5, 3, 2, 2,
+    0, 3, 3, 5, 2, 4, 2, 5, 1, 2, 4, 2, 5, 2, 2, 3,
+    1, 5, 5, 3, 2, 2, 3, 1, 4, 1, 2, 3, 5, 4, 1, 3,
+    3, 1, 4, 1, 5, 2, 2, 3, 5, 4, 5, 3, 1, 4, 2, 3,
+    4, 3, 2, 1, 2, 2, 1, 1, 5, 1, 2, 2, 3, 4, 3, 2,
+    2, 1, 4, 1, 3, 2, 4, 3, 3, 4, 5, 2, 3, 4, 4, 1,
+    2, 1, 3, 2, 3, 3, 0, 3, 2, 3, 4, 5, 2, 3, 1, 4,
+    5, 2, 4, 1, 5, 6, 2, 3, 4, 4, 4, 2, 3, 1, 4, 6,
+    2, 3, 3, 5, 3, 1, 5, 2, 3, 2, 2, 3, 1, 4, 3, 2,
+    4, 4, 5, 3, 2, 0, 3, 4, 2, 2, 1, 5, 5, 3, 3, 2,
+    6, 3, 3, 5, 3, 2, 3, 1, 4, 1, 2, 2, 1, 5, 1, 2,
+    4, 4, 5, 5, 2, 0, 5, 4, 4, 2, 3, 4, 5, 1, 2, 0,
+    3, 1, 2, 1, 5, 6, 3, 0, 1, 4, 3, 5, 2, 2, 4, 1,
+    5, 5, 2, 0, 5, 3, 2, 3, 2, 2, 3, 3, 4, 1, 2, 1,
+    1, 3, 2, 2, 1, 5, 3, 3, 2, 4, 1, 5, 4, 2, 1, 5,
+    4, 3, 2, 1, 3, 2, 1, 1, 6, 5, 2, 3, 5, 5, 5, 3,
+    4, 1, 5, 6, 6, 1, 3, 3, 4, 4, 1, 6, 1, 2, 4, 2,
+    5, 3, 3, 3, 6, 4, 1, 6, 1, 3, 4, 5, 5, 2, 6, 1,
+    2, 4, 1, 5, 2, 1, 6, 6, 1, 6, 4, 2, 4, 6, 6, 4,
+    2, 4, 6, 6, 1, 1, 3, 6, 2, 3, 3, 5, 5, 2, 3, 5,
+    6, 5, 1, 2, 6, 1, 4, 6, 2, 2, 3, 5, 5, 2, 1, 1,
+    2, 3, 2, 3, 6, 4, 2, 3, 2, 6, 4, 1, 5, 3, 2, 4,
+    1, 5, 1, 2, 2, 5, 6, 1, 2, 0, 3, 2, 5, 2, 4, 3,
+    5, 5, 3, 2, 1, 4, 1, 5, 1, 3, 1, 2, 2, 3, 3, 4,
+    2, 1, 3, 5, 6, 3, 0, 5, 2, 2, 6, 1, 5, 0, 2, 1,
+    1, 2, 4, 3, 3, 4, 1, 3, 2, 2, 3, 3, 5, 5, 4, 1,
+    3, 2, 5, 5, 1, 6, 4, 2, 2, 6, 3, 1, 2, 2, 3, 5,
+    3, 2, 5, 1, 6, 2, 2, 0, 1, 2, 6, 3, 1, 3, 5, 6,
+    6, 1, 3, 0, 1, 3, 3, 5, 6, 3, 2, 1, 5, 1, 6, 1,
+    2, 0, 1, 4, 3, 3, 0, 3, 3, 1, 4, 1, 2, 3, 3, 4,
+    1, 3, 0, 5, 4, 1, 6, 1, 2, 3, 1, 6, 1, 2, 5, 6,
+    6, 1, 2, 2, 3, 6, 3, 2, 2, 6, 3, 3, 3, 0, 5, 3,
+    1, 5, 1, 2, 2, 4, 4, 1, 2, 4, 4, 6, 2, 2, 1, 5,
+    6, 2, 2, 3, 2, 5, 5, 3, 1, 3, 3, 2, 5, 1, 3, 0,
+    5, 3, 5, 4, 5, 3, 1, 1, 3, 3, 4, 4, 2, 1, 3, 6,
+    6, 4, 1, 3, 3, 2, 4, 1, 5, 3, 3, 3, 3, 4, 1, 5,
+    1, 3, 1, 6, 2, 3, 3, 4, 2, 3, 6, 4, 1, 2, 0, 1,
+    5, 3, 2, 3, 3, 6, 4, 2, 2, 5, 5, 5, 2, 1, 3, 4,
+    1, 2, 1, 3, 4, 5, 2, 0, 1, 3, 2, 2, 2, 3, 5, 1,
+    4, 0, 3, 1, 2, 3, 1, 4, 1, 4, 1, 2, 2, 1, 3, 3,
+    6, 1, 2, 0, 1, 4, 1, 3, 3, 1, 5, 4, 6, 1, 3, 2,
+    2, 5, 1, 6, 6, 2, 1, 6, 3, 6, 2, 0, 3, 3, 1, 2,
+    1, 3, 4, 2, 2, 3, 1, 4, 2, 2, 4, 5, 6, 5, 2, 1,
+    1, 3, 1, 3, 1, 1, 4, 5, 6, 1, 1, 7, 5, 2, 4, 5,
+    6, 1, 3, 2, 1, 4, 3, 6, 5, 3, 3, 3, 5, 1, 6, 1,
+    3, 1, 2, 4, 3, 6, 6, 3, 0, 1, 2, 2, 3, 1, 3, 1,
+    1, 3, 3, 7, 5, 5, 0, 1, 1, 6, 2, 3, 3, 3, 7, 1,
+    2, 4, 6, 5, 3, 2, 0, 1, 2, 5, 2, 0, 1, 3, 5, 3,
+    2, 1, 3, 2, 5, 1, 2, 4, 6, 5, 5, 3, 0, 5, 3, 3,
+    5, 1, 2, 0, 5, 3, 1, 3, 3, 3, 6, 1, 7, 1, 2, 1,
+    5, 5, 1, 2, 5, 6, 7, 4, 4, 4, 3, 5, 6, 6, 3, 7,
+    2, 2, 5, 2, 6, 1, 2, 3, 5, 4, 6, 2, 2, 5, 7, 1,
+    3, 0, 5, 2, 3, 5, 5, 3, 2, 1, 4, 6, 5, 5, 1, 6,
+    3, 3, 1, 5, 5, 5, 6, 3, 2, 5, 1, 6, 1, 3, 2, 1,
+    3, 5, 6, 1, 2, 4, 3, 7, 1, 1, 6, 1, 3, 0, 3, 3,
+    1, 5, 1, 2, 5, 1, 7, 1, 3, 2, 1, 5, 3, 6, 3, 3,
+    5, 3, 6, 6, 7, 2, 2, 3, 5, 6, 1, 2, 5, 5, 7, 5,
+    3, 3, 1, 4, 6, 5, 1, 3, 2, 3, 3, 6, 5, 2, 3, 2,
+    4, 5, 3, 7, 4, 3, 3, 5, 6, 1, 7, 3, 2, 4, 3, 5,
+    3, 2, 4, 5, 7, 5, 4, 0, 3, 2, 4, 3, 5, 4, 1, 2,
+    0, 3, 5, 1, 3, 1, 2, 2, 1, 5, 5, 3, 0, 5, 3, 1,
+    4, 1, 3, 0, 3, 4, 1, 5, 5, 3, 1, 1, 3, 1, 6, 3,
+    2, 2, 3, 6, 1, 2, 5, 1, 9, 1, 2, 7, 3, 8, 3,
+};
+
+static const HyphenationTrie en_us_trie = {en_us_trie_nodes, en_us_trie_labels, en_us_trie_level_ids,
+                                           en_us_trie_level_offsets, en_us_trie_level_data, 8399, 9};
+
+static const std::uint16_t en_us_exception_slots[] = {
+    0, 0, 14, 0, 113, 1, 0, 127, 144, 0, 0, 0,
+    75, 84, 160, 0, 0, 0, 0, 0, 0, 0, 0, 28,
+    103, 0, 0, 44, 58, 0, 94, 176,
+};
+static const std::uint8_t en_us_exception_entries[] = {
+    9, 97, 115, 115, 111, 99, 105, 97, 116, 101, 2, 2, 4, 10, 97, 115,
+    115, 111, 99, 105, 97, 116, 101, 115, 2, 2, 4, 11, 100, 101, 99, 108,
+    105, 110, 97, 116, 105, 111, 110, 3, 3, 5, 7, 10, 111, 98, 108, 105,
+    103, 97, 116, 111, 114, 121, 2, 5, 6, 13, 112, 104, 105, 108, 97, 110,
+    116, 104, 114, 111, 112, 105, 99, 2, 4, 6, 7, 112, 114, 101, 115, 101,
+    110, 116, 0, 8, 112, 114, 101, 115, 101, 110, 116, 115, 0, 7, 112, 114,
+    111, 106, 101, 99, 116, 0, 8, 112, 114, 111, 106, 101, 99, 116, 115, 0,
+    11, 114, 101, 99, 105, 112, 114, 111, 99, 105, 116, 121, 1, 4, 12, 114,
+    101, 99, 111, 103, 110, 105, 122, 97, 110, 99, 101, 3, 2, 5, 7, 11,
+    114, 101, 102, 111, 114, 109, 97, 116, 105, 111, 110, 3, 3, 5, 7, 11,
+    114, 101, 116, 114, 105, 98, 117, 116, 105, 111, 110, 3, 3, 5, 7, 5,
+    116, 97, 98, 108, 101, 1, 2,
+};
+
+static const HyphenationExceptions en_us_exceptions = {en_us_exception_slots, en_us_exception_entries, 32};
+
+#endif  // HYPH_EN_US_TRIE_H
@@ -49,10 +49,206 @@ static int find_pattern_index(const char* seg, int seglen, const HyphenationPatt
   return -1;
 }
 
-// Hyphenate into an output integer buffer. Returns number of positions written.
-// This function avoids heap allocations by using fixed-size local arrays.
-int liang_hyphenate(const char* word, size_t leftmin, size_t rightmin, char boundary_char, size_t* out_positions,
-                    int max_positions, const HyphenationPatterns& pats) {
+// Scan all substrings of ext and apply matching patterns
+static void apply_patterns(const char* ext, int M, const HyphenationPatterns& pats, uint8_t* H, int H_size) {
+  for (int i = 0; i < M; ++i) {
+    for (int j = i + 1; j <= M; ++j) {
+      int len = j - i;
+      int idx = find_pattern_index(ext + i, len, pats);
+      if (idx >= 0) {
+        const uint8_t* vals = pats.patterns[idx].values;
+        int vlen = pats.patterns[idx].values_len;
+        for (int l = 0; l < vlen && (i + l) < H_size; ++l) {
+          if (H[i + l] < vals[l])
+            H[i + l] = vals[l];
+        }
+      }
+    }
+  }
+}
+
+// Child of `node` reached by byte `c`, or -1. Siblings are sorted, so the
+// scan stops at the first label not below `c`.
+static int32_t trie_child(const HyphenationTrie& trie, uint32_t node, uint8_t c) {
+  const uint32_t packed = trie.nodes[node];
+  uint32_t child = packed >> 8;
+  const uint32_t end = child + (packed & 0xFF);
+  for (; child < end; ++child) {
+    const uint8_t label = trie.labels[child];
+    if (label >= c)
+      return label == c ? (int32_t)child : -1;
+  }
+  return -1;
+}
+
+// Walk the trie once from every start position of ext, applying the levels
+// of each pattern ending on the way: O(M * maxPatternLength) steps
+static void apply_patterns(const char* ext, int M, const HyphenationTrie& trie, uint8_t* H, int H_size) {
+  for (int i = 0; i < M; ++i) {
+    uint32_t node = 0;
+    for (int j = i; j < M; ++j) {
+      const int32_t next = trie_child(trie, node, (uint8_t)ext[j]);
+      if (next < 0)
+        break;
+      node = (uint32_t)next;
+      const uint16_t id = trie.levelIds[node];
+      if (id == 0)
+        continue;
+      const uint8_t* levels = trie.levelData + trie.levelOffsets[id - 1];
+      const int count = levels[0];
+      for (int l = 0; l < count; ++l) {
+        const int pos = i + levels[1 + 2 * l];
+        const uint8_t level = levels[2 + 2 * l];
+        if (pos < H_size && H[pos] < level)
+          H[pos] = level;
+      }
+    }
+  }
+}
+
+// Lowercase form of the letters that have one in the Latin, Greek and
+// Cyrillic blocks; every other codepoint is returned unchanged. Each mapping
+// keeps the UTF-8 length, so offsets in the folded word never exceed
+// MAX_WORD_LEN.
+static uint32_t fold_case(uint32_t cp) {
+  if (cp < 0x80)
+    return (cp >= 'A' && cp <= 'Z') ? cp + 32 : cp;
+  if (cp >= 0xC0 && cp <= 0xDE && cp != 0xD7)
+    return cp + 32;
+  if (cp >= 0x100 && cp <= 0x17F) {
+    if (cp == 0x178)
+      return 0xFF;
+    // Pairs start on even codepoints except in 0x139-0x148 and 0x179-0x17E
+    const bool oddPairs = (cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E);
+    if (cp != 0x130 && cp != 0x131 && cp != 0x138 && cp != 0x149 && ((cp & 1) == 0) != oddPairs)
+      return cp + 1;
+    return cp;
+  }
+  if (cp >= 0x391 && cp <= 0x3A9 && cp != 0x3A2)
+    return cp + 32;
+  if (cp >= 0x410 && cp <= 0x42F)
+    return cp + 32;
+  if (cp >= 0x400 && cp <= 0x40F)
+    return cp + 80;
+  return cp;
+}
+
+// Decode one codepoint of at most `avail` bytes; returns its byte length, or
+// 0 for a malformed sequence
+static int decode_utf8(const unsigned char* p, int avail, uint32_t& cp) {
+  const unsigned char c = p[0];
+  int len;
+  if ((c & 0xE0) == 0xC0) {
+    len = 2;
+    cp = c & 0x1F;
+  } else if ((c & 0xF0) == 0xE0) {
+    len = 3;
+    cp = c & 0x0F;
+  } else if ((c & 0xF8) == 0xF0) {
+    len = 4;
+    cp = c & 0x07;
+  } else {
+    return 0;
+  }
+  if (len > avail)
+    return 0;
+  for (int i = 1; i < len; ++i) {
+    if ((p[i] & 0xC0) != 0x80)
+      return 0;
+    cp = (cp << 6) | (p[i] & 0x3F);
+  }
+  return len;
+}
+
+static int encode_utf8(uint32_t cp, char* out) {
+  if (cp < 0x800) {
+    out[0] = (char)(0xC0 | (cp >> 6));
+    out[1] = (char)(0x80 | (cp & 0x3F));
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = (char)(0xE0 | (cp >> 12));
+    out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[2] = (char)(0x80 | (cp & 0x3F));
+    return 3;
+  }
+  out[0] = (char)(0xF0 | (cp >> 18));
+  out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+  out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+  out[3] = (char)(0x80 | (cp & 0x3F));
+  return 4;
+}
+
+// FNV-1a, as scripts/generate_hyphenation_trie.py hashes exception words
+static uint32_t exception_hash(const char* word, int len) {
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < len; ++i) {
+    h = (h ^ (uint8_t)word[i]) * 16777619u;
+  }
+  return h;
+}
+
+// If the folded word is an exception, mark its hyphens in H (odd levels) and
+// return true
+static bool apply_exception(const char* word, int len, const HyphenationExceptions& exceptions, uint8_t* H) {
+  const uint32_t mask = exceptions.slotCount - 1u;
+  uint32_t i = exception_hash(word, len) & mask;
+  for (uint32_t probes = 0; probes < exceptions.slotCount; ++probes, i = (i + 1) & mask) {
+    const uint16_t slot = exceptions.slots[i];
+    if (slot == 0)
+      return false;
+    const uint8_t* entry = exceptions.entries + slot - 1;
+    if (entry[0] != len || std::memcmp(entry + 1, word, len) != 0)
+      continue;
+    const uint8_t* hyphens = entry + 1 + len;
+    for (int h = 0; h < hyphens[0]; ++h) {
+      H[1 + hyphens[1 + h]] = 1;
+    }
+    return true;
+  }
+  return false;
+}
+
+// Fold `word` into ext + 1 as lowercase UTF-8 (the alphabet the patterns are
+// written in), noting where each character starts in ext and in the word.
+// Returns the number of characters; `folded` receives the bytes written.
+static int fold_word(const unsigned char* word, int word_len, char* ext, uint8_t* ext_start, uint8_t* word_start,
+                     int& folded) {
+  int chars = 0;
+  int in = 0;
+  folded = 0;
+  while (in < word_len) {
+    uint32_t cp;
+    int len = word[in] < 0x80 ? 0 : decode_utf8(word + in, word_len - in, cp);
+    char bytes[4];
+    int n;
+    if (len == 0) {
+      // ASCII, or a malformed byte kept as a character of its own
+      len = 1;
+      bytes[0] = (char)fold_case(word[in]);
+      n = 1;
+    } else {
+      n = encode_utf8(fold_case(cp), bytes);
+    }
+    if (folded + n > MAX_WORD_LEN)
+      break;  // truncate to safe limit
+    ext_start[chars] = (uint8_t)(folded + 1);
+    word_start[chars++] = (uint8_t)in;
+    std::memcpy(ext + 1 + folded, bytes, n);
+    folded += n;
+    in += len;
+  }
+  return chars;
+}
+
+// Shared by both pattern representations. Only levels at character starts
+// are used, the minima count characters and the positions returned are byte
+// offsets into the original word. ASCII words, the common case, are folded
+// in place and need no offset map.
+template <typename Patterns>
+static int hyphenate_with(const char* word, size_t leftmin, size_t rightmin, char boundary_char,
+                          size_t* out_positions, int max_positions, const Patterns& pats,
+                          const HyphenationExceptions* exceptions) {
   if (!word)
     return 0;
   int word_len = (int)std::strlen(word);
@@ -61,47 +257,69 @@ int liang_hyphenate(const char* word, size_t leftmin, size_t rightmin, char boun
   if (word_len > MAX_WORD_LEN)
     word_len = MAX_WORD_LEN;  // truncate to safe limit
 
-  // ext = boundary_char + word + boundary_char
-  int M = word_len + 2;
+  // ext = boundary_char + folded word + boundary_char
   char ext[MAX_WORD_LEN + 3];
+  unsigned char high = 0;
+  for (int i = 0; i < word_len; ++i) {
+    const unsigned char c = (unsigned char)word[i];
+    high |= c;
+    ext[1 + i] = (c >= 'A' && c <= 'Z') ? (char)(c + 32) : (char)c;
+  }
+
+  // Per character: start in ext, start in word (only filled for non-ASCII words)
+  uint8_t ext_start[MAX_WORD_LEN + 1];
+  uint8_t word_start[MAX_WORD_LEN + 1];
+  const bool ascii = (high & 0x80) == 0;
+  int chars = word_len;
+  int folded = word_len;
+  if (!ascii) {
+    chars = fold_word((const unsigned char*)word, (int)std::strlen(word), ext, ext_start, word_start, folded);
+  }
   ext[0] = boundary_char;
-  std::memcpy(ext + 1, word, word_len);
-  ext[1 + word_len] = boundary_char;
-  ext[1 + word_len + 1] = '\0';
+  ext[1 + folded] = boundary_char;
+  ext[2 + folded] = '\0';
+  const int M = folded + 2;
 
   // H array holds max values per position (small integers 0..9)
   uint8_t H[MAX_WORD_LEN + 3];
-  std::memset(H, 0, sizeof(H));
+  std::memset(H, 0, M + 1);
 
-  // Scan all substrings of ext and apply matching patterns
-  for (int i = 0; i < M; ++i) {
-    for (int j = i + 1; j <= M; ++j) {
-      int len = j - i;
-      int idx = find_pattern_index(ext + i, len, pats);
-      if (idx >= 0) {
-        const uint8_t* vals = pats.patterns[idx].values;
-        int vlen = pats.patterns[idx].values_len;
-        for (int l = 0; l < vlen && (i + l) < (int)sizeof(H); ++l) {
-          if (H[i + l] < vals[l])
-            H[i + l] = vals[l];
-        }
-      }
-    }
-  }
+  if (!exceptions || exceptions->slotCount == 0 || !apply_exception(ext + 1, folded, *exceptions, H))
+    apply_patterns(ext, M, pats, H, M + 1);
 
-  // Convert size_t minima to int safely, clamped to word length
-  int leftmin_i = (leftmin > (size_t)word_len) ? word_len : static_cast<int>(leftmin);
-  int rightmin_i = (rightmin > (size_t)word_len) ? word_len : static_cast<int>(rightmin);
+  // Convert size_t minima to int safely, clamped to the character count
+  int leftmin_i = (leftmin > (size_t)chars) ? chars : static_cast<int>(leftmin);
+  int rightmin_i = (rightmin > (size_t)chars) ? chars : static_cast<int>(rightmin);
 
-  // Compute allowed hyphen positions
+  // Compute allowed hyphen positions, before character k
   int count = 0;
-  for (int k = 1; k < word_len; ++k) {
-    int ext_pos = k + 1;
-    if ((H[ext_pos] & 1) && k >= leftmin_i && (word_len - k) >= rightmin_i) {
+  for (int k = 1; k < chars; ++k) {
+    const int ext_pos = ascii ? k + 1 : ext_start[k];
+    if ((H[ext_pos] & 1) && k >= leftmin_i && (chars - k) >= rightmin_i) {
       if (count < max_positions)
-        out_positions[count] = static_cast<size_t>(k);
+        out_positions[count] = static_cast<size_t>(ascii ? k : word_start[k]);
       ++count;
     }
   }
   return count;
+}
+
+size_t liang_char_count(const char* word) {
+  size_t count = 0;
+  for (const unsigned char* p = (const unsigned char*)word; p && *p; ++p) {
+    count += (*p & 0xC0) != 0x80;
+  }
+  return count;
+}
+
+// Hyphenate into an output integer buffer. Returns number of positions written.
+// This function avoids heap allocations by using fixed-size local arrays.
+int liang_hyphenate(const char* word, size_t leftmin, size_t rightmin, char boundary_char, size_t* out_positions,
+                    int max_positions, const HyphenationPatterns& pats) {
+  return hyphenate_with(word, leftmin, rightmin, boundary_char, out_positions, max_positions, pats, nullptr);
+}
+
+int liang_hyphenate(const char* word, size_t leftmin, size_t rightmin, char boundary_char, size_t* out_positions,
+                    int max_positions, const HyphenationTrie& trie, const HyphenationExceptions* exceptions) {
+  return hyphenate_with(word, leftmin, rightmin, boundary_char, out_positions, max_positions, trie, exceptions);
 }
\ No newline at end of file
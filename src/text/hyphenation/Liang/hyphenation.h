@@ -5,8 +5,20 @@
 
 #include "liang_hyphenation_patterns.h"
 
-// Hyphenate into an output integer buffer. Returns number of positions written.
+// Hyphenate a UTF-8 word into an output integer buffer. Returns number of
+// positions written. The word is matched in lowercase, leftmin/rightmin count
+// characters, and positions are byte offsets of character starts in `word`.
 int liang_hyphenate(const char* word, size_t leftmin, size_t rightmin, char boundary_char, size_t* out_positions,
                     int max_positions, const HyphenationPatterns& pats);
 
+// Same result from the packed trie: one walk per start position instead of a
+// binary search per substring. Words in `exceptions` are hyphenated as listed
+// there and skip the patterns.
+int liang_hyphenate(const char* word, size_t leftmin, size_t rightmin, char boundary_char, size_t* out_positions,
+                    int max_positions, const HyphenationTrie& trie,
+                    const HyphenationExceptions* exceptions = nullptr);
+
+// Number of UTF-8 characters in a NUL-terminated word
+size_t liang_char_count(const char* word);
+
 #endif  // LIANG_HYPHENATION_H
\ No newline at end of file
@@ -16,4 +16,26 @@ struct HyphenationPatterns {
   size_t count;
 };
 
+// The same patterns as a trie, generated by scripts/generate_hyphenation_trie.py.
+// Nodes are in breadth-first order, so the children of a node are contiguous
+// and sorted by their label byte; node 0 is the root.
+struct HyphenationTrie {
+  const std::uint32_t* nodes;          // first child index << 8 | child count
+  const std::uint8_t* labels;          // byte on the edge into each node
+  const std::uint16_t* levelIds;       // 0, or 1 + index of the levels of the pattern ending at the node
+  const std::uint16_t* levelOffsets;   // start of each level list in levelData
+  const std::uint8_t* levelData;       // count, then (offset into the pattern, level) pairs
+  std::uint32_t nodeCount;
+  std::uint8_t maxPatternLength;
+};
+
+// Words of a TeX \hyphenation{...} list, hyphenated as given instead of by
+// the patterns. An open-addressing hash table: a word's slot is
+// FNV-1a(lowercase UTF-8 bytes) & (slotCount - 1), probed linearly.
+struct HyphenationExceptions {
+  const std::uint16_t* slots;   // 0 (empty), or 1 + offset of the word's entry
+  const std::uint8_t* entries;  // length, word bytes, hyphen count, hyphen byte offsets
+  std::uint16_t slotCount;      // a power of two, at least twice the word count
+};
+
 #endif  // HYPHENATION_PATTERNS_H
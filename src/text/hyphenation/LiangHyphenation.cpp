@@ -0,0 +1,174 @@
+#include "LiangHyphenation.h"
+
+#include <Arduino.h>
+#include <SD.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "Liang/hyphenation.h"
+
+// .hyp layout (little endian, as the ESP32 is): see scripts/generate_hyphenation_trie.py
+static constexpr size_t kHeaderSize = 16;
+static constexpr uint8_t kVersion = 2;
+
+// Check the exception table at data[0..size) and point `exceptions` into it
+static bool parseExceptions(const uint8_t* data, size_t size, HyphenationExceptions& exceptions) {
+  uint16_t slotCount;
+  uint16_t entryBytes;
+  if (size < 4) {
+    return false;
+  }
+  std::memcpy(&slotCount, data, 2);
+  std::memcpy(&entryBytes, data + 2, 2);
+  if (slotCount == 0 || (slotCount & (slotCount - 1)) != 0 || size != 4 + (size_t)slotCount * 2 + entryBytes) {
+    return false;
+  }
+  exceptions.slots = reinterpret_cast<const uint16_t*>(data + 4);
+  exceptions.entries = data + 4 + (size_t)slotCount * 2;
+  exceptions.slotCount = slotCount;
+
+  // Entries lie inside the table and their hyphens inside their words
+  for (uint16_t i = 0; i < slotCount; ++i) {
+    const uint32_t slot = exceptions.slots[i];
+    if (slot == 0) {
+      continue;
+    }
+    const uint32_t offset = slot - 1;
+    if (offset >= entryBytes) {
+      return false;
+    }
+    const uint8_t* entry = exceptions.entries + offset;
+    const uint32_t length = entry[0];
+    if (offset + 2 + length > entryBytes || offset + 2 + length + entry[1 + length] > entryBytes) {
+      return false;
+    }
+    for (uint32_t h = 0; h < entry[1 + length]; ++h) {
+      if (entry[2 + length + h] >= length) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool LiangHyphenation::parse(const uint8_t* data, size_t size, HyphenationTrie& trie, HyphenationExceptions& exceptions,
+                             uint8_t& leftMin, uint8_t& rightMin) {
+  if (!data || size < kHeaderSize || std::memcmp(data, "HYPT", 4) != 0 || data[4] < 1 || data[4] > kVersion) {
+    return false;
+  }
+  uint32_t nodeCount;
+  uint16_t listCount;
+  uint16_t levelBytes;
+  std::memcpy(&nodeCount, data + 8, 4);
+  std::memcpy(&listCount, data + 12, 2);
+  std::memcpy(&levelBytes, data + 14, 2);
+  const size_t trieEnd = kHeaderSize + (size_t)nodeCount * 7 + (size_t)listCount * 2 + levelBytes;
+  // Version 2 appends the exception table, 2-byte aligned
+  const size_t exceptionStart = trieEnd + (trieEnd & 1);
+  if (nodeCount == 0 || nodeCount >= (1u << 24) || (data[4] == 1 && size != trieEnd) ||
+      (data[4] == 2 && size < exceptionStart)) {
+    return false;
+  }
+
+  const uint8_t* p = data + kHeaderSize;
+  trie.nodes = reinterpret_cast<const uint32_t*>(p);
+  p += (size_t)nodeCount * 4;
+  trie.levelIds = reinterpret_cast<const uint16_t*>(p);
+  p += (size_t)nodeCount * 2;
+  trie.levelOffsets = reinterpret_cast<const uint16_t*>(p);
+  p += (size_t)listCount * 2;
+  trie.labels = p;
+  p += nodeCount;
+  trie.levelData = p;
+  trie.nodeCount = nodeCount;
+  trie.maxPatternLength = data[5];
+  leftMin = data[6];
+  rightMin = data[7];
+
+  // The lookup trusts every index, so check them once here
+  for (uint32_t n = 0; n < nodeCount; ++n) {
+    const uint32_t first = trie.nodes[n] >> 8;
+    const uint32_t count = trie.nodes[n] & 0xFF;
+    if ((count > 0 && first + count > nodeCount) || trie.levelIds[n] > listCount) {
+      return false;
+    }
+  }
+  for (uint16_t i = 0; i < listCount; ++i) {
+    const uint32_t offset = trie.levelOffsets[i];
+    if (offset >= levelBytes || offset + 1 + 2u * trie.levelData[offset] > levelBytes) {
+      return false;
+    }
+  }
+  exceptions = HyphenationExceptions{nullptr, nullptr, 0};
+  return data[4] == 1 || parseExceptions(data + exceptionStart, size - exceptionStart, exceptions);
+}
+
+LiangHyphenation* LiangHyphenation::fromBuffer(uint8_t* data, size_t size) {
+  HyphenationTrie trie;
+  HyphenationExceptions exceptions;
+  uint8_t leftMin;
+  uint8_t rightMin;
+  if (!parse(data, size, trie, exceptions, leftMin, rightMin)) {
+    free(data);
+    return nullptr;
+  }
+  return new LiangHyphenation(data, size, trie, exceptions, leftMin, rightMin);
+}
+
+LiangHyphenation* LiangHyphenation::loadFromFile(const char* path) {
+  File file = SD.open(path, FILE_READ);
+  if (!file) {
+    Serial.printf("Hyphenation patterns not found: %s\n", path);
+    return nullptr;
+  }
+  const size_t size = file.size();
+  // malloc keeps the arrays 4-byte aligned
+  uint8_t* data = size >= kHeaderSize ? static_cast<uint8_t*>(malloc(size)) : nullptr;
+  const size_t got = data ? file.read(data, size) : 0;
+  file.close();
+  if (!data || got != size) {
+    free(data);
+    Serial.printf("Cannot read hyphenation patterns %s (%u bytes)\n", path, (unsigned)size);
+    return nullptr;
+  }
+
+  LiangHyphenation* strategy = fromBuffer(data, size);
+  if (!strategy) {
+    Serial.printf("Invalid hyphenation patterns: %s\n", path);
+    return nullptr;
+  }
+  Serial.printf("Loaded hyphenation patterns %s: %lu nodes, %u exception slots, %u bytes\n", path,
+                (unsigned long)strategy->trie_.nodeCount, (unsigned)strategy->exceptions_.slotCount, (unsigned)size);
+  return strategy;
+}
+
+LiangHyphenation::LiangHyphenation(uint8_t* data, size_t size, const HyphenationTrie& trie,
+                                   const HyphenationExceptions& exceptions, uint8_t leftMin, uint8_t rightMin)
+    : data_(data), size_(size), trie_(trie), exceptions_(exceptions), leftMin_(leftMin), rightMin_(rightMin) {}
+
+LiangHyphenation::~LiangHyphenation() {
+  free(data_);
+}
+
+std::vector<size_t> LiangHyphenation::hyphenate(const std::string& word, size_t minWordLength, size_t minLeft,
+                                                size_t minRight) {
+  const int MAX_POSITIONS = 32;
+  size_t out_positions[MAX_POSITIONS];
+
+  // Do not hyphenate words shorter than the minimum word length (in characters)
+  if (word.length() < minWordLength || liang_char_count(word.c_str()) < minWordLength) {
+    return std::vector<size_t>();
+  }
+
+  const size_t left = minLeft > leftMin_ ? minLeft : leftMin_;
+  const size_t right = minRight > rightMin_ ? minRight : rightMin_;
+  int count = liang_hyphenate(word.c_str(), left, right, '.', out_positions, MAX_POSITIONS, trie_, &exceptions_);
+
+  std::vector<size_t> positions;
+  if (count > 0) {
+    positions.assign(out_positions, out_positions + (count < MAX_POSITIONS ? count : MAX_POSITIONS));
+  }
+
+  return positions;
+}
@@ -0,0 +1,59 @@
+#ifndef LIANG_HYPHENATION_STRATEGY_H
+#define LIANG_HYPHENATION_STRATEGY_H
+
+#include <cstdint>
+
+#include "HyphenationStrategy.h"
+#include "Liang/liang_hyphenation_patterns.h"
+
+/**
+ * Liang hyphenation with a pattern trie loaded at runtime from a .hyp file
+ * (written by scripts/generate_hyphenation_trie.py --binary), so languages
+ * other than the compiled-in ones cost RAM only while a book in that
+ * language is open.
+ */
+class LiangHyphenation : public HyphenationStrategy {
+ public:
+  // Directory on the SD card holding <language>.hyp files
+  static constexpr const char* kPatternDirectory = "/microreader/hyphenation";
+
+  // Load a .hyp file; returns nullptr when it is missing or malformed
+  static LiangHyphenation* loadFromFile(const char* path);
+
+  // Take ownership of a malloc'd .hyp image; returns nullptr (and frees it)
+  // when it is malformed
+  static LiangHyphenation* fromBuffer(uint8_t* data, size_t size);
+
+  // Point `trie` and `exceptions` (empty for version 1 files) into a .hyp
+  // image after checking that every index in it is in range. The image must
+  // stay alive and 4-byte aligned.
+  static bool parse(const uint8_t* data, size_t size, HyphenationTrie& trie, HyphenationExceptions& exceptions,
+                    uint8_t& leftMin, uint8_t& rightMin);
+
+  ~LiangHyphenation() override;
+
+  // The minima of the pattern file apply when they are larger than the ones passed in
+  std::vector<size_t> hyphenate(const std::string& word, size_t minWordLength = 6, size_t minLeft = 3,
+                                size_t minRight = 3) override;
+
+  Language getLanguage() const override {
+    return Language::PATTERN_FILE;
+  }
+
+  size_t getPatternBytes() const {
+    return size_;
+  }
+
+ private:
+  LiangHyphenation(uint8_t* data, size_t size, const HyphenationTrie& trie, const HyphenationExceptions& exceptions,
+                   uint8_t leftMin, uint8_t rightMin);
+
+  uint8_t* data_;
+  size_t size_;
+  HyphenationTrie trie_;
+  HyphenationExceptions exceptions_;
+  uint8_t leftMin_;
+  uint8_t rightMin_;
+};
+
+#endif  // LIANG_HYPHENATION_STRATEGY_H
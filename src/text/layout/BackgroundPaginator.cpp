@@ -0,0 +1,109 @@
+#include "BackgroundPaginator.h"
+
+#include "../../content/providers/WordProvider.h"
+#include "PaginationIndex.h"
+
+BackgroundPaginator::BackgroundPaginator() {}
+
+void BackgroundPaginator::start(uint32_t fingerprint, int firstChapter) {
+  running_ = true;
+  fingerprint_ = fingerprint;
+  chapter_ = firstChapter < 0 ? 0 : firstChapter;
+  stats_ = Stats();
+}
+
+void BackgroundPaginator::cancel() {
+  running_ = false;
+}
+
+void BackgroundPaginator::restoreProvider(WordProvider& provider) {
+  if (!holdsProvider_) {
+    return;
+  }
+  holdsProvider_ = false;
+  if (provider.getCurrentChapter() != savedChapter_) {
+    provider.setChapter(savedChapter_);
+  }
+  provider.setPosition(savedPosition_);
+}
+
+int BackgroundPaginator::findIncompleteChapter(const PaginationIndex& index) const {
+  const int count = index.getChapterCount();
+  if (count <= 0) {
+    return -1;
+  }
+  for (int i = 0; i < count; ++i) {
+    int c = (chapter_ + i) % count;
+    if (!index.isChapterComplete(c)) {
+      return c;
+    }
+  }
+  return -1;
+}
+
+int BackgroundPaginator::run(WordProvider& provider, LayoutStrategy& layout, TextRenderer& renderer,
+                             const LayoutStrategy::LayoutConfig& config, PaginationIndex& index, int maxPages,
+                             StopCallback shouldStop, void* context) {
+  if (!running_) {
+    return 0;
+  }
+  if (index.getFingerprint() != fingerprint_) {
+    // Settings changed since the job started; the caller restarts it.
+    running_ = false;
+    return 0;
+  }
+
+  const unsigned long startMs = millis();
+  if (!holdsProvider_) {
+    savedChapter_ = provider.getCurrentChapter();
+    savedPosition_ = provider.getCurrentIndex();
+    holdsProvider_ = true;
+  }
+  int currentChapter = provider.getCurrentChapter();
+
+  int pages = 0;
+  while (maxPages <= 0 || pages < maxPages) {
+    if (shouldStop && shouldStop(context)) {
+      break;
+    }
+
+    const int chapter = findIncompleteChapter(index);
+    if (chapter < 0) {
+      running_ = false;
+      break;
+    }
+    chapter_ = chapter;
+
+    if (chapter != currentChapter) {
+      // Opening a chapter may convert it first; this is the one step that
+      // cannot be interrupted.
+      if (!provider.setChapter(chapter)) {
+        running_ = false;
+        break;
+      }
+      currentChapter = chapter;
+    }
+
+    // The last start of an incomplete chapter is where the last page laid
+    // out ended, so every page is laid out once. The provider usually is
+    // there already.
+    const int known = index.getKnownPageCount(chapter);
+    const int pageStart = known > 0 ? index.getPageStart(chapter, known - 1) : 0;
+    if (provider.getCurrentIndex() != pageStart) {
+      provider.setPosition(pageStart);
+    }
+
+    LayoutStrategy::PageLayout page = layout.layoutText(provider, renderer, config);
+    const bool isChapterEnd = page.endPosition <= pageStart || provider.getChapterPercentage(page.endPosition) >= 10000;
+    index.recordPage(chapter, pageStart, page.endPosition, isChapterEnd);
+
+    ++pages;
+    ++stats_.pages;
+    if (isChapterEnd) {
+      ++stats_.chapters;
+    }
+  }
+
+  stats_.elapsedMs += millis() - startMs;
+  return pages;
+}
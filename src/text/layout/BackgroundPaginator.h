@@ -0,0 +1,89 @@
+#ifndef BACKGROUND_PAGINATOR_H
+#define BACKGROUND_PAGINATOR_H
+
+#include <Arduino.h>
+
+#include <cstdint>
+
+#include "LayoutStrategy.h"
+
+class PaginationIndex;
+class TextRenderer;
+class WordProvider;
+
+/**
+ * Resumable whole-book paginator.
+ *
+ * Lays out pages one at a time with LayoutStrategy::layoutText and records
+ * each break in a PaginationIndex, so the work can be spread over idle time
+ * and continues where it left off on the next call (or after a reboot, since
+ * the index is persisted). The job is tied to the layout fingerprint it was
+ * started with and cancels itself as soon as the index is reset for a
+ * different layout.
+ *
+ * The provider is shared with the reader. The first run() remembers its
+ * chapter and position; later calls keep working in the chapter the provider
+ * was left in, so an EPUB chapter is opened once rather than twice per call.
+ * restoreProvider() hands it back and must be called before the reader uses
+ * the provider again.
+ */
+class BackgroundPaginator {
+ public:
+  // Polled between pages; return true to stop immediately (e.g. a button is down).
+  typedef bool (*StopCallback)(void* context);
+
+  struct Stats {
+    uint32_t pages = 0;          // Pages laid out since start()
+    uint32_t chapters = 0;       // Chapters completed since start()
+    unsigned long elapsedMs = 0;  // Time spent inside run() since start()
+  };
+
+  BackgroundPaginator();
+
+  // Start (or restart) paginating the book for `fingerprint`, beginning with
+  // `firstChapter` and wrapping around to the chapters before it.
+  void start(uint32_t fingerprint, int firstChapter);
+  void cancel();
+
+  // Put the provider back in the chapter and position the reader left it at.
+  // Cheap when run() has not touched it since the last call.
+  void restoreProvider(WordProvider& provider);
+  // Forget the reader's position without restoring it (the provider was deleted)
+  void dropProvider() {
+    holdsProvider_ = false;
+  }
+
+  bool isRunning() const {
+    return running_;
+  }
+  uint32_t getFingerprint() const {
+    return fingerprint_;
+  }
+  const Stats& getStats() const {
+    return stats_;
+  }
+
+  // Lay out up to `maxPages` pages (0 = until done). Stops early when
+  // `shouldStop` returns true, the index no longer matches the job's
+  // fingerprint (settings changed) or the book is fully paginated.
+  // Returns the number of pages laid out.
+  int run(WordProvider& provider, LayoutStrategy& layout, TextRenderer& renderer,
+          const LayoutStrategy::LayoutConfig& config, PaginationIndex& index, int maxPages,
+          StopCallback shouldStop = nullptr, void* context = nullptr);
+
+ private:
+  // Next chapter (from `chapter_` onwards, wrapping) that is not complete, or -1.
+  int findIncompleteChapter(const PaginationIndex& index) const;
+
+  bool running_ = false;
+  uint32_t fingerprint_ = 0;
+  int chapter_ = 0;
+  Stats stats_;
+
+  // Reader's place in the provider while run() holds it
+  bool holdsProvider_ = false;
+  int savedChapter_ = 0;
+  int savedPosition_ = 0;
+};
+
+#endif
@@ -2,6 +2,7 @@
 
 #include "../../content/providers/WordProvider.h"
 #include "../../rendering/TextRenderer.h"
+#include "../hyphenation/HyphenationStrategy.h"
 #include "WString.h"
 #ifdef ARDUINO
 #include <Arduino.h>
@@ -12,10 +13,22 @@ extern unsigned long millis();
 
 #include <cstdint>
 #include <algorithm>
-#include <limits>
+#include <string>
 #include <vector>
 
-#define DEBUG_LAYOUT
+namespace {
+
+uint16_t measureText(TextRenderer& renderer, const char* text) {
+  uint16_t w = 0;
+  renderer.getTextBounds(text, 0, 0, nullptr, nullptr, &w, nullptr);
+  return w;
+}
+
+uint16_t measureText(TextRenderer& renderer, const std::string& text, size_t from, size_t to) {
+  return measureText(renderer, text.substr(from, to - from).c_str());
+}
+
+}  // namespace
 
 KnuthPlassLayoutStrategy::KnuthPlassLayoutStrategy() {}
 
@@ -33,182 +46,77 @@ LayoutStrategy::PageLayout KnuthPlassLayoutStrategy::layoutText(WordProvider& pr
   renderer.getTextBounds(" ", 0, 0, nullptr, nullptr, &spaceWidth_, nullptr);
 
   PageLayout result;
-  std::vector<ParagraphLayoutInfo> paragraphs;
-  std::vector<LayoutStrategy::Word> words;
+  const int startIndex = provider.getCurrentIndex();
+  int pageEnd = startIndex;
+  bool pageFull = false;
+  int16_t spacingAbove = 0;  // paragraph spacing right above y
 
-  int startIndex = provider.getCurrentIndex();
-  while (y < maxY) {
+  while (!pageFull) {
     // Hard stop: don't start a new line if it would cross into reserved bottom area
     if ((int32_t)y + (int32_t)lineHeight > (int32_t)maxY) {
       break;
     }
-    int16_t yStart = y;
-    int16_t lineCount = 0;
-    bool isParagraphEnd = false;
-    TextAlignment paragraphAlignment = config.alignment;  // Will be set by first line
+    provider.setPosition(pageEnd);
+    if (!provider.hasNextWord()) {
+      break;
+    }
 
-    // Collect words for the paragraph
-    while (y < maxY && !isParagraphEnd) {
-      if ((int32_t)y + (int32_t)lineHeight > (int32_t)maxY) {
+    if (!readParagraph(provider, renderer, config.alignment)) {
+      // Empty paragraph: a blank line
+      if (paragraphEndIndex_ <= pageEnd) {
         break;
       }
-      Line lineResult = getNextLine(provider, renderer, maxWidth, isParagraphEnd, config.alignment);
-      y += lineHeight;
-
-      // Capture alignment from first line of paragraph
-      if (lineCount == 0 && !lineResult.words.empty()) {
-        paragraphAlignment = lineResult.alignment;
+      pageEnd = paragraphEndIndex_;
+      if (paragraphEnd_) {
+        y += lineHeight;
+        spacingAbove = 0;
       }
+      continue;
+    }
 
-      // Only count lines that have actual content
-      if (!lineResult.words.empty()) {
-        lineCount++;
-      }
+    breakParagraph(maxWidth);
 
-      // iterate line by line until paragraph end
-      for (size_t i = 0; i < lineResult.words.size(); i++) {
-        words.push_back(lineResult.words[i]);
-      }
+    // Adjacent margins collapse: the larger of the top margin and the spacing above wins
+    const int16_t top = spaceBefore(config);
+    if (y > config.marginTop && top > spacingAbove) {
+      y += top - spacingAbove;
     }
+    spacingAbove = 0;
 
-    if (isParagraphEnd && lineCount > 0) {
-      const int16_t ps = (config.paragraphSpacing > 0) ? config.paragraphSpacing : 0;
-      if ((int32_t)y + (int32_t)ps <= (int32_t)maxY) {
-        y += ps;
-      } else {
+    for (size_t i = 0; i < breaks_.size(); i++) {
+      if ((int32_t)y + (int32_t)lineHeight > (int32_t)maxY) {
+        // The rest of the paragraph starts the next page
+        pageEnd = lineStart(provider, i);
+        pageFull = true;
         break;
       }
-    }
-
-    if (!words.empty()) {
-      // Calculate line breaks using Knuth-Plass algorithm
-      std::vector<size_t> breaks = calculateBreaks(words, maxWidth);
-
-      if (lineCount != breaks.size() + 1) {
-        lineCountMismatch_ = true;
-        expectedLineCount_ = lineCount;
-        actualLineCount_ = breaks.size() + 1;
-      }
-
-      // Convert breaks into lines and calculate positions
-      int16_t currentY = yStart;
-
-      size_t lineStart = 0;
-      for (size_t breakIdx = 0; breakIdx <= breaks.size(); breakIdx++) {
-        size_t lineEnd = (breakIdx < breaks.size()) ? breaks[breakIdx] : words.size();
-        if (lineStart >= lineEnd)
-          break;
-
-        // Hard stop: don't emit a line that would draw into reserved bottom area.
-        if ((int32_t)currentY + (int32_t)lineHeight > (int32_t)maxY) {
-          break;
-        }
-
-        std::vector<Word> lineWords;
-        for (size_t i = lineStart; i < lineEnd; i++) {
-          lineWords.push_back(words[i]);
-        }
 
-        // Calculate indentation from leading spaces for first line
-        int16_t indent = 0;
-        // if (breakIdx == 0) {
-        //   for (const auto& w : lineWords) {
-        //     if (w.text == " ") {
-        //       indent += w.width;
-        //     } else {
-        //       break;
-        //     }
-        //   }
-        // }
-        const int16_t x = config.marginLeft + indent;
-        int16_t effectiveMaxWidth = maxWidth - indent;
-
-        // Trim leading and trailing spaces
-        while (!lineWords.empty() && lineWords.front().text == " ") {
-          lineWords.erase(lineWords.begin());
-        }
-        while (!lineWords.empty() && lineWords.back().text == " ") {
-          lineWords.erase(lineWords.end() - 1);
-        }
-
-        // Calculate positions for words in this line
-        bool isLastLine = (breakIdx == breaks.size()) && isParagraphEnd;
-        size_t numWords = lineWords.size();
-        size_t numSpaceWords = 0;
-        for (const auto& w : lineWords) {
-          if (w.text == " ")
-            numSpaceWords++;
-        }
+      Line line = buildLine(renderer, i);
 
-        if (isLastLine || numSpaceWords == 0) {
-          // Last line: use alignment, no justification
-          int16_t lineWidth = 0;
-          for (size_t i = 0; i < lineWords.size(); i++) {
-            lineWidth += lineWords[i].width;
-          }
-
-          int16_t xPos = x;
-          if (paragraphAlignment == ALIGN_CENTER) {
-            xPos = x + (effectiveMaxWidth - lineWidth) / 2;
-          } else if (paragraphAlignment == ALIGN_RIGHT) {
-            xPos = x + effectiveMaxWidth - lineWidth;
-          }
-
-          int16_t currentX = xPos;
-          for (size_t i = 0; i < lineWords.size(); i++) {
-            lineWords[i].x = currentX;
-            lineWords[i].y = currentY;
-            currentX += lineWords[i].width;
-          }
-        } else {
-          // Non-last line: justify by distributing space evenly among space words
-          int16_t totalWordWidth = 0;
-          for (size_t i = 0; i < lineWords.size(); i++) {
-            totalWordWidth += lineWords[i].width;
-          }
-
-          // Calculate space to distribute among space words
-          int16_t totalSpaceWidth = maxWidth - totalWordWidth;
-          int32_t extraPerSpaceFixed = ((int32_t)totalSpaceWidth << 8) / (int32_t)numSpaceWords;
-
-          if (extraPerSpaceFixed > (16 * (int32_t)spaceWidth_ << 8)) {
-            // Limit maximum space stretch to avoid extreme gaps
-            extraPerSpaceFixed = std::max(extraPerSpaceFixed / 4, (int32_t)spaceWidth_ << 8);
-          }
-
-          // Increase widths of space words
-          int32_t accumulatedExtraFixed = 0;
-          for (auto& w : lineWords) {
-            if (w.text == " ") {
-              accumulatedExtraFixed += extraPerSpaceFixed;
-              int16_t extra = (int16_t)(accumulatedExtraFixed >> 8);
-              w.width += extra;
-              accumulatedExtraFixed -= ((int32_t)extra << 8);
-            }
-          }
-
-          // Now place words
-          int16_t currentX = x;
-          for (size_t i = 0; i < lineWords.size(); i++) {
-            lineWords[i].x = currentX;
-            lineWords[i].y = currentY;
-            currentX += lineWords[i].width;
-          }
-        }
+      // First-line indent of the paragraph (the breaker gave that line less width)
+      const int16_t indent = i == 0 ? firstLineIndent_ : 0;
+      const bool isLastLine = (i + 1 == breaks_.size()) && !truncated_;
+      placeLine(line, config.marginLeft + indent, maxWidth - indent, y, isLastLine);
+      result.lines.push_back(line);
+      y += lineHeight;
+    }
+    if (pageFull) {
+      break;
+    }
 
-        Line lineStruct;
-        lineStruct.words = lineWords;
-        lineStruct.alignment = paragraphAlignment;
-        result.lines.push_back(lineStruct);
-        lineStart = lineEnd;
-        currentY += lineHeight;
+    pageEnd = paragraphEndIndex_;
+    if (paragraphEnd_) {
+      const int16_t ps = spaceAfter(config);
+      if ((int32_t)y + (int32_t)ps <= (int32_t)maxY) {
+        y += ps;
+        spacingAbove = ps;
+      } else {
+        break;
       }
-
-      words.clear();
     }
   }
 
-  result.endPosition = provider.getCurrentIndex();
+  result.endPosition = pageEnd;
   // reset the provider to the start index
   provider.setPosition(startIndex);
 
@@ -233,131 +141,732 @@ void KnuthPlassLayoutStrategy::renderPage(const PageLayout& layout, TextRenderer
   }
 }
 
-std::vector<size_t> KnuthPlassLayoutStrategy::calculateBreaks(const std::vector<Word>& words, int16_t maxWidth) {
-  std::vector<size_t> breaks;
+int KnuthPlassLayoutStrategy::getPreviousPageStart(WordProvider& provider, TextRenderer& renderer,
+                                                   const LayoutConfig& config, int currentStartPosition) {
+  const int savedPosition = provider.getCurrentIndex();
+  if (currentStartPosition <= 0) {
+    return 0;
+  }
+
+  const int32_t maxY = config.pageHeight - config.marginBottom;
+  const int32_t lineHeight = (config.lineHeight > 0) ? config.lineHeight : 1;
+  const size_t linesPerPage = (size_t)((config.pageHeight - config.marginTop - config.marginBottom) / lineHeight) + 1;
+
+  // First-line indents are in spaces, as in layoutText
+  renderer.setFontStyle(FontStyle::REGULAR);
+  renderer.getTextBounds(" ", 0, 0, nullptr, nullptr, &spaceWidth_, nullptr);
+
+  // Lines before the current page, a whole paragraph at a time so they break
+  // exactly as they did when laid out forward, until there is more than a page
+  std::vector<LineMark> marks;
+  std::vector<LineMark> paragraph;
+  int position = currentStartPosition;
+  while (position > 0 && marks.size() <= linesPerPage) {
+    const int start = paragraphStartBefore(provider, position);
+    if (start >= position) {
+      break;
+    }
+    paragraph.clear();
+    collectLineMarks(provider, renderer, config, start, position, paragraph);
+    marks.insert(marks.begin(), paragraph.begin(), paragraph.end());
+    position = start;
+  }
+
+  provider.setPosition(currentStartPosition);
+  const bool atEnd = !provider.hasNextWord();
+  const size_t n = marks.size();
+
+  // Index of the first line not on a page starting at marks[first]; n when
+  // that is the current page, more than n if the page would run past it.
+  // Mirrors the fill loop of layoutText.
+  auto pageEnd = [&](size_t first) -> size_t {
+    int32_t y = config.marginTop;
+    int32_t spacingAbove = 0;
+    for (size_t i = first; i < n; i++) {
+      if (y > config.marginTop && marks[i].spaceBefore > spacingAbove) {
+        y += marks[i].spaceBefore - spacingAbove;
+      }
+      if (y + lineHeight > maxY) {
+        return i;
+      }
+      y += lineHeight;
+      spacingAbove = 0;
+      if (marks[i].paragraphEnd && !marks[i].blank) {
+        if (y + marks[i].spaceAfter <= maxY) {
+          y += marks[i].spaceAfter;
+          spacingAbove = marks[i].spaceAfter;
+        } else {
+          return i + 1;
+        }
+      }
+    }
+    return (atEnd || y + lineHeight > maxY) ? n : n + 1;
+  };
 
-  if (words.empty()) {
-    return breaks;
+  // The earliest start whose page still reaches the current one
+  int previousPageStart = 0;
+  for (size_t k = n; k-- > 0;) {
+    if (pageEnd(k) < n) {
+      break;
+    }
+    previousPageStart = marks[k].start;
   }
 
-  size_t n = words.size();
+  // Restore provider state
+  provider.setPosition(savedPosition);
+  return previousPageStart;
+}
 
-  // Dynamic programming array: minimum demerits to reach each word
-  std::vector<int32_t> minDemerits(n + 1, INFINITY_PENALTY);
-  std::vector<int> prevBreak(n + 1, -1);
+bool KnuthPlassLayoutStrategy::readParagraph(WordProvider& provider, TextRenderer& renderer,
+                                             TextAlignment defaultAlignment) {
+  paragraphStart_ = provider.getCurrentIndex();
+  startsParagraph_ = paragraphStart_ == 0 || provider.peekChar(-1) == '\n';
+
+  if (CachedParagraph* cached = findCached(provider, paragraphStart_)) {
+    tokens_ = cached->tokens;
+    items_ = cached->items;
+    text_ = cached->text;
+    paragraphEndIndex_ = cached->endIndex;
+    paragraphEnd_ = cached->paragraphEnd;
+    truncated_ = cached->truncated;
+    startsInsideWord_ = cached->startsInsideWord;
+    paragraphAlignment_ = cached->alignment;
+    paragraphFormat_ = cached->format;
+    alignment_ = paragraphAlignment_ < 0 ? defaultAlignment : (TextAlignment)paragraphAlignment_;
+    if (cached->family != renderer.getFontFamily() || cached->generation != renderer.getWidthCacheGeneration()) {
+      // Same text in other fonts: measure again, the breaks are made afresh anyway
+      remeasure(renderer);
+      cached->tokens = tokens_;
+      cached->items = items_;
+      cached->family = renderer.getFontFamily();
+      cached->generation = renderer.getWidthCacheGeneration();
+    }
+    provider.setPosition(paragraphEndIndex_);
+    return true;
+  }
 
-  // Base case: starting position has 0 demerits
-  minDemerits[0] = 0;
+  tokens_.clear();
+  items_.clear();
+  text_.clear();
+  paragraphEnd_ = false;
+  truncated_ = false;
+  paragraphAlignment_ = -1;
+  paragraphFormat_ = ParagraphFormat();
+  alignment_ = defaultAlignment;
+
+  // A page can start inside a word that was broken at a hyphen. Hyphenate the
+  // whole word so the candidates left match the ones it had before the break.
+  startsInsideWord_ = provider.isInsideWord();
+  String prefix;
+  if (startsInsideWord_) {
+    prefix = provider.getPrevWord().text;
+    provider.setPosition(paragraphStart_);
+  }
 
-  // For each possible starting position
-  for (size_t i = 0; i < n; i++) {
-    if (minDemerits[i] >= INFINITY_PENALTY) {
-      continue;  // This position is unreachable
+  bool hasBox = false;
+  while (provider.hasNextWord()) {
+    if (tokens_.size() >= kMaxParagraphTokens) {
+      truncated_ = true;
+      break;
+    }
+    const int index = provider.getCurrentIndex();
+    StyledWord styledWord = provider.getNextWord();
+    const String& text = styledWord.text;
+    if (text == String("\n")) {
+      paragraphEnd_ = true;
+      break;
+    }
+    if (text.isEmpty()) {
+      if (provider.getCurrentIndex() <= index) {
+        break;
+      }
+      continue;
+    }
+    if (text_.length() + text.length() > 0xFFFF) {
+      // Token offsets are 16 bit: the rest is broken as the next chunk
+      provider.setPosition(index);
+      truncated_ = true;
+      break;
     }
 
-    // Try to fit words [i, j) on one line
-    int16_t lineWidth = 0;
-    for (size_t j = i; j < n; j++) {
-      lineWidth += words[j].width;
+    // Capture alignment from the first word of the paragraph
+    // CSS alignment overrides the default
+    if (tokens_.empty()) {
+      switch (provider.getParagraphAlignment()) {
+        case TextAlign::Center:
+          paragraphAlignment_ = ALIGN_CENTER;
+          break;
+        case TextAlign::Right:
+          paragraphAlignment_ = ALIGN_RIGHT;
+          break;
+        case TextAlign::Left:
+          paragraphAlignment_ = ALIGN_LEFT;
+          break;
+        default:
+          // Keep defaultAlignment for Justify or unknown
+          break;
+      }
+      if (paragraphAlignment_ >= 0) {
+        alignment_ = (TextAlignment)paragraphAlignment_;
+      }
+      paragraphFormat_ = provider.getParagraphFormat();
+    }
 
-      // Check if line is too wide
-      if (lineWidth > maxWidth) {
-        // Special case: if this is the first word on the line and it's too wide,
-        // we must still place it on its own line to make progress
-        if (j == i) {
-          // Force this oversized word onto its own line with a high but not infinite penalty
-          // Use a large fixed penalty (100) rather than INFINITY_PENALTY to allow progress
-          int32_t demerits = 100;
+    // Larger text (headings) is set in bold
+    FontStyle style = styledWord.style;
+    if (paragraphFormat_.fontSize >= kLargeFontSize) {
+      if (style == FontStyle::REGULAR) {
+        style = FontStyle::BOLD;
+      } else if (style == FontStyle::ITALIC) {
+        style = FontStyle::BOLD_ITALIC;
+      }
+    }
 
-          // Add a constant penalty per line to favor fewer lines
-          demerits += 50;
+    renderer.setFontStyle(style);
+    const int16_t width = (int16_t)measureText(renderer, text.c_str());
+    const uint16_t token = (uint16_t)tokens_.size();
+    tokens_.push_back({index, (uint16_t)text_.length(), (uint16_t)text.length(), width, style});
+    text_ += text.c_str();
 
-          int32_t totalDemerits = minDemerits[i] + demerits;
-          if (totalDemerits < minDemerits[j + 1]) {
-            minDemerits[j + 1] = totalDemerits;
-            prevBreak[j + 1] = i;
-          }
-        }
-        break;  // Can't fit any more words on this line
+    if (text[0] == ' ') {
+      // Spaces before the first word are dropped, as at the start of every other line
+      if (hasBox) {
+        items_.push_back({GLUE, false, false, width, (int16_t)(width / 2), (int16_t)(width / 3), 0, token, 0});
       }
+      continue;
+    }
+    addWordItems(renderer, text, token == 0 ? prefix : String(), token);
+    hasBox = true;
+  }
+  paragraphEndIndex_ = provider.getCurrentIndex();
 
-      // Calculate badness and demerits for this line
-      bool isLastLine = (j == n - 1);
-      int32_t badness = calculateBadness(lineWidth, maxWidth);
-      int32_t demerits = calculateDemerits(badness, isLastLine);
+  while (!items_.empty() && items_.back().kind == GLUE) {
+    items_.pop_back();
+  }
+  if (!hasBox) {
+    return false;
+  }
 
-      // Add a constant penalty per line to favor fewer lines
-      // This makes layouts with fewer lines always preferable
-      demerits += 50;
+  // The last line may end short: fill glue, then a forced break
+  const uint16_t last = (uint16_t)(tokens_.size() - 1);
+  items_.push_back({GLUE, false, false, 0, FILL_STRETCH, 0, 0, last, 0});
+  items_.push_back({PENALTY, false, false, 0, 0, 0, (int16_t)-INFINITY_PENALTY, last, 0});
+  storeCached(provider, renderer);
+  return true;
+}
 
-      // Update minimum demerits to reach position j+1
-      int32_t totalDemerits = minDemerits[i] + demerits;
-      if (totalDemerits < minDemerits[j + 1]) {
-        minDemerits[j + 1] = totalDemerits;
-        prevBreak[j + 1] = i;
+void KnuthPlassLayoutStrategy::remeasure(TextRenderer& renderer) {
+  for (Token& token : tokens_) {
+    renderer.setFontStyle(token.style);
+    token.width = (int16_t)measureText(renderer, text_, token.textOffset, token.textOffset + token.length);
+  }
+  FontStyle hyphenStyle = FontStyle::REGULAR;
+  int16_t hyphenWidth = -1;
+  for (size_t i = 0; i < items_.size(); i++) {
+    Item& item = items_[i];
+    const Token& token = tokens_[item.token];
+    if (item.kind == GLUE) {
+      // The fill glue at the end has no width of its own
+      if (item.stretch != FILL_STRETCH) {
+        item.width = token.width;
+        item.stretch = (int16_t)(token.width / 2);
+        item.shrink = (int16_t)(token.width / 3);
+      }
+    } else if (item.kind == PENALTY) {
+      if (item.addsHyphen) {
+        if (hyphenWidth < 0 || hyphenStyle != token.style) {
+          renderer.setFontStyle(token.style);
+          hyphenWidth = (int16_t)measureText(renderer, "-");
+          hyphenStyle = token.style;
+        }
+        item.width = hyphenWidth;
       }
+    } else {
+      // A box runs to the hyphenation point after it, or to the end of its token
+      const bool cut = i + 1 < items_.size() && items_[i + 1].kind == PENALTY && items_[i + 1].flagged &&
+                       items_[i + 1].token == item.token;
+      const uint16_t to = cut ? items_[i + 1].offset : token.length;
+      if (item.offset == 0 && to == token.length) {
+        item.width = token.width;
+      } else {
+        renderer.setFontStyle(token.style);
+        item.width = (int16_t)measureText(renderer, text_, token.textOffset + item.offset, token.textOffset + to);
+      }
+    }
+  }
+}
+
+KnuthPlassLayoutStrategy::CachedParagraph* KnuthPlassLayoutStrategy::findCached(WordProvider& provider, int start) {
+  const int chapter = provider.getCurrentChapter();
+  const Language language = hyphenationStrategy_ ? hyphenationStrategy_->getLanguage() : Language::NONE;
+  for (CachedParagraph& entry : cache_) {
+    if (entry.provider == &provider && entry.start == start && entry.chapter == chapter &&
+        entry.language == language) {
+      entry.lastUse = ++cacheClock_;
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+size_t KnuthPlassLayoutStrategy::cachedBytes(const CachedParagraph& entry) {
+  return entry.tokens.capacity() * sizeof(Token) + entry.items.capacity() * sizeof(Item) + entry.text.capacity();
+}
+
+void KnuthPlassLayoutStrategy::storeCached(WordProvider& provider, TextRenderer& renderer) {
+  const size_t bytes = tokens_.size() * sizeof(Token) + items_.size() * sizeof(Item) + text_.length();
+  if (bytes > kParagraphCacheBytes / 2) {
+    return;
+  }
 
-      // If this word was split (hyphenated), we must break the line here
-      if (words[j].wasSplit) {
+  // Reuse the least recently used entry, then evict others until the new one fits the budget
+  CachedParagraph* slot = &cache_[0];
+  for (CachedParagraph& entry : cache_) {
+    if (entry.provider == nullptr || entry.lastUse < slot->lastUse) {
+      slot = &entry;
+      if (entry.provider == nullptr) {
         break;
       }
     }
   }
+  slot->provider = nullptr;
+  while (true) {
+    size_t total = bytes;
+    CachedParagraph* oldest = nullptr;
+    for (CachedParagraph& entry : cache_) {
+      if (&entry != slot && entry.provider != nullptr) {
+        total += cachedBytes(entry);
+        if (oldest == nullptr || entry.lastUse < oldest->lastUse) {
+          oldest = &entry;
+        }
+      }
+    }
+    if (total <= kParagraphCacheBytes || oldest == nullptr) {
+      break;
+    }
+    oldest->provider = nullptr;
+    std::vector<Token>().swap(oldest->tokens);
+    std::vector<Item>().swap(oldest->items);
+    std::string().swap(oldest->text);
+  }
+
+  slot->provider = &provider;
+  slot->chapter = provider.getCurrentChapter();
+  slot->start = paragraphStart_;
+  slot->language = hyphenationStrategy_ ? hyphenationStrategy_->getLanguage() : Language::NONE;
+  slot->family = renderer.getFontFamily();
+  slot->generation = renderer.getWidthCacheGeneration();
+  slot->lastUse = ++cacheClock_;
+  slot->endIndex = paragraphEndIndex_;
+  slot->paragraphEnd = paragraphEnd_;
+  slot->truncated = truncated_;
+  slot->startsInsideWord = startsInsideWord_;
+  slot->alignment = paragraphAlignment_;
+  slot->format = paragraphFormat_;
+  slot->tokens.assign(tokens_.begin(), tokens_.end());
+  slot->items.assign(items_.begin(), items_.end());
+  slot->text.assign(text_);
+}
 
-  // Reconstruct breaks by backtracking
-  int pos = n;
-  while (pos > 0 && prevBreak[pos] >= 0) {
-    breaks.push_back(pos);
-    pos = prevBreak[pos];
+void KnuthPlassLayoutStrategy::clearLayoutCache() {
+  for (CachedParagraph& entry : cache_) {
+    entry.provider = nullptr;
+    std::vector<Token>().swap(entry.tokens);
+    std::vector<Item>().swap(entry.items);
+    std::string().swap(entry.text);
   }
+}
 
-  // Reverse to get breaks in forward order
-  std::reverse(breaks.begin(), breaks.end());
+void KnuthPlassLayoutStrategy::addWordItems(TextRenderer& renderer, const String& text, const String& prefix,
+                                            uint16_t token) {
+  HyphenPositions hyphenPositions;
+  if (hyphenationStrategy_) {
+    if (prefix.isEmpty()) {
+      hyphenationStrategy_->findHyphenPositions(text.c_str(), text.length(), hyphenPositions);
+    } else {
+      const String word = prefix + text;
+      hyphenationStrategy_->findHyphenPositions(word.c_str(), word.length(), hyphenPositions);
+    }
+  }
 
-  // Remove the last break (end of text)
-  if (!breaks.empty() && breaks.back() == n) {
-    breaks.pop_back();
+  const int shift = prefix.length();
+  const int length = text.length();
+  int16_t hyphenWidth = -1;
+  int from = 0;
+  for (size_t i = 0; i < hyphenPositions.size(); i++) {
+    const int pos = hyphenPositions[i];
+    const bool isAlgorithmic = pos < 0;
+    // Existing hyphens stay with the first part; algorithmic ones are inserted at the break
+    const int cut = (isAlgorithmic ? -(pos + 1) : pos + 1) - shift;
+    if (cut <= from || cut >= length) {
+      continue;
+    }
+    if (isAlgorithmic && hyphenWidth < 0) {
+      hyphenWidth = (int16_t)measureText(renderer, "-");
+    }
+    const int16_t partWidth = (int16_t)measureText(renderer, text.substring(from, cut).c_str());
+    items_.push_back({BOX, false, false, partWidth, 0, 0, 0, token, (uint16_t)from});
+    items_.push_back({PENALTY, true, isAlgorithmic, (int16_t)(isAlgorithmic ? hyphenWidth : 0), 0, 0, HYPHEN_PENALTY,
+                      token, (uint16_t)cut});
+    from = cut;
   }
 
-  return breaks;
+  const int16_t width =
+      from == 0 ? tokens_[token].width : (int16_t)measureText(renderer, text.substring(from, length).c_str());
+  items_.push_back({BOX, false, false, width, 0, 0, 0, token, (uint16_t)from});
 }
 
-int32_t KnuthPlassLayoutStrategy::calculateBadness(int16_t actualWidth, int16_t targetWidth) {
-  if (actualWidth > targetWidth) {
-    // Line is too wide - very bad
-    return INFINITY_PENALTY;
+void KnuthPlassLayoutStrategy::breakParagraph(int16_t maxWidth) {
+  nodes_.clear();
+  active_.clear();
+  breaks_.clear();
+  firstLineIndent_ = firstLineIndent(maxWidth);
+
+  nodes_.push_back({0, 0, 0, 0, -1, 0, startsInsideWord_});
+  active_.push_back(0);
+
+  int32_t width = 0;
+  int32_t stretch = 0;
+  int32_t shrink = 0;
+  for (size_t i = 0; i < items_.size(); i++) {
+    const Item& item = items_[i];
+    switch (item.kind) {
+      case BOX:
+        width += item.width;
+        break;
+      case GLUE:
+        // Glue is a legal break only right after a box
+        if (i > 0 && items_[i - 1].kind == BOX) {
+          tryBreak(i, width, stretch, shrink, maxWidth);
+        }
+        width += item.width;
+        stretch += item.stretch;
+        shrink += item.shrink;
+        break;
+      case PENALTY:
+        if (item.penalty < INFINITY_PENALTY) {
+          tryBreak(i, width, stretch, shrink, maxWidth);
+        }
+        break;
+    }
   }
 
-  if (actualWidth == targetWidth) {
-    // Perfect fit
-    return 0;
+  // The forced break at the end always gets a node; it is the last one made
+  for (int32_t n = (int32_t)nodes_.size() - 1; n > 0; n = nodes_[n].prev) {
+    breaks_.push_back(nodes_[n].item);
   }
+  std::reverse(breaks_.begin(), breaks_.end());
+}
 
-  // Calculate adjustment ratio (how much space needs to be stretched)
-  // Scaling by 100 for integer precision
-  int32_t diff = (int32_t)(targetWidth - actualWidth);
-  int32_t ratio = (diff * 100) / targetWidth;
+void KnuthPlassLayoutStrategy::tryBreak(size_t itemIdx, int32_t width, int32_t stretch, int32_t shrink,
+                                        int16_t maxWidth) {
+  const Item& item = items_[itemIdx];
+  const bool forced = item.kind == PENALTY && item.penalty <= -INFINITY_PENALTY;
+  const int32_t breakWidth = item.kind == PENALTY ? item.width : 0;
+
+  int32_t best = -1;
+  int64_t bestDemerits = 0;
+  int32_t overfull = -1;
+  size_t kept = 0;
+  for (size_t i = 0; i < active_.size(); i++) {
+    const uint32_t a = active_[i];
+    const Node& node = nodes_[a];
+    const int32_t lineWidth = width - node.width + breakWidth;
+    // Node 0 starts the first line, which is narrower by the indent
+    const int32_t measure = a == 0 ? maxWidth - firstLineIndent_ : maxWidth;
+
+    bool fits = true;
+    int32_t badness = 0;
+    if (lineWidth < measure) {
+      badness = calculateBadness(measure - lineWidth, stretch - node.stretch);
+    } else if (lineWidth > measure) {
+      const int32_t shrinkable = shrink - node.shrink;
+      if (lineWidth - measure > shrinkable) {
+        fits = false;
+      } else {
+        badness = calculateBadness(lineWidth - measure, shrinkable);
+      }
+    }
 
-  // Badness is cube of ratio (Knuth-Plass formula)
-  // This penalizes very loose lines more heavily
-  int32_t badness = (ratio * ratio * ratio) / 100;
+    if (fits) {
+      const int64_t demerits = node.demerits + calculateDemerits(badness, item, node.flagged && item.flagged);
+      if (best < 0 || demerits < bestDemerits) {
+        best = (int32_t)a;
+        bestDemerits = demerits;
+      }
+      if (!forced) {
+        active_[kept++] = a;
+      }
+    } else {
+      // Lines from this node only get longer: drop it. Active nodes are in
+      // text order, so the last one dropped starts the shortest line.
+      overfull = (int32_t)a;
+    }
+  }
+  active_.resize(kept);
+
+  if (best < 0 && overfull >= 0) {
+    // Nothing fits (a box wider than the line): break anyway, keeping the
+    // overfull line as short as possible
+    const int64_t worst = LINE_PENALTY + INFINITY_BADNESS;
+    best = overfull;
+    bestDemerits = nodes_[overfull].demerits + worst * worst;
+  }
+  if (best >= 0) {
+    addNode(itemIdx, bestDemerits, best, width, stretch, shrink);
+  }
+}
 
-  return badness;
+void KnuthPlassLayoutStrategy::addNode(size_t itemIdx, int64_t demerits, int32_t prev, int32_t width,
+                                       int32_t stretch, int32_t shrink) {
+  // The next line starts at the next box: glue and penalties after the break are discarded
+  for (size_t i = itemIdx; i < items_.size(); i++) {
+    const Item& item = items_[i];
+    if (item.kind == BOX || (i > itemIdx && item.kind == PENALTY && item.penalty <= -INFINITY_PENALTY)) {
+      break;
+    }
+    if (item.kind == GLUE) {
+      width += item.width;
+      stretch += item.stretch;
+      shrink += item.shrink;
+    }
+  }
+  const Item& breakItem = items_[itemIdx];
+  nodes_.push_back({demerits, width, stretch, shrink, prev, (uint16_t)itemIdx,
+                    breakItem.kind == PENALTY && breakItem.flagged});
+  active_.push_back((uint32_t)(nodes_.size() - 1));
 }
 
-int32_t KnuthPlassLayoutStrategy::calculateDemerits(int32_t badness, bool isLastLine) {
-  if (badness >= INFINITY_PENALTY) {
-    return INFINITY_PENALTY;
+int16_t KnuthPlassLayoutStrategy::firstLineIndent(int16_t maxWidth) const {
+  if (!startsParagraph_) {
+    return 0;
   }
+  // Quarter ems, about a space each
+  const int32_t indent = (int32_t)paragraphFormat_.indent * spaceWidth_;
+  return (int16_t)std::min<int32_t>(indent, maxWidth / 2);
+}
 
-  // Last line is allowed to be loose without penalty
-  if (isLastLine) {
+int16_t KnuthPlassLayoutStrategy::spaceBefore(const LayoutConfig& config) const {
+  if (!startsParagraph_) {
     return 0;
   }
+  // Quarter ems, taking a line as an em
+  return (int16_t)((int32_t)paragraphFormat_.marginTop * config.lineHeight / 4);
+}
 
-  // Demerits is square of (1 + badness)
-  int32_t val = (1 + badness);
-  int32_t demerits = val * val;
+int16_t KnuthPlassLayoutStrategy::spaceAfter(const LayoutConfig& config) const {
+  const int16_t ps = (config.paragraphSpacing > 0) ? config.paragraphSpacing : 0;
+  const int16_t margin = (int16_t)((int32_t)paragraphFormat_.marginBottom * config.lineHeight / 4);
+  return std::max(ps, margin);
+}
 
+int32_t KnuthPlassLayoutStrategy::calculateBadness(int32_t shortfall, int32_t flexibility) const {
+  // About 100 * (shortfall / flexibility)^3, in TeX's integer form (no libm on the C3)
+  if (shortfall <= 0) {
+    return 0;
+  }
+  if (flexibility <= 0) {
+    return INFINITY_BADNESS;
+  }
+  const int32_t ratio = (shortfall * 297) / flexibility;
+  if (ratio > 1290) {
+    return INFINITY_BADNESS;
+  }
+  return (ratio * ratio * ratio + 0x20000) / 0x40000;
+}
+
+int32_t KnuthPlassLayoutStrategy::calculateDemerits(int32_t badness, const Item& breakItem, bool doubleHyphen) const {
+  int32_t demerits = (LINE_PENALTY + badness) * (LINE_PENALTY + badness);
+  if (breakItem.kind == PENALTY) {
+    const int32_t penalty = breakItem.penalty;
+    if (penalty > 0) {
+      demerits += penalty * penalty;
+    } else if (penalty > -INFINITY_PENALTY) {
+      demerits -= penalty * penalty;
+    }
+  }
+  // Two hyphenated lines in a row
+  if (doubleHyphen) {
+    demerits += DOUBLE_HYPHEN_DEMERITS;
+  }
   return demerits;
 }
+
+int KnuthPlassLayoutStrategy::lineStart(WordProvider& provider, size_t lineIdx) {
+  if (lineIdx == 0) {
+    return paragraphStart_;
+  }
+  const size_t breakIdx = breaks_[lineIdx - 1];
+  const Item& item = items_[breakIdx];
+  if (item.kind == PENALTY) {
+    // Inside a word: consume the characters before the break
+    provider.setPosition(tokens_[item.token].index);
+    provider.consumeChars(item.offset);
+    return provider.getCurrentIndex();
+  }
+  for (size_t i = breakIdx + 1; i < items_.size(); i++) {
+    if (items_[i].kind == BOX) {
+      return tokens_[items_[i].token].index;
+    }
+  }
+  return paragraphEndIndex_;
+}
+
+LayoutStrategy::Line KnuthPlassLayoutStrategy::buildLine(TextRenderer& renderer, size_t lineIdx) {
+  Line line;
+  line.alignment = alignment_;
+
+  const size_t end = breaks_[lineIdx];
+  size_t first = 0;
+  if (lineIdx > 0) {
+    first = breaks_[lineIdx - 1] + 1;
+    while (first < end && items_[first].kind != BOX) {
+      first++;
+    }
+  }
+  size_t last = end;
+  while (last > first && items_[last - 1].kind != BOX) {
+    last--;
+  }
+  if (last == first) {
+    return line;
+  }
+
+  const Item& breakItem = items_[end];
+  const bool hyphenBreak = breakItem.kind == PENALTY && breakItem.penalty > -INFINITY_PENALTY;
+  const uint16_t firstToken = items_[first].token;
+  const uint16_t lastToken = items_[last - 1].token;
+  const int startOffset = items_[first].offset;
+
+  for (uint16_t t = firstToken; t <= lastToken; t++) {
+    const Token& token = tokens_[t];
+    const bool cutStart = t == firstToken && startOffset > 0;
+    const bool cutEnd = t == lastToken && hyphenBreak;
+    const int from = cutStart ? startOffset : 0;
+    const int to = cutEnd ? breakItem.offset : token.length;
+    std::string text = text_.substr(token.textOffset + from, to - from);
+    if (!cutStart && !cutEnd) {
+      line.words.push_back(Word(String(text.c_str()), token.width, 0, 0, false, token.style));
+      continue;
+    }
+
+    if (cutEnd && breakItem.addsHyphen) {
+      text += '-';
+    }
+    renderer.setFontStyle(token.style);
+    const int16_t width = (int16_t)measureText(renderer, text.c_str());
+    line.words.push_back(Word(String(text.c_str()), width, 0, 0, cutEnd, token.style));
+  }
+  return line;
+}
+
+void KnuthPlassLayoutStrategy::placeLine(Line& line, int16_t x, int16_t maxWidth, int16_t y, bool isLastLine) const {
+  std::vector<Word>& lineWords = line.words;
+  size_t numSpaceWords = 0;
+  int16_t totalWordWidth = 0;
+  for (const auto& w : lineWords) {
+    if (w.text.length() > 0 && w.text[0] == ' ')
+      numSpaceWords++;
+    totalWordWidth += w.width;
+  }
+
+  if (isLastLine || numSpaceWords == 0) {
+    // Last line: use alignment, no justification
+    int16_t xPos = x;
+    if (line.alignment == ALIGN_CENTER) {
+      xPos = x + (maxWidth - totalWordWidth) / 2;
+    } else if (line.alignment == ALIGN_RIGHT) {
+      xPos = x + maxWidth - totalWordWidth;
+    }
+
+    int16_t currentX = xPos;
+    for (size_t i = 0; i < lineWords.size(); i++) {
+      lineWords[i].x = currentX;
+      lineWords[i].y = y;
+      currentX += lineWords[i].width;
+    }
+    return;
+  }
+
+  // Non-last line: justify by distributing space evenly among space words
+  int16_t totalSpaceWidth = maxWidth - totalWordWidth;
+  int32_t extraPerSpaceFixed = ((int32_t)totalSpaceWidth << 8) / (int32_t)numSpaceWords;
+
+  if (extraPerSpaceFixed > (16 * (int32_t)spaceWidth_ << 8)) {
+    // Limit maximum space stretch to avoid extreme gaps
+    extraPerSpaceFixed = std::max(extraPerSpaceFixed / 4, (int32_t)spaceWidth_ << 8);
+  }
+
+  // Increase widths of space words
+  int32_t accumulatedExtraFixed = 0;
+  for (auto& w : lineWords) {
+    if (w.text.length() > 0 && w.text[0] == ' ') {
+      accumulatedExtraFixed += extraPerSpaceFixed;
+      int16_t extra = (int16_t)(accumulatedExtraFixed >> 8);
+      w.width += extra;
+      accumulatedExtraFixed -= ((int32_t)extra << 8);
+    }
+  }
+
+  // Now place words
+  int16_t currentX = x;
+  for (size_t i = 0; i < lineWords.size(); i++) {
+    lineWords[i].x = currentX;
+    lineWords[i].y = y;
+    currentX += lineWords[i].width;
+  }
+}
+
+int KnuthPlassLayoutStrategy::paragraphStartBefore(WordProvider& provider, int position) {
+  // Walk back to the newline before the paragraph holding position; a newline
+  // right before position ends the previous paragraph, which is the one wanted
+  provider.setPosition(position);
+  bool first = true;
+  while (provider.getCurrentIndex() > 0) {
+    const int after = provider.getCurrentIndex();
+    StyledWord styledWord = provider.getPrevWord();
+    if (styledWord.text == String("\n") && !first) {
+      return after;
+    }
+    first = false;
+    if (provider.getCurrentIndex() >= after) {
+      break;
+    }
+  }
+  return provider.getCurrentIndex();
+}
+
+void KnuthPlassLayoutStrategy::collectLineMarks(WordProvider& provider, TextRenderer& renderer,
+                                                const LayoutConfig& config, int from, int to,
+                                                std::vector<LineMark>& marks) {
+  const int16_t maxWidth = config.pageWidth - config.marginLeft - config.marginRight;
+  int position = from;
+  while (position < to) {
+    provider.setPosition(position);
+    if (!provider.hasNextWord()) {
+      break;
+    }
+    if (!readParagraph(provider, renderer, config.alignment)) {
+      if (paragraphEnd_) {
+        marks.push_back({paragraphStart_, true, true, 0, 0});
+      }
+    } else {
+      breakParagraph(maxWidth);
+      const int16_t before = spaceBefore(config);
+      const int16_t after = paragraphEnd_ ? spaceAfter(config) : 0;
+      for (size_t i = 0; i < breaks_.size(); i++) {
+        const int start = lineStart(provider, i);
+        if (start >= to) {
+          break;
+        }
+        const bool last = i + 1 == breaks_.size();
+        marks.push_back({start, last && paragraphEnd_, false, (int16_t)(i == 0 ? before : 0),
+                         (int16_t)(last ? after : 0)});
+      }
+    }
+    if (paragraphEndIndex_ <= position) {
+      break;
+    }
+    position = paragraphEndIndex_;
+  }
+}
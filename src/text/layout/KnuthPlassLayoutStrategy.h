@@ -1,31 +1,45 @@
 #ifndef KNUTH_PLASS_LAYOUT_STRATEGY_H
 #define KNUTH_PLASS_LAYOUT_STRATEGY_H
 
+#include <string>
 #include <vector>
 
+#include "../../content/providers/WordProvider.h"
 #include "LayoutStrategy.h"
 
+/**
+ * Total-fit line breaking (Knuth & Plass, "Breaking Paragraphs into Lines").
+ *
+ * Each paragraph is read once into a box/glue/penalty model: words are boxes,
+ * spaces are glue that may stretch and shrink, and hyphenation candidates are
+ * flagged penalties inside the word. Breaks are chosen over the whole
+ * paragraph with an active-node list, so only breakpoints that can still end
+ * a line are examined and the work stays close to linear in the paragraph.
+ *
+ * Line demerits depend only on the line itself and on whether both of its
+ * ends are hyphen breaks. The optimal breaks of a paragraph tail are therefore
+ * the tail of the paragraph's optimal breaks, which is what lets a page start
+ * mid-paragraph and still get the lines it had when the page before it was
+ * laid out.
+ *
+ * A paragraph longer than kMaxParagraphTokens is broken in chunks.
+ *
+ * The provider's ParagraphFormat indents the first line (a narrower first
+ * line for the breaker), adds its margins to the paragraph spacing (the
+ * larger of adjacent margins wins, and none at the top of a page) and sets
+ * paragraphs at kLargeFontSize or more in bold, as the fonts come in one size.
+ *
+ * Measured paragraphs (token text, widths and hyphenation points, but not the
+ * line breaks) are kept in a small LRU cache keyed by where they were read.
+ * Laying out the same page again after a margin or orientation change only
+ * re-breaks them; after a font change their text is re-measured. Neither
+ * reads the provider again.
+ */
 class KnuthPlassLayoutStrategy : public LayoutStrategy {
  public:
   KnuthPlassLayoutStrategy();
   ~KnuthPlassLayoutStrategy();
 
-  // Test support: check if line count mismatch occurred
-  bool hasLineCountMismatch() const {
-    return lineCountMismatch_;
-  }
-  int getExpectedLineCount() const {
-    return expectedLineCount_;
-  }
-  int getActualLineCount() const {
-    return actualLineCount_;
-  }
-  void resetLineCountMismatch() {
-    lineCountMismatch_ = false;
-    expectedLineCount_ = 0;
-    actualLineCount_ = 0;
-  }
-
   Type getType() const override {
     return KNUTH_PLASS;
   }
@@ -34,39 +48,143 @@ class KnuthPlassLayoutStrategy : public LayoutStrategy {
   PageLayout layoutText(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config) override;
   void renderPage(const PageLayout& layout, TextRenderer& renderer, const LayoutConfig& config) override;
 
+  // Breaks the paragraphs before currentStartPosition the same way layoutText
+  // does, then picks the start whose page ends at currentStartPosition
+  int getPreviousPageStart(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
+                           int currentStartPosition) override;
+
+  void clearLayoutCache() override;
+
+  static constexpr size_t kMaxParagraphTokens = 1024;
+  static constexpr size_t kParagraphCacheEntries = 6;
+  static constexpr size_t kParagraphCacheBytes = 16 * 1024;
+  static constexpr uint8_t kLargeFontSize = 12;  // ParagraphFormat::fontSize set in bold
+
  private:
   // spaceWidth_ is defined in base class
 
-  struct ParagraphLayoutInfo {
-    std::vector<Word> words;
-    std::vector<size_t> breaks;
-    bool paragraphEnd;
-    int16_t yStart;
+  // Knuth-Plass parameters (TeX's defaults where TeX has one)
+  static constexpr int16_t INFINITY_PENALTY = 10000;
+  static constexpr int16_t HYPHEN_PENALTY = 50;
+  static constexpr int32_t LINE_PENALTY = 10;
+  static constexpr int32_t DOUBLE_HYPHEN_DEMERITS = 3000;
+  static constexpr int32_t INFINITY_BADNESS = 10000;
+  static constexpr int16_t FILL_STRETCH = 0x3FFF;  // glue that ends the last line of a paragraph
+
+  enum ItemKind : uint8_t { BOX, GLUE, PENALTY };
+
+  // Provider token of the paragraph: a word or a run of spaces
+  struct Token {
+    int index;            // provider index where the token starts
+    uint16_t textOffset;  // token text in text_
+    uint16_t length;
+    int16_t width;
+    FontStyle style;
   };
 
-  // Knuth-Plass parameters
-  static constexpr int32_t INFINITY_PENALTY = 1000000;
-  static constexpr int32_t HYPHEN_PENALTY = 50;
-  static constexpr int32_t FITNESS_DEMERITS = 100;
+  struct Item {
+    ItemKind kind;
+    bool flagged;      // penalty at a hyphenation point
+    bool addsHyphen;   // breaking here inserts a hyphen (algorithmic hyphenation)
+    int16_t width;     // box/glue width; hyphen width for penalties
+    int16_t stretch;   // glue only
+    int16_t shrink;    // glue only
+    int16_t penalty;   // penalties only; -INFINITY_PENALTY forces a break
+    uint16_t token;    // index into tokens_
+    uint16_t offset;   // byte offset into the token text where a box starts or a penalty breaks
+  };
 
-  // Node for dynamic programming
+  // Feasible breakpoint; nodes_ holds all of them, active_ those that can still start a line
   struct Node {
-    size_t position;         // Word index
-    size_t line;             // Line number
-    int32_t totalDemerits;   // Total demerits up to this point
-    int16_t totalWidth;      // Width accumulated up to this position
-    int prevBreak;           // Previous break point index (-1 if none)
+    int64_t demerits;  // total demerits of the best way to reach this break
+    int32_t width;     // item totals after the break, discardable items skipped
+    int32_t stretch;
+    int32_t shrink;
+    int32_t prev;      // previous node on the best path, -1 for the paragraph start
+    uint16_t item;     // item index of the break
+    bool flagged;
+  };
+
+  // A measured paragraph and what its widths depend on
+  struct CachedParagraph {
+    const WordProvider* provider = nullptr;  // nullptr: unused entry
+    int chapter = 0;
+    int start = 0;
+    Language language;
+    const FontFamily* family = nullptr;
+    uint32_t generation = 0;  // TextRenderer::getWidthCacheGeneration()
+    uint32_t lastUse = 0;
+    int endIndex = 0;
+    bool paragraphEnd = false;
+    bool truncated = false;
+    bool startsInsideWord = false;
+    int8_t alignment = -1;
+    ParagraphFormat format;
+    std::vector<Token> tokens;
+    std::vector<Item> items;
+    std::string text;
+  };
+
+  // Line starts of a stretch of text, as used for backward navigation
+  struct LineMark {
+    int start;
+    bool paragraphEnd;    // last line of its paragraph (paragraph spacing follows)
+    bool blank;           // empty paragraph, takes one line height
+    int16_t spaceBefore;  // top margin of a paragraph's first line
+    int16_t spaceAfter;   // paragraph spacing after a paragraph's last line
   };
 
-  // Helper methods
-  std::vector<size_t> calculateBreaks(const std::vector<Word>& words, int16_t maxWidth);
-  int32_t calculateBadness(int16_t actualWidth, int16_t targetWidth);
-  int32_t calculateDemerits(int32_t badness, bool isLastLine);
+  // Read the paragraph at the provider position into tokens_/items_.
+  // Returns false if it holds no words.
+  bool readParagraph(WordProvider& provider, TextRenderer& renderer, TextAlignment defaultAlignment);
+  void addWordItems(TextRenderer& renderer, const String& text, const String& prefix, uint16_t token);
+  // Measure tokens_/items_ again from text_ with the renderer's current fonts
+  void remeasure(TextRenderer& renderer);
+  CachedParagraph* findCached(WordProvider& provider, int start);
+  void storeCached(WordProvider& provider, TextRenderer& renderer);
+  static size_t cachedBytes(const CachedParagraph& entry);
+  // Fill breaks_ with the item index ending each line of the paragraph
+  void breakParagraph(int16_t maxWidth);
+  void tryBreak(size_t item, int32_t width, int32_t stretch, int32_t shrink, int16_t maxWidth);
+
+  // Block spacing of the paragraph read last, in pixels
+  int16_t firstLineIndent(int16_t maxWidth) const;
+  int16_t spaceBefore(const LayoutConfig& config) const;
+  int16_t spaceAfter(const LayoutConfig& config) const;
+  void addNode(size_t item, int64_t demerits, int32_t prev, int32_t width, int32_t stretch, int32_t shrink);
+  int32_t calculateBadness(int32_t shortfall, int32_t flexibility) const;
+  int32_t calculateDemerits(int32_t badness, const Item& breakItem, bool doubleHyphen) const;
+
+  // Provider index where the line after breakIdx starts
+  int lineStart(WordProvider& provider, size_t breakIdx);
+  // Words of the line ending at breaks_[breakIdx]
+  Line buildLine(TextRenderer& renderer, size_t breakIdx);
+  void placeLine(Line& line, int16_t x, int16_t maxWidth, int16_t y, bool isLastLine) const;
+
+  int paragraphStartBefore(WordProvider& provider, int position);
+  void collectLineMarks(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config, int from, int to,
+                        std::vector<LineMark>& marks);
+
+  // Paragraph being broken; reused between paragraphs so steady-state layout does not allocate
+  std::vector<Token> tokens_;
+  std::vector<Item> items_;
+  std::string text_;  // token texts, back to back
+  std::vector<Node> nodes_;
+  std::vector<uint32_t> active_;
+  std::vector<uint16_t> breaks_;
+  int paragraphStart_ = 0;
+  int paragraphEndIndex_ = 0;  // provider index after the paragraph (past its newline)
+  bool paragraphEnd_ = false;  // ended at a newline, not at the token limit or end of text
+  bool truncated_ = false;     // stopped at kMaxParagraphTokens
+  bool startsInsideWord_ = false;
+  int8_t paragraphAlignment_ = -1;  // TextAlignment from the provider, -1 for the config default
+  TextAlignment alignment_ = ALIGN_LEFT;
+  ParagraphFormat paragraphFormat_;
+  bool startsParagraph_ = false;  // read from the start of its paragraph, not from a later line
+  int16_t firstLineIndent_ = 0;   // of the paragraph being broken
 
-  // Line count mismatch tracking for testing
-  bool lineCountMismatch_ = false;
-  int expectedLineCount_ = 0;
-  int actualLineCount_ = 0;
+  CachedParagraph cache_[kParagraphCacheEntries];
+  uint32_t cacheClock_ = 0;
 };
 
 #endif
@@ -26,6 +26,13 @@ void LayoutStrategy::setLanguage(Language language) {
   hyphenationStrategy_ = createHyphenationStrategy(language);
 }
 
+void LayoutStrategy::setHyphenationPatterns(const char* patternFile) {
+  // Free the previous patterns before loading the new ones
+  delete hyphenationStrategy_;
+  hyphenationStrategy_ = nullptr;
+  hyphenationStrategy_ = createHyphenationStrategy(patternFile);
+}
+
 LayoutStrategy::Line LayoutStrategy::getNextLine(WordProvider& provider, TextRenderer& renderer, int16_t maxWidth,
                                                  bool& isParagraphEnd, TextAlignment defaultAlignment) {
   isParagraphEnd = false;
@@ -296,15 +303,13 @@ int LayoutStrategy::getPreviousPageStart(WordProvider& provider, TextRenderer& r
 LayoutStrategy::HyphenSplit LayoutStrategy::findBestHyphenSplitForward(const Word& word, int16_t availableWidth,
                                                                        TextRenderer& renderer) {
   // Find the last (rightmost) hyphen position where the first part fits
-  std::vector<int> hyphenPositions;
+  HyphenPositions hyphenPositions;
   if (hyphenationStrategy_) {
-    std::string stdWord = word.text.c_str();
-    hyphenPositions = hyphenationStrategy_->findHyphenPositions(stdWord);
+    hyphenationStrategy_->findHyphenPositions(word.text.c_str(), word.text.length(), hyphenPositions);
   }
   HyphenSplit result = {-1, false, false};
 
-  for (int i = 0; i < hyphenPositions.size(); i++) {
-    int pos = hyphenPositions[i];
+  for (int pos : hyphenPositions) {
     bool isAlgorithmic = pos < 0;
     int actualPos = isAlgorithmic ? -(pos + 1) : pos;
 
@@ -336,14 +341,13 @@ LayoutStrategy::HyphenSplit LayoutStrategy::findBestHyphenSplitForward(const Wor
 LayoutStrategy::HyphenSplit LayoutStrategy::findBestHyphenSplitBackward(const Word& word, int16_t availableWidth,
                                                                         TextRenderer& renderer) {
   // Find the earliest (leftmost) hyphen position where the second part fits
-  std::vector<int> hyphenPositions;
+  HyphenPositions hyphenPositions;
   if (hyphenationStrategy_) {
-    std::string stdWord = word.text.c_str();
-    hyphenPositions = hyphenationStrategy_->findHyphenPositions(stdWord);
+    hyphenationStrategy_->findHyphenPositions(word.text.c_str(), word.text.length(), hyphenPositions);
   }
   HyphenSplit result = {-1, false, false};
 
-  for (int i = hyphenPositions.size() - 1; i >= 0; i--) {
+  for (size_t i = hyphenPositions.size(); i-- > 0;) {
     int pos = hyphenPositions[i];
     bool isAlgorithmic = pos < 0;
     int actualPos = isAlgorithmic ? -(pos + 1) : pos;
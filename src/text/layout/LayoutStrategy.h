@@ -78,6 +78,12 @@ class LayoutStrategy {
 
   // Set the language for hyphenation (updates hyphenation strategy)
   void setLanguage(Language language);
+  // Hyphenate with the patterns of a .hyp file (Language::PATTERN_FILE)
+  void setHyphenationPatterns(const char* patternFile);
+  // Strategy for the current language, for its memo statistics; may be null
+  HyphenationStrategy* getHyphenationStrategy() const {
+    return hyphenationStrategy_;
+  }
 
   // Main layout method: takes words from a provider and computes layout
   // Returns page layout with lines and end position
@@ -93,6 +99,10 @@ class LayoutStrategy {
   virtual int getPreviousPageStart(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config,
                                    int currentEndPosition);
 
+  // Drop text measurements kept between layoutText calls. Call when the
+  // provider's text is replaced; font and width changes are detected.
+  virtual void clearLayoutCache() {}
+
   // Optional lower-level methods for strategies that need them
   virtual void setSpaceWidth(int16_t spaceWidth) {
     spaceWidth_ = spaceWidth;
@@ -0,0 +1,316 @@
+#include "PaginationIndex.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "../hyphenation/HyphenationStrategy.h"
+
+namespace {
+
+const uint32_t kFnvOffset = 2166136261u;
+const uint32_t kFnvPrime = 16777619u;
+
+// Bump when the on-disk format, the fingerprint inputs or line breaking change.
+const uint32_t kIndexVersion = 2;
+
+uint32_t fnvMixBytes(uint32_t h, const void* data, size_t len) {
+  const uint8_t* p = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < len; ++i) {
+    h ^= p[i];
+    h *= kFnvPrime;
+  }
+  return h;
+}
+
+uint32_t fnvMixInt(uint32_t h, int32_t v) {
+  // Mix as little-endian bytes so the hash is identical on host and device.
+  uint8_t b[4] = {(uint8_t)(v & 0xFF), (uint8_t)((v >> 8) & 0xFF), (uint8_t)((v >> 16) & 0xFF),
+                  (uint8_t)((v >> 24) & 0xFF)};
+  return fnvMixBytes(h, b, sizeof(b));
+}
+
+}  // namespace
+
+PaginationIndex::PaginationIndex() {}
+
+uint32_t PaginationIndex::computeFingerprint(const char* fontFamilyName, const LayoutStrategy::LayoutConfig& config,
+                                             LayoutStrategy::Type layoutType) {
+  uint32_t h = kFnvOffset;
+  h = fnvMixInt(h, (int32_t)kIndexVersion);
+  if (fontFamilyName) {
+    h = fnvMixBytes(h, fontFamilyName, strlen(fontFamilyName));
+  }
+  h = fnvMixInt(h, config.marginLeft);
+  h = fnvMixInt(h, config.marginRight);
+  h = fnvMixInt(h, config.marginTop);
+  h = fnvMixInt(h, config.marginBottom);
+  h = fnvMixInt(h, config.lineHeight);
+  h = fnvMixInt(h, config.paragraphSpacing);
+  h = fnvMixInt(h, config.minSpaceWidth);
+  h = fnvMixInt(h, config.pageWidth);
+  h = fnvMixInt(h, config.pageHeight);
+  h = fnvMixInt(h, (int32_t)config.alignment);
+  h = fnvMixInt(h, (int32_t)config.language);
+  h = fnvMixInt(h, (int32_t)layoutType);
+  return h;
+}
+
+void PaginationIndex::reset(uint32_t fingerprint, int chapterCount) {
+  if (chapterCount < 1) {
+    chapterCount = 1;
+  }
+  if (fingerprint != fingerprint_) {
+    chapters_.clear();
+    fingerprint_ = fingerprint;
+    dirty_ = true;
+  }
+  if ((int)chapters_.size() != chapterCount) {
+    chapters_.resize(chapterCount);
+    dirty_ = true;
+  }
+}
+
+void PaginationIndex::clear() {
+  chapters_.clear();
+  fingerprint_ = 0;
+  dirty_ = false;
+}
+
+PaginationIndex::ChapterPages* PaginationIndex::chapterAt(int chapter) {
+  if (chapter < 0 || chapter >= (int)chapters_.size()) {
+    return nullptr;
+  }
+  return &chapters_[chapter];
+}
+
+const PaginationIndex::ChapterPages* PaginationIndex::chapterAt(int chapter) const {
+  if (chapter < 0 || chapter >= (int)chapters_.size()) {
+    return nullptr;
+  }
+  return &chapters_[chapter];
+}
+
+bool PaginationIndex::recordPage(int chapter, int startOffset, int endOffset, bool isChapterEnd) {
+  ChapterPages* cp = chapterAt(chapter);
+  if (!cp || startOffset < 0) {
+    return false;
+  }
+
+  if (cp->starts.empty()) {
+    // Chains always begin at the chapter start.
+    if (startOffset != 0) {
+      return false;
+    }
+    cp->starts.push_back(0);
+    dirty_ = true;
+  }
+
+  int page = findPage(chapter, startOffset);
+  if (page < 0) {
+    // Page is not aligned with the known chain (e.g. resumed mid-chapter).
+    return false;
+  }
+
+  bool changed = false;
+  if (isChapterEnd || endOffset <= startOffset) {
+    // This is the last page: anything recorded after it is stale.
+    if ((int)cp->starts.size() > page + 1) {
+      cp->starts.resize(page + 1);
+      changed = true;
+    }
+    if (!cp->complete) {
+      cp->complete = true;
+      changed = true;
+    }
+  } else if (page + 1 < (int)cp->starts.size()) {
+    if (cp->starts[page + 1] != endOffset) {
+      // Should not happen for a matching fingerprint; trust the fresh layout.
+      cp->starts.resize(page + 1);
+      cp->starts.push_back(endOffset);
+      cp->complete = false;
+      changed = true;
+    }
+  } else {
+    cp->starts.push_back(endOffset);
+    cp->complete = false;
+    changed = true;
+  }
+
+  if (changed) {
+    dirty_ = true;
+  }
+  return changed;
+}
+
+int PaginationIndex::findPage(int chapter, int startOffset) const {
+  const ChapterPages* cp = chapterAt(chapter);
+  if (!cp || cp->starts.empty()) {
+    return -1;
+  }
+  auto it = std::lower_bound(cp->starts.begin(), cp->starts.end(), (int32_t)startOffset);
+  if (it == cp->starts.end() || *it != startOffset) {
+    return -1;
+  }
+  return (int)(it - cp->starts.begin());
+}
+
+int PaginationIndex::getPreviousPageStart(int chapter, int startOffset) const {
+  int page = findPage(chapter, startOffset);
+  if (page <= 0) {
+    return -1;
+  }
+  return chapters_[chapter].starts[page - 1];
+}
+
+int PaginationIndex::getLastPageStart(int chapter) const {
+  const ChapterPages* cp = chapterAt(chapter);
+  if (!cp || !cp->complete || cp->starts.empty()) {
+    return -1;
+  }
+  return cp->starts.back();
+}
+
+int PaginationIndex::getPageStart(int chapter, int page) const {
+  const ChapterPages* cp = chapterAt(chapter);
+  if (!cp || page < 0 || page >= (int)cp->starts.size()) {
+    return -1;
+  }
+  return cp->starts[page];
+}
+
+bool PaginationIndex::isChapterComplete(int chapter) const {
+  const ChapterPages* cp = chapterAt(chapter);
+  return cp && cp->complete;
+}
+
+int PaginationIndex::getChapterPageCount(int chapter) const {
+  const ChapterPages* cp = chapterAt(chapter);
+  if (!cp || !cp->complete) {
+    return -1;
+  }
+  return (int)cp->starts.size();
+}
+
+int PaginationIndex::getKnownPageCount(int chapter) const {
+  const ChapterPages* cp = chapterAt(chapter);
+  return cp ? (int)cp->starts.size() : 0;
+}
+
+bool PaginationIndex::isBookComplete() const {
+  if (chapters_.empty()) {
+    return false;
+  }
+  for (const ChapterPages& cp : chapters_) {
+    if (!cp.complete) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int PaginationIndex::getTotalPageCount() const {
+  if (!isBookComplete()) {
+    return -1;
+  }
+  int total = 0;
+  for (const ChapterPages& cp : chapters_) {
+    total += (int)cp.starts.size();
+  }
+  return total;
+}
+
+int PaginationIndex::getBookPageNumber(int chapter, int startOffset) const {
+  int page = findPage(chapter, startOffset);
+  if (page < 0) {
+    return -1;
+  }
+  int before = 0;
+  for (int c = 0; c < chapter; ++c) {
+    if (!chapters_[c].complete) {
+      return -1;
+    }
+    before += (int)chapters_[c].starts.size();
+  }
+  return before + page;
+}
+
+String PaginationIndex::serialize() const {
+  String out;
+  char buf[32];
+  snprintf(buf, sizeof(buf), "PAG1 %08lx %d\n", (unsigned long)fingerprint_, (int)chapters_.size());
+  out += buf;
+  for (size_t c = 0; c < chapters_.size(); ++c) {
+    const ChapterPages& cp = chapters_[c];
+    out.reserve(out.length() + cp.starts.size() * 7 + 16);
+    snprintf(buf, sizeof(buf), "%d %d", (int)c, cp.complete ? 1 : 0);
+    out += buf;
+    for (int32_t s : cp.starts) {
+      snprintf(buf, sizeof(buf), " %ld", (long)s);
+      out += buf;
+    }
+    out += '\n';
+  }
+  return out;
+}
+
+bool PaginationIndex::deserialize(const String& data, uint32_t expectedFingerprint) {
+  chapters_.clear();
+  fingerprint_ = expectedFingerprint;
+  dirty_ = false;
+
+  const char* p = data.c_str();
+  if (!p || strncmp(p, "PAG1 ", 5) != 0) {
+    return false;
+  }
+  p += 5;
+  char* end = nullptr;
+  unsigned long fp = strtoul(p, &end, 16);
+  if (end == p || (uint32_t)fp != expectedFingerprint) {
+    return false;
+  }
+  p = end;
+  long chapterCount = strtol(p, &end, 10);
+  if (end == p || chapterCount < 0 || chapterCount > 4096) {
+    return false;
+  }
+  p = end;
+
+  std::vector<ChapterPages> chapters((size_t)chapterCount);
+  for (long i = 0; i < chapterCount; ++i) {
+    long c = strtol(p, &end, 10);
+    if (end == p || c != i) {
+      return false;
+    }
+    p = end;
+    long complete = strtol(p, &end, 10);
+    if (end == p) {
+      return false;
+    }
+    p = end;
+    chapters[i].complete = (complete != 0);
+    // Offsets run until the end of the line
+    while (*p == ' ') {
+      ++p;
+      long s = strtol(p, &end, 10);
+      if (end == p) {
+        break;
+      }
+      if (!chapters[i].starts.empty() && s <= chapters[i].starts.back()) {
+        return false;
+      }
+      chapters[i].starts.push_back((int32_t)s);
+      p = end;
+    }
+    if (*p == '\r') {
+      ++p;
+    }
+    if (*p == '\n') {
+      ++p;
+    }
+  }
+
+  chapters_.swap(chapters);
+  return true;
+}
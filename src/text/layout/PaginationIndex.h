@@ -0,0 +1,102 @@
+#ifndef PAGINATION_INDEX_H
+#define PAGINATION_INDEX_H
+
+#include <Arduino.h>
+#include <WString.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "LayoutStrategy.h"
+
+/**
+ * Per-book index of page start offsets, one list per chapter.
+ *
+ * Page starts are only recorded as a contiguous chain beginning at offset 0
+ * of a chapter: a page is appended when its start equals the last known
+ * start, so every entry is guaranteed to be a real page break for the current
+ * layout. Once the last page of a chapter is seen the chapter is marked
+ * complete and its page count becomes known.
+ *
+ * The index is only valid for the layout it was built with. The fingerprint
+ * (see computeFingerprint) covers everything that influences line breaking;
+ * a mismatch on load or reset() discards the recorded pages.
+ */
+class PaginationIndex {
+ public:
+  PaginationIndex();
+
+  // Hash of everything that changes where pages break: font family, margins,
+  // line height, paragraph spacing, page size (orientation), alignment,
+  // hyphenation language and line breaking algorithm.
+  static uint32_t computeFingerprint(const char* fontFamilyName, const LayoutStrategy::LayoutConfig& config,
+                                     LayoutStrategy::Type layoutType);
+
+  // Drop all pages if `fingerprint` differs from the current one. `chapterCount`
+  // sizes the per-chapter tables (1 for single-file documents).
+  void reset(uint32_t fingerprint, int chapterCount);
+  void clear();
+
+  uint32_t getFingerprint() const {
+    return fingerprint_;
+  }
+  int getChapterCount() const {
+    return (int)chapters_.size();
+  }
+
+  // Record a laid out page [startOffset, endOffset) of `chapter`. `isChapterEnd`
+  // marks the last page of the chapter. Returns true if the index changed.
+  bool recordPage(int chapter, int startOffset, int endOffset, bool isChapterEnd);
+
+  // Zero-based page number of the page starting at `startOffset`, or -1 if the
+  // offset is not a known page start.
+  int findPage(int chapter, int startOffset) const;
+  // Start offset of the page before the one starting at `startOffset`, or -1
+  // if unknown. O(log n) on the page list; O(1) when the page number is known.
+  int getPreviousPageStart(int chapter, int startOffset) const;
+  // Start offset of the last page of a complete chapter, or -1.
+  int getLastPageStart(int chapter) const;
+  int getPageStart(int chapter, int page) const;
+
+  bool isChapterComplete(int chapter) const;
+  // Number of pages in `chapter`, or -1 while the chapter is incomplete.
+  int getChapterPageCount(int chapter) const;
+  // Number of known page starts in `chapter` (complete or not).
+  int getKnownPageCount(int chapter) const;
+  bool isBookComplete() const;
+  // Total pages of the book, or -1 unless every chapter is complete.
+  int getTotalPageCount() const;
+  // Book-wide zero-based page number, or -1 unless all preceding chapters are
+  // complete and the page itself is known.
+  int getBookPageNumber(int chapter, int startOffset) const;
+
+  bool isDirty() const {
+    return dirty_;
+  }
+  void markClean() {
+    dirty_ = false;
+  }
+
+  // Text serialization used for the `<book>.pag` file next to the book:
+  //   PAG1 <fingerprint hex> <chapterCount>
+  //   <chapter> <complete 0|1> <start0> <start1> ...
+  String serialize() const;
+  // Returns false (and leaves the index empty) on a malformed file or when the
+  // stored fingerprint does not match `expectedFingerprint`.
+  bool deserialize(const String& data, uint32_t expectedFingerprint);
+
+ private:
+  struct ChapterPages {
+    std::vector<int32_t> starts;
+    bool complete = false;
+  };
+
+  ChapterPages* chapterAt(int chapter);
+  const ChapterPages* chapterAt(int chapter) const;
+
+  std::vector<ChapterPages> chapters_;
+  uint32_t fingerprint_ = 0;
+  bool dirty_ = false;
+};
+
+#endif
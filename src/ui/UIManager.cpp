@@ -903,6 +903,13 @@ void UIManager::showScreen(ScreenId id) {
     textRenderer.setOrientation(TextRenderer::Portrait);
   }
 
+  if (id != currentScreen) {
+    auto leaving = screens.find(currentScreen);
+    if (leaving != screens.end() && leaving->second) {
+      leaving->second->deactivate();
+    }
+  }
+
   previousScreen = currentScreen;
   currentScreen = id;
   // Call activate so screens can perform any work needed when they become
@@ -82,68 +82,99 @@ void FileBrowserScreen::renderSdBrowser() {
     textRenderer.print(title);
   }
 
-  textRenderer.setFont(getMainFont());
-
   // Render file list centered both horizontally and vertically.
   textRenderer.setFont(getMainFont());
-  const int lineHeight = 28;
-  int lines = SD_LINES_PER_SCREEN;
-
-  // Count how many actual rows we'll draw (clamped by available files)
-  int drawable = 0;
-  for (int i = 0; i < lines; ++i) {
-    if (sdScrollOffset + i >= (int)sdFiles.size())
-      break;
-    ++drawable;
+  const int drawable = visibleRowCount();
+  for (int i = 0; i < drawable; ++i) {
+    rowRegions[i] = renderSdRow(i, drawable);
   }
+  renderedScrollOffset = sdScrollOffset;
+}
 
-  if (drawable == 0)
-    return;
+int FileBrowserScreen::visibleRowCount() const {
+  // Clamped by available files
+  int drawable = (int)sdFiles.size() - sdScrollOffset;
+  if (drawable > SD_LINES_PER_SCREEN)
+    drawable = SD_LINES_PER_SCREEN;
+  return drawable < 0 ? 0 : drawable;
+}
 
+DirtyRegion FileBrowserScreen::renderSdRow(int row, int drawable) {
+  const int lineHeight = 28;
   int totalHeight = drawable * lineHeight;
   int startY = (800 - totalHeight) / 2;  // center vertically (pageHeight = 800)
 
-  for (int i = 0; i < drawable; ++i) {
-    int idx = sdScrollOffset + i;
-    String fullPath = sdFiles[idx];
-    String filename = fullPath;
-    int lastSlash = fullPath.lastIndexOf('/');
-    if (lastSlash != -1) {
-      filename = fullPath.substring(lastSlash + 1);
-    }
+  int idx = sdScrollOffset + row;
+  String fullPath = sdFiles[idx];
+  String filename = fullPath;
+  int lastSlash = fullPath.lastIndexOf('/');
+  if (lastSlash != -1) {
+    filename = fullPath.substring(lastSlash + 1);
+  }
 
-    // For display, strip the .txt extension if present but keep the stored
-    // filename intact so confirm() can open it later.
-    // For .epub files, keep the extension visible.
-    String displayNameRaw = filename;
-    if (displayNameRaw.length() >= 4) {
-      String ext = displayNameRaw.substring(displayNameRaw.length() - 4);
-      ext.toLowerCase();
-      if (ext == String(".txt")) {
-        displayNameRaw = displayNameRaw.substring(0, displayNameRaw.length() - 4);
-      }
+  // For display, strip the .txt extension if present but keep the stored
+  // filename intact so confirm() can open it later.
+  // For .epub files, keep the extension visible.
+  String displayNameRaw = filename;
+  if (displayNameRaw.length() >= 4) {
+    String ext = displayNameRaw.substring(displayNameRaw.length() - 4);
+    ext.toLowerCase();
+    if (ext == String(".txt")) {
+      displayNameRaw = displayNameRaw.substring(0, displayNameRaw.length() - 4);
     }
+  }
 
-    if (displayNameRaw.length() > 30)
-      displayNameRaw = displayNameRaw.substring(0, 27) + "...";
+  if (displayNameRaw.length() > 30)
+    displayNameRaw = displayNameRaw.substring(0, 27) + "...";
 
-    String displayName;
-    if (idx == sdSelectedIndex) {
-      // Show both left and right markers around the selection and center the whole string
-      displayName = String(">") + displayNameRaw + String("<");
-    } else {
-      displayName = displayNameRaw;
-    }
+  String displayName;
+  if (idx == sdSelectedIndex) {
+    // Show both left and right markers around the selection and center the whole string
+    displayName = String(">") + displayNameRaw + String("<");
+  } else {
+    displayName = displayNameRaw;
+  }
 
-    int16_t x1, y1;
-    uint16_t w, h;
-    textRenderer.getTextBounds(displayName.c_str(), 0, 0, &x1, &y1, &w, &h);
-    int16_t centerX = (480 - (int)w) / 2;  // horizontal center (pageWidth = 480)
-    int16_t rowY = startY + i * lineHeight;
-    textRenderer.setCursor(centerX, rowY);
-    textRenderer.print(displayName);
+  int16_t x1, y1;
+  uint16_t w, h;
+  textRenderer.getTextBounds(displayName.c_str(), 0, 0, &x1, &y1, &w, &h);
+  int16_t centerX = (480 - (int)w) / 2;  // horizontal center (pageWidth = 480)
+  int16_t rowY = startY + row * lineHeight;
+  textRenderer.resetDirtyRegion();
+  textRenderer.setCursor(centerX, rowY);
+  textRenderer.print(displayName);
+  return textRenderer.getDirtyRegion();
+}
+
+void FileBrowserScreen::updateSelectionRows(int oldIndex) {
+  // Only the rows losing and gaining the selection markers change. The status
+  // header is left as is until the next full render.
+  if (!display.beginRegionUpdate()) {
+    show();
+    return;
   }
 
+  textRenderer.setTextColor(TextRenderer::COLOR_BLACK);
+  textRenderer.setFrameBuffer(display.getFrameBuffer());
+  textRenderer.setBitmapType(TextRenderer::BITMAP_BW);
+  textRenderer.setFont(getMainFont());
+
+  const int drawable = visibleRowCount();
+  const int oldRow = oldIndex - sdScrollOffset;
+  const int newRow = sdSelectedIndex - sdScrollOffset;
+  DirtyRegion cleared = rowRegions[oldRow];
+  cleared.unite(rowRegions[newRow]);
+  display.clearRegion(cleared);
+
+  // Also redraw neighbours whose glyphs reach into the cleared area
+  DirtyRegion dirty = cleared;
+  for (int i = 0; i < drawable; ++i) {
+    if (i == oldRow || i == newRow || rowRegions[i].intersects(cleared)) {
+      rowRegions[i] = renderSdRow(i, drawable);
+      dirty.unite(rowRegions[i]);
+    }
+  }
+  display.displayRegion(dirty, EInkDisplay::FAST_REFRESH);
 }
 
 void FileBrowserScreen::confirm() {
@@ -168,6 +199,7 @@ void FileBrowserScreen::offsetSelection(int offset) {
   if (sdFiles.empty())
     return;
 
+  const int oldIndex = sdSelectedIndex;
   int n = (int)sdFiles.size();
   int newIndex = sdSelectedIndex + offset;
   newIndex %= n;
@@ -198,10 +230,16 @@ void FileBrowserScreen::offsetSelection(int offset) {
     s.setString(String("filebrowser.selected"), full);
   }
 
-  show();
+  // Without scrolling only two rows change
+  if (sdScrollOffset == renderedScrollOffset && oldIndex != sdSelectedIndex) {
+    updateSelectionRows(oldIndex);
+  } else {
+    show();
+  }
 }
 
 void FileBrowserScreen::loadFolder(int maxFiles) {
+  renderedScrollOffset = -1;
   sdFiles.clear();
 
   if (!sdManager.ready()) {
@@ -30,6 +30,11 @@ class FileBrowserScreen : public Screen {
  private:
   void loadFolder(int maxFiles = 200);
   void renderSdBrowser();
+  int visibleRowCount() const;
+  // Draw visible row `row` of `drawable`; returns the panel region it covers
+  DirtyRegion renderSdRow(int row, int drawable);
+  // Move the selection markers from `oldIndex` with a region-limited update
+  void updateSelectionRows(int oldIndex);
 
   EInkDisplay& display;
   TextRenderer& textRenderer;
@@ -42,6 +47,11 @@ class FileBrowserScreen : public Screen {
   String browsePath = "/books";
 
   static const int SD_LINES_PER_SCREEN = 8;
+
+  // Panel regions of the rows currently on screen, and the scroll offset they
+  // were drawn with (-1 when the screen has not been rendered yet)
+  DirtyRegion rowRegions[SD_LINES_PER_SCREEN];
+  int renderedScrollOffset = -1;
 };
 
 #endif
@@ -16,6 +16,9 @@ class Screen {
   // Called when the screen becomes active
   virtual void activate() {}
 
+  // Called when another screen is about to become active
+  virtual void deactivate() {}
+
   // Called when the screen should render itself (no args for generic screens)
   virtual void show() = 0;
 
@@ -38,6 +38,7 @@ void SettingsScreen::handleButtons(Buttons& buttons) {
 
 void SettingsScreen::activate() {
   selectedIndex = 0;
+  rowsRendered = false;
   loadSettings();
 }
 
@@ -73,41 +74,78 @@ void SettingsScreen::renderSettings() {
   textRenderer.setFont(getMainFont());
 
   // Render settings list
+  for (int i = 0; i < SETTINGS_COUNT; ++i) {
+    rowRegions[i] = renderSettingRow(i);
+  }
+  rowsRendered = true;
+}
+
+DirtyRegion SettingsScreen::renderSettingRow(int index) {
   const int lineHeight = 28;
   int totalHeight = SETTINGS_COUNT * lineHeight;
   int startY = (800 - totalHeight) / 2;  // center vertically
 
-  for (int i = 0; i < SETTINGS_COUNT; ++i) {
-    String displayName = getSettingName(i);
-    displayName += ": ";
-    displayName += getSettingValue(i);
+  String displayName = getSettingName(index);
+  displayName += ": ";
+  displayName += getSettingValue(index);
 
-    if (i == selectedIndex) {
-      displayName = String(">") + displayName + String("<");
-    }
+  if (index == selectedIndex) {
+    displayName = String(">") + displayName + String("<");
+  }
 
-    int16_t x1, y1;
-    uint16_t w, h;
-    textRenderer.getTextBounds(displayName.c_str(), 0, 0, &x1, &y1, &w, &h);
-    int16_t centerX = (480 - (int)w) / 2;
-    int16_t rowY = startY + i * lineHeight;
-    textRenderer.setCursor(centerX, rowY);
-    textRenderer.print(displayName);
+  int16_t x1, y1;
+  uint16_t w, h;
+  textRenderer.getTextBounds(displayName.c_str(), 0, 0, &x1, &y1, &w, &h);
+  int16_t centerX = (480 - (int)w) / 2;
+  int16_t rowY = startY + index * lineHeight;
+  textRenderer.resetDirtyRegion();
+  textRenderer.setCursor(centerX, rowY);
+  textRenderer.print(displayName);
+  return textRenderer.getDirtyRegion();
+}
+
+void SettingsScreen::updateRows(int rowA, int rowB) {
+  // Redraw only the given rows (selection moved or a value changed) and send
+  // just that band. The status header is left as is until the next full render.
+  if (!rowsRendered || !display.beginRegionUpdate()) {
+    show();
+    return;
+  }
+
+  textRenderer.setTextColor(TextRenderer::COLOR_BLACK);
+  textRenderer.setFrameBuffer(display.getFrameBuffer());
+  textRenderer.setBitmapType(TextRenderer::BITMAP_BW);
+  textRenderer.setFont(getMainFont());
+
+  DirtyRegion cleared = rowRegions[rowA];
+  cleared.unite(rowRegions[rowB]);
+  display.clearRegion(cleared);
+
+  // Also redraw neighbours whose glyphs reach into the cleared area
+  DirtyRegion dirty = cleared;
+  for (int i = 0; i < SETTINGS_COUNT; ++i) {
+    if (i == rowA || i == rowB || rowRegions[i].intersects(cleared)) {
+      rowRegions[i] = renderSettingRow(i);
+      dirty.unite(rowRegions[i]);
+    }
   }
+  display.displayRegion(dirty, EInkDisplay::FAST_REFRESH);
 }
 
 void SettingsScreen::selectNext() {
+  const int oldIndex = selectedIndex;
   selectedIndex++;
   if (selectedIndex >= SETTINGS_COUNT)
     selectedIndex = 0;
-  show();
+  updateRows(oldIndex, selectedIndex);
 }
 
 void SettingsScreen::selectPrev() {
+  const int oldIndex = selectedIndex;
   selectedIndex--;
   if (selectedIndex < 0)
     selectedIndex = SETTINGS_COUNT - 1;
-  show();
+  updateRows(oldIndex, selectedIndex);
 }
 
 void SettingsScreen::toggleCurrentSetting() {
@@ -141,9 +179,29 @@ void SettingsScreen::toggleCurrentSetting() {
       showChapterNumbersIndex = 1 - showChapterNumbersIndex;
       break;
     case 6:  // Font Family
-      fontFamilyIndex++;
-      if (fontFamilyIndex >= 2)
-        fontFamilyIndex = 0;
+      // NotoSans, Bookerly, then each family found on the SD card
+      if (fontFamilyIndex < 2) {
+        fontFamilyIndex++;
+        if (fontFamilyIndex == 2) {
+          std::vector<String> sdFamilies = listSdFontFamilies();
+          if (sdFamilies.empty()) {
+            fontFamilyIndex = 0;
+          } else {
+            sdFontFamily = sdFamilies[0];
+          }
+        }
+      } else {
+        std::vector<String> sdFamilies = listSdFontFamilies();
+        size_t next = 0;
+        while (next < sdFamilies.size() && sdFamilies[next] != sdFontFamily) {
+          next++;
+        }
+        if (next + 1 < sdFamilies.size()) {
+          sdFontFamily = sdFamilies[next + 1];
+        } else {
+          fontFamilyIndex = 0;
+        }
+      }
       applyFontSettings();
       break;
     case 7:  // Font Size
@@ -155,7 +213,10 @@ void SettingsScreen::toggleCurrentSetting() {
     case 8:  // UI Font Size
       uiFontSizeIndex = 1 - uiFontSizeIndex;
       applyUIFontSettings();
-      break;
+      // Every row changes size
+      saveSettings();
+      show();
+      return;
     case 9:  // Sleep Screen
       sleepScreenModeIndex = 1 - sleepScreenModeIndex;
       break;
@@ -187,7 +248,7 @@ void SettingsScreen::toggleCurrentSetting() {
       break;
   }
   saveSettings();
-  show();
+  updateRows(selectedIndex, selectedIndex);
 }
 
 void SettingsScreen::loadSettings() {
@@ -238,11 +299,12 @@ void SettingsScreen::loadSettings() {
     showChapterNumbersIndex = showChapters;
   }
 
-  // Load font family (0=NotoSans, 1=Bookerly)
+  // Load font family (0=NotoSans, 1=Bookerly, 2=SD font)
   int fontFamily = 1;
   if (s.getInt(String("settings.fontFamily"), fontFamily)) {
     fontFamilyIndex = fontFamily;
   }
+  sdFontFamily = s.getString(String("settings.sdFontFamily"));
 
   // Load font size (0=Small, 1=Medium, 2=Large)
   int fontSize = 0;
@@ -300,6 +362,7 @@ void SettingsScreen::saveSettings() {
   s.setInt(String("settings.alignment"), alignmentIndex);
   s.setInt(String("settings.showChapterNumbers"), showChapterNumbersIndex);
   s.setInt(String("settings.fontFamily"), fontFamilyIndex);
+  s.setString(String("settings.sdFontFamily"), sdFontFamily);
   s.setInt(String("settings.fontSize"), fontSizeIndex);
   s.setInt(String("settings.uiFontSize"), uiFontSizeIndex);
   s.setInt(String("settings.sleepScreenMode"), sleepScreenModeIndex);
@@ -380,6 +443,8 @@ String SettingsScreen::getSettingValue(int index) {
           return "NotoSans";
         case 1:
           return "Bookerly";
+        case 2:
+          return sdFontFamily;
         default:
           return "Unknown";
       }
@@ -469,6 +534,15 @@ void SettingsScreen::applyFontSettings() {
         targetFamily = &bookerly30Family;
         break;
     }
+  } else if (fontFamilyIndex == 2) {  // SD font; its size is part of the family
+    targetFamily = loadSdFontFamily(sdFontFamily);
+    if (!targetFamily) {
+      Serial.printf("SettingsScreen: SD font %s unavailable, using Bookerly\n", sdFontFamily.c_str());
+      fontFamilyIndex = 1;
+      targetFamily = &bookerly26Family;
+    }
+    // The SD fonts reuse their structs, so cached widths may be stale
+    textRenderer.invalidateWidthCache();
   }
 
   if (targetFamily) {
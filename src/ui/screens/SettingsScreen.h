@@ -33,9 +33,11 @@ class SettingsScreen : public Screen {
   int paragraphSpacingIndex = 2;
   int alignmentIndex = 3;
   int showChapterNumbersIndex = 4;
-  int fontFamilyIndex = 5;  // 0=NotoSans, 1=Bookerly
+  int fontFamilyIndex = 5;  // 0=NotoSans, 1=Bookerly, 2=SD font (sdFontFamily)
   int fontSizeIndex = 6;    // 0=Small(26), 1=Medium(28), 2=Large(30)
   int uiFontSizeIndex = 7;  // 0=Small(14), 1=Large(28)
+  // Family loaded from SD_FONT_DIR when fontFamilyIndex is 2
+  String sdFontFamily;
   // Sleep screen mode: 0=Book Cover (default), 1=SD Random
   int sleepScreenModeIndex = 0;
 
@@ -50,6 +52,10 @@ class SettingsScreen : public Screen {
 
   int clearCacheStatus = -1; // -1=idle, 0=fail, 1=ok
 
+  // Panel regions of the rows on screen (valid once rowsRendered is set)
+  DirtyRegion rowRegions[SETTINGS_COUNT];
+  bool rowsRendered = false;
+
   // Available values for each setting
   static constexpr int marginValues[] = {5, 10, 15, 20, 25, 30};
   static constexpr int marginValuesCount = 6;
@@ -61,6 +67,10 @@ class SettingsScreen : public Screen {
   // showChapterNumbers: 0=OFF, 1=ON
 
   void renderSettings();
+  // Draw one settings row; returns the panel region it covers
+  DirtyRegion renderSettingRow(int index);
+  // Redraw rows `rowA` and `rowB` with a region-limited update
+  void updateRows(int rowA, int rowB);
   void selectNext();
   void selectPrev();
   void toggleCurrentSetting();
@@ -139,6 +139,16 @@ static int16_t getFontMaxBottom_tv(const SimpleGFXfont* font) {
   return maxBottom;
 }
 
+static bool anyButtonDown_tv(void* context) {
+  Buttons* buttons = static_cast<Buttons*>(context);
+  for (uint8_t i = Buttons::BACK; i <= Buttons::POWER; ++i) {
+    if (buttons->isDown(i)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 static constexpr int16_t kFooterPaddingBottom_tv = 8;
 static constexpr int16_t kFooterGapAbove_tv = 14;
 
@@ -178,7 +188,17 @@ void TextViewerScreen::closeDocument() {
   loadedText = String("");
   currentFilePath = String("");
   noDocumentMessage = String("");
+  backgroundPaginator.cancel();
+  backgroundPaginator.dropProvider();
+  paginationIndex.clear();
+  layoutStrategy->clearLayoutCache();
+  // Patterns loaded from the SD card only stay in RAM while their book is open
+  if (layoutConfig.language == Language::PATTERN_FILE) {
+    layoutConfig.language = Language::ENGLISH;
+    layoutStrategy->setLanguage(Language::ENGLISH);
+  }
   epub_release_shared_buffers();
+  display.releaseGrayscalePlanes();
 }
 
 void TextViewerScreen::begin() {
@@ -233,6 +253,11 @@ void TextViewerScreen::loadSettingsFromFile() {
       baseFontHeight = 30;
       break;
   }
+  // SD fonts come in one size, recorded in the font file
+  const FontFamily* family = getCurrentFontFamily();
+  if (fontFamily == 2 && family && family->regular && family->regular->size > 0) {
+    baseFontHeight = family->regular->size;
+  }
 
   // Line height = font height + additional spacing from settings
   int lineSpacing = 4;  // Default spacing
@@ -317,6 +342,17 @@ void TextViewerScreen::activate() {
   }
 }
 
+void TextViewerScreen::deactivate() {
+  reclaimProvider();
+  display.releaseGrayscalePlanes();
+}
+
+void TextViewerScreen::reclaimProvider() {
+  if (provider) {
+    backgroundPaginator.restoreProvider(*provider);
+  }
+}
+
 int TextViewerScreen::getChapterCount() const {
   if (!provider) {
     return 0;
@@ -360,6 +396,11 @@ void TextViewerScreen::handleButtons(Buttons& buttons) {
   // Long press threshold in milliseconds
   const unsigned long LONG_PRESS_MS = 500;
 
+  // The background paginator may have the provider in another chapter
+  if (anyButtonDown_tv(&buttons)) {
+    reclaimProvider();
+  }
+
   if (buttons.isPressed(Buttons::BACK)) {
     // Save current position for the opened book (if any) before leaving
     savePositionToFile();
@@ -387,7 +428,11 @@ void TextViewerScreen::handleButtons(Buttons& buttons) {
     } else {
       nextPage();
     }
+  } else {
+    runBackgroundPagination(buttons);
+    return;
   }
+  lastInteractionMs = millis();
 
   // if (buttons.isPressed(Buttons::VOLUME_UP)) {
   //   // switch through alignments (cycle through enum values safely)
@@ -398,6 +443,7 @@ void TextViewerScreen::handleButtons(Buttons& buttons) {
 }
 
 void TextViewerScreen::show() {
+  reclaimProvider();
   showPage();
 }
 
@@ -453,6 +499,8 @@ void TextViewerScreen::showPage() {
     return;
   }
 
+  syncPaginationIndex();
+
   display.clearScreen(0xFF);
   textRenderer.setTextColor(TextRenderer::COLOR_BLACK);
   textRenderer.setFontFamily(getCurrentFontFamily());
@@ -469,16 +517,40 @@ void TextViewerScreen::showPage() {
   Serial.print("Layout time: ");
   Serial.print(layoutEnd - layoutStart);
   Serial.println(" ms");
+  {
+    const uint32_t hits = textRenderer.getWidthCacheHits();
+    const uint32_t total = hits + textRenderer.getWidthCacheMisses();
+    Serial.printf("Width cache: %lu/%lu hits (%lu%%)\n", (unsigned long)hits, (unsigned long)total,
+                  (unsigned long)(total ? (hits * 100u) / total : 0));
+  }
+  if (HyphenationStrategy* hyphenation = layoutStrategy->getHyphenationStrategy()) {
+    const uint32_t hits = hyphenation->getMemoHits();
+    const uint32_t total = hits + hyphenation->getMemoMisses();
+    Serial.printf("Hyphenation memo: %lu/%lu hits (%lu%%)\n", (unsigned long)hits, (unsigned long)total,
+                  (unsigned long)(total ? (hits * 100u) / total : 0));
+  }
 
   pageStartIndex = provider->getCurrentIndex();
   pageEndIndex = layout.endPosition;
 
+  const bool isChapterEnd = provider->getChapterPercentage(pageEndIndex) >= 10000;
+  paginationIndex.recordPage(provider->getCurrentChapter(), pageStartIndex, pageEndIndex, isChapterEnd);
+
   unsigned long renderStart = millis();
 
-  // Render to BW buffer
+  uint8_t* grayLsb = nullptr;
+  uint8_t* grayMsb = nullptr;
+  const bool renderGray = display.supportsGrayscale() && display.getGrayscalePlanes(&grayLsb, &grayMsb);
+
+  // Render to BW buffer, and with grayscale to both gray planes in the same
+  // pass so each glyph is only decoded once. Without room for the planes the
+  // gray parts are rendered per plane after the BW refresh.
   textRenderer.setFrameBuffer(display.getFrameBuffer());
-  textRenderer.setBitmapType(TextRenderer::BITMAP_BW);
+  textRenderer.setGrayscalePlanes(grayLsb, grayMsb);
+  textRenderer.setBitmapType(renderGray ? TextRenderer::BITMAP_ALL_PLANES : TextRenderer::BITMAP_BW);
   layoutStrategy->renderPage(layout, textRenderer, layoutConfig);
+  textRenderer.setBitmapType(TextRenderer::BITMAP_BW);
+  textRenderer.setGrayscalePlanes(nullptr, nullptr);
 
   unsigned long renderEnd = millis();
 
@@ -498,7 +570,7 @@ void TextViewerScreen::showPage() {
     // Use book-wide percentage for display
     // If at end of chapter and it's the last chapter, show 100%
     uint32_t pagePercentage = provider->getPercentage();
-    if (provider->getChapterPercentage(pageEndIndex) >= 10000) {
+    if (isChapterEnd) {
       // At end of current chapter - check if it's the last chapter
       if (!provider->hasChapters() || provider->getCurrentChapter() >= provider->getChapterCount() - 1) {
         pagePercentage = 10000;
@@ -532,6 +604,21 @@ void TextViewerScreen::showPage() {
     }
     indicator += String(pagePercentage / 100) + "%";
 
+    // Real page numbers once the pagination index covers this page: book-wide
+    // when every chapter is paginated, otherwise within the current chapter.
+    {
+      const int chapter = provider->getCurrentChapter();
+      const int bookPage = paginationIndex.getBookPageNumber(chapter, pageStartIndex);
+      const int bookTotal = paginationIndex.getTotalPageCount();
+      const int chapterPage = paginationIndex.findPage(chapter, pageStartIndex);
+      const int chapterTotal = paginationIndex.getChapterPageCount(chapter);
+      if (bookPage >= 0 && bookTotal > 0) {
+        indicator += " - Page " + String(bookPage + 1) + " of " + String(bookTotal);
+      } else if (chapterPage >= 0 && chapterTotal > 0) {
+        indicator += " - Page " + String(chapterPage + 1) + " of " + String(chapterTotal);
+      }
+    }
+
     int16_t x1, y1;
     uint16_t w, h;
     textRenderer.getTextBounds(indicator.c_str(), 0, 0, &x1, &y1, &w, &h);
@@ -542,13 +629,15 @@ void TextViewerScreen::showPage() {
     textRenderer.print(indicator);
   }
 
-  // display bw parts
-  const bool doCondition = (kConditionEvery > 0) && (pageRenderCounter > 0) && ((pageRenderCounter % kConditionEvery) == 0);
-  display.displayBuffer(doCondition ? EInkDisplay::FULL_REFRESH : EInkDisplay::FAST_REFRESH);
+  // display bw parts; the display's ghosting budget decides when a full
+  // refresh is due
+  display.displayBuffer(EInkDisplay::AUTO_REFRESH);
 
-  if (!doCondition && display.supportsGrayscale()) {
-    // grayscale rendering
-    {
+  // Conditioning (full) refreshes skip the grayscale pass
+  if (display.supportsGrayscale() && display.getLastRefreshMode() != EInkDisplay::FULL_REFRESH) {
+    if (renderGray) {
+      display.copyGrayscaleBuffers(grayLsb, grayMsb);
+    } else {
       textRenderer.setTextColor(TextRenderer::COLOR_BLACK);
       textRenderer.setFontFamily(getCurrentFontFamily());
       textRenderer.setFontStyle(FontStyle::REGULAR);
@@ -566,13 +655,13 @@ void TextViewerScreen::showPage() {
       textRenderer.setBitmapType(TextRenderer::BITMAP_GRAY_MSB);
       layoutStrategy->renderPage(layout, textRenderer, layoutConfig);
       display.copyGrayscaleMsbBuffers(display.getFrameBuffer());
-
-      // display grayscale part
-      display.displayGrayBuffer();
+      textRenderer.setBitmapType(TextRenderer::BITMAP_BW);
     }
+    // display grayscale part
+    display.displayGrayBuffer();
   }
 
-  pageRenderCounter++;
+  lastInteractionMs = millis();
 }
 
 void TextViewerScreen::nextPage() {
@@ -609,6 +698,16 @@ void TextViewerScreen::prevPage() {
       if (currentChapter > 0) {
         // Go to previous chapter and position at the end
         provider->setChapter(currentChapter - 1);
+
+        // The last page of a paginated chapter is known directly
+        const int lastStart = paginationIndex.getLastPageStart(currentChapter - 1);
+        if (lastStart >= 0) {
+          pageStartIndex = lastStart;
+          provider->setPosition(pageStartIndex);
+          showPage();
+          return;
+        }
+
         // Go to end of previous chapter by setting position to a large value
         // then use getPreviousPageStart to find the last page
         provider->setPosition(0x7FFFFFFF);  // Seek to end
@@ -623,8 +722,15 @@ void TextViewerScreen::prevPage() {
 
   textRenderer.setFontFamily(getCurrentFontFamily());
 
-  // Find where the previous page starts
-  pageStartIndex = layoutStrategy->getPreviousPageStart(*provider, textRenderer, layoutConfig, pageStartIndex);
+  // Find where the previous page starts: O(1) from the pagination index when
+  // this page is part of it, otherwise by scanning backwards.
+  syncPaginationIndex();
+  const int indexedStart = paginationIndex.getPreviousPageStart(provider->getCurrentChapter(), pageStartIndex);
+  if (indexedStart >= 0) {
+    pageStartIndex = indexedStart;
+  } else {
+    pageStartIndex = layoutStrategy->getPreviousPageStart(*provider, textRenderer, layoutConfig, pageStartIndex);
+  }
 
   // Set currentIndex to the start of the previous page
   provider->setPosition(pageStartIndex);
@@ -693,8 +799,12 @@ void TextViewerScreen::loadTextFromString(const String& content) {
   // Preserve the passed-in content on the object so the provider has
   // stable storage for its internal copy/operations.
   delete provider;
+  backgroundPaginator.cancel();
+  backgroundPaginator.dropProvider();
+  savePaginationIndex();
+  paginationIndex.clear();
+  layoutStrategy->clearLayoutCache();
   loadedText = content;
-  pageRenderCounter = 0;
   if (loadedText.length() > 0) {
     provider = new StringWordProvider(loadedText);
   } else {
@@ -721,8 +831,14 @@ void TextViewerScreen::openFile(const String& sdPath) {
   delete provider;
   provider = nullptr;
   noDocumentMessage = String("");
+  // Flush the previous book's index before it is replaced
+  backgroundPaginator.cancel();
+  backgroundPaginator.dropProvider();
+  savePaginationIndex();
+  paginationIndex.clear();
+  layoutStrategy->clearLayoutCache();
+  display.releaseGrayscalePlanes();
   currentFilePath = sdPath;
-  pageRenderCounter = 0;
 
   // Load the saved position from SD if present
   loadPositionFromFile();
@@ -785,10 +901,16 @@ void TextViewerScreen::openFile(const String& sdPath) {
     // For EPUB files, get language from the EPUB metadata
     EpubWordProvider* epubProvider = static_cast<EpubWordProvider*>(provider);
     Language epubLanguage = epubProvider->getLanguage();
-    layoutStrategy->setLanguage(epubLanguage);
+    layoutConfig.language = epubLanguage;
+    if (epubLanguage == Language::PATTERN_FILE) {
+      layoutStrategy->setHyphenationPatterns(epubProvider->getHyphenationPatternPath().c_str());
+    } else {
+      layoutStrategy->setLanguage(epubLanguage);
+    }
     Serial.printf("Set hyphenation language to %d for EPUB\n", static_cast<int>(epubLanguage));
   } else {
     // For non-EPUB files, use default English hyphenation
+    layoutConfig.language = Language::ENGLISH;
     layoutStrategy->setLanguage(Language::ENGLISH);
   }
 
@@ -822,6 +944,83 @@ void TextViewerScreen::savePositionToFile() {
   if (!sdManager.writeFile(posPath.c_str(), content)) {
     Serial.printf("Failed to save position for %s\n", currentFilePath.c_str());
   }
+  savePaginationIndex();
+}
+
+void TextViewerScreen::syncPaginationIndex() {
+  if (!provider) {
+    return;
+  }
+  const FontFamily* family = getCurrentFontFamily();
+  const uint32_t fingerprint = PaginationIndex::computeFingerprint(family ? family->familyName : nullptr, layoutConfig,
+                                                                   layoutStrategy->getType());
+  const int chapterCount = getChapterCount();
+  if (fingerprint == paginationIndex.getFingerprint() && paginationIndex.getChapterCount() == chapterCount) {
+    return;
+  }
+
+  // Layout changed (or a new book was opened): keep what we have for the old
+  // layout, then try the stored index for the new one.
+  backgroundPaginator.cancel();
+  savePaginationIndex();
+  if (currentFilePath.length() > 0) {
+    String pagPath = currentFilePath + String(".pag");
+    sdManager.ensureSpiBusIdle();
+    if (SD.exists(pagPath.c_str())) {
+      String data = sdManager.readFile(pagPath.c_str());
+      if (paginationIndex.deserialize(data, fingerprint) && paginationIndex.getChapterCount() == chapterCount) {
+        Serial.printf("Loaded pagination index (%d chapters)\n", chapterCount);
+        return;
+      }
+    }
+  }
+  paginationIndex.clear();
+  paginationIndex.reset(fingerprint, chapterCount);
+}
+
+void TextViewerScreen::runBackgroundPagination(Buttons& buttons) {
+  if (!provider || millis() - lastInteractionMs < kPaginateIdleDelayMs) {
+    return;
+  }
+
+  syncPaginationIndex();
+  if (paginationIndex.isBookComplete()) {
+    return;
+  }
+  if (!backgroundPaginator.isRunning() || backgroundPaginator.getFingerprint() != paginationIndex.getFingerprint()) {
+    // Current chapter first so its page numbers show up soonest
+    backgroundPaginator.start(paginationIndex.getFingerprint(), provider->getCurrentChapter());
+  }
+
+  textRenderer.setFontFamily(getCurrentFontFamily());
+  textRenderer.setFontStyle(FontStyle::REGULAR);
+
+  const uint32_t chaptersBefore = backgroundPaginator.getStats().chapters;
+  backgroundPaginator.run(*provider, *layoutStrategy, textRenderer, layoutConfig, paginationIndex,
+                          kPaginatePagesPerTick, anyButtonDown_tv, &buttons);
+
+  // Persist at chapter boundaries so progress survives a power loss
+  if (backgroundPaginator.getStats().chapters != chaptersBefore || !backgroundPaginator.isRunning()) {
+    savePaginationIndex();
+  }
+  if (!backgroundPaginator.isRunning()) {
+    reclaimProvider();
+  }
+  if (!backgroundPaginator.isRunning() && paginationIndex.isBookComplete()) {
+    const BackgroundPaginator::Stats& st = backgroundPaginator.getStats();
+    Serial.printf("Background pagination done: %lu pages in %lu ms\n", (unsigned long)st.pages, st.elapsedMs);
+  }
+}
+
+void TextViewerScreen::savePaginationIndex() {
+  if (currentFilePath.length() == 0 || !paginationIndex.isDirty())
+    return;
+  String pagPath = currentFilePath + String(".pag");
+  if (sdManager.writeFile(pagPath.c_str(), paginationIndex.serialize())) {
+    paginationIndex.markClean();
+  } else {
+    Serial.printf("Failed to save pagination index for %s\n", currentFilePath.c_str());
+  }
 }
 
 void TextViewerScreen::loadPositionFromFile() {
@@ -873,6 +1072,7 @@ void TextViewerScreen::loadPositionFromFile() {
 
 void TextViewerScreen::shutdown() {
   // Persist the current position for the opened file (if any)
+  reclaimProvider();
   savePositionToFile();
   saveSettingsToFile();
 }
@@ -5,7 +5,9 @@
 #include "../../core/EInkDisplay.h"
 #include "../../core/SDCardManager.h"
 #include "../../rendering/TextRenderer.h"
+#include "../../text/layout/BackgroundPaginator.h"
 #include "../../text/layout/LayoutStrategy.h"
+#include "../../text/layout/PaginationIndex.h"
 #include "../UIManager.h"
 #include "Screen.h"
 
@@ -16,6 +18,8 @@ class TextViewerScreen : public Screen {
 
   void begin() override;
   void activate() override;
+  // Frees the grayscale planes while other screens are shown
+  void deactivate() override;
 
   // Load content from SD by path and display it
   void openFile(const String& sdPath);
@@ -53,9 +57,6 @@ class TextViewerScreen : public Screen {
   SDCardManager& sdManager;
   UIManager& uiManager;
 
-  uint32_t pageRenderCounter = 0;
-  static constexpr uint32_t kConditionEvery = 8;
-
   WordProvider* provider = nullptr;
   // Keep the loaded text alive for the lifetime of the provider
   String loadedText;
@@ -71,9 +72,26 @@ class TextViewerScreen : public Screen {
 
   String noDocumentMessage;
 
+  // Page start offsets for the open book under the current layout fingerprint.
+  // Persisted as `<book>.pag` next to the `.pos` file.
+  PaginationIndex paginationIndex;
+  // Fills `paginationIndex` for the rest of the book while the reader is idle
+  BackgroundPaginator backgroundPaginator;
+  unsigned long lastInteractionMs = 0;
+  static constexpr unsigned long kPaginateIdleDelayMs = 1500;
+  static constexpr int kPaginatePagesPerTick = 4;
+
   // Persist/load current reading position for `currentFilePath`
   void savePositionToFile();
   void loadPositionFromFile();
+  // Make sure `paginationIndex` matches the current font/layout, loading the
+  // stored index from SD when the fingerprint changes.
+  void syncPaginationIndex();
+  void savePaginationIndex();
+  // Lay out a few more pages in the background; returns at once on a button press.
+  void runBackgroundPagination(class Buttons& buttons);
+  // Take the provider back from the background paginator before using it
+  void reclaimProvider();
   // Persist/load viewer settings (last opened file path + layout config)
   void saveSettingsToFile();
   void loadSettingsFromFile();
@@ -7,6 +7,11 @@
 #include "../../core/Buttons.h"
 #include "../../core/Settings.h"
 
+// Pages in RAM: the current one and the next (1-bit or displayed plane of a
+// 2-bit 480x800 page), read ahead in steps while the panel refreshes
+static constexpr size_t kPageCacheBytes = 96 * 1024;
+static constexpr size_t kReadAheadStep = 4096;
+
 static uint32_t fnv1a32(const char* s) {
   uint32_t h = 2166136261u;
   if (!s) {
@@ -111,7 +116,11 @@ static inline bool getFrameBufferPixelBw(const uint8_t* fb, int fx, int fy) {
 }
 
 XtcViewerScreen::XtcViewerScreen(EInkDisplay& display, TextRenderer& renderer, SDCardManager& sdManager, UIManager& uiManager)
-    : display(display), textRenderer(renderer), sdManager(sdManager), uiManager(uiManager) {}
+    : display(display),
+      textRenderer(renderer),
+      sdManager(sdManager),
+      uiManager(uiManager),
+      pageCache(xtc, kPageCacheBytes) {}
 
 void XtcViewerScreen::begin() {
   loadSettingsFromFile();
@@ -122,9 +131,16 @@ void XtcViewerScreen::activate() {
     String p = pendingOpenPath;
     pendingOpenPath = String("");
     openFile(p);
+  } else if (valid && pageCache.getSlotCount() == 0) {
+    resetPageCache();
   }
 }
 
+void XtcViewerScreen::deactivate() {
+  pageCache.release();
+  readAheadPending = false;
+}
+
 void XtcViewerScreen::show() {
   renderPage();
 }
@@ -143,6 +159,10 @@ void XtcViewerScreen::handleButtons(Buttons& buttons) {
     nextPage();
   } else if (buttons.isPressed(Buttons::RIGHT)) {
     prevPage();
+  } else if (readAheadPending) {
+    // Finish what the last refresh left to read, a step per loop tick
+    sdManager.ensureSpiBusIdle();
+    readAheadPending = pageCache.readAhead(kReadAheadStep);
   }
 }
 
@@ -169,6 +189,8 @@ void XtcViewerScreen::openFile(const String& sdPath) {
     return;
   }
 
+  resetPageCache();
+
   const uint32_t coverKey = fnv1a32(sdPath.c_str());
   (void)sdManager.ensureDirectoryExists("/microreader/xtc_covers");
   String coverPath = String("/microreader/xtc_covers/") + String(coverKey, HEX) + String(".bmp");
@@ -204,12 +226,26 @@ void XtcViewerScreen::openFile(const String& sdPath) {
 }
 
 void XtcViewerScreen::closeDocument() {
+  pageCache.release();
+  readAheadPending = false;
   xtc.close();
   valid = false;
   currentPage = 0;
   currentFilePath = String("");
 }
 
+void XtcViewerScreen::resetPageCache() {
+  // Cache what renderPage draws: the 1-bit bitmap, or the second plane of a
+  // 2-bit page (see renderPage)
+  const size_t w = xtc.getWidth();
+  const size_t h = xtc.getHeight();
+  if (xtc.getBitDepth() == 2) {
+    pageCache.reset((uint32_t)((w * h + 7) / 8), ((h + 7) / 8) * w);
+  } else {
+    pageCache.reset(0, ((w + 7) / 8) * h);
+  }
+}
+
 void XtcViewerScreen::renderPage() {
   display.clearScreen(0xFF);
   textRenderer.setFrameBuffer(display.getFrameBuffer());
@@ -228,14 +264,12 @@ void XtcViewerScreen::renderPage() {
   const uint16_t h = xtc.getHeight();
   const uint8_t bd = xtc.getBitDepth();
 
-  uint32_t bitmapOffset = 0;
-  uint16_t pw = 0;
-  uint16_t ph = 0;
-  if (!xtc.getPageBitmapOffset(currentPage, bitmapOffset, pw, ph)) {
+  const uint8_t* page = pageCache.getPage(currentPage);
+  if (!page) {
     textRenderer.setTextColor(TextRenderer::COLOR_BLACK);
     textRenderer.setFont(getMainFont());
     textRenderer.setCursor(20, 200);
-    textRenderer.print("Page load error");
+    textRenderer.print(pageCache.getSlotCount() == 0 ? "Memory error" : "Page load error");
     display.displayBuffer(EInkDisplay::FAST_REFRESH);
     return;
   }
@@ -243,43 +277,14 @@ void XtcViewerScreen::renderPage() {
   uint8_t* fb = display.getFrameBuffer();
 
   if (bd == 2) {
-
+    // Two planes of columns, right to left. The panel is black and white:
+    // levels 1 (dark gray) and 3 (black) are drawn black, 0 and 2 white, i.e.
+    // exactly the pixels set in the second plane, the only one cached.
     const size_t colBytes = (h + 7) / 8;
-    const size_t planeSize = (static_cast<size_t>(w) * h + 7) / 8;
-    uint8_t* col1 = (uint8_t*)malloc(colBytes);
-    uint8_t* col2 = (uint8_t*)malloc(colBytes);
-    if (!col1 || !col2) {
-      if (col1) free(col1);
-      if (col2) free(col2);
-      textRenderer.setTextColor(TextRenderer::COLOR_BLACK);
-      textRenderer.setFont(getMainFont());
-      textRenderer.setCursor(20, 200);
-      textRenderer.print("Memory error");
-      display.displayBuffer(EInkDisplay::FAST_REFRESH);
-      return;
-    }
-
     for (uint16_t x = 0; x < w; ++x) {
-      const size_t colIndex = (size_t)w - 1 - x;
-      const uint32_t off1 = bitmapOffset + (uint32_t)(colIndex * colBytes);
-      const uint32_t off2 = bitmapOffset + (uint32_t)planeSize + (uint32_t)(colIndex * colBytes);
-      if (xtc.readAt(off1, col1, colBytes) != colBytes || xtc.readAt(off2, col2, colBytes) != colBytes) {
-        continue;
-      }
-
+      const uint8_t* col = page + ((size_t)w - 1 - x) * colBytes;
       for (uint16_t y = 0; y < h; ++y) {
-        const size_t byteInCol = y / 8;
-        const size_t bitInByte = 7 - (y % 8);
-        const uint8_t bit1 = (col1[byteInCol] >> bitInByte) & 1;
-        const uint8_t bit2 = (col2[byteInCol] >> bitInByte) & 1;
-        const uint8_t pv = (bit1 << 1) | bit2;
-
-        uint8_t lum = 255;
-        if (pv == 1) lum = 96;
-        else if (pv == 2) lum = 192;
-        else if (pv == 3) lum = 0;
-
-        const bool black = (lum < 128);
+        const bool black = (col[y / 8] >> (7 - (y % 8))) & 1;
         const int fx = (int)y;
         const int fy = 479 - (int)x;
         if (fx < 0 || fx >= 800 || fy < 0 || fy >= 480) {
@@ -295,26 +300,10 @@ void XtcViewerScreen::renderPage() {
       }
     }
 
-    free(col1);
-    free(col2);
-
   } else {
     const size_t rowBytes = (w + 7) / 8;
-    uint8_t* row = (uint8_t*)malloc(rowBytes);
-    if (!row) {
-      textRenderer.setTextColor(TextRenderer::COLOR_BLACK);
-      textRenderer.setFont(getMainFont());
-      textRenderer.setCursor(20, 200);
-      textRenderer.print("Memory error");
-      display.displayBuffer(EInkDisplay::FAST_REFRESH);
-      return;
-    }
-
     for (uint16_t y = 0; y < h; ++y) {
-      const uint32_t off = bitmapOffset + (uint32_t)((size_t)y * rowBytes);
-      if (xtc.readAt(off, row, rowBytes) != rowBytes) {
-        continue;
-      }
+      const uint8_t* row = page + (size_t)y * rowBytes;
       for (uint16_t x = 0; x < w; ++x) {
         const size_t byteIdx = x / 8;
         const size_t bitIdx = 7 - (x % 8);
@@ -334,11 +323,21 @@ void XtcViewerScreen::renderPage() {
         }
       }
     }
-
-    free(row);
   }
 
+  // Stream the next page in while this one refreshes; handleButtons reads
+  // whatever is left
+  readAheadPending = true;
+  display.setRefreshWork(readAheadWhileRefreshing, this);
   display.displayBuffer(EInkDisplay::FAST_REFRESH);
+  display.setRefreshWork(nullptr, nullptr);
+}
+
+bool XtcViewerScreen::readAheadWhileRefreshing(void* context) {
+  XtcViewerScreen* screen = static_cast<XtcViewerScreen*>(context);
+  screen->sdManager.ensureSpiBusIdle();
+  screen->readAheadPending = screen->pageCache.readAhead(kReadAheadStep);
+  return screen->readAheadPending;
 }
 
 void XtcViewerScreen::nextPage() {
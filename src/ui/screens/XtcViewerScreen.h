@@ -9,6 +9,7 @@
 #include "../UIManager.h"
 #include "Screen.h"
 #include "../../content/xtc/XtcFile.h"
+#include "../../content/xtc/XtcPageCache.h"
 
 class XtcViewerScreen : public Screen {
  public:
@@ -16,6 +17,8 @@ class XtcViewerScreen : public Screen {
 
   void begin() override;
   void activate() override;
+  // Frees the page cache while other screens are shown
+  void deactivate() override;
   void show() override;
   void handleButtons(Buttons& buttons) override;
   void shutdown() override;
@@ -30,13 +33,17 @@ class XtcViewerScreen : public Screen {
   UIManager& uiManager;
 
   XtcFile xtc;
+  XtcPageCache pageCache;
   bool valid = false;
   uint32_t currentPage = 0;
+  bool readAheadPending = false;
 
   String pendingOpenPath;
   String currentFilePath;
 
+  void resetPageCache();
   void renderPage();
+  static bool readAheadWhileRefreshing(void* context);
   void nextPage();
   void prevPage();
 
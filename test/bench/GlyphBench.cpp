@@ -0,0 +1,124 @@
+/**
+ * GlyphBench.cpp - Glyph Lookup, Measure and Draw Throughput
+ *
+ * Compares the Latin-1 direct glyph index against the binary search
+ * fallback, and times text measurement and drawing through TextRenderer.
+ *
+ * Usage: GlyphBench [iterations]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/EInkDisplay.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+
+namespace {
+
+// Mixed English/German prose with Latin-1 accents and a few punctuation
+// characters outside Latin-1 (dashes, quotes) that take the fallback path.
+const char* kSampleText =
+    "It was the best of times, it was the worst of times, it was the age of wisdom, "
+    "it was the age of foolishness \xE2\x80\x94 \xE2\x80\x9C" "das M\xC3\xA4" "dchen lief \xC3\xBC" "ber die Stra\xC3\x9F" "e\xE2\x80\x9D, "
+    "caf\xC3\xA9, na\xC3\xAFve, r\xC3\xA9sum\xC3\xA9; and so on until the end of the paragraph.";
+
+using Clock = std::chrono::steady_clock;
+
+double nsSince(Clock::time_point start) {
+  return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+std::vector<uint32_t> decodeCodepoints(const char* s) {
+  std::vector<uint32_t> out;
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
+  while (*p) {
+    uint32_t c = *p;
+    int extra = 0;
+    if (c >= 0xF0) {
+      c &= 0x07;
+      extra = 3;
+    } else if (c >= 0xE0) {
+      c &= 0x0F;
+      extra = 2;
+    } else if (c >= 0xC0) {
+      c &= 0x1F;
+      extra = 1;
+    }
+    ++p;
+    for (int i = 0; i < extra && *p; ++i, ++p) {
+      c = (c << 6) | (*p & 0x3F);
+    }
+    out.push_back(c);
+  }
+  return out;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+  renderer.setFontFamily(&bookerly26Family);
+  renderer.setFrameBuffer(display.getFrameBuffer());
+  renderer.setBitmapType(TextRenderer::BITMAP_BW);
+
+  const SimpleGFXfont* font = bookerly26Family.regular;
+  const std::vector<uint32_t> codepoints = decodeCodepoints(kSampleText);
+  const size_t chars = codepoints.size();
+
+  // Glyph lookup: direct index vs binary search
+  volatile int sink = 0;
+  auto t0 = Clock::now();
+  for (int it = 0; it < iterations; ++it) {
+    for (uint32_t cp : codepoints) {
+      sink += findGlyphIndexSearch(font, cp);
+    }
+  }
+  const double searchNs = nsSince(t0) / (double)(iterations * chars);
+
+  t0 = Clock::now();
+  for (int it = 0; it < iterations; ++it) {
+    for (uint32_t cp : codepoints) {
+      sink += findGlyphIndex(font, cp);
+    }
+  }
+  const double indexNs = nsSince(t0) / (double)(iterations * chars);
+
+  // Measure: the whole sample is longer than the word-width cache limit, so
+  // every call walks the glyphs.
+  uint16_t w = 0;
+  t0 = Clock::now();
+  for (int it = 0; it < iterations; ++it) {
+    renderer.getTextBounds(kSampleText, 0, 0, nullptr, nullptr, &w, nullptr);
+    sink += w;
+  }
+  const double measureNs = nsSince(t0) / (double)(iterations * chars);
+
+  // Draw: print the sample across the page
+  t0 = Clock::now();
+  for (int it = 0; it < iterations; ++it) {
+    renderer.setCursor(-(it % 200), 40 + (it % 20) * 36);
+    renderer.print(kSampleText);
+  }
+  const double drawNs = nsSince(t0) / (double)(iterations * chars);
+  (void)sink;
+
+  std::cout << "Font:                 " << bookerly26Family.familyName << " (" << font->glyphCount << " glyphs)\n";
+  std::cout << "Sample:               " << chars << " codepoints x " << iterations << " iterations\n";
+  std::cout << "Lookup binary search: " << searchNs << " ns/char\n";
+  std::cout << "Lookup Latin-1 index: " << indexNs << " ns/char (" << (indexNs > 0 ? searchNs / indexNs : 0)
+            << "x)\n";
+  std::cout << "Measure:              " << measureNs << " ns/char\n";
+  std::cout << "Draw:                 " << drawNs << " ns/char\n";
+  return 0;
+}
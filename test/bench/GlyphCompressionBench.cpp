@@ -0,0 +1,179 @@
+/**
+ * GlyphCompressionBench.cpp - Planar vs Run-Length Coded Glyph Bitmaps
+ *
+ * Encodes every built-in reading font with GlyphRle and reports, per font
+ * and in total, the flash taken by the three planar bitmaps against the
+ * run-length coded stream. For a sample page it reports the font bytes and
+ * 32-byte flash cache lines each drawn glyph touches, and times drawing the
+ * page with both encodings in BW and single-pass grayscale.
+ *
+ * Usage: GlyphCompressionBench [iterations]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "core/EInkDisplay.h"
+#include "rendering/GlyphRle.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+
+namespace {
+
+const char* kSampleText =
+    "It was the best of times, it was the worst of times, it was the age of wisdom, "
+    "it was the age of foolishness, it was the epoch of belief, it was the epoch of incredulity, "
+    "it was the season of Light, it was the season of Darkness.";
+
+// ESP32-C3 flash cache line
+constexpr size_t kCacheLine = 32;
+
+using Clock = std::chrono::steady_clock;
+
+double nsSince(Clock::time_point start) {
+  return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+size_t planarGlyphBytes(const SimpleGFXglyph& g) {
+  return (size_t)((g.width + 7) / 8) * g.height;
+}
+
+// Bytes of one planar bitmap (all glyphs)
+size_t planarPlaneBytes(const SimpleGFXfont* f) {
+  size_t end = 0;
+  for (uint16_t i = 0; i < f->glyphCount; ++i) {
+    const size_t e = f->glyph[i].bitmapOffset + planarGlyphBytes(f->glyph[i]);
+    end = e > end ? e : end;
+  }
+  return end;
+}
+
+size_t linesSpanned(size_t offset, size_t bytes) {
+  return bytes ? (offset + bytes - 1) / kCacheLine - offset / kCacheLine + 1 : 0;
+}
+
+struct RleFont {
+  std::vector<uint8_t> data;
+  std::vector<SimpleGFXglyph> glyphs;
+  std::vector<uint16_t> sizes;  // encoded bytes per glyph
+  SimpleGFXfont font;
+};
+
+void encodeFont(const SimpleGFXfont* src, RleFont& out) {
+  out.glyphs.assign(src->glyph, src->glyph + src->glyphCount);
+  out.sizes.clear();
+  out.data.clear();
+  for (SimpleGFXglyph& g : out.glyphs) {
+    const uint16_t planarOffset = g.bitmapOffset;
+    const size_t n = GlyphRle::encodeGlyph(src->bitmap + planarOffset, src->bitmap_gray_lsb + planarOffset,
+                                           src->bitmap_gray_msb + planarOffset, g.width, g.height, nullptr);
+    g.bitmapOffset = (uint16_t)out.data.size();
+    out.data.resize(out.data.size() + n);
+    GlyphRle::encodeGlyph(src->bitmap + planarOffset, src->bitmap_gray_lsb + planarOffset,
+                          src->bitmap_gray_msb + planarOffset, g.width, g.height, out.data.data() + g.bitmapOffset);
+    out.sizes.push_back((uint16_t)n);
+  }
+  out.font = *src;
+  out.font.bitmap = out.data.data();
+  out.font.bitmap_gray_lsb = nullptr;
+  out.font.bitmap_gray_msb = nullptr;
+  out.font.glyph = out.glyphs.data();
+  out.font.bitmapFormat = FONT_BITMAP_RLE_GRAY;
+}
+
+double timeDraw(TextRenderer& renderer, const SimpleGFXfont* font, TextRenderer::BitmapType type,
+                TextRenderer::Orientation orientation, int iterations, size_t chars) {
+  renderer.setFont(font);
+  renderer.setBitmapType(type);
+  renderer.setOrientation(orientation);
+  auto t0 = Clock::now();
+  for (int it = 0; it < iterations; ++it) {
+    renderer.setCursor(-(it % 100), 40 + (it % 12) * 36);
+    renderer.print(kSampleText);
+  }
+  return nsSince(t0) / (double)(iterations * chars);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? atoi(argv[1]) : 1000;
+
+  FontFamily* families[] = {&bookerly26Family, &bookerly28Family, &bookerly30Family,
+                            &notoSans26Family, &notoSans28Family, &notoSans30Family};
+  const FontStyle styles[] = {FontStyle::REGULAR, FontStyle::BOLD, FontStyle::ITALIC, FontStyle::BOLD_ITALIC};
+  const char* styleNames[] = {"", "Bold", "Italic", "BoldItalic"};
+
+  // Flash footprint
+  size_t totalPlanar = 0;
+  size_t totalRle = 0;
+  printf("Flash (bitmap bytes)        planar      rle   ratio\n");
+  for (FontFamily* family : families) {
+    for (int st = 0; st < 4; ++st) {
+      const SimpleGFXfont* font = getFontVariant(family, styles[st]);
+      RleFont rle;
+      encodeFont(font, rle);
+      const size_t planar = planarPlaneBytes(font) * 3;
+      totalPlanar += planar;
+      totalRle += rle.data.size();
+      const std::string name = std::string(family->familyName) + styleNames[st];
+      printf("  %-24s %8zu %8zu   %4.1f%%\n", name.c_str(), planar, rle.data.size(), 100.0 * rle.data.size() / planar);
+    }
+  }
+  printf("  %-24s %8zu %8zu   %4.1f%%\n", "Total", totalPlanar, totalRle, 100.0 * totalRle / totalPlanar);
+
+  // Font bytes and cache lines touched per drawn glyph on the sample
+  const SimpleGFXfont* font = bookerly26Family.regular;
+  RleFont rle;
+  encodeFont(font, rle);
+  size_t glyphs = 0;
+  size_t planarBytes = 0, planarLines = 0, rleBytes = 0, rleLines = 0;
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(kSampleText);
+  for (; *p; ++p) {
+    const int gi = findGlyphIndex(font, *p);
+    if (gi < 0) {
+      continue;
+    }
+    const SimpleGFXglyph& g = font->glyph[gi];
+    ++glyphs;
+    planarBytes += planarGlyphBytes(g);
+    planarLines += linesSpanned(g.bitmapOffset, planarGlyphBytes(g));
+    rleBytes += rle.sizes[gi];
+    rleLines += linesSpanned(rle.glyphs[gi].bitmapOffset, rle.sizes[gi]);
+  }
+  const size_t chars = glyphs;
+  printf("\nPer glyph (Bookerly26 sample)    bytes   lines\n");
+  printf("  Planar, BW plane               %6.1f  %6.2f\n", (double)planarBytes / glyphs,
+         (double)planarLines / glyphs);
+  printf("  Planar, all three planes       %6.1f  %6.2f\n", 3.0 * planarBytes / glyphs,
+         3.0 * planarLines / glyphs);
+  printf("  RLE (any planes)               %6.1f  %6.2f\n", (double)rleBytes / glyphs, (double)rleLines / glyphs);
+
+  // Render speed
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+  std::vector<uint8_t> lsb(EInkDisplay::BUFFER_SIZE, 0xFF);
+  std::vector<uint8_t> msb(EInkDisplay::BUFFER_SIZE, 0xFF);
+  renderer.setFrameBuffer(display.getFrameBuffer());
+  renderer.setGrayscalePlanes(lsb.data(), msb.data());
+
+  printf("\nDraw (ns/char)                planar      rle\n");
+  const TextRenderer::Orientation orientations[] = {TextRenderer::Portrait, TextRenderer::LandscapeCounterClockwise};
+  const char* orientationNames[] = {"portrait", "landscape"};
+  const TextRenderer::BitmapType types[] = {TextRenderer::BITMAP_BW, TextRenderer::BITMAP_ALL_PLANES};
+  const char* typeNames[] = {"BW", "all planes"};
+  for (int o = 0; o < 2; ++o) {
+    for (int t = 0; t < 2; ++t) {
+      const double planarNs = timeDraw(renderer, font, types[t], orientations[o], iterations, chars);
+      const double rleNs = timeDraw(renderer, &rle.font, types[t], orientations[o], iterations, chars);
+      printf("  %-10s %-16s %8.1f %8.1f\n", orientationNames[o], typeNames[t], planarNs, rleNs);
+    }
+  }
+  return 0;
+}
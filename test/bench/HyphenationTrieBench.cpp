@@ -0,0 +1,103 @@
+/**
+ * HyphenationTrieBench.cpp - Liang Pattern Lookup: Binary Search vs Trie
+ *
+ * Hyphenates every word of test/resources/english_hyphenation_tests.txt with
+ * the sorted pattern table (a binary search per substring) and with the
+ * packed trie (one walk per start position), checks that both give the same
+ * positions and reports ns/word for each. Run from the repository root.
+ *
+ * Usage: HyphenationTrieBench [iterations] [word list]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Liang/hyph-en-us-trie.h"
+#include "Liang/hyph-en-us.h"
+#include "Liang/hyphenation.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double nsSince(Clock::time_point start) {
+  return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+std::vector<std::string> loadWords(const char* path) {
+  std::vector<std::string> words;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const size_t bar = line.find('|');
+    if (bar != std::string::npos && bar > 0) {
+      words.push_back(line.substr(0, bar));
+    }
+  }
+  return words;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? atoi(argv[1]) : 20;
+  const char* path = argc > 2 ? argv[2] : "test/resources/english_hyphenation_tests.txt";
+
+  const std::vector<std::string> words = loadWords(path);
+  if (words.empty()) {
+    std::cerr << "ERROR: no words in " << path << "\n";
+    return 2;
+  }
+
+  // Same positions from both, with no minimum so every candidate is compared
+  size_t a[32];
+  size_t b[32];
+  size_t mismatches = 0;
+  size_t positions = 0;
+  for (const std::string& word : words) {
+    const int na = liang_hyphenate(word.c_str(), 0, 0, '.', a, 32, en_us_patterns);
+    const int nb = liang_hyphenate(word.c_str(), 0, 0, '.', b, 32, en_us_trie);
+    positions += nb;
+    bool same = na == nb;
+    for (int i = 0; same && i < na && i < 32; ++i) {
+      same = a[i] == b[i];
+    }
+    if (!same && mismatches++ < 5) {
+      std::cerr << "MISMATCH: " << word << "\n";
+    }
+  }
+
+  volatile size_t sink = 0;
+  auto t0 = Clock::now();
+  for (int it = 0; it < iterations; ++it) {
+    for (const std::string& word : words) {
+      sink += liang_hyphenate(word.c_str(), 2, 2, '.', a, 32, en_us_patterns);
+    }
+  }
+  const double searchNs = nsSince(t0) / (double)(iterations * words.size());
+
+  t0 = Clock::now();
+  for (int it = 0; it < iterations; ++it) {
+    for (const std::string& word : words) {
+      sink += liang_hyphenate(word.c_str(), 2, 2, '.', b, 32, en_us_trie);
+    }
+  }
+  const double trieNs = nsSince(t0) / (double)(iterations * words.size());
+  (void)sink;
+
+  std::cout << "Words:          " << words.size() << " x " << iterations << " iterations (" << positions
+            << " positions)\n";
+  std::cout << "Patterns:       " << en_us_patterns.count << ", trie nodes " << en_us_trie.nodeCount
+            << ", longest pattern " << (int)en_us_trie.maxPatternLength << "\n";
+  std::cout << "Binary search:  " << searchNs << " ns/word\n";
+  std::cout << "Trie:           " << trieNs << " ns/word (" << (trieNs > 0 ? searchNs / trieNs : 0) << "x)\n";
+  std::cout << "Mismatches:     " << mismatches << "\n";
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+/**
+ * PaginationBench.cpp - Whole-Book Pagination Throughput
+ *
+ * Runs the BackgroundPaginator over every chapter of an EPUB in one batch and
+ * reports pages/sec, so layout throughput regressions show up as numbers.
+ *
+ * Usage: PaginationBench [book.epub] [greedy|kp]
+ * Defaults to the book configured in test_globals.h and Knuth-Plass.
+ */
+
+#include <cstring>
+#include <iostream>
+
+#include "core/EInkDisplay.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_globals.h"
+#include "text/hyphenation/HyphenationStrategy.h"
+#include "text/layout/BackgroundPaginator.h"
+#include "text/layout/PaginationIndex.h"
+
+int main(int argc, char** argv) {
+  const char* bookPath = argc > 1 ? argv[1] : TestGlobals::g_testFilePath;
+  const bool useGreedy = argc > 2 && strcmp(argv[2], "greedy") == 0;
+
+  EpubWordProvider provider(bookPath);
+  if (!provider.isValid()) {
+    std::cerr << "ERROR: Failed to open EPUB file: " << bookPath << "\n";
+    return 2;
+  }
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+  renderer.setFontFamily(&bookerly26Family);
+
+  LayoutStrategy* layout = useGreedy ? static_cast<LayoutStrategy*>(new GreedyLayoutStrategy())
+                                     : static_cast<LayoutStrategy*>(new KnuthPlassLayoutStrategy());
+
+  LayoutStrategy::LayoutConfig config;
+  config.marginLeft = TestConfig::DEFAULT_MARGIN_LEFT;
+  config.marginRight = TestConfig::DEFAULT_MARGIN_RIGHT;
+  config.marginTop = TestConfig::DEFAULT_MARGIN_TOP;
+  config.marginBottom = TestConfig::DEFAULT_MARGIN_BOTTOM;
+  config.lineHeight = TestConfig::DEFAULT_LINE_HEIGHT;
+  config.paragraphSpacing = TestConfig::DEFAULT_LINE_HEIGHT / 2;
+  config.minSpaceWidth = TestConfig::DEFAULT_MIN_SPACE_WIDTH;
+  config.pageWidth = TestConfig::DISPLAY_WIDTH;
+  config.pageHeight = TestConfig::DISPLAY_HEIGHT;
+  config.alignment = LayoutStrategy::ALIGN_LEFT;
+  config.language = provider.getLanguage();
+  layout->setLanguage(config.language);
+
+  // Open every chapter once up front so XHTML conversion is not counted as layout time
+  const int chapterCount = provider.getChapterCount();
+  for (int c = 0; c < chapterCount; ++c) {
+    provider.setChapter(c);
+  }
+  provider.setChapter(0);
+
+  PaginationIndex index;
+  index.reset(PaginationIndex::computeFingerprint(bookerly26Family.familyName, config, layout->getType()),
+              chapterCount);
+
+  BackgroundPaginator paginator;
+  paginator.start(index.getFingerprint(), 0);
+  paginator.run(provider, *layout, renderer, config, index, 0);
+
+  const BackgroundPaginator::Stats& stats = paginator.getStats();
+  const double seconds = stats.elapsedMs / 1000.0;
+  std::cout << "Book:      " << bookPath << "\n";
+  std::cout << "Layout:    " << (useGreedy ? "GreedyLayoutStrategy" : "KnuthPlassLayoutStrategy") << "\n";
+  std::cout << "Chapters:  " << chapterCount << " (" << stats.chapters << " paginated)\n";
+  std::cout << "Pages:     " << stats.pages << " (index total " << index.getTotalPageCount() << ")\n";
+  std::cout << "Time:      " << stats.elapsedMs << " ms\n";
+  std::cout << "Pages/sec: " << (seconds > 0 ? stats.pages / seconds : 0.0) << "\n";
+
+  delete layout;
+  return index.isBookComplete() ? 0 : 1;
+}
@@ -0,0 +1,156 @@
+#include "BenchSuite.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+#include "SD.h"
+
+namespace {
+
+uint64_t g_allocs = 0;
+uint64_t g_allocBytes = 0;
+
+std::string jsonString(const std::string& s) {
+  std::string out = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if ((unsigned char)c < 0x20) {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\u%04x", (unsigned)c);
+      out += buf;
+    } else {
+      out += c;
+    }
+  }
+  return out + "\"";
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  g_allocs++;
+  g_allocBytes += size;
+  if (void* p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  g_allocs++;
+  g_allocBytes += size;
+  return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+  std::free(p);
+}
+
+namespace Bench {
+
+Counters snapshot() {
+  Counters c;
+  c.allocs = g_allocs;
+  c.allocBytes = g_allocBytes;
+  c.bytesRead = g_mockFileBytesRead;
+  return c;
+}
+
+void Suite::run(const std::string& name, const std::string& corpus, const std::function<uint64_t()>& body) {
+  using Clock = std::chrono::steady_clock;
+
+  Result r;
+  r.name = name;
+  r.corpus = corpus;
+  r.repetitions = repetitions_;
+  double bestNs = -1;
+  uint64_t totalOps = 0;
+  const Counters before = snapshot();
+  for (int i = 0; i < repetitions_; i++) {
+    const Clock::time_point start = Clock::now();
+    const uint64_t ops = body();
+    const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    if (ops == 0) {
+      continue;
+    }
+    r.ops = ops;
+    totalOps += ops;
+    if (bestNs < 0 || ns / ops < bestNs) {
+      bestNs = ns / ops;
+    }
+  }
+  const Counters after = snapshot();
+
+  if (totalOps == 0) {
+    r.skipped = "no operations";
+  } else {
+    r.nsPerOp = bestNs;
+    r.allocsPerOp = (double)(after.allocs - before.allocs) / totalOps;
+    r.allocBytesPerOp = (double)(after.allocBytes - before.allocBytes) / totalOps;
+    r.bytesReadPerOp = (double)(after.bytesRead - before.bytesRead) / totalOps;
+  }
+  results_.push_back(r);
+}
+
+void Suite::skip(const std::string& name, const std::string& corpus, const std::string& reason) {
+  Result r;
+  r.name = name;
+  r.corpus = corpus;
+  r.skipped = reason;
+  results_.push_back(r);
+}
+
+void Suite::printTable() const {
+  std::cout << std::left << std::setw(26) << "stage" << std::right << std::setw(8) << "ops" << std::setw(14)
+            << "ns/op" << std::setw(12) << "allocs/op" << std::setw(14) << "alloc B/op" << std::setw(14)
+            << "read B/op" << "\n";
+  for (const Result& r : results_) {
+    std::cout << std::left << std::setw(26) << r.name << std::right;
+    if (!r.skipped.empty()) {
+      std::cout << "  skipped: " << r.skipped << "\n";
+      continue;
+    }
+    std::cout << std::setw(8) << r.ops << std::fixed << std::setprecision(0) << std::setw(14) << r.nsPerOp
+              << std::setprecision(1) << std::setw(12) << r.allocsPerOp << std::setprecision(0) << std::setw(14)
+              << r.allocBytesPerOp << std::setw(14) << r.bytesReadPerOp << "\n";
+    std::cout.unsetf(std::ios::fixed);
+  }
+}
+
+bool Suite::writeJson(const std::string& path) const {
+  std::ofstream out(path);
+  if (!out.is_open()) {
+    return false;
+  }
+  out << "{\n  \"repetitions\": " << repetitions_ << ",\n  \"benchmarks\": [";
+  for (size_t i = 0; i < results_.size(); i++) {
+    const Result& r = results_[i];
+    out << (i ? ",\n" : "\n") << "    {\"name\": " << jsonString(r.name) << ", \"corpus\": " << jsonString(r.corpus);
+    if (!r.skipped.empty()) {
+      out << ", \"skipped\": " << jsonString(r.skipped) << "}";
+      continue;
+    }
+    out << std::fixed << std::setprecision(1) << ", \"ops\": " << r.ops << ", \"ns_per_op\": " << r.nsPerOp
+        << ", \"allocs_per_op\": " << r.allocsPerOp << ", \"alloc_bytes_per_op\": " << r.allocBytesPerOp
+        << ", \"bytes_read_per_op\": " << r.bytesReadPerOp << "}";
+  }
+  out << "\n  ]\n}\n";
+  return out.good();
+}
+
+}  // namespace Bench
@@ -0,0 +1,64 @@
+/**
+ * BenchSuite.h - Stage Timing Harness for microreader_bench
+ *
+ * Runs a stage a few times and reports the best time per operation together
+ * with heap allocations and file bytes read per operation, as a table and as
+ * JSON that can be compared between commits.
+ *
+ * Allocations are counted by replacing the global operator new, so plain
+ * malloc calls are not included. Bytes read are those returned by the SD mock
+ * (MockFile::read), which is the path the device reads cached and extracted
+ * files through; the host EPUB parser reads the archive itself with stdio.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+struct Counters {
+  uint64_t allocs = 0;
+  uint64_t allocBytes = 0;
+  uint64_t bytesRead = 0;
+};
+
+// Totals since the program started
+Counters snapshot();
+
+struct Result {
+  std::string name;
+  std::string corpus;
+  uint64_t ops = 0;  // operations per repetition
+  int repetitions = 0;
+  double nsPerOp = 0;  // best repetition
+  double allocsPerOp = 0;
+  double allocBytesPerOp = 0;
+  double bytesReadPerOp = 0;
+  std::string skipped;  // reason, empty when the stage ran
+};
+
+class Suite {
+ public:
+  explicit Suite(int repetitions) : repetitions_(repetitions > 0 ? repetitions : 1) {}
+
+  // `body` runs the stage once and returns the number of operations it did
+  void run(const std::string& name, const std::string& corpus, const std::function<uint64_t()>& body);
+  void skip(const std::string& name, const std::string& corpus, const std::string& reason);
+
+  void printTable() const;
+  bool writeJson(const std::string& path) const;
+
+  const std::vector<Result>& results() const {
+    return results_;
+  }
+
+ private:
+  int repetitions_;
+  std::vector<Result> results_;
+};
+
+}  // namespace Bench
@@ -0,0 +1,273 @@
+/**
+ * MicroreaderBench.cpp - Reader Pipeline Stage Benchmarks
+ *
+ * Times the stages a page turn goes through on fixed corpora: EPUB open and
+ * chapter conversion, layoutText with both strategies, getPreviousPageStart,
+ * renderPage and hyphenation. Reports ns/op, allocations/op and bytes read/op
+ * and writes the same numbers as JSON for comparing commits.
+ *
+ * The text corpus is prose assembled deterministically from the words of
+ * test/resources/english_hyphenation_tests.txt; the hyphenation corpus is the
+ * word lists themselves. Run from the repository root.
+ *
+ * Usage: microreader_bench [--epub book.epub] [--json out.json] [--reps N]
+ * The EPUB defaults to the book configured in test_globals.h; its stages are
+ * skipped when it cannot be opened.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchSuite.h"
+#include "WString.h"
+#include "core/EInkDisplay.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_globals.h"
+#include "text/hyphenation/HyphenationStrategy.h"
+
+namespace {
+
+const char* kEnglishWords = "test/resources/english_hyphenation_tests.txt";
+const char* kGermanWords = "test/resources/german_hyphenation_tests.txt";
+
+// First column of a hyphenation test file (word|hyphenated|frequency)
+std::vector<std::string> loadWords(const char* path) {
+  std::vector<std::string> words;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const size_t bar = line.find('|');
+    if (bar != std::string::npos && bar > 0) {
+      words.push_back(line.substr(0, bar));
+    }
+  }
+  return words;
+}
+
+// Paragraphs of sentences drawn from `words` with a fixed LCG, so every run
+// and every commit lays out the same text
+std::string makeProse(const std::vector<std::string>& words, int paragraphs) {
+  std::string text;
+  uint32_t state = 12345;
+  auto next = [&state](uint32_t n) {
+    state = state * 1103515245u + 12345u;
+    return (state >> 8) % n;
+  };
+  for (int p = 0; p < paragraphs; p++) {
+    const int sentences = 3 + next(5);
+    for (int s = 0; s < sentences; s++) {
+      const int length = 6 + next(15);
+      for (int w = 0; w < length; w++) {
+        std::string word = words[next((uint32_t)words.size())];
+        if (w == 0 && word[0] >= 'a' && word[0] <= 'z') {
+          word[0] = (char)(word[0] - 'a' + 'A');
+        }
+        if (s > 0 || w > 0) {
+          text += ' ';
+        }
+        text += word;
+      }
+      text += next(4) == 0 ? "," : ".";
+    }
+    text += '\n';
+  }
+  return text;
+}
+
+LayoutStrategy::LayoutConfig makeConfig(Language language) {
+  LayoutStrategy::LayoutConfig config;
+  config.marginLeft = TestConfig::DEFAULT_MARGIN_LEFT;
+  config.marginRight = TestConfig::DEFAULT_MARGIN_RIGHT;
+  config.marginTop = TestConfig::DEFAULT_MARGIN_TOP;
+  config.marginBottom = TestConfig::DEFAULT_MARGIN_BOTTOM;
+  config.lineHeight = TestConfig::DEFAULT_LINE_HEIGHT;
+  config.paragraphSpacing = TestConfig::DEFAULT_LINE_HEIGHT / 2;
+  config.minSpaceWidth = TestConfig::DEFAULT_MIN_SPACE_WIDTH;
+  config.pageWidth = TestConfig::DISPLAY_WIDTH;
+  config.pageHeight = TestConfig::DISPLAY_HEIGHT;
+  config.alignment = LayoutStrategy::ALIGN_LEFT;
+  config.language = language;
+  return config;
+}
+
+std::unique_ptr<LayoutStrategy> makeLayout(bool knuthPlass, Language language) {
+  std::unique_ptr<LayoutStrategy> layout;
+  if (knuthPlass) {
+    layout.reset(new KnuthPlassLayoutStrategy());
+  } else {
+    layout.reset(new GreedyLayoutStrategy());
+  }
+  layout->setLanguage(language);
+  return layout;
+}
+
+// Lays out every page from the provider's start; returns the page starts
+std::vector<int> paginate(WordProvider& provider, LayoutStrategy& layout, TextRenderer& renderer,
+                          const LayoutStrategy::LayoutConfig& config) {
+  std::vector<int> starts;
+  int start = 0;
+  provider.setPosition(0);
+  while (provider.hasNextWord()) {
+    LayoutStrategy::PageLayout page = layout.layoutText(provider, renderer, config);
+    if (page.endPosition <= start) {
+      break;
+    }
+    starts.push_back(start);
+    start = page.endPosition;
+    provider.setPosition(start);
+  }
+  return starts;
+}
+
+// layoutText, getPreviousPageStart and renderPage over a whole provider
+void runLayoutStages(Bench::Suite& suite, const std::string& corpus, WordProvider& provider, TextRenderer& renderer,
+                     const LayoutStrategy::LayoutConfig& config) {
+  for (int kp = 0; kp < 2; kp++) {
+    const std::string suffix = kp ? "_kp" : "_greedy";
+
+    suite.run("layout" + suffix, corpus, [&]() -> uint64_t {
+      std::unique_ptr<LayoutStrategy> layout = makeLayout(kp, config.language);
+      return paginate(provider, *layout, renderer, config).size();
+    });
+
+    std::unique_ptr<LayoutStrategy> reference = makeLayout(kp, config.language);
+    const std::vector<int> starts = paginate(provider, *reference, renderer, config);
+
+    suite.run("previous_page" + suffix, corpus, [&]() -> uint64_t {
+      std::unique_ptr<LayoutStrategy> layout = makeLayout(kp, config.language);
+      for (size_t i = starts.size(); i-- > 1;) {
+        provider.setPosition(starts[i]);
+        layout->getPreviousPageStart(provider, renderer, config, starts[i]);
+      }
+      return starts.empty() ? 0 : starts.size() - 1;
+    });
+
+    // Rendering only: the pages are laid out before timing
+    std::vector<LayoutStrategy::PageLayout> pages;
+    for (int start : starts) {
+      provider.setPosition(start);
+      pages.push_back(reference->layoutText(provider, renderer, config));
+    }
+    suite.run("render_page" + suffix, corpus, [&]() -> uint64_t {
+      for (const LayoutStrategy::PageLayout& page : pages) {
+        reference->renderPage(page, renderer, config);
+      }
+      return pages.size();
+    });
+  }
+}
+
+void runHyphenation(Bench::Suite& suite, const char* name, const char* path, Language language) {
+  const std::vector<std::string> words = loadWords(path);
+  if (words.empty()) {
+    suite.skip(name, path, "word list not found");
+    return;
+  }
+  std::unique_ptr<HyphenationStrategy> strategy(createHyphenationStrategy(language));
+  suite.run(name, path, [&]() -> uint64_t {
+    size_t positions = 0;
+    for (const std::string& word : words) {
+      positions += strategy->findHyphenPositions(word).size();
+    }
+    return positions > 0 ? words.size() : 0;
+  });
+}
+
+void runEpubStages(Bench::Suite& suite, const std::string& path, TextRenderer& renderer) {
+  {
+    EpubWordProvider probe(path.c_str());
+    if (!probe.isValid()) {
+      suite.skip("epub_open", path, "cannot open");
+      suite.skip("chapter_convert", path, "cannot open");
+      return;
+    }
+  }
+
+  suite.run("epub_open", path, [&]() -> uint64_t {
+    EpubWordProvider provider(path.c_str());
+    return provider.isValid() ? 1 : 0;
+  });
+
+  EpubWordProvider provider(path.c_str());
+  suite.run("chapter_convert", path, [&]() -> uint64_t {
+    const int chapters = provider.getChapterCount();
+    int converted = 0;
+    for (int c = 0; c < chapters; c++) {
+      converted += provider.setChapter(c) ? 1 : 0;
+    }
+    return converted;
+  });
+
+  // Layout on the configured test chapter, which carries real styling
+  const int chapter = std::min(TestGlobals::chapterToTest, provider.getChapterCount() - 1);
+  if (chapter >= 0 && provider.setChapter(chapter)) {
+    runLayoutStages(suite, path + "#" + std::to_string(chapter), provider, renderer,
+                    makeConfig(provider.getLanguage()));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  // test_globals.h paths are relative to test/
+  std::string epubPath = std::string("test/") + TestGlobals::g_testFilePath;
+  std::string jsonPath = "microreader_bench.json";
+  int repetitions = 3;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--epub") == 0 && i + 1 < argc) {
+      epubPath = argv[++i];
+    } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+      jsonPath = argv[++i];
+    } else if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+      repetitions = atoi(argv[++i]);
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--epub book.epub] [--json out.json] [--reps N]\n";
+      return 2;
+    }
+  }
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+  renderer.setFontFamily(&bookerly26Family);
+
+  // Library logging would be timed with the stages
+  Serial.enabled = false;
+  Bench::Suite suite(repetitions);
+
+  const std::vector<std::string> words = loadWords(kEnglishWords);
+  if (words.empty()) {
+    suite.skip("layout", kEnglishWords, "word list not found");
+  } else {
+    const std::string prose = makeProse(words, 150);
+    String text(prose.c_str());
+    StringWordProvider provider(text);
+    runLayoutStages(suite, "prose:english-words", provider, renderer, makeConfig(Language::ENGLISH));
+  }
+
+  runHyphenation(suite, "hyphenate_en", kEnglishWords, Language::ENGLISH);
+  runHyphenation(suite, "hyphenate_de", kGermanWords, Language::GERMAN);
+
+  runEpubStages(suite, epubPath, renderer);
+
+  Serial.enabled = true;
+  suite.printTable();
+  if (!suite.writeJson(jsonPath)) {
+    std::cerr << "ERROR: cannot write " << jsonPath << "\n";
+    return 1;
+  }
+  std::cout << "Wrote " << jsonPath << "\n";
+  return 0;
+}
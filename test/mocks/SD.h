@@ -20,6 +20,9 @@ using std::min;
 #define FILE_READ 0
 #define FILE_WRITE 1
 
+// Bytes handed out by MockFile::read, for benchmarks to report file I/O
+inline uint64_t g_mockFileBytesRead = 0;
+
 struct MockFile {
   std::string content;
   std::string filepath;
@@ -51,11 +54,13 @@ struct MockFile {
     size_t toRead = std::min(len, content.size() - currentPos);
     memcpy(buf, content.data() + currentPos, toRead);
     currentPos += toRead;
+    g_mockFileBytesRead += toRead;
     return toRead;
   }
   int read() {
     if (!isOpen || currentPos >= content.size())
       return -1;
+    g_mockFileBytesRead++;
     return static_cast<unsigned char>(content[currentPos++]);
   }
   size_t write(const uint8_t* buf, size_t len) {
@@ -113,6 +118,13 @@ struct MockSD {
       f.isWriteMode = true;
     } else {
       // Read mode - load existing file
+#ifndef _WIN32
+      // Directories open as empty streams here (they fail on Windows)
+      struct stat st;
+      if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) {
+        return f;
+      }
+#endif
       std::ifstream in(path, std::ios::binary);
       if (in.is_open()) {
         f.isOpen = true;
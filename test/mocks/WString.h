@@ -3,6 +3,7 @@
 // used only for building unit tests on the host.
 #pragma once
 
+#include <cstring>
 #include <string>
 
 class String {
@@ -38,6 +39,10 @@ class String {
       return 0;
     return s_[index];
   }
+  void setCharAt(size_t index, char c) {
+    if (index < s_.size())
+      s_[index] = c;
+  }
   bool operator==(const char* rhs) const {
     if (!rhs)
       return s_.empty();
@@ -68,6 +73,10 @@ class String {
       return String("");
     return String(s_.substr(start));
   }
+  bool endsWith(const char* suffix) const {
+    const size_t n = suffix ? strlen(suffix) : 0;
+    return n <= s_.size() && s_.compare(s_.size() - n, n, suffix ? suffix : "") == 0;
+  }
   int lastIndexOf(char c) const {
     size_t pos = s_.rfind(c);
     return (pos == std::string::npos) ? -1 : static_cast<int>(pos);
@@ -15,6 +15,8 @@ MockSD SD;
 
 // Implement MockSerial methods
 void MockSerial::printf(const char* fmt, ...) {
+  if (!enabled)
+    return;
   va_list args;
   va_start(args, fmt);
   vprintf(fmt, args);
@@ -93,9 +93,12 @@ struct MockSerial : public Print {
   void print(int v);
   void print(const String& s);
   size_t write(uint8_t c) {
-    putchar(c);
+    if (enabled)
+      putchar(c);
     return 1;
   }
+  // Benchmarks turn logging off so it is not timed
+  bool enabled = true;
 };
 
 extern MockSerial Serial;
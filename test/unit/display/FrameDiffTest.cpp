@@ -0,0 +1,153 @@
+/**
+ * FrameDiffTest.cpp - Frame Diff Test
+ *
+ * Tests the dirty region computed between two panel frames: identical
+ * frames, single pixels at the panel corners, scattered changes and the
+ * region union used to track controller RAM that lags behind. Also checks
+ * that the dirty region TextRenderer records while drawing covers every
+ * changed pixel.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/EInkDisplay.h"
+#include "core/FrameDiff.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_utils.h"
+
+static const uint16_t kWidthBytes = EInkDisplay::DISPLAY_WIDTH_BYTES;
+static const uint16_t kHeight = EInkDisplay::DISPLAY_HEIGHT;
+
+static void flipPixel(std::vector<uint8_t>& frame, int x, int y) {
+  frame[y * kWidthBytes + x / 8] ^= (uint8_t)(0x80 >> (x % 8));
+}
+
+static bool regionIs(const DirtyRegion& r, int x, int y, int w, int h) {
+  return r.x == x && r.y == y && r.w == w && r.h == h;
+}
+
+static std::string describe(const DirtyRegion& r) {
+  return "got x=" + std::to_string(r.x) + " y=" + std::to_string(r.y) + " w=" + std::to_string(r.w) +
+         " h=" + std::to_string(r.h);
+}
+
+static void testIdentical(TestUtils::TestRunner& runner) {
+  std::vector<uint8_t> a(EInkDisplay::BUFFER_SIZE);
+  for (size_t i = 0; i < a.size(); ++i) {
+    a[i] = (uint8_t)(i * 131 + 7);
+  }
+  std::vector<uint8_t> b = a;
+  DirtyRegion r = FrameDiff::computeDirtyRegion(a.data(), b.data(), kWidthBytes, kHeight);
+  runner.expectTrue(r.isEmpty(), "Identical frames have no dirty region", describe(r));
+}
+
+static void testSinglePixels(TestUtils::TestRunner& runner) {
+  const int points[][2] = {{0, 0}, {799, 0}, {0, 479}, {799, 479}, {403, 217}};
+  for (const auto& p : points) {
+    std::vector<uint8_t> a(EInkDisplay::BUFFER_SIZE, 0xFF);
+    std::vector<uint8_t> b = a;
+    flipPixel(b, p[0], p[1]);
+    DirtyRegion r = FrameDiff::computeDirtyRegion(a.data(), b.data(), kWidthBytes, kHeight);
+    runner.expectTrue(regionIs(r, (p[0] / 8) * 8, p[1], 8, 1),
+                      "Single pixel at " + std::to_string(p[0]) + "," + std::to_string(p[1]), describe(r));
+  }
+}
+
+static void testBoundingBox(TestUtils::TestRunner& runner) {
+  std::vector<uint8_t> a(EInkDisplay::BUFFER_SIZE, 0xFF);
+  std::vector<uint8_t> b = a;
+  // A text line and a page number far below it
+  for (int y = 100; y < 130; ++y) {
+    for (int x = 44; x < 600; x += 3) {
+      flipPixel(b, x, y);
+    }
+  }
+  flipPixel(b, 380, 460);
+  DirtyRegion r = FrameDiff::computeDirtyRegion(a.data(), b.data(), kWidthBytes, kHeight);
+  runner.expectTrue(regionIs(r, 40, 100, 560, 361), "Bounding box of scattered changes", describe(r));
+
+  // Differences both ways count (pixels turning white as well as black)
+  std::vector<uint8_t> c = b;
+  r = FrameDiff::computeDirtyRegion(b.data(), a.data(), kWidthBytes, kHeight);
+  runner.expectTrue(regionIs(r, 40, 100, 560, 361), "Diff is symmetric", describe(r));
+  r = FrameDiff::computeDirtyRegion(b.data(), c.data(), kWidthBytes, kHeight);
+  runner.expectTrue(r.isEmpty(), "Copied frame is clean", describe(r));
+}
+
+static void testUnite(TestUtils::TestRunner& runner) {
+  DirtyRegion a;
+  DirtyRegion b;
+  b.x = 80;
+  b.y = 10;
+  b.w = 16;
+  b.h = 5;
+  a.unite(b);
+  runner.expectTrue(regionIs(a, 80, 10, 16, 5), "Union with empty region", describe(a));
+
+  DirtyRegion c;
+  c.x = 8;
+  c.y = 40;
+  c.w = 8;
+  c.h = 2;
+  a.unite(c);
+  runner.expectTrue(regionIs(a, 8, 10, 88, 32), "Union of disjoint regions", describe(a));
+
+  DirtyRegion empty;
+  a.unite(empty);
+  runner.expectTrue(regionIs(a, 8, 10, 88, 32), "Union with empty keeps region", describe(a));
+}
+
+static bool contains(const DirtyRegion& outer, const DirtyRegion& inner) {
+  return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.w <= outer.x + outer.w &&
+         inner.y + inner.h <= outer.y + outer.h;
+}
+
+static void testRendererDirtyRegion(TestUtils::TestRunner& runner) {
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  TextRenderer renderer(display);
+  renderer.setFontFamily(&bookerly26Family);
+  renderer.setBitmapType(TextRenderer::BITMAP_BW);
+
+  std::vector<uint8_t> blank(EInkDisplay::BUFFER_SIZE, 0xFF);
+  std::vector<uint8_t> frame(EInkDisplay::BUFFER_SIZE);
+  const char* names[] = {"Portrait", "LandscapeClockwise", "PortraitInverted", "LandscapeCounterClockwise"};
+  for (int o = 0; o < 4; ++o) {
+    // One line in the middle and one clipped at the logical origin
+    const int16_t positions[][2] = {{60, 300}, {-10, 12}};
+    for (const auto& pos : positions) {
+      std::fill(frame.begin(), frame.end(), 0xFF);
+      renderer.setOrientation(static_cast<TextRenderer::Orientation>(o));
+      renderer.setFrameBuffer(frame.data());
+      renderer.resetDirtyRegion();
+      renderer.setCursor(pos[0], pos[1]);
+      renderer.print("Dirty region > row <");
+
+      const DirtyRegion changed = FrameDiff::computeDirtyRegion(blank.data(), frame.data(), kWidthBytes, kHeight);
+      const DirtyRegion& recorded = renderer.getDirtyRegion();
+      runner.expectTrue(!changed.isEmpty() && contains(recorded, changed),
+                        std::string("Renderer dirty region covers drawing (") + names[o] + ")", describe(recorded));
+    }
+  }
+
+  renderer.resetDirtyRegion();
+  runner.expectTrue(renderer.getDirtyRegion().isEmpty(), "Reset clears renderer dirty region");
+}
+
+int main() {
+  TestUtils::TestRunner runner("Frame Diff Test");
+
+  testIdentical(runner);
+  testSinglePixels(runner);
+  testBoundingBox(runner);
+  testUnite(runner);
+  testRendererDirtyRegion(runner);
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
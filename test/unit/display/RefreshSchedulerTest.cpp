@@ -0,0 +1,175 @@
+/**
+ * RefreshSchedulerTest.cpp - Refresh Scheduler Test
+ *
+ * Drives the ghosting-budget scheduler with synthetic frame sequences:
+ * regular text pages, light pages where only one short line changes, heavy
+ * image pages, and the refresh cap. Each frame is assessed against the
+ * previous one and the suggested waveform is committed, as EInkDisplay does
+ * for AUTO_REFRESH.
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/EInkDisplay.h"
+#include "core/FrameDiff.h"
+#include "core/RefreshScheduler.h"
+#include "test_utils.h"
+
+static const uint16_t kWidthBytes = EInkDisplay::DISPLAY_WIDTH_BYTES;
+static const uint16_t kHeight = EInkDisplay::DISPLAY_HEIGHT;
+
+typedef std::vector<uint8_t> Frame;
+
+static uint32_t nextRandom(uint32_t& state) {
+  state = state * 1664525u + 1013904223u;
+  return state >> 8;
+}
+
+// Text-like page: 8 px of ~25% ink per 30 px line, about 6-7% coverage
+static Frame makeTextPage(uint32_t seed) {
+  Frame f(EInkDisplay::BUFFER_SIZE, 0xFF);
+  uint32_t state = seed * 2654435761u + 1;
+  for (int y = 40; y + 8 <= 460; y += 30) {
+    for (int row = y; row < y + 8; ++row) {
+      for (int b = 2; b < kWidthBytes - 2; ++b) {
+        const uint8_t ink = (uint8_t)(nextRandom(state) & nextRandom(state));
+        f[row * kWidthBytes + b] = (uint8_t)~ink;
+      }
+    }
+  }
+  return f;
+}
+
+// Image-like page: dithered noise over the whole panel
+static Frame makeImagePage(uint32_t seed) {
+  Frame f(EInkDisplay::BUFFER_SIZE);
+  uint32_t state = seed * 40503u + 7;
+  for (size_t i = 0; i < f.size(); ++i) {
+    f[i] = (uint8_t)nextRandom(state);
+  }
+  return f;
+}
+
+struct Run {
+  int partial = 0;
+  int fast = 0;
+  int firstFull = -1;  // frame index of the first FULL, -1 if none
+};
+
+// Show `frames` in order starting from a white panel
+static Run runSequence(RefreshScheduler& scheduler, const std::vector<Frame>& frames) {
+  Run run;
+  Frame onPanel(EInkDisplay::BUFFER_SIZE, 0xFF);
+  for (size_t i = 0; i < frames.size(); ++i) {
+    const DirtyRegion dirty = FrameDiff::computeDirtyRegion(onPanel.data(), frames[i].data(), kWidthBytes, kHeight);
+    const RefreshScheduler::Waveform w = scheduler.assess(onPanel.data(), frames[i].data(), dirty);
+    scheduler.onRefresh(w);
+    if (w == RefreshScheduler::FULL) {
+      if (run.firstFull < 0) {
+        run.firstFull = (int)i;
+      }
+    } else if (w == RefreshScheduler::FAST) {
+      ++run.fast;
+    } else {
+      ++run.partial;
+    }
+    onPanel = frames[i];
+  }
+  return run;
+}
+
+static void testTextPages(TestUtils::TestRunner& runner) {
+  RefreshScheduler scheduler(kWidthBytes, kHeight);
+  std::vector<Frame> pages;
+  for (uint32_t i = 0; i < 20; ++i) {
+    pages.push_back(makeTextPage(i + 1));
+  }
+  Run run = runSequence(scheduler, pages);
+  runner.expectTrue(run.firstFull >= 4 && run.firstFull <= 12, "Text pages get a full refresh every few pages",
+                    "first full at page " + std::to_string(run.firstFull));
+  runner.expectTrue(run.fast <= 1, "Text page turns are partial (first page may be fast)",
+                    std::to_string(run.fast) + " fast refreshes");
+}
+
+static void testLightPages(TestUtils::TestRunner& runner) {
+  RefreshScheduler scheduler(kWidthBytes, kHeight);
+  // A page with a single dialog line that changes every turn
+  std::vector<Frame> pages;
+  Frame base(EInkDisplay::BUFFER_SIZE, 0xFF);
+  for (uint32_t i = 0; i < 30; ++i) {
+    Frame f = base;
+    uint32_t state = i * 97u + 3;
+    for (int row = 200; row < 208; ++row) {
+      for (int b = 10; b < 40; ++b) {
+        f[row * kWidthBytes + b] = (uint8_t)~(nextRandom(state) & nextRandom(state));
+      }
+    }
+    pages.push_back(f);
+  }
+  Run run = runSequence(scheduler, pages);
+  runner.expectTrue(run.firstFull < 0 || run.firstFull > 12, "Light pages go longer than text pages without a flash",
+                    "first full at page " + std::to_string(run.firstFull));
+  runner.expectTrue(run.fast == 0, "Light pages use partial updates", std::to_string(run.fast) + " fast refreshes");
+}
+
+static void testImagePages(TestUtils::TestRunner& runner) {
+  RefreshScheduler scheduler(kWidthBytes, kHeight);
+  Frame white(EInkDisplay::BUFFER_SIZE, 0xFF);
+  Frame image = makeImagePage(1);
+  DirtyRegion dirty = FrameDiff::computeDirtyRegion(white.data(), image.data(), kWidthBytes, kHeight);
+  runner.expectTrue(scheduler.assess(white.data(), image.data(), dirty) == RefreshScheduler::FAST,
+                    "Heavy change selects the fast waveform");
+
+  RefreshScheduler fresh(kWidthBytes, kHeight);
+  std::vector<Frame> pages;
+  for (uint32_t i = 0; i < 6; ++i) {
+    pages.push_back(makeImagePage(i + 1));
+  }
+  Run run = runSequence(fresh, pages);
+  runner.expectTrue(run.firstFull >= 0 && run.firstFull <= 3, "Image pages are cleaned quickly",
+                    "first full at page " + std::to_string(run.firstFull));
+}
+
+static void testBudgetAndCap(TestUtils::TestRunner& runner) {
+  RefreshScheduler scheduler(kWidthBytes, kHeight);
+  Frame a(EInkDisplay::BUFFER_SIZE, 0xFF);
+  Frame b = makeTextPage(5);
+  DirtyRegion dirty = FrameDiff::computeDirtyRegion(a.data(), b.data(), kWidthBytes, kHeight);
+  scheduler.assess(a.data(), b.data(), dirty);
+  scheduler.onRefresh(RefreshScheduler::PARTIAL);
+  runner.expectTrue(scheduler.getMaxTileBudgetPercent() > 0 && scheduler.getRefreshesSinceFull() == 1,
+                    "Flips are charged to the budget");
+  scheduler.onRefresh(RefreshScheduler::FULL);
+  runner.expectTrue(scheduler.getMaxTileBudgetPercent() == 0 && scheduler.getRefreshesSinceFull() == 0,
+                    "Full refresh clears the budget");
+
+  // Unchanged frames cost nothing, but the refresh count still caps
+  RefreshScheduler::Config config;
+  config.maxRefreshesBetweenFull = 5;
+  scheduler.setConfig(config);
+  DirtyRegion none;
+  int full = -1;
+  for (int i = 0; i < 10 && full < 0; ++i) {
+    RefreshScheduler::Waveform w = scheduler.assess(a.data(), a.data(), none);
+    if (w == RefreshScheduler::FULL) {
+      full = i;
+    }
+    scheduler.onRefresh(w);
+  }
+  runner.expectTrue(scheduler.getLastFrameFlips() == 0, "Identical frames have no flips");
+  runner.expectTrue(full == 4, "Refresh cap forces a full refresh", "full at update " + std::to_string(full));
+}
+
+int main() {
+  TestUtils::TestRunner runner("Refresh Scheduler Test");
+
+  testTextPages(runner);
+  testLightPages(runner);
+  testImagePages(runner);
+  testBudgetAndCap(runner);
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
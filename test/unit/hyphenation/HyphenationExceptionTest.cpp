@@ -0,0 +1,65 @@
+/**
+ * HyphenationExceptionTest.cpp - Hyphenation Exception List Test
+ *
+ * Checks the \hyphenation{} exception table compiled into the English trie
+ * header: listed words are hyphenated as listed (in any case), words listed
+ * without hyphens are not split, the minima still apply, and words that are
+ * not listed fall through to the patterns.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Liang/hyph-en-us-trie.h"
+#include "Liang/hyphenation.h"
+#include "test_utils.h"
+
+static std::vector<size_t> hyphenate(const char* word, size_t minLeft, size_t minRight,
+                                     const HyphenationExceptions* exceptions) {
+  size_t positions[32];
+  const int count = liang_hyphenate(word, minLeft, minRight, '.', positions, 32, en_us_trie, exceptions);
+  return std::vector<size_t>(positions, positions + (count < 32 ? count : 32));
+}
+
+static std::string describe(const std::vector<size_t>& positions) {
+  std::string text;
+  for (size_t pos : positions) {
+    text += std::to_string(pos) + " ";
+  }
+  return text;
+}
+
+int main() {
+  TestUtils::TestRunner runner("Hyphenation Exception Test");
+  const HyphenationExceptions* exceptions = &en_us_exceptions;
+
+  // Table invariants the lookup relies on
+  int words = 0;
+  for (uint16_t i = 0; i < en_us_exceptions.slotCount; ++i) {
+    words += en_us_exceptions.slots[i] != 0;
+  }
+  runner.expectTrue((en_us_exceptions.slotCount & (en_us_exceptions.slotCount - 1)) == 0 &&
+                        words * 2 <= en_us_exceptions.slotCount,
+                    "slot count is a power of two at most half full", std::to_string(words) + " words");
+
+  const std::vector<size_t> table = hyphenate("table", 2, 2, exceptions);
+  runner.expectTrue(table == std::vector<size_t>({2}), "ta-ble", describe(table));
+  runner.expectTrue(hyphenate("table", 2, 2, nullptr) != table, "patterns alone differ for table");
+
+  const std::vector<size_t> associate = hyphenate("associate", 2, 2, exceptions);
+  runner.expectTrue(associate == std::vector<size_t>({2, 4}), "as-so-ciate", describe(associate));
+  runner.expectTrue(hyphenate("Associate", 2, 2, exceptions) == associate, "exceptions match any case");
+  runner.expectTrue(hyphenate("associate", 3, 2, exceptions) == std::vector<size_t>({4}), "minima apply");
+
+  runner.expectTrue(hyphenate("present", 1, 1, exceptions).empty() && hyphenate("projects", 1, 1, exceptions).empty(),
+                    "words listed without hyphens are not split");
+
+  // Not listed: same as the patterns, including a listed word's prefix
+  runner.expectTrue(hyphenate("computer", 2, 2, exceptions) == hyphenate("computer", 2, 2, nullptr) &&
+                        hyphenate("associated", 2, 2, exceptions) == hyphenate("associated", 2, 2, nullptr),
+                    "other words use the patterns");
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
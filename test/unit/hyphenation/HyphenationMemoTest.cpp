@@ -0,0 +1,99 @@
+/**
+ * HyphenationMemoTest.cpp - Hyphenation Memo Test
+ *
+ * Checks that findHyphenPositions returns the same positions through the
+ * memo as when computed afresh, counts repeated words as hits, keeps words
+ * with different minima apart, stays bounded (old words are evicted) and
+ * handles words too long to memoize.
+ */
+
+#include <string>
+#include <vector>
+
+#include "test_utils.h"
+#include "text/hyphenation/HyphenationStrategy.h"
+
+static const char* kWords[] = {"hyphenation", "computer",     "algorithm", "well-known",  "international",
+                               "paragraph",   "responsibility", "photographers", "x", "mother-in-law"};
+
+// Positions built directly from hyphenate(), without going through the memo
+static std::vector<int> expectedPositions(HyphenationStrategy& strategy, const std::string& word, size_t minLeft) {
+  std::vector<int> positions;
+  for (size_t i = 0; i < word.length(); i++) {
+    if (word[i] == '-') {
+      positions.push_back((int)i);
+    }
+  }
+  if (positions.empty()) {
+    for (size_t pos : strategy.hyphenate(word, 6, minLeft, 3)) {
+      positions.push_back(-((int)pos + 1));
+    }
+  }
+  return positions;
+}
+
+static std::vector<int> lookup(HyphenationStrategy& strategy, const std::string& word, size_t minLeft = 3) {
+  HyphenPositions found;
+  strategy.findHyphenPositions(word.c_str(), word.length(), found, 6, minLeft, 3);
+  return std::vector<int>(found.begin(), found.end());
+}
+
+int main() {
+  TestUtils::TestRunner runner("Hyphenation Memo Test");
+  HyphenationStrategy* strategy = createHyphenationStrategy(Language::ENGLISH);
+
+  // First pass misses, second pass hits, both match the direct computation
+  bool firstMatches = true;
+  bool secondMatches = true;
+  for (const char* w : kWords) {
+    firstMatches = firstMatches && lookup(*strategy, w) == expectedPositions(*strategy, w, 3);
+  }
+  const uint32_t missesAfterFirst = strategy->getMemoMisses();
+  for (const char* w : kWords) {
+    secondMatches = secondMatches && lookup(*strategy, w) == expectedPositions(*strategy, w, 3);
+  }
+  runner.expectTrue(firstMatches && secondMatches, "memoized positions match direct hyphenation");
+  runner.expectTrue(missesAfterFirst == 10 && strategy->getMemoHits() == 10 && strategy->getMemoMisses() == 10,
+                    "repeated words are hits",
+                    std::to_string(strategy->getMemoHits()) + " hits, " +
+                        std::to_string(strategy->getMemoMisses()) + " misses");
+
+  // The vector interface goes through the same memo
+  strategy->resetMemoStats();
+  const std::vector<int> viaVector = strategy->findHyphenPositions(std::string("hyphenation"));
+  runner.expectTrue(viaVector == expectedPositions(*strategy, "hyphenation", 3) && strategy->getMemoHits() == 1,
+                    "vector interface uses the memo");
+
+  // Different minima are different entries
+  const std::vector<int> loose = lookup(*strategy, "responsibility", 1);
+  runner.expectTrue(loose == expectedPositions(*strategy, "responsibility", 1) &&
+                        loose != lookup(*strategy, "responsibility", 3),
+                    "minima are part of the key");
+
+  // Bounded: after many other words the first ones are gone
+  for (int i = 0; i < 400; i++) {
+    lookup(*strategy, "filler" + std::to_string(i) + "word");
+  }
+  strategy->resetMemoStats();
+  lookup(*strategy, "hyphenation");
+  runner.expectTrue(strategy->getMemoMisses() == 1, "old entries are evicted");
+
+  // Too long to memoize: still correct, always computed
+  std::string longWord;
+  for (int i = 0; i < 8; i++) {
+    longWord += "photographers";
+  }
+  strategy->resetMemoStats();
+  const bool longMatches = lookup(*strategy, longWord) == expectedPositions(*strategy, longWord, 3);
+  lookup(*strategy, longWord);
+  runner.expectTrue(longMatches && strategy->getMemoHits() == 0, "long words bypass the memo");
+
+  strategy->clearMemo();
+  strategy->resetMemoStats();
+  lookup(*strategy, "computer");
+  runner.expectTrue(strategy->getMemoMisses() == 1, "clearMemo empties the memo");
+
+  delete strategy;
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
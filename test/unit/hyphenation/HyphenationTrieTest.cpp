@@ -0,0 +1,77 @@
+/**
+ * HyphenationTrieTest.cpp - Packed Liang Trie Test
+ *
+ * Checks the generated English trie against the sorted pattern table it was
+ * built from: the layout invariants the lookup relies on, and identical
+ * hyphenation positions for every word of the English test list.
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Liang/hyph-en-us-trie.h"
+#include "Liang/hyph-en-us.h"
+#include "Liang/hyphenation.h"
+#include "test_utils.h"
+
+int main() {
+  TestUtils::TestRunner runner("Hyphenation Trie Test");
+  const HyphenationTrie& trie = en_us_trie;
+
+  // Children are contiguous, in range and sorted by label
+  bool sorted = true;
+  bool inRange = true;
+  for (uint32_t n = 0; n < trie.nodeCount; ++n) {
+    const uint32_t first = trie.nodes[n] >> 8;
+    const uint32_t count = trie.nodes[n] & 0xFF;
+    if (count > 0 && (first <= n || first + count > trie.nodeCount)) {
+      inRange = false;
+    }
+    for (uint32_t c = 1; c < count && inRange; ++c) {
+      sorted = sorted && trie.labels[first + c - 1] < trie.labels[first + c];
+    }
+  }
+  runner.expectTrue(inRange, "child ranges lie after their parent");
+  runner.expectTrue(sorted, "siblings are sorted by label");
+
+  size_t ends = 0;
+  for (uint32_t n = 0; n < trie.nodeCount; ++n) {
+    ends += trie.levelIds[n] != 0;
+  }
+  runner.expectTrue(ends == en_us_patterns.count, "one pattern end per pattern",
+                    std::to_string(ends) + " vs " + std::to_string(en_us_patterns.count));
+
+  size_t a[32];
+  size_t b[32];
+  const int na = liang_hyphenate("computer", 2, 2, '.', a, 32, en_us_trie);
+  runner.expectTrue(na == 2 && a[0] == 3 && a[1] == 6, "com-put-er", std::to_string(na));
+
+  std::ifstream in("test/resources/english_hyphenation_tests.txt");
+  std::string line;
+  int words = 0;
+  int mismatches = 0;
+  std::string firstMismatch;
+  while (std::getline(in, line)) {
+    const size_t bar = line.find('|');
+    if (line.empty() || line[0] == '#' || bar == std::string::npos) {
+      continue;
+    }
+    const std::string word = line.substr(0, bar);
+    const int expected = liang_hyphenate(word.c_str(), 0, 0, '.', a, 32, en_us_patterns);
+    const int actual = liang_hyphenate(word.c_str(), 0, 0, '.', b, 32, en_us_trie);
+    bool same = expected == actual;
+    for (int i = 0; same && i < expected && i < 32; ++i) {
+      same = a[i] == b[i];
+    }
+    if (!same && mismatches++ == 0) {
+      firstMismatch = word;
+    }
+    words++;
+  }
+  runner.expectTrue(words > 1000, "word list loaded", std::to_string(words) + " words");
+  runner.expectTrue(mismatches == 0, "trie matches the pattern table", firstMismatch);
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+/**
+ * HyphenationUtf8Test.cpp - UTF-8 Liang Hyphenation Test
+ *
+ * Checks that liang_hyphenate matches capitalized words and words with
+ * multi-byte letters against lowercase patterns, counts the minima in
+ * characters and only returns byte offsets of character starts in the
+ * original word. Uses the English trie and a small hand-written table of
+ * patterns with umlauts.
+ */
+
+#include <string>
+#include <vector>
+
+#include "Liang/hyph-en-us-trie.h"
+#include "Liang/hyphenation.h"
+#include "test_utils.h"
+
+// "ä1d", "1ch", "ü1b" and "1\xA4" (a level inside the two bytes of ä, which
+// must never become a split point); sorted by bytes
+static const std::uint8_t let0[] = {'c', 'h'};
+static const std::uint8_t val0[] = {1, 0, 0};
+static const std::uint8_t let1[] = {0xA4};
+static const std::uint8_t val1[] = {1, 0};
+static const std::uint8_t let2[] = {0xC3, 0xA4, 'd'};
+static const std::uint8_t val2[] = {0, 0, 1, 0};
+static const std::uint8_t let3[] = {0xC3, 0xBC, 'b'};
+static const std::uint8_t val3[] = {0, 0, 1, 0};
+static const PatternC kPatternList[] = {{let0, val0, 2, 3}, {let1, val1, 1, 2}, {let2, val2, 3, 4}, {let3, val3, 3, 4}};
+static const HyphenationPatterns kPatterns = {kPatternList, 4};
+
+template <typename Patterns>
+static std::vector<size_t> hyphenate(const char* word, size_t minLeft, size_t minRight, const Patterns& patterns) {
+  size_t positions[32];
+  const int count = liang_hyphenate(word, minLeft, minRight, '.', positions, 32, patterns);
+  return std::vector<size_t>(positions, positions + (count < 32 ? count : 32));
+}
+
+static std::string describe(const std::vector<size_t>& positions) {
+  std::string text;
+  for (size_t pos : positions) {
+    text += std::to_string(pos) + " ";
+  }
+  return text;
+}
+
+int main() {
+  TestUtils::TestRunner runner("Hyphenation UTF-8 Test");
+
+  const std::vector<size_t> lower = hyphenate("computer", 2, 2, en_us_trie);
+  runner.expectTrue(lower == std::vector<size_t>({3, 6}), "com-put-er", describe(lower));
+  runner.expectTrue(hyphenate("Computer", 2, 2, en_us_trie) == lower, "capitalized word is folded");
+  runner.expectTrue(hyphenate("COMPUTER", 2, 2, en_us_trie) == lower, "upper case word is folded");
+
+  // "Mädchen": M(0) ä(1-2) d(3) c(4) h(5) e(6) n(7), split before d and before c
+  const std::vector<size_t> madchen = hyphenate("M\xC3\xA4" "dchen", 1, 1, kPatterns);
+  runner.expectTrue(madchen == std::vector<size_t>({3, 4}), "multi-byte letter before the split", describe(madchen));
+  const std::vector<size_t> upper = hyphenate("M\xC3\x84" "DCHEN", 1, 1, kPatterns);
+  runner.expectTrue(upper == madchen, "upper case umlaut is folded", describe(upper));
+
+  // "Übung" starts with a two-byte letter: split after it is at byte 2, and
+  // it counts as one character for the minima
+  runner.expectTrue(hyphenate("\xC3\x9C" "bung", 1, 1, kPatterns) == std::vector<size_t>({2}), "split after Ü");
+  runner.expectTrue(hyphenate("\xC3\x9C" "bung", 2, 1, kPatterns).empty(), "left minimum counts characters");
+  runner.expectTrue(hyphenate("ab\xC3\xA4" "d", 1, 1, kPatterns) == std::vector<size_t>({4}),
+                    "right minimum counts characters");
+
+  // Every offset lies on a character start
+  const char* words[] = {"\xC3\xA4\xC3\xA4\xC3\xA4\xC3\xA4", "x\xC3\xA4\xC3\xA4" "ch\xC3\xA4" "d", "\xE2\x82\xAC" "ch"};
+  bool boundaries = true;
+  for (const char* word : words) {
+    for (size_t pos : hyphenate(word, 1, 1, kPatterns)) {
+      boundaries = boundaries && (((unsigned char)word[pos]) & 0xC0) != 0x80;
+    }
+  }
+  runner.expectTrue(boundaries, "offsets are character starts");
+
+  // Malformed UTF-8 is hyphenated without reading past the word
+  runner.expectTrue(hyphenate("ab\xC3" "ch", 1, 1, kPatterns) == std::vector<size_t>({3}), "malformed byte");
+
+  runner.expectTrue(liang_char_count("M\xC3\xA4" "dchen") == 7 && liang_char_count("\xE2\x82\xAC") == 1,
+                    "character count");
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+/**
+ * LiangHyphenationTest.cpp - Pattern File Hyphenation Test
+ *
+ * Writes the compiled English trie as a .hyp image (the layout
+ * scripts/generate_hyphenation_trie.py --binary produces), loads it through
+ * LiangHyphenation and checks that it hyphenates the English test words like
+ * the compiled-in strategy (exception list included), that the file's minima
+ * apply, and that truncated or corrupt images and missing files are rejected.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Liang/hyph-en-us-trie.h"
+#include "test_utils.h"
+#include "text/hyphenation/EnglishHyphenation.h"
+#include "text/hyphenation/LiangHyphenation.h"
+
+template <typename T>
+static void append(std::string& out, const T* values, size_t count) {
+  out.append(reinterpret_cast<const char*>(values), count * sizeof(T));
+}
+
+static std::string makeImage(const HyphenationTrie& trie, uint8_t leftMin, uint8_t rightMin,
+                             const HyphenationExceptions* exceptions = nullptr) {
+  uint16_t lists = 0;
+  for (uint32_t n = 0; n < trie.nodeCount; ++n) {
+    lists = trie.levelIds[n] > lists ? trie.levelIds[n] : lists;
+  }
+  const uint16_t last = trie.levelOffsets[lists - 1];
+  const uint16_t levelBytes = last + 1 + 2 * trie.levelData[last];
+
+  std::string image("HYPT");
+  const uint8_t bytes[4] = {(uint8_t)(exceptions ? 2 : 1), trie.maxPatternLength, leftMin, rightMin};
+  append(image, bytes, 4);
+  append(image, &trie.nodeCount, 1);
+  append(image, &lists, 1);
+  append(image, &levelBytes, 1);
+  append(image, trie.nodes, trie.nodeCount);
+  append(image, trie.levelIds, trie.nodeCount);
+  append(image, trie.levelOffsets, lists);
+  append(image, trie.labels, trie.nodeCount);
+  append(image, trie.levelData, levelBytes);
+  if (exceptions) {
+    uint16_t entryBytes = 0;
+    for (uint16_t i = 0; i < exceptions->slotCount; ++i) {
+      if (exceptions->slots[i] != 0) {
+        const uint8_t* entry = exceptions->entries + exceptions->slots[i] - 1;
+        const uint16_t end = (uint16_t)(exceptions->slots[i] - 1 + 2 + entry[0] + entry[1 + entry[0]]);
+        entryBytes = end > entryBytes ? end : entryBytes;
+      }
+    }
+    image.resize(image.size() + (image.size() & 1));
+    append(image, &exceptions->slotCount, 1);
+    append(image, &entryBytes, 1);
+    append(image, exceptions->slots, exceptions->slotCount);
+    append(image, exceptions->entries, entryBytes);
+  }
+  return image;
+}
+
+static LiangHyphenation* fromImage(const std::string& image) {
+  uint8_t* data = static_cast<uint8_t*>(malloc(image.size()));
+  memcpy(data, image.data(), image.size());
+  return LiangHyphenation::fromBuffer(data, image.size());
+}
+
+int main() {
+  TestUtils::TestRunner runner("Liang Pattern File Test");
+  const std::string image = makeImage(en_us_trie, 2, 3, &en_us_exceptions);
+
+  // Same positions as the compiled-in English patterns
+  LiangHyphenation* loaded = fromImage(image);
+  runner.expectTrue(loaded != nullptr && loaded->getLanguage() == Language::PATTERN_FILE, "image parses");
+  EnglishHyphenation english;
+  std::ifstream in("test/resources/english_hyphenation_tests.txt");
+  std::string line;
+  int words = 0;
+  int mismatches = 0;
+  std::string firstMismatch;
+  while (loaded && std::getline(in, line)) {
+    const size_t bar = line.find('|');
+    if (line.empty() || line[0] == '#' || bar == std::string::npos) {
+      continue;
+    }
+    const std::string word = line.substr(0, bar);
+    if (loaded->hyphenate(word) != english.hyphenate(word) && mismatches++ == 0) {
+      firstMismatch = word;
+    }
+    words++;
+  }
+  runner.expectTrue(words > 1000 && mismatches == 0, "matches the compiled-in patterns",
+                    std::to_string(words) + " words, first mismatch: " + firstMismatch);
+
+  // The file's minima win over smaller ones passed in
+  const std::vector<size_t> computer = loaded ? loaded->hyphenate("computer", 6, 1, 1) : std::vector<size_t>();
+  runner.expectTrue(computer == std::vector<size_t>({3}), "minima from the file apply",
+                    std::to_string(computer.size()));
+  delete loaded;
+
+  // Malformed images are rejected
+  runner.expectTrue(fromImage(image.substr(0, image.size() - 1)) == nullptr, "truncated image rejected");
+  std::string badMagic = image;
+  badMagic[0] = 'X';
+  runner.expectTrue(fromImage(badMagic) == nullptr, "bad magic rejected");
+  std::string badChild = image;
+  const uint32_t outOfRange = (en_us_trie.nodeCount << 8) | 1;
+  memcpy(&badChild[16], &outOfRange, 4);
+  runner.expectTrue(fromImage(badChild) == nullptr, "child range out of bounds rejected");
+  std::string badException = image;
+  badException[badException.size() - 1] = (char)200;  // hyphen of the last entry past its word
+  runner.expectTrue(fromImage(badException) == nullptr, "exception hyphen out of bounds rejected");
+  LiangHyphenation* version1 = fromImage(makeImage(en_us_trie, 2, 3));
+  runner.expectTrue(version1 != nullptr && version1->hyphenate("table", 5, 2, 2).empty(),
+                    "version 1 image without exceptions");
+  delete version1;
+
+  // Loading from a file, and the fallback when there is none
+  const char* path = "liang_hyphenation_test.hyp";
+  {
+    std::ofstream out(path, std::ios::binary);
+    out.write(image.data(), image.size());
+  }
+  HyphenationStrategy* fromFile = createHyphenationStrategy(path);
+  runner.expectTrue(fromFile->getLanguage() == Language::PATTERN_FILE &&
+                        fromFile->hyphenate("hyphenation") == english.hyphenate("hyphenation"),
+                    "createHyphenationStrategy loads a file");
+  delete fromFile;
+  std::remove(path);
+  HyphenationStrategy* missing = createHyphenationStrategy("does_not_exist.hyp");
+  runner.expectTrue(missing->getLanguage() == Language::BASIC, "missing file falls back to existing hyphens");
+  delete missing;
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
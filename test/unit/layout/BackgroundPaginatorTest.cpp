@@ -0,0 +1,142 @@
+/**
+ * BackgroundPaginatorTest.cpp - Background Paginator Test
+ *
+ * Paginates a three-chapter book a few pages per call, as the reader does
+ * while idle, and checks that every page is laid out exactly once, that a
+ * chapter is only opened when the paginator moves on to it (not again on
+ * every call), and that restoreProvider() puts the provider back in the
+ * reader's chapter and position, also when the job is interrupted.
+ */
+
+#include <set>
+#include <string>
+#include <utility>
+
+#include "WString.h"
+#include "content/providers/StringWordProvider.h"
+#include "core/EInkDisplay.h"
+#include "rendering/TextRenderer.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "text/layout/BackgroundPaginator.h"
+#include "text/layout/PaginationIndex.h"
+
+static const int kChapters = 3;
+static const int kPageChars = 40;
+
+// The same text in every chapter; counts chapter opens
+class ChapterWordProvider : public StringWordProvider {
+ public:
+  explicit ChapterWordProvider(const String& text) : StringWordProvider(text) {}
+  int getChapterCount() override {
+    return kChapters;
+  }
+  int getCurrentChapter() override {
+    return chapter;
+  }
+  bool setChapter(int chapterIndex) override {
+    opens++;
+    chapter = chapterIndex;
+    setPosition(0);
+    return true;
+  }
+  bool hasChapters() override {
+    return true;
+  }
+  int chapter = 0;
+  int opens = 0;
+};
+
+// Pages of a fixed number of characters; remembers every page laid out
+class FixedPageLayout : public LayoutStrategy {
+ public:
+  Type getType() const override {
+    return GREEDY;
+  }
+  PageLayout layoutText(WordProvider& provider, TextRenderer& renderer, const LayoutConfig& config) override {
+    PageLayout page;
+    const int start = provider.getCurrentIndex();
+    provider.setPosition(start + kPageChars);
+    page.endPosition = provider.getCurrentIndex();
+    const auto key = std::make_pair(provider.getCurrentChapter(), start);
+    if (!laidOut.insert(key).second) {
+      repeats++;
+    }
+    return page;
+  }
+  void renderPage(const PageLayout& layout, TextRenderer& renderer, const LayoutConfig& config) override {}
+  std::set<std::pair<int, int>> laidOut;
+  int repeats = 0;
+};
+
+static std::string makeText() {
+  std::string text;
+  while (text.size() < 190) {
+    text += "lorem ipsum dolor sit amet ";
+  }
+  return text;
+}
+
+int main() {
+  TestUtils::TestRunner runner("Background Paginator Test");
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  TextRenderer renderer(display);
+  const LayoutStrategy::LayoutConfig config = LayoutStrategy::LayoutConfig();
+
+  const std::string source = makeText();
+  const int pagesPerChapter = ((int)source.size() + kPageChars - 1) / kPageChars;
+  ChapterWordProvider provider(String(source.c_str()));
+  FixedPageLayout layout;
+  PaginationIndex index;
+  index.reset(0x1234, kChapters);
+
+  // The reader is in the middle of the second chapter
+  provider.setChapter(1);
+  provider.setPosition(50);
+  provider.opens = 0;
+
+  BackgroundPaginator paginator;
+  paginator.start(0x1234, 1);
+  int calls = 0;
+  while (paginator.isRunning() && calls < 100) {
+    paginator.run(provider, layout, renderer, config, index, 2);
+    calls++;
+  }
+
+  runner.expectTrue(index.isBookComplete() && index.getTotalPageCount() == kChapters * pagesPerChapter,
+                    "whole book paginated", std::to_string(index.getTotalPageCount()));
+  runner.expectTrue(layout.repeats == 0 && (int)layout.laidOut.size() == kChapters * pagesPerChapter,
+                    "every page laid out once", std::to_string(layout.repeats) + " repeats");
+  runner.expectTrue(provider.opens == kChapters - 1, "chapters opened once each, not per call",
+                    std::to_string(provider.opens) + " opens in " + std::to_string(calls) + " calls");
+
+  paginator.restoreProvider(provider);
+  runner.expectTrue(provider.chapter == 1 && provider.getCurrentIndex() == 50, "reader position restored");
+  provider.opens = 0;
+  paginator.restoreProvider(provider);
+  runner.expectTrue(provider.opens == 0 && provider.getCurrentIndex() == 50, "second restore is a no-op");
+
+  // Interrupted in another chapter: the reader gets its chapter back, and the
+  // next call picks up where the job stopped
+  index.reset(0x5678, kChapters);
+  layout.laidOut.clear();
+  paginator.start(0x5678, 2);
+  paginator.run(provider, layout, renderer, config, index, 2);
+  runner.expectTrue(provider.chapter == 2 && index.getKnownPageCount(2) == 3, "job holds the provider");
+  paginator.restoreProvider(provider);
+  runner.expectTrue(provider.chapter == 1 && provider.getCurrentIndex() == 50, "restored after an interruption");
+  paginator.run(provider, layout, renderer, config, index, 1);
+  runner.expectTrue(provider.chapter == 2 && index.getKnownPageCount(2) == 4 && layout.repeats == 0,
+                    "resumed without laying a page out again");
+
+  // A deleted provider is forgotten, not restored
+  paginator.dropProvider();
+  provider.opens = 0;
+  paginator.restoreProvider(provider);
+  runner.expectTrue(provider.opens == 0 && provider.chapter == 2, "dropped provider left alone");
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
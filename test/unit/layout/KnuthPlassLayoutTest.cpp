@@ -0,0 +1,427 @@
+/**
+ * KnuthPlassLayoutTest.cpp - Total-Fit Line Breaking Test
+ *
+ * Lays out an English text page by page with KnuthPlassLayoutStrategy on a
+ * StringWordProvider and checks that no text is lost or duplicated, that
+ * lines stay within the measure, that hyphenation candidates are used, that
+ * a word wider than the line still gets a line of its own, and that
+ * getPreviousPageStart finds a page ending where the current one starts
+ * (the forward page start itself when there is no paragraph spacing),
+ * including for pages that start inside a hyphenated word. Relaying a page
+ * out after a margin or font change must give the lines a fresh strategy
+ * gives, without reading the provider again. Paragraph formats indent first
+ * lines, space paragraphs by their margins and set large text in bold, and
+ * backward navigation still finds the forward page starts.
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "WString.h"
+#include "content/providers/StringWordProvider.h"
+#include "core/EInkDisplay.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_utils.h"
+#include "text/hyphenation/HyphenationStrategy.h"
+#include "text/layout/KnuthPlassLayoutStrategy.h"
+
+static const char* kSentences[] = {
+    "Extraordinary circumstances occasionally require unconventional approaches to otherwise straightforward "
+    "problems.",
+    "The committee deliberated interminably about the characteristics of the proposed infrastructure.",
+    "Nevertheless, the administration maintained that responsibility for the miscommunication was shared.",
+    "A quick brown fox jumps over the lazy dog while the photographers document everything meticulously.",
+    "Understandably, international representatives questioned the methodology behind the recommendations.",
+    "Short words fit easily.",
+};
+
+static std::string makeText() {
+  std::string text;
+  for (int p = 0; p < 14; ++p) {
+    for (int s = 0; s < 4 + p % 3; ++s) {
+      if (s > 0) {
+        text += ' ';
+      }
+      text += kSentences[(p * 5 + s) % 6];
+    }
+    if (p == 6) {
+      text += " Supercalifragilisticexpialidociousnessxxxxxxxxxxxxxxxxxx ends here.";
+    }
+    text += p % 5 == 4 ? "\n\n" : "\n";
+  }
+  return text;
+}
+
+static std::vector<std::string> splitWords(const std::string& text) {
+  std::vector<std::string> words;
+  std::istringstream in(text);
+  std::string w;
+  while (in >> w) {
+    words.push_back(w);
+  }
+  return words;
+}
+
+// Counts the words read, to tell cached paragraphs from ones read again
+class CountingWordProvider : public StringWordProvider {
+ public:
+  explicit CountingWordProvider(const String& text) : StringWordProvider(text) {}
+  StyledWord getNextWord() override {
+    reads++;
+    return StringWordProvider::getNextWord();
+  }
+  int reads = 0;
+};
+
+// Gives each paragraph a format picked by its number
+class FormattedWordProvider : public StringWordProvider {
+ public:
+  explicit FormattedWordProvider(const String& text) : StringWordProvider(text), text_(text.c_str()) {}
+  ParagraphFormat getParagraphFormat() override {
+    return formatOf(paragraphAt(getCurrentIndex()));
+  }
+  static ParagraphFormat formatOf(int paragraph) {
+    ParagraphFormat format;
+    format.indent = paragraph % 3 == 0 ? 8 : 0;
+    format.marginTop = paragraph % 4 == 1 ? 6 : 0;
+    format.marginBottom = paragraph % 5 == 2 ? 4 : 0;
+    format.fontSize = paragraph == 3 ? 15 : 10;
+    return format;
+  }
+  int paragraphAt(int index) const {
+    int paragraph = 0;
+    for (int i = 0; i < index && i < (int)text_.size(); ++i) {
+      paragraph += text_[i] == '\n';
+    }
+    return paragraph;
+  }
+
+ private:
+  std::string text_;
+};
+
+static bool sameLines(const LayoutStrategy::PageLayout& a, const LayoutStrategy::PageLayout& b) {
+  if (a.endPosition != b.endPosition || a.lines.size() != b.lines.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.lines.size(); ++i) {
+    const auto& wa = a.lines[i].words;
+    const auto& wb = b.lines[i].words;
+    if (wa.size() != wb.size()) {
+      return false;
+    }
+    for (size_t j = 0; j < wa.size(); ++j) {
+      if (wa[j].text != wb[j].text || wa[j].x != wb[j].x || wa[j].y != wb[j].y || wa[j].width != wb[j].width) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Page at `start` from a strategy that has seen nothing before
+static LayoutStrategy::PageLayout freshLayout(const String& text, int start, TextRenderer& renderer,
+                                              const LayoutStrategy::LayoutConfig& config) {
+  StringWordProvider provider(text);
+  KnuthPlassLayoutStrategy layout;
+  layout.setLanguage(config.language);
+  provider.setPosition(start);
+  return layout.layoutText(provider, renderer, config);
+}
+
+static LayoutStrategy::LayoutConfig makeConfig() {
+  LayoutStrategy::LayoutConfig config;
+  config.marginLeft = 10;
+  config.marginRight = 10;
+  config.marginTop = 40;
+  config.marginBottom = 20;
+  config.lineHeight = 30;
+  config.paragraphSpacing = 12;
+  config.minSpaceWidth = 8;
+  config.pageWidth = 300;
+  config.pageHeight = 480;
+  config.alignment = LayoutStrategy::ALIGN_LEFT;
+  config.language = Language::ENGLISH;
+  return config;
+}
+
+int main() {
+  TestUtils::TestRunner runner("Knuth-Plass Layout Test");
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+  renderer.setFontFamily(&bookerly26Family);
+  renderer.setFontStyle(FontStyle::REGULAR);
+
+  const std::string source = makeText();
+  String text(source.c_str());
+  StringWordProvider provider(text);
+  KnuthPlassLayoutStrategy layout;
+  const LayoutStrategy::LayoutConfig config = makeConfig();
+  layout.setLanguage(config.language);
+  const int16_t right = config.pageWidth - config.marginRight;
+
+  std::vector<std::pair<int, int>> pages;
+  std::vector<std::string> laidOut;
+  std::string pending;  // first part of a word broken at a hyphen
+  int hyphenatedLines = 0;
+  int overfullLines = 0;
+  int linesTooWide = 0;
+  bool overlongWordAlone = false;
+
+  int start = 0;
+  while (start < (int)source.length() && pages.size() < 200) {
+    provider.setPosition(start);
+    LayoutStrategy::PageLayout page = layout.layoutText(provider, renderer, config);
+    if (page.endPosition <= start) {
+      break;
+    }
+    pages.push_back({start, page.endPosition});
+
+    for (const auto& line : page.lines) {
+      std::vector<const LayoutStrategy::Word*> words;
+      for (const auto& w : line.words) {
+        if (w.text.length() > 0 && w.text[0] != ' ') {
+          words.push_back(&w);
+        }
+      }
+      if (words.empty()) {
+        continue;
+      }
+      const LayoutStrategy::Word& lastWord = *words.back();
+      if (lastWord.x + lastWord.width > right) {
+        if (words.size() == 1) {
+          overfullLines++;
+          overlongWordAlone = overlongWordAlone || lastWord.text.indexOf("xxxxxxxx") >= 0;
+        } else {
+          linesTooWide++;
+        }
+      }
+      for (const auto* w : words) {
+        std::string s = w->text.c_str();
+        if (!pending.empty()) {
+          s = pending + s;
+          pending.clear();
+        }
+        if (w->wasSplit) {
+          hyphenatedLines++;
+          // Algorithmic hyphens are not in the source; existing ones are kept
+          if (!s.empty() && s.back() == '-' && source.find(s) == std::string::npos) {
+            s.pop_back();
+          }
+          pending = s;
+          continue;
+        }
+        laidOut.push_back(s);
+      }
+    }
+    start = page.endPosition;
+  }
+
+  runner.expectTrue(!pages.empty() && pages.back().second == (int)source.length(), "pages cover the whole text",
+                    std::to_string(pages.size()) + " pages");
+  const std::vector<std::string> expected = splitWords(source);
+  size_t mismatch = 0;
+  while (mismatch < expected.size() && mismatch < laidOut.size() && expected[mismatch] == laidOut[mismatch]) {
+    ++mismatch;
+  }
+  runner.expectTrue(laidOut.size() == expected.size() && mismatch == expected.size(), "every word laid out once",
+                    mismatch < laidOut.size() ? "first difference: " + laidOut[mismatch] : "");
+  runner.expectTrue(linesTooWide == 0, "lines fit the measure", std::to_string(linesTooWide) + " too wide");
+  runner.expectTrue(hyphenatedLines > 0, "hyphenation penalties are used",
+                    std::to_string(hyphenatedLines) + " hyphenated lines");
+  runner.expectTrue(overlongWordAlone && overfullLines == 1, "overlong word gets a line of its own");
+
+  // Backward navigation: the page before must end where the current one starts
+  int roundTripFailures = 0;
+  int midWordStarts = 0;
+  for (size_t i = 1; i < pages.size(); ++i) {
+    provider.setPosition(pages[i].first);
+    if (provider.isInsideWord()) {
+      midWordStarts++;
+    }
+    const int prev = layout.getPreviousPageStart(provider, renderer, config, pages[i].first);
+    provider.setPosition(prev);
+    if (layout.layoutText(provider, renderer, config).endPosition != pages[i].first) {
+      roundTripFailures++;
+    }
+  }
+  runner.expectTrue(roundTripFailures == 0, "previous page ends at the current page",
+                    std::to_string(roundTripFailures) + " of " + std::to_string(pages.size() - 1) + " pages");
+  runner.expectTrue(midWordStarts > 0, "some pages start inside a hyphenated word");
+
+  // Without paragraph spacing a page end has exactly one full page before it,
+  // so the start found must be the one the forward pass used
+  LayoutStrategy::LayoutConfig flat = config;
+  flat.paragraphSpacing = 0;
+  int backwardFailures = 0;
+  int flatPages = 0;
+  for (int pageStart = 0; pageStart < (int)source.length() && flatPages < 200; ++flatPages) {
+    provider.setPosition(pageStart);
+    const int pageEnd = layout.layoutText(provider, renderer, flat).endPosition;
+    if (pageEnd <= pageStart || pageEnd >= (int)source.length()) {
+      break;
+    }
+    provider.setPosition(pageEnd);
+    const int prev = layout.getPreviousPageStart(provider, renderer, flat, pageEnd);
+    if (prev != pageStart && backwardFailures++ < 3) {
+      std::cerr << "page at " << pageStart << ": previous start found " << prev << "\n";
+    }
+    pageStart = pageEnd;
+  }
+  runner.expectTrue(flatPages > 10 && backwardFailures == 0, "previous page start matches forward layout",
+                    std::to_string(backwardFailures) + " of " + std::to_string(flatPages) + " pages");
+
+  // A page can start on any line of the forward layout and continue the same way
+  int resumeFailures = 0;
+  for (size_t i = 0; i + 1 < pages.size(); ++i) {
+    LayoutStrategy::LayoutConfig oneLine = config;
+    oneLine.pageHeight = config.marginTop + config.lineHeight + config.marginBottom;
+    provider.setPosition(pages[i].first);
+    const int second = layout.layoutText(provider, renderer, oneLine).endPosition;
+    provider.setPosition(second);
+    const int end = layout.layoutText(provider, renderer, config).endPosition;
+    provider.setPosition(pages[i].first);
+    const int reference = layout.layoutText(provider, renderer, config).endPosition;
+    // One line further down, the page ends at or after the original end
+    if (end < reference) {
+      resumeFailures++;
+    }
+  }
+  runner.expectTrue(resumeFailures == 0, "layout from a later line start stays consistent");
+
+  // Previous page from the end of the text is the last full page
+  provider.setPosition((int)source.length());
+  const int lastStart = layout.getPreviousPageStart(provider, renderer, config, (int)source.length());
+  provider.setPosition(lastStart);
+  runner.expectTrue(layout.layoutText(provider, renderer, config).endPosition == (int)source.length(),
+                    "previous page from the end reaches the end");
+
+  // Relayout after a settings change reuses the measured paragraphs
+  {
+    CountingWordProvider counting(text);
+    KnuthPlassLayoutStrategy cached;
+    cached.setLanguage(config.language);
+    const int pageStart = pages.size() > 2 ? pages[2].first : 0;
+    counting.setPosition(pageStart);
+    cached.layoutText(counting, renderer, config);
+    runner.expectTrue(counting.reads > 0, "first layout reads the provider");
+
+    LayoutStrategy::LayoutConfig narrow = config;
+    narrow.marginLeft = 30;
+    narrow.marginRight = 30;
+    counting.reads = 0;
+    counting.setPosition(pageStart);
+    const LayoutStrategy::PageLayout rebroken = cached.layoutText(counting, renderer, narrow);
+    runner.expectTrue(counting.reads == 0, "margin change does not read the provider",
+                      std::to_string(counting.reads) + " words read");
+    runner.expectTrue(sameLines(rebroken, freshLayout(text, pageStart, renderer, narrow)),
+                      "margin change matches a fresh layout");
+
+    renderer.setFontFamily(&bookerly28Family);
+    counting.reads = 0;
+    counting.setPosition(pageStart);
+    const LayoutStrategy::PageLayout remeasured = cached.layoutText(counting, renderer, config);
+    runner.expectTrue(counting.reads == 0, "font change does not read the provider",
+                      std::to_string(counting.reads) + " words read");
+    runner.expectTrue(sameLines(remeasured, freshLayout(text, pageStart, renderer, config)),
+                      "font change matches a fresh layout");
+    renderer.setFontFamily(&bookerly26Family);
+
+    cached.clearLayoutCache();
+    counting.reads = 0;
+    counting.setPosition(pageStart);
+    cached.layoutText(counting, renderer, config);
+    runner.expectTrue(counting.reads > 0, "cleared cache reads the provider again");
+  }
+
+  // Paragraph formats: first-line indent, margins and large text
+  {
+    FormattedWordProvider formatted(text);
+    KnuthPlassLayoutStrategy styled;
+    styled.setLanguage(config.language);
+    uint16_t spaceWidth = 0;
+    renderer.setFontStyle(FontStyle::REGULAR);
+    renderer.getTextBounds(" ", 0, 0, nullptr, nullptr, &spaceWidth, nullptr);
+
+    formatted.setPosition(0);
+    const LayoutStrategy::PageLayout first = styled.layoutText(formatted, renderer, config);
+    runner.expectTrue(first.lines.size() > 2 && first.lines[0].words[0].x == config.marginLeft + 8 * spaceWidth &&
+                          first.lines[1].words[0].x == config.marginLeft,
+                      "first line of a paragraph is indented");
+
+    std::vector<std::pair<int, int>> styledPages;
+    int tooWide = 0;
+    int wrongIndent = 0;
+    bool topMargin = false;
+    bool bottomMargin = false;
+    int unexpectedGaps = 0;
+    for (int pageStart = 0; pageStart < (int)source.length() && styledPages.size() < 200;) {
+      formatted.setPosition(pageStart);
+      const LayoutStrategy::PageLayout page = styled.layoutText(formatted, renderer, config);
+      if (page.endPosition <= pageStart) {
+        break;
+      }
+      styledPages.push_back({pageStart, page.endPosition});
+      int16_t lastY = -1;
+      for (const auto& line : page.lines) {
+        if (line.words.empty()) {
+          continue;
+        }
+        const LayoutStrategy::Word& last = line.words.back();
+        if (last.x + last.width > right && line.words.size() > 1) {
+          tooWide++;
+        }
+        const int16_t indent = line.words[0].x - config.marginLeft;
+        if (indent != 0 && indent != 8 * spaceWidth) {
+          wrongIndent++;
+        }
+        if (lastY >= 0) {
+          // Line, paragraph spacing, a 1.5-line top margin or a 1-line bottom margin
+          const int gap = line.words[0].y - lastY - config.lineHeight;
+          topMargin = topMargin || gap == 45;
+          bottomMargin = bottomMargin || gap == 30;
+          if (gap != 0 && gap != 12 && gap != 30 && gap != 45 && gap != config.lineHeight + 12) {
+            unexpectedGaps++;
+          }
+        }
+        lastY = line.words[0].y;
+      }
+      pageStart = page.endPosition;
+    }
+    runner.expectTrue(!styledPages.empty() && styledPages.back().second == (int)source.length() && tooWide == 0 &&
+                          wrongIndent == 0,
+                      "formatted lines fit the measure", std::to_string(tooWide) + " too wide");
+    runner.expectTrue(topMargin && bottomMargin && unexpectedGaps == 0, "margins collapse with paragraph spacing",
+                      std::to_string(unexpectedGaps) + " unexpected gaps");
+
+    // Paragraph 3 is large: its words are bold
+    const int large = (int)source.find('\n', source.find('\n', source.find('\n') + 1) + 1) + 1;
+    formatted.setPosition(large);
+    const LayoutStrategy::PageLayout heading = styled.layoutText(formatted, renderer, config);
+    runner.expectTrue(!heading.lines.empty() && heading.lines[0].words[0].style == FontStyle::BOLD &&
+                          formatted.paragraphAt(large) == 3,
+                      "large text is set in bold");
+
+    int styledFailures = 0;
+    for (size_t i = 1; i < styledPages.size(); ++i) {
+      formatted.setPosition(styledPages[i].first);
+      const int prev = styled.getPreviousPageStart(formatted, renderer, config, styledPages[i].first);
+      formatted.setPosition(prev);
+      if (styled.layoutText(formatted, renderer, config).endPosition != styledPages[i].first) {
+        styledFailures++;
+      }
+    }
+    runner.expectTrue(styledFailures == 0, "previous page ends at the current page with margins",
+                      std::to_string(styledFailures) + " of " + std::to_string(styledPages.size() - 1) + " pages");
+  }
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+/**
+ * PaginationIndexTest.cpp - Pagination Index Test
+ *
+ * Tests recording of page chains, previous-page lookup, page numbering,
+ * fingerprint invalidation and the on-disk text format.
+ */
+
+#include <iostream>
+#include <string>
+
+#include "WString.h"
+#include "test_utils.h"
+#include "text/hyphenation/HyphenationStrategy.h"
+#include "text/layout/PaginationIndex.h"
+
+static LayoutStrategy::LayoutConfig makeConfig() {
+  LayoutStrategy::LayoutConfig config;
+  config.marginLeft = 10;
+  config.marginRight = 10;
+  config.marginTop = 44;
+  config.marginBottom = 20;
+  config.lineHeight = 30;
+  config.paragraphSpacing = 15;
+  config.minSpaceWidth = 8;
+  config.pageWidth = 480;
+  config.pageHeight = 800;
+  config.alignment = LayoutStrategy::ALIGN_LEFT;
+  config.language = Language::ENGLISH;
+  return config;
+}
+
+static void testFingerprint(TestUtils::TestRunner& runner) {
+  LayoutStrategy::LayoutConfig config = makeConfig();
+  const uint32_t base = PaginationIndex::computeFingerprint("Bookerly26", config, LayoutStrategy::KNUTH_PLASS);
+
+  runner.expectTrue(base == PaginationIndex::computeFingerprint("Bookerly26", config, LayoutStrategy::KNUTH_PLASS),
+                    "Fingerprint is stable");
+  runner.expectTrue(base != PaginationIndex::computeFingerprint("Bookerly28", config, LayoutStrategy::KNUTH_PLASS),
+                    "Fingerprint covers font family");
+  runner.expectTrue(base != PaginationIndex::computeFingerprint("Bookerly26", config, LayoutStrategy::GREEDY),
+                    "Fingerprint covers layout strategy");
+
+  LayoutStrategy::LayoutConfig c = config;
+  c.marginLeft = 20;
+  runner.expectTrue(base != PaginationIndex::computeFingerprint("Bookerly26", c, LayoutStrategy::KNUTH_PLASS),
+                    "Fingerprint covers margins");
+  c = config;
+  c.lineHeight = 32;
+  runner.expectTrue(base != PaginationIndex::computeFingerprint("Bookerly26", c, LayoutStrategy::KNUTH_PLASS),
+                    "Fingerprint covers line height");
+  c = config;
+  c.pageWidth = 800;
+  c.pageHeight = 480;
+  runner.expectTrue(base != PaginationIndex::computeFingerprint("Bookerly26", c, LayoutStrategy::KNUTH_PLASS),
+                    "Fingerprint covers orientation");
+  c = config;
+  c.language = Language::GERMAN;
+  runner.expectTrue(base != PaginationIndex::computeFingerprint("Bookerly26", c, LayoutStrategy::KNUTH_PLASS),
+                    "Fingerprint covers hyphenation language");
+}
+
+static void testChain(TestUtils::TestRunner& runner) {
+  PaginationIndex index;
+  index.reset(0x1234u, 2);
+
+  // Pages that do not start at the chapter start cannot seed a chain
+  runner.expectTrue(!index.recordPage(0, 500, 900, false), "Unanchored page is ignored");
+  runner.expectTrue(index.getKnownPageCount(0) == 0, "No pages after unanchored record");
+
+  index.recordPage(0, 0, 400, false);
+  index.recordPage(0, 400, 810, false);
+  index.recordPage(0, 810, 1200, true);
+  runner.expectTrue(index.isChapterComplete(0), "Chapter 0 complete");
+  runner.expectTrue(index.getChapterPageCount(0) == 3, "Chapter 0 has 3 pages");
+  runner.expectTrue(index.getPreviousPageStart(0, 810) == 400, "Previous of page 3 is page 2");
+  runner.expectTrue(index.getPreviousPageStart(0, 400) == 0, "Previous of page 2 is page 1");
+  runner.expectTrue(index.getPreviousPageStart(0, 0) == -1, "No previous page on first page");
+  runner.expectTrue(index.getPreviousPageStart(0, 600) == -1, "Unknown start has no previous page");
+  runner.expectTrue(index.getLastPageStart(0) == 810, "Last page start of chapter 0");
+
+  // Re-recording the same page is a no-op
+  runner.expectTrue(!index.recordPage(0, 400, 810, false), "Re-recording page is a no-op");
+
+  runner.expectTrue(index.getTotalPageCount() == -1, "Total unknown while chapter 1 incomplete");
+  index.recordPage(1, 0, 300, false);
+  runner.expectTrue(index.getBookPageNumber(1, 300) == 4, "Book page number spans chapters");
+  index.recordPage(1, 300, 300, true);
+  runner.expectTrue(index.isBookComplete(), "Book complete");
+  runner.expectTrue(index.getTotalPageCount() == 5, "Book has 5 pages");
+
+  // A different layout discards everything
+  index.reset(0x5678u, 2);
+  runner.expectTrue(index.getKnownPageCount(0) == 0 && !index.isChapterComplete(0), "Fingerprint change clears");
+}
+
+static void testSerialization(TestUtils::TestRunner& runner) {
+  PaginationIndex index;
+  index.reset(0xCAFEBABEu, 3);
+  index.recordPage(0, 0, 120, false);
+  index.recordPage(0, 120, 240, true);
+  index.recordPage(2, 0, 77, false);
+  runner.expectTrue(index.isDirty(), "Index dirty after recording");
+
+  String data = index.serialize();
+
+  PaginationIndex loaded;
+  runner.expectTrue(loaded.deserialize(data, 0xCAFEBABEu), "Round trip loads");
+  runner.expectTrue(loaded.getChapterCount() == 3, "Round trip keeps chapter count");
+  runner.expectTrue(loaded.getChapterPageCount(0) == 2, "Round trip keeps complete chapter");
+  runner.expectTrue(loaded.getKnownPageCount(1) == 0, "Round trip keeps empty chapter");
+  runner.expectTrue(loaded.getKnownPageCount(2) == 2 && !loaded.isChapterComplete(2),
+                    "Round trip keeps partial chapter");
+  runner.expectTrue(loaded.getPreviousPageStart(2, 77) == 0, "Round trip keeps offsets");
+  runner.expectTrue(loaded.serialize() == data, "Re-serialization is identical");
+
+  PaginationIndex stale;
+  runner.expectTrue(!stale.deserialize(data, 0xDEADBEEFu), "Fingerprint mismatch rejected");
+  runner.expectTrue(stale.getChapterCount() == 0, "Rejected index stays empty");
+  runner.expectTrue(!stale.deserialize(String("garbage"), 0xCAFEBABEu), "Malformed data rejected");
+}
+
+int main() {
+  TestUtils::TestRunner runner("Pagination Index Test");
+
+  testFingerprint(runner);
+  testChain(runner);
+  testSerialization(runner);
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
@@ -54,15 +54,13 @@ void runTestConfiguration(const PageTestConfig& testConfig, TestUtils::TestRunne
   WordProvider& provider = TestGlobals::provider();
   LayoutStrategy& layout = TestGlobals::layout();
 
-  // Check if it's KnuthPlass for line count mismatch checking
-  KnuthPlassLayoutStrategy* knuthPlassLayout = dynamic_cast<KnuthPlassLayoutStrategy*>(&layout);
-
   LayoutStrategy::LayoutConfig layoutConfig;
   layoutConfig.marginLeft = ::TestConfig::DEFAULT_MARGIN_LEFT;
   layoutConfig.marginRight = ::TestConfig::DEFAULT_MARGIN_RIGHT;
   layoutConfig.marginTop = ::TestConfig::DEFAULT_MARGIN_TOP;
   layoutConfig.marginBottom = ::TestConfig::DEFAULT_MARGIN_BOTTOM;
   layoutConfig.lineHeight = ::TestConfig::DEFAULT_LINE_HEIGHT;
+  layoutConfig.paragraphSpacing = 0;
   layoutConfig.minSpaceWidth = ::TestConfig::DEFAULT_MIN_SPACE_WIDTH;
   layoutConfig.pageWidth = ::TestConfig::DISPLAY_WIDTH;
   layoutConfig.pageHeight = ::TestConfig::DISPLAY_HEIGHT;
@@ -84,11 +82,6 @@ void runTestConfiguration(const PageTestConfig& testConfig, TestUtils::TestRunne
 
     provider.setPosition(pageStart);
 
-    // Reset mismatch flag before layout
-    if (knuthPlassLayout) {
-      knuthPlassLayout->resetLineCountMismatch();
-    }
-
     LayoutStrategy::PageLayout pageLayout = layout.layoutText(provider, renderer, layoutConfig);
     int endPos = pageLayout.endPosition;
 
@@ -96,21 +89,6 @@ void runTestConfiguration(const PageTestConfig& testConfig, TestUtils::TestRunne
       layout.renderPage(pageLayout, renderer, layoutConfig);
     }
 
-    // Check for line count mismatch in KnuthPlass layout
-    if (knuthPlassLayout) {
-      if (knuthPlassLayout->hasLineCountMismatch()) {
-        std::string errorMsg = testConfig.name + " - Page " + std::to_string(pageIndex) +
-                               " line count mismatch - Expected " +
-                               std::to_string(knuthPlassLayout->getExpectedLineCount()) + " lines, got " +
-                               std::to_string(knuthPlassLayout->getActualLineCount());
-        std::cerr << errorMsg << "\n";
-        runner.expectTrue(false, testConfig.name + " - Line count check page " + std::to_string(pageIndex), errorMsg);
-      } else {
-        runner.expectTrue(true, testConfig.name + " - Line count check page " + std::to_string(pageIndex), "",
-                          true);  // silent=true
-      }
-    }
-
     // record the start and end positions for this page
     pageRanges.push_back(std::make_pair(pageStart, endPos));
 
@@ -180,12 +158,12 @@ void runTestConfiguration(const PageTestConfig& testConfig, TestUtils::TestRunne
     }
 
     if (testConfig.incrementalMode) {
-      // Move one word forward from the start of the current page
+      // Move one line forward from the start of the current page: lay out a
+      // page that holds a single line, so the line breaks are the layout's own
       provider.setPosition(pageStart);
-      bool dummy;
-      layout.test_getNextLineDefault(
-          provider, renderer, layoutConfig.pageWidth - layoutConfig.marginLeft - layoutConfig.marginRight, dummy);
-      int nextPos = provider.getCurrentIndex();
+      LayoutStrategy::LayoutConfig oneLine = layoutConfig;
+      oneLine.pageHeight = layoutConfig.marginTop + layoutConfig.lineHeight + layoutConfig.marginBottom;
+      int nextPos = layout.layoutText(provider, renderer, oneLine).endPosition;
 
       // If we can't move forward, we're done
       if (nextPos <= pageStart) {
@@ -0,0 +1,185 @@
+/**
+ * CssSelectorTest.cpp - Compiled CSS Selector Test
+ *
+ * Parses a small stylesheet and resolves compiled element paths against it:
+ * element, class, element.class and descendant selectors, the cascade by
+ * specificity and source order, skipped unsupported selectors, the
+ * per-class view used by getStyleForClass() and the margin and font-size
+ * values. Also feeds the tokenizer comments, strings and @-rules across read
+ * chunk boundaries, an oversized rule and a block left open at the end.
+ */
+
+#include <string>
+#include <vector>
+
+#include "content/css/CssParser.h"
+#include "test_utils.h"
+
+static const char* kStylesheet = R"(
+  p { text-align: justify; }
+  .center { text-align: center; }
+  p.right { text-align: right; }
+  .note p { font-style: italic; }
+  div.chapter .note span { font-weight: bold; }
+  h1, .title { text-align: center; font-weight: bold; }
+  .late { text-align: left; }
+  .later { text-align: right; }
+  p:first-child, #intro, a > b, p.x.y, [lang] { text-align: center; }
+  .unsupported { color: red; }
+  P.Mixed { text-indent: 2em; }
+)";
+
+static bool parseStylesheet(CssParser& parser, const std::string& css) {
+  const char* path = "css_selector_test.css";
+  File file = SD.open(path, FILE_WRITE);
+  if (!file) {
+    return false;
+  }
+  file.write((const uint8_t*)css.data(), css.size());
+  file.close();
+  const bool ok = parser.parseFile(path);
+  SD.remove(path);
+  return ok;
+}
+
+// Resolve the last of a list of (tag, class attribute) pairs, outermost first
+static CssStyle resolvePath(const CssParser& parser, const std::vector<std::pair<const char*, const char*>>& tags) {
+  std::vector<CssParser::Element> path;
+  for (const auto& tag : tags) {
+    path.push_back(parser.compileElement(tag.first, tag.second));
+  }
+  return parser.resolve(path.data(), path.size());
+}
+
+int main() {
+  TestUtils::TestRunner runner("CSS Selector Test");
+  CssParser parser;
+  runner.expectTrue(parseStylesheet(parser, kStylesheet), "stylesheet parses");
+
+  // 10 supported selectors; the pseudo-class, id, child, multi-class, attribute
+  // and property-less rules are dropped
+  runner.expectTrue(parser.getStyleCount() == 10, "unsupported selectors skipped",
+                    std::to_string(parser.getStyleCount()));
+
+  CssStyle style = resolvePath(parser, {{"body", ""}, {"p", ""}});
+  runner.expectTrue(style.hasTextAlign && style.textAlign == TextAlign::Justify, "element selector");
+  style = resolvePath(parser, {{"div", "center"}});
+  runner.expectTrue(style.hasTextAlign && style.textAlign == TextAlign::Center, "class selector");
+  style = resolvePath(parser, {{"div", "right"}});
+  runner.expectTrue(!style.hasTextAlign, "element.class does not match another element");
+
+  // p.right (0,1,1) beats .center (0,1,0) beats p (0,0,1), whatever the class order
+  style = resolvePath(parser, {{"p", "center right"}});
+  runner.expectTrue(style.textAlign == TextAlign::Right, "higher specificity wins");
+  style = resolvePath(parser, {{"p", "right center"}});
+  runner.expectTrue(style.textAlign == TextAlign::Right, "class attribute order does not matter");
+  style = resolvePath(parser, {{"p", "center"}});
+  runner.expectTrue(style.textAlign == TextAlign::Center, "class beats element");
+
+  // Equal specificity: the later rule wins
+  style = resolvePath(parser, {{"span", "later late"}});
+  runner.expectTrue(style.textAlign == TextAlign::Right, "source order breaks ties");
+
+  // Descendant selectors
+  style = resolvePath(parser, {{"div", "note"}, {"blockquote", ""}, {"p", ""}});
+  runner.expectTrue(style.hasFontStyle && style.fontStyle == CssFontStyle::Italic &&
+                        style.textAlign == TextAlign::Justify,
+                    "descendant selector through an unrelated ancestor");
+  style = resolvePath(parser, {{"div", ""}, {"p", ""}});
+  runner.expectTrue(!style.hasFontStyle, "descendant selector needs its ancestor");
+  style = resolvePath(parser, {{"div", "chapter"}, {"section", "note"}, {"p", ""}, {"span", ""}});
+  runner.expectTrue(style.hasFontWeight && style.fontWeight == CssFontWeight::Bold, "three compound descendant");
+  style = resolvePath(parser, {{"section", "note"}, {"div", "chapter"}, {"span", ""}});
+  runner.expectTrue(!style.hasFontWeight, "ancestors must be in order");
+
+  // Comma-separated selectors share the declaration block
+  style = resolvePath(parser, {{"h1", ""}});
+  const CssStyle title = resolvePath(parser, {{"div", "title"}});
+  runner.expectTrue(style.fontWeight == CssFontWeight::Bold && title.fontWeight == CssFontWeight::Bold,
+                    "selector list");
+
+  // Tag names are case-insensitive, class names are not; unknown names are dropped
+  style = resolvePath(parser, {{"p", "Mixed"}});
+  runner.expectTrue(style.hasTextIndent && style.textIndent == 32, "upper case tag name in the stylesheet");
+  style = resolvePath(parser, {{"p", "mixed"}});
+  runner.expectTrue(!style.hasTextIndent, "class names are case-sensitive");
+  const CssParser::Element element = parser.compileElement("p", " unknown center  center ");
+  runner.expectTrue(element.classCount == 1, "unknown and repeated classes dropped",
+                    std::to_string(element.classCount));
+
+  // Names of dropped rules are never interned ("a > b", ".unsupported", "p.x.y")
+  const CssParser::Element dropped = parser.compileElement("a", "unsupported x y");
+  runner.expectTrue(dropped.name == CssParser::kNoId && dropped.classCount == 0, "names of dropped rules not interned");
+
+  // Per-class view
+  const CssStyle* right = parser.getStyleForClass("right");
+  runner.expectTrue(right != nullptr && right->textAlign == TextAlign::Right, "getStyleForClass");
+  runner.expectTrue(parser.getStyleForClass("unsupported") == nullptr && parser.getStyleForClass("p") == nullptr,
+                    "getStyleForClass ignores property-less rules and tag names");
+
+  // Margins (shorthand and longhand) and font sizes in the units books use
+  style = parser.parseInlineStyle("margin: 1em 0 2em; font-size: 150%");
+  runner.expectTrue(style.hasMarginTop && style.marginTop == 16 && style.hasMarginBottom && style.marginBottom == 32 &&
+                        style.fontSize == 150,
+                    "margin shorthand and percent font size");
+  style = parser.parseInlineStyle("margin: 12pt; margin-bottom: -1em; font-size: x-large");
+  const CssStyle pixels = parser.parseInlineStyle("margin-top: auto; font-size: 24px");
+  runner.expectTrue(style.marginTop == 16 && style.hasMarginBottom && style.marginBottom == 0 && style.fontSize == 150 &&
+                        !pixels.hasMarginTop && pixels.fontSize == 150,
+                    "points, negative margins, keywords and pixels");
+  runner.expectTrue(parser.parseInlineStyle("margin: 1em 0 2em").marginTopEm && !style.marginTopEm,
+                    "em lengths flagged to scale with the font size");
+  style.merge(parser.parseInlineStyle("margin-top: 0.5em"));
+  runner.expectTrue(style.marginTopEm && style.marginTop == 8 && style.marginBottom == 0, "em flag merged with its value");
+
+  // A zero indent overrides an earlier one; negative indents are ignored
+  CssParser indents;
+  runner.expectTrue(parseStylesheet(indents, "p { text-indent: 1.5em; } p.first { text-indent: 0; } "
+                                             ".hang { text-indent: -1em; }") &&
+                        indents.getStyleCount() == 2,
+                    "zero indent rule kept, negative indent rule dropped", std::to_string(indents.getStyleCount()));
+  style = resolvePath(indents, {{"p", "first"}});
+  const CssStyle hanging = resolvePath(indents, {{"p", "hang"}});
+  runner.expectTrue(style.hasTextIndent && style.textIndent == 0 && hanging.textIndent == 24,
+                    "text-indent: 0 overrides an inherited indent");
+  style = resolvePath(indents, {{"p", ""}});
+  style.merge(parser.parseInlineStyle("text-indent: 0px"));
+  runner.expectTrue(style.hasTextIndent && style.textIndent == 0, "inline text-indent: 0 overrides the stylesheet");
+
+  parser.clear();
+  runner.expectTrue(!parser.hasStyles() && resolvePath(parser, {{"p", "center"}}).isEmpty(), "clear");
+
+  // Comments, quoted braces and @-rules at every offset around the read chunk size
+  const std::string tricky =
+      "/* .a { text-align: left } */ .a { text-align: right; }\n"
+      "@import url(\"x.css\");\n"
+      "@media screen { .b { text-align: left; } p { margin: 0 } }\n"
+      "@font-face { font-family: \"F\"; src: url(\"f}.ttf\"); }\n"
+      ".b { content: \"}{\"; /* } */ font-style: italic; }\n"
+      ".c/**/{ font-weight: bold }";
+  bool tokenized = true;
+  for (int pad = 480; pad < 560 && tokenized; pad++) {
+    CssParser chunked;
+    tokenized = parseStylesheet(chunked, std::string(pad, ' ') + tricky) && chunked.getStyleCount() == 3 &&
+                resolvePath(chunked, {{"p", "a"}}).textAlign == TextAlign::Right &&
+                resolvePath(chunked, {{"p", "b"}}).fontStyle == CssFontStyle::Italic &&
+                !resolvePath(chunked, {{"p", "b"}}).hasTextAlign &&
+                resolvePath(chunked, {{"p", "c"}}).fontWeight == CssFontWeight::Bold;
+  }
+  runner.expectTrue(tokenized, "comments, strings and @-rules across chunks");
+
+  // A rule too long to collect is skipped, the next one is not; a block
+  // left open at the end of the file still counts
+  std::string oversized;
+  for (int i = 0; i < 1000; i++) {
+    oversized += ".long" + std::to_string(i) + ", ";
+  }
+  oversized += ".long { text-align: center; }\n.after { text-align: right; }\n.open { font-style: italic";
+  parser.clear();
+  runner.expectTrue(parseStylesheet(parser, oversized) && parser.getStyleForClass("long") == nullptr &&
+                        parser.getStyleForClass("after") != nullptr && parser.getStyleForClass("open") != nullptr,
+                    "oversized rule skipped, unterminated block kept", std::to_string(parser.getStyleCount()));
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
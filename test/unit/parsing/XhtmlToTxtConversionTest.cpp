@@ -8,8 +8,10 @@
  * - &nbsp; for intentional blank lines
  * - <br/> handling
  * - Whitespace normalization
+ * - Paragraph format tokens and the per-book element style memo
  */
 
+#include <cstdio>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -18,6 +20,7 @@
 
 #include "content/providers/EpubWordProvider.h"
 #include "content/xml/SimpleXmlParser.h"
+#include "lib/miniz.h"
 #include "test_globals.h"
 #include "test_utils.h"
 
@@ -59,6 +62,34 @@ void printWithMarkers(const std::string& text) {
   std::cout << "\n--- End Output ---\n";
 }
 
+/**
+ * Value at byte offset of the ESC 'P' format token on the needle's line: 0
+ * when there is none, -1 when the needle is missing
+ */
+int formatValueBefore(const std::string& output, const std::string& needle, size_t offset) {
+  size_t pos = output.find(needle);
+  if (pos == std::string::npos)
+    return -1;
+  size_t lineStart = output.rfind('\n', pos);
+  lineStart = lineStart == std::string::npos ? 0 : lineStart + 1;
+  size_t token = output.find(std::string("\x1B") + FileWordProvider::kFormatCommand, lineStart);
+  if (token == std::string::npos || token > pos)
+    return 0;
+  return output[token + offset] - '0';
+}
+
+int formatIndentBefore(const std::string& output, const std::string& needle) {
+  return formatValueBefore(output, needle, 2);
+}
+
+int formatMarginTopBefore(const std::string& output, const std::string& needle) {
+  return formatValueBefore(output, needle, 3);
+}
+
+int formatMarginBottomBefore(const std::string& output, const std::string& needle) {
+  return formatValueBefore(output, needle, FileWordProvider::kFormatMarginBottomOffset);
+}
+
 /**
  * Count occurrences of a substring
  */
@@ -303,6 +334,162 @@ void testInlineStyleStacking(TestUtils::TestRunner& runner) {
   }
 }
 
+/**
+ * Write a one-chapter EPUB with a stylesheet
+ */
+bool writeTestEpub(const char* path, const std::string& css, const std::string& xhtml) {
+  const std::string container =
+      "<?xml version=\"1.0\"?><container version=\"1.0\" "
+      "xmlns=\"urn:oasis:names:tc:opendocument:xmlns:container\"><rootfiles>"
+      "<rootfile full-path=\"OEBPS/content.opf\" media-type=\"application/oebps-package+xml\"/>"
+      "</rootfiles></container>";
+  const std::string opf =
+      "<?xml version=\"1.0\"?><package xmlns=\"http://www.idpf.org/2007/opf\" version=\"2.0\">"
+      "<metadata><dc:title xmlns:dc=\"http://purl.org/dc/elements/1.1/\">Memo</dc:title></metadata><manifest>"
+      "<item id=\"c1\" href=\"c1.xhtml\" media-type=\"application/xhtml+xml\"/>"
+      "<item id=\"css\" href=\"style.css\" media-type=\"text/css\"/>"
+      "</manifest><spine><itemref idref=\"c1\"/></spine></package>";
+  const std::string mimetype = "application/epub+zip";
+
+  std::remove(path);
+  mz_zip_archive zip = {};
+  if (!mz_zip_writer_init_file(&zip, path, 0))
+    return false;
+  bool ok = mz_zip_writer_add_mem(&zip, "mimetype", mimetype.data(), mimetype.size(), MZ_NO_COMPRESSION) &&
+            mz_zip_writer_add_mem(&zip, "META-INF/container.xml", container.data(), container.size(),
+                                  MZ_DEFAULT_COMPRESSION) &&
+            mz_zip_writer_add_mem(&zip, "OEBPS/content.opf", opf.data(), opf.size(), MZ_DEFAULT_COMPRESSION) &&
+            mz_zip_writer_add_mem(&zip, "OEBPS/style.css", css.data(), css.size(), MZ_DEFAULT_COMPRESSION) &&
+            mz_zip_writer_add_mem(&zip, "OEBPS/c1.xhtml", xhtml.data(), xhtml.size(), MZ_DEFAULT_COMPRESSION);
+  ok = mz_zip_writer_finalize_archive(&zip) && ok;
+  mz_zip_writer_end(&zip);
+  return ok;
+}
+
+/**
+ * Test the per-book memo of resolved element styles: repeated classes hit
+ * it, while other ancestors or inline styles get entries of their own
+ */
+void testStyleMemo(TestUtils::TestRunner& runner) {
+  std::cout << "\n=== Test: Element style memo ===\n";
+  const char* epubPath = "style_memo_test.epub";
+  const char* extractDir = "test/output/epub_style_memo_test";
+  // Converted chapters left by an earlier run would be reused
+  fs::remove_all(extractDir);
+  fs::create_directories("test/output");
+
+  const std::string css = ".note { text-indent: 1em; } blockquote .note { text-indent: 2em; }";
+  const std::string xhtml =
+      "<html><head><title>Memo</title></head><body>"
+      "<p class=\"note\">First</p>"
+      "<p class=\"note\">Second</p>"  // Memo hit
+      "<blockquote><p class=\"note\">Quoted</p></blockquote>"
+      "<p class=\"note\" style=\"text-indent:3em\">InlineWide</p>"
+      "<p class=\"note\" style=\"text-indent:0.5em\">InlineNarrow</p>"
+      "<p class=\"note\">Again</p>"  // Memo hit
+      "</body></html>";
+  if (!writeTestEpub(epubPath, css, xhtml)) {
+    runner.expectTrue(false, "Should be able to write test EPUB");
+    return;
+  }
+
+  {
+    EpubWordProvider provider(epubPath);
+    runner.expectTrue(provider.isValid() && provider.setChapter(0), "Provider should open the memo test chapter");
+
+    std::string output = readFileContents(std::string(extractDir) + "/OEBPS/c1.txt");
+    printWithMarkers(output);
+
+    // Quarter ems of the indents
+    runner.expectTrue(formatIndentBefore(output, "First") == 4 && formatIndentBefore(output, "Second") == 4 &&
+                          formatIndentBefore(output, "Again") == 4,
+                      "Repeated class should resolve the same from the memo");
+    runner.expectTrue(formatIndentBefore(output, "Quoted") == 8,
+                      "Same class under blockquote should match the descendant selector");
+    runner.expectTrue(formatIndentBefore(output, "InlineWide") == 12 && formatIndentBefore(output, "InlineNarrow") == 2,
+                      "Same class with different inline styles should not share an entry");
+
+    // Misses: First, blockquote, Quoted, InlineWide, InlineNarrow
+    const EpubWordProvider::ConversionTimings& timings = provider.getLastConversionTimings();
+    std::cout << "Style memo: " << timings.styleMemoHits << " hits, " << timings.styleMemoMisses << " misses\n";
+    runner.expectTrue(timings.styleMemoHits == 2 && timings.styleMemoMisses == 5,
+                      "Conversion timings should count style memo hits and misses");
+  }
+  std::remove(epubPath);
+}
+
+/**
+ * Test: a <br/> after the conversion buffer was flushed mid-line still clears
+ * the bottom margin of the wrapped line
+ */
+void testMarginBottomAcrossFlush(TestUtils::TestRunner& runner) {
+  std::cout << "\n=== Test: margin-bottom across a buffer flush ===\n";
+  const char* epubPath = "margin_flush_test.epub";
+  const char* extractDir = "test/output/epub_margin_flush_test";
+  fs::remove_all(extractDir);
+  fs::create_directories("test/output");
+
+  // Longer than the 2048-byte flush threshold before the <br/>
+  std::string longLine = "Head";
+  while (longLine.size() < 3000) {
+    longLine += " lorem ipsum";
+  }
+  const std::string xhtml = "<html><head><title>Flush</title></head><body>"
+                            "<p style=\"margin-bottom:1em\">" +
+                            longLine + "<br/>Tail</p></body></html>";
+  if (!writeTestEpub(epubPath, "", xhtml)) {
+    runner.expectTrue(false, "Should be able to write test EPUB");
+    return;
+  }
+
+  {
+    EpubWordProvider provider(epubPath);
+    runner.expectTrue(provider.isValid() && provider.setChapter(0), "Provider should open the flush test chapter");
+
+    std::string output = readFileContents(std::string(extractDir) + "/OEBPS/c1.txt");
+    runner.expectTrue(formatMarginBottomBefore(output, "Head") == 0,
+                      "Line before <br/> should lose the bottom margin even after a flush");
+    runner.expectTrue(formatMarginBottomBefore(output, "Tail") == 4, "Last line should keep the bottom margin");
+  }
+  std::remove(epubPath);
+}
+
+/**
+ * Test: em lengths scale with the element's font size, pixel lengths do not
+ */
+void testLengthUnits(TestUtils::TestRunner& runner) {
+  std::cout << "\n=== Test: length units and font size ===\n";
+  const char* epubPath = "length_units_test.epub";
+  const char* extractDir = "test/output/epub_length_units_test";
+  fs::remove_all(extractDir);
+  fs::create_directories("test/output");
+
+  const std::string xhtml =
+      "<html><head><title>Units</title></head><body>"
+      "<h1 style=\"margin-top:12px\">PxHeading</h1>"
+      "<p style=\"margin-top:12px\">PxBody</p>"
+      "<h1 style=\"margin-top:1em\">EmHeading</h1>"  // 1em at 200% -> 8 quarter ems
+      "<p style=\"margin-top:1em\">EmBody</p>"
+      "</body></html>";
+  if (!writeTestEpub(epubPath, "", xhtml)) {
+    runner.expectTrue(false, "Should be able to write test EPUB");
+    return;
+  }
+
+  {
+    EpubWordProvider provider(epubPath);
+    runner.expectTrue(provider.isValid() && provider.setChapter(0), "Provider should open the units test chapter");
+
+    std::string output = readFileContents(std::string(extractDir) + "/OEBPS/c1.txt");
+    printWithMarkers(output);
+    runner.expectTrue(formatMarginTopBefore(output, "PxHeading") == 3 && formatMarginTopBefore(output, "PxBody") == 3,
+                      "Pixel margin should be the same on a heading and on body text");
+    runner.expectTrue(formatMarginTopBefore(output, "EmHeading") == 8 && formatMarginTopBefore(output, "EmBody") == 4,
+                      "Em margin should scale with the heading's font size");
+  }
+  std::remove(epubPath);
+}
+
 int main() {
   std::cout << "========================================\n";
   std::cout << "XHTML to TXT Conversion Test\n";
@@ -388,16 +575,16 @@ int main() {
   };
   testInlineCssBaseAndOverrides(runner);
 
-  // New test: text-indent -> spaces mapping
+  // New test: text-indent -> paragraph format token (indent in quarter ems)
   auto testTextIndentMapping = [&](TestUtils::TestRunner& r) {
-    std::cout << "\n=== Test: text-indent to spaces mapping ===\n";
+    std::cout << "\n=== Test: text-indent to paragraph format ===\n";
     const char* indentHtmlPath = "C:/Users/Patrick/Desktop/microreader/resources/books/text_indent_test.html";
 
     std::string html =
         "<html><head><title>IndentTest</title></head><body>"
-        "<p style=\"text-indent:20px\">PxIndent</p>"   // 20px -> round(20/8)=3
-        "<p style=\"text-indent:1.5em\">EmIndent</p>"  // 1.5em -> 24px -> 3
-        "<p style=\"text-indent:4px\">TinyIndent</p>"  // 4px -> round(4/8)=0 -> no indent
+        "<p style=\"text-indent:20px\">PxIndent</p>"   // 20px -> 20/4 = 5 quarter ems
+        "<p style=\"text-indent:1.5em\">EmIndent</p>"  // 1.5em -> 24px -> 6 quarter ems
+        "<p style=\"text-indent:1px\">TinyIndent</p>"  // 1px rounds to 0 -> no format token
         "</body></html>";
 
     // Write file
@@ -424,35 +611,22 @@ int main() {
 
     printWithMarkers(output);
 
-    auto countLeadingSpacesBefore = [&](const std::string& needle) {
-      size_t pos = output.find(needle);
-      if (pos == std::string::npos)
-        return -1;
-      int spaces = 0;
-      for (int i = (int)pos - 1; i >= 0; --i) {
-        if (output[i] == '\n')
-          break;
-        if (output[i] == ' ')
-          spaces++;
-        else
-          spaces = 0;
-      }
-      return spaces;
-    };
-
-    int sPx = countLeadingSpacesBefore("PxIndent");
-    int sEm = countLeadingSpacesBefore("EmIndent");
-    int sTiny = countLeadingSpacesBefore("TinyIndent");
+    int sPx = formatIndentBefore(output, "PxIndent");
+    int sEm = formatIndentBefore(output, "EmIndent");
+    int sTiny = formatIndentBefore(output, "TinyIndent");
 
-    std::cout << "Spaces before PxIndent: " << sPx << "\n";
-    std::cout << "Spaces before EmIndent: " << sEm << "\n";
-    std::cout << "Spaces before TinyIndent: " << sTiny << "\n";
+    std::cout << "Indent before PxIndent: " << sPx << "\n";
+    std::cout << "Indent before EmIndent: " << sEm << "\n";
+    std::cout << "Indent before TinyIndent: " << sTiny << "\n";
 
-    r.expectTrue(sPx >= 3, "20px indent should map to >=3 spaces (round(px/8))");
-    r.expectTrue(sEm >= 3, "1.5em indent should map to >=3 spaces");
-    r.expectTrue(sTiny == 0, "4px indent should map to 0 spaces (ignored)");
+    r.expectTrue(sPx == 5, "20px indent should map to 5 quarter ems");
+    r.expectTrue(sEm == 6, "1.5em indent should map to 6 quarter ems");
+    r.expectTrue(sTiny == 0, "1px indent should be dropped");
   };
   testTextIndentMapping(runner);
+  testStyleMemo(runner);
+  testMarginBottomAcrossFlush(runner);
+  testLengthUnits(runner);
 
   std::cout << "\n========================================\n";
   runner.printSummary();
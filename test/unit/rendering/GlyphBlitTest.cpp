@@ -0,0 +1,225 @@
+/**
+ * GlyphBlitTest.cpp - Glyph Blitter Equivalence Test
+ *
+ * Renders text with TextRenderer's byte-wise glyph blitter and with a
+ * per-pixel reference built on drawPixel, in every orientation and bitmap
+ * plane, including glyphs clipped at each panel edge. The framebuffers must
+ * be bit-identical. Also checks that the single-pass BITMAP_ALL_PLANES mode
+ * produces the same three planes as three separate passes, and that a
+ * run-length coded copy of the font draws exactly like the planar one.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/EInkDisplay.h"
+#include "rendering/GlyphRle.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_utils.h"
+
+static const char* kSample = "Hello, w\xC3\xB6rld! The quick brown fox \xE2\x80\x94 jumps over the lazy dog. \xC3\x84\xC3\x96\xC3\x9C\xC3\x9F 0123";
+
+// Reference: the original per-pixel glyph loop, drawn through drawPixel.
+static void drawReference(TextRenderer& r, const SimpleGFXfont* f, TextRenderer::BitmapType type, int16_t x,
+                          int16_t y, const char* text) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(text);
+  while (*p) {
+    uint32_t cp = *p++;
+    if (cp >= 0xC0) {
+      int extra = cp >= 0xF0 ? 3 : (cp >= 0xE0 ? 2 : 1);
+      cp &= (0x3F >> extra);
+      for (int i = 0; i < extra && *p; ++i) {
+        cp = (cp << 6) | (*p++ & 0x3F);
+      }
+    }
+    int gi = findGlyphIndex(f, cp);
+    if (gi < 0) {
+      x += 6;
+      continue;
+    }
+    const SimpleGFXglyph& g = f->glyph[gi];
+    const uint8_t* bitmap =
+        type == TextRenderer::BITMAP_BW ? f->bitmap : (type == TextRenderer::BITMAP_GRAY_LSB ? f->bitmap_gray_lsb
+                                                                                          : f->bitmap_gray_msb);
+    const uint8_t stride = (g.width + 7) / 8;
+    for (uint8_t yy = 0; yy < g.height; ++yy) {
+      for (uint8_t xx = 0; xx < g.width; ++xx) {
+        const uint16_t bi = g.bitmapOffset + yy * stride + xx / 8;
+        const uint8_t mask = 1 << (7 - (xx % 8));
+        const int16_t px = x + g.xOffset + xx;
+        const int16_t py = y + g.yOffset + yy;
+        if (type != TextRenderer::BITMAP_BW) {
+          if ((f->bitmap_gray_lsb[bi] & mask) == 0 || (f->bitmap_gray_msb[bi] & mask) == 0) {
+            r.drawPixel(px, py, (bitmap[bi] & mask) == 0);
+          }
+        } else if ((bitmap[bi] & mask) == 0) {
+          r.drawPixel(px, py, true);
+        }
+      }
+    }
+    x += g.xAdvance;
+  }
+}
+
+// Run-length coded copy of a planar font; `data` and `glyphs` back the result.
+static SimpleGFXfont makeRleFont(const SimpleGFXfont* src, std::vector<uint8_t>& data,
+                                 std::vector<SimpleGFXglyph>& glyphs) {
+  glyphs.assign(src->glyph, src->glyph + src->glyphCount);
+  data.clear();
+  for (SimpleGFXglyph& g : glyphs) {
+    const uint16_t planarOffset = g.bitmapOffset;
+    g.bitmapOffset = (uint16_t)data.size();
+    const size_t n = GlyphRle::encodeGlyph(src->bitmap + planarOffset, src->bitmap_gray_lsb + planarOffset,
+                                           src->bitmap_gray_msb + planarOffset, g.width, g.height, nullptr);
+    data.resize(data.size() + n);
+    GlyphRle::encodeGlyph(src->bitmap + planarOffset, src->bitmap_gray_lsb + planarOffset,
+                          src->bitmap_gray_msb + planarOffset, g.width, g.height, data.data() + g.bitmapOffset);
+  }
+  SimpleGFXfont font = *src;
+  font.bitmap = data.data();
+  font.bitmap_gray_lsb = nullptr;
+  font.bitmap_gray_msb = nullptr;
+  font.glyph = glyphs.data();
+  font.bitmapFormat = FONT_BITMAP_RLE_GRAY;
+  return font;
+}
+
+int main() {
+  TestUtils::TestRunner runner("Glyph Blit Test");
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+
+  std::vector<uint8_t> actual(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> expected(EInkDisplay::BUFFER_SIZE);
+
+  const char* orientationNames[] = {"Portrait", "LandscapeClockwise", "PortraitInverted",
+                                    "LandscapeCounterClockwise"};
+  const char* planeNames[] = {"BW", "GRAY_LSB", "GRAY_MSB"};
+
+  for (int o = 0; o < 4; ++o) {
+    for (int plane = 0; plane < 3; ++plane) {
+      int mismatches = 0;
+      for (int pos = 0; pos < 40; ++pos) {
+        // Walk the text diagonally across and past every panel edge
+        const int16_t x = -60 + pos * 23;
+        const int16_t y = -20 + pos * 21;
+        for (size_t i = 0; i < actual.size(); ++i) {
+          actual[i] = expected[i] = (uint8_t)(i * 37 + 11);  // non-uniform background
+        }
+
+        renderer.setOrientation(static_cast<TextRenderer::Orientation>(o));
+        renderer.setBitmapType(static_cast<TextRenderer::BitmapType>(plane));
+        renderer.setFontFamily(&bookerly26Family);
+        renderer.setFontStyle(FontStyle::REGULAR);
+
+        renderer.setFrameBuffer(actual.data());
+        renderer.setCursor(x, y);
+        renderer.print(kSample);
+
+        renderer.setFrameBuffer(expected.data());
+        drawReference(renderer, bookerly26Family.regular, static_cast<TextRenderer::BitmapType>(plane), x, y,
+                      kSample);
+
+        if (actual != expected) {
+          ++mismatches;
+        }
+      }
+      runner.expectTrue(mismatches == 0, std::string(orientationNames[o]) + " " + planeNames[plane],
+                        std::to_string(mismatches) + " of 40 positions differ");
+    }
+  }
+
+  // Single pass over all planes vs. one pass per plane
+  std::vector<uint8_t> lsbPlane(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> msbPlane(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> single(EInkDisplay::BUFFER_SIZE);
+  for (int o = 0; o < 4; ++o) {
+    int mismatches = 0;
+    for (int pos = 0; pos < 40; ++pos) {
+      const int16_t x = -60 + pos * 23;
+      const int16_t y = -20 + pos * 21;
+      renderer.setOrientation(static_cast<TextRenderer::Orientation>(o));
+      renderer.setFontFamily(&bookerly26Family);
+      renderer.setFontStyle(FontStyle::REGULAR);
+
+      std::fill(actual.begin(), actual.end(), 0xFF);
+      std::fill(lsbPlane.begin(), lsbPlane.end(), 0xFF);
+      std::fill(msbPlane.begin(), msbPlane.end(), 0xFF);
+      renderer.setFrameBuffer(actual.data());
+      renderer.setGrayscalePlanes(lsbPlane.data(), msbPlane.data());
+      renderer.setBitmapType(TextRenderer::BITMAP_ALL_PLANES);
+      renderer.setCursor(x, y);
+      renderer.print(kSample);
+      renderer.setGrayscalePlanes(nullptr, nullptr);
+
+      const std::vector<uint8_t>* planes[] = {&actual, &lsbPlane, &msbPlane};
+      for (int plane = 0; plane < 3; ++plane) {
+        std::fill(single.begin(), single.end(), 0xFF);
+        renderer.setFrameBuffer(single.data());
+        renderer.setBitmapType(static_cast<TextRenderer::BitmapType>(plane));
+        renderer.setCursor(x, y);
+        renderer.print(kSample);
+        if (single != *planes[plane]) {
+          ++mismatches;
+        }
+      }
+    }
+    runner.expectTrue(mismatches == 0, std::string(orientationNames[o]) + " ALL_PLANES",
+                      std::to_string(mismatches) + " of 120 planes differ");
+  }
+
+  // Run-length coded font vs. the planar original, every orientation and plane
+  std::vector<uint8_t> rleData;
+  std::vector<SimpleGFXglyph> rleGlyphs;
+  SimpleGFXfont rleFont = makeRleFont(bookerly26Family.regular, rleData, rleGlyphs);
+  const char* allPlaneNames[] = {"BW", "GRAY_LSB", "GRAY_MSB", "ALL_PLANES"};
+  std::vector<uint8_t> expectedLsb(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> expectedMsb(EInkDisplay::BUFFER_SIZE);
+  for (int o = 0; o < 4; ++o) {
+    for (int plane = 0; plane < 4; ++plane) {
+      const TextRenderer::BitmapType type = static_cast<TextRenderer::BitmapType>(plane);
+      int mismatches = 0;
+      for (int pos = 0; pos < 40; ++pos) {
+        const int16_t x = -60 + pos * 23;
+        const int16_t y = -20 + pos * 21;
+        for (size_t i = 0; i < actual.size(); ++i) {
+          actual[i] = expected[i] = (uint8_t)(i * 37 + 11);
+          lsbPlane[i] = expectedLsb[i] = (uint8_t)(i * 13 + 5);
+          msbPlane[i] = expectedMsb[i] = (uint8_t)(i * 29 + 3);
+        }
+        renderer.setOrientation(static_cast<TextRenderer::Orientation>(o));
+        renderer.setBitmapType(type);
+
+        renderer.setFont(bookerly26Family.regular);
+        renderer.setFrameBuffer(expected.data());
+        renderer.setGrayscalePlanes(expectedLsb.data(), expectedMsb.data());
+        renderer.setCursor(x, y);
+        renderer.print(kSample);
+
+        renderer.setFont(&rleFont);
+        renderer.setFrameBuffer(actual.data());
+        renderer.setGrayscalePlanes(lsbPlane.data(), msbPlane.data());
+        renderer.setCursor(x, y);
+        renderer.print(kSample);
+
+        if (actual != expected || lsbPlane != expectedLsb || msbPlane != expectedMsb) {
+          ++mismatches;
+        }
+      }
+      runner.expectTrue(mismatches == 0, std::string(orientationNames[o]) + " RLE " + allPlaneNames[plane],
+                        std::to_string(mismatches) + " of 40 positions differ");
+    }
+  }
+  renderer.setGrayscalePlanes(nullptr, nullptr);
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
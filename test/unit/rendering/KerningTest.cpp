@@ -0,0 +1,142 @@
+/**
+ * KerningTest.cpp - Kerning Pair Table Test
+ *
+ * Gives a copy of a built-in font a small kerning table and checks the pair
+ * lookup, that measured widths include the pairs (through the word-width
+ * cache and without it), and that drawing a kerned pair matches drawing its
+ * glyphs separately at the kerned position.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "core/EInkDisplay.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_utils.h"
+
+struct KernedFont {
+  std::vector<uint16_t> index;
+  std::vector<uint16_t> second;
+  std::vector<int8_t> adjust;
+  SimpleGFXkerning kerning;
+  SimpleGFXfont font;
+};
+
+// Kerning table for `pairs` (two characters each) moved by `pixels`
+static void makeKernedFont(const SimpleGFXfont* src, const std::vector<std::string>& pairs,
+                           const std::vector<int>& pixels, KernedFont& out) {
+  struct Pair {
+    int first, second, px;
+  };
+  std::vector<Pair> sorted;
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    sorted.push_back({findGlyphIndex(src, (uint8_t)pairs[i][0]), findGlyphIndex(src, (uint8_t)pairs[i][1]), pixels[i]});
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const Pair& a, const Pair& b) { return a.first != b.first ? a.first < b.first : a.second < b.second; });
+  const int indexCount = sorted.back().first + 1;
+  size_t pos = 0;
+  for (int first = 0; first <= indexCount; ++first) {
+    while (pos < sorted.size() && sorted[pos].first < first) {
+      ++pos;
+    }
+    out.index.push_back((uint16_t)pos);
+  }
+  for (const Pair& p : sorted) {
+    out.second.push_back((uint16_t)p.second);
+    out.adjust.push_back((int8_t)p.px);
+  }
+  out.kerning = {out.index.data(), out.second.data(), out.adjust.data(), (uint16_t)indexCount};
+  out.font = *src;
+  out.font.kerning = &out.kerning;
+}
+
+static uint16_t widthOf(TextRenderer& r, const char* s) {
+  int16_t x1, y1;
+  uint16_t w, h;
+  r.getTextBounds(s, 0, 0, &x1, &y1, &w, &h);
+  return w;
+}
+
+int main() {
+  TestUtils::TestRunner runner("Kerning Test");
+
+  const SimpleGFXfont* plain = bookerly26Family.regular;
+  KernedFont kerned;
+  makeKernedFont(plain, {"AV", "VA", "To", "Te"}, {-3, -2, -2, 1}, kerned);
+  const SimpleGFXfont* font = &kerned.font;
+
+  const int a = findGlyphIndex(font, 'A');
+  const int v = findGlyphIndex(font, 'V');
+  const int t = findGlyphIndex(font, 'T');
+  const int o = findGlyphIndex(font, 'o');
+  const int e = findGlyphIndex(font, 'e');
+  runner.expectTrue(getKerning(font, a, v) == -3 && getKerning(font, v, a) == -2 && getKerning(font, t, o) == -2 &&
+                        getKerning(font, t, e) == 1,
+                    "pair lookup");
+  runner.expectTrue(getKerning(font, v, v) == 0 && getKerning(font, t, a) == 0 && getKerning(font, o, t) == 0,
+                    "missing pairs are zero");
+  runner.expectTrue(getKerning(font, font->glyphCount - 1, a) == 0, "first glyph past the index");
+  runner.expectTrue(getKerning(plain, a, v) == 0, "font without kerning");
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+
+  // Measurement: short strings go through the width cache, long ones not
+  renderer.setFont(plain);
+  const int wA = widthOf(renderer, "A");
+  const int wV = widthOf(renderer, "V");
+  const int wTo = widthOf(renderer, "To");
+  renderer.setFont(font);
+  renderer.resetWidthCacheStats();
+  const uint16_t first = widthOf(renderer, "AV");
+  const uint16_t second = widthOf(renderer, "AV");
+  runner.expectTrue(first == wA + wV - 3 && second == first, "kerned width, cached",
+                    std::to_string(first) + " / " + std::to_string(second));
+  runner.expectTrue(renderer.getWidthCacheHits() == 1, "second measurement is a cache hit");
+  runner.expectTrue(widthOf(renderer, "To") == wTo - 2, "kerned width of a second pair");
+  runner.expectTrue(widthOf(renderer, "AVAVAVAVAVAVAVAVAVAV") == 10 * (wA + wV) - 10 * 3 - 9 * 2,
+                    "kerned width past the cache length");
+  renderer.setFont(plain);
+  runner.expectTrue(widthOf(renderer, "AV") == wA + wV, "cache keeps fonts apart");
+
+  // Drawing a kerned pair equals drawing its glyphs at the kerned positions
+  std::vector<uint8_t> together(EInkDisplay::BUFFER_SIZE, 0xFF);
+  std::vector<uint8_t> apart(EInkDisplay::BUFFER_SIZE, 0xFF);
+  renderer.setFont(font);
+  renderer.setBitmapType(TextRenderer::BITMAP_BW);
+  renderer.setFrameBuffer(together.data());
+  renderer.setCursor(40, 100);
+  renderer.print("AVA");
+  renderer.setFrameBuffer(apart.data());
+  renderer.setCursor(40, 100);
+  renderer.print("A");
+  renderer.setCursor(40 + wA - 3, 100);
+  renderer.print("V");
+  renderer.setCursor(40 + wA - 3 + wV - 2, 100);
+  renderer.print("A");
+  runner.expectTrue(together == apart, "drawn pairs use the kerned advance");
+
+  // Kerning only moves glyphs; their bitmaps are those of the plain font
+  std::fill(together.begin(), together.end(), 0xFF);
+  std::fill(apart.begin(), apart.end(), 0xFF);
+  renderer.setFrameBuffer(together.data());
+  renderer.setCursor(40, 200);
+  renderer.print("To");
+  renderer.setFrameBuffer(apart.data());
+  renderer.setFont(plain);
+  renderer.setCursor(40, 200);
+  renderer.print("T");
+  renderer.setCursor(40 + widthOf(renderer, "T") - 2, 200);
+  renderer.print("o");
+  runner.expectTrue(together == apart, "kerned font draws like plain glyphs moved by the pair");
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
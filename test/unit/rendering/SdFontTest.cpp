@@ -0,0 +1,269 @@
+/**
+ * SdFontTest.cpp - Runtime Font Loading Test
+ *
+ * Checks the GlyphCache LRU against a reference model, then writes a binary
+ * font file (.mrf) from a built-in font the way generate_simplefont does,
+ * opens it with SdFont using a cache far smaller than the font and verifies
+ * that metrics, measured widths and rendered planes match the built-in font
+ * in every orientation. Malformed files must be rejected.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "core/EInkDisplay.h"
+#include "rendering/GlyphCache.h"
+#include "rendering/GlyphRle.h"
+#include "rendering/SdFont.h"
+#include "rendering/TextRenderer.h"
+#include "resources/fonts/FontDefinitions.h"
+#include "test_config.h"
+#include "test_utils.h"
+
+static const char* kSample = "Hello, w\xC3\xB6rld! The quick brown fox \xE2\x80\x94 jumps over the lazy dog. \xC3\x84\xC3\x96\xC3\x9C\xC3\x9F 0123";
+
+static void put32(std::string& out, uint32_t v) {
+  for (int i = 0; i < 4; ++i) {
+    out.push_back((char)((v >> (8 * i)) & 0xFF));
+  }
+}
+
+static void put16(std::string& out, uint16_t v) {
+  out.push_back((char)(v & 0xFF));
+  out.push_back((char)(v >> 8));
+}
+
+// Binary font image of a planar font (layout in SdFont.h), with kerning
+// pairs "AV" -3 and "To" -2
+static std::string buildFontFile(const SimpleGFXfont* src) {
+  std::string data;
+  std::vector<uint32_t> offsets;
+  uint16_t maxGlyph = 0;
+  for (uint16_t i = 0; i < src->glyphCount; ++i) {
+    const SimpleGFXglyph& g = src->glyph[i];
+    std::vector<uint8_t> buf(GlyphRle::encodeGlyph(src->bitmap + g.bitmapOffset, src->bitmap_gray_lsb + g.bitmapOffset,
+                                                   src->bitmap_gray_msb + g.bitmapOffset, g.width, g.height, nullptr));
+    GlyphRle::encodeGlyph(src->bitmap + g.bitmapOffset, src->bitmap_gray_lsb + g.bitmapOffset,
+                          src->bitmap_gray_msb + g.bitmapOffset, g.width, g.height, buf.data());
+    offsets.push_back((uint32_t)data.size());
+    data.append(reinterpret_cast<const char*>(buf.data()), buf.size());
+    maxGlyph = std::max<uint16_t>(maxGlyph, (uint16_t)buf.size());
+  }
+
+  const uint16_t a = (uint16_t)findGlyphIndex(src, 'A'), v = (uint16_t)findGlyphIndex(src, 'V');
+  const uint16_t t = (uint16_t)findGlyphIndex(src, 'T'), o = (uint16_t)findGlyphIndex(src, 'o');
+  const uint16_t kernIndexCount = (uint16_t)(t + 1);
+  std::string kerning;
+  for (uint16_t first = 0; first <= kernIndexCount; ++first) {
+    put16(kerning, (uint16_t)((first > a) + (first > t)));
+  }
+  put16(kerning, v);
+  put16(kerning, o);
+  kerning.push_back((char)-3);
+  kerning.push_back((char)-2);
+
+  std::string out;
+  put32(out, SdFont::kMagic);
+  out.push_back((char)SdFont::kVersion);
+  out.push_back((char)FONT_BITMAP_RLE_GRAY);
+  out.push_back((char)src->yAdvance);
+  out.push_back((char)26);
+  out.push_back((char)0);
+  out.append(3, '\0');
+  put32(out, src->glyphCount);
+  put32(out, 64);
+  put32(out, 64 + 16u * src->glyphCount + (uint32_t)kerning.size());
+  put32(out, (uint32_t)data.size());
+  put16(out, maxGlyph);
+  put16(out, kernIndexCount);
+  char name[32] = "Bookerly26";
+  out.append(name, sizeof(name));
+  for (uint16_t i = 0; i < src->glyphCount; ++i) {
+    const SimpleGFXglyph& g = src->glyph[i];
+    put32(out, g.codepoint);
+    put32(out, offsets[i]);
+    out.push_back((char)g.width);
+    out.push_back((char)g.height);
+    out.push_back((char)g.xAdvance);
+    out.push_back((char)g.xOffset);
+    out.push_back((char)g.yOffset);
+    out.append(3, '\0');
+  }
+  return out + kerning + data;
+}
+
+static void writeFile(const std::string& path, const std::string& content) {
+  std::ofstream out(path, std::ios::binary);
+  out.write(content.data(), content.size());
+}
+
+int main() {
+  TestUtils::TestRunner runner("SD Font Test");
+
+  // --- GlyphCache: LRU order and eviction against a list model ---
+  {
+    GlyphCache cache;
+    runner.expectTrue(cache.configure(4, 16), "GlyphCache configure");
+    std::list<uint32_t> model;  // most recent first
+    int wrong = 0;
+    uint32_t seed = 12345;
+    for (int step = 0; step < 20000; ++step) {
+      seed = seed * 1103515245u + 12345u;
+      const uint32_t key = (seed >> 16) % 40;
+      uint8_t* slot = cache.find(key);
+      auto it = std::find(model.begin(), model.end(), key);
+      if ((slot != nullptr) != (it != model.end())) {
+        ++wrong;
+      }
+      if (slot) {
+        uint32_t stored;
+        memcpy(&stored, slot, 4);
+        wrong += stored != key;
+        model.erase(it);
+      } else {
+        slot = cache.insert(key);
+        memcpy(slot, &key, 4);
+        if (model.size() == 16) {
+          model.pop_back();
+        }
+      }
+      model.push_front(key);
+    }
+    runner.expectTrue(wrong == 0, "GlyphCache matches LRU model", std::to_string(wrong) + " mismatches");
+    runner.expectTrue(cache.getEvictions() > 0 && cache.getHits() + cache.getMisses() == 20000,
+                      "GlyphCache stats");
+    cache.clear();
+    runner.expectTrue(cache.find(model.front()) == nullptr, "GlyphCache clear drops entries");
+  }
+
+  // --- Round trip through a font file ---
+  SD.mkdir(TestConfig::TEST_OUTPUT_DIR.c_str());
+  const std::string path = TestConfig::TEST_OUTPUT_DIR + "/Bookerly26.mrf";
+  const SimpleGFXfont* builtIn = bookerly26Family.regular;
+  const std::string image = buildFontFile(builtIn);
+  writeFile(path, image);
+
+  // 1 KB holds only a handful of glyphs, so drawing the sample evicts
+  SdFont sdFont(1024);
+  runner.expectTrue(sdFont.open(path.c_str()), "open font file");
+  const SimpleGFXfont* font = sdFont.getFont();
+  if (!font) {
+    runner.printSummary();
+    return 1;
+  }
+
+  bool sameMetrics = font->glyphCount == builtIn->glyphCount && font->yAdvance == builtIn->yAdvance &&
+                     strcmp(font->name, "Bookerly26") == 0 && font->bitmap == nullptr;
+  for (uint16_t i = 0; sameMetrics && i < font->glyphCount; ++i) {
+    const SimpleGFXglyph& a = font->glyph[i];
+    const SimpleGFXglyph& b = builtIn->glyph[i];
+    sameMetrics = a.codepoint == b.codepoint && a.width == b.width && a.height == b.height &&
+                  a.xAdvance == b.xAdvance && a.xOffset == b.xOffset && a.yOffset == b.yOffset;
+  }
+  runner.expectTrue(sameMetrics, "metrics match built-in font");
+  const uint16_t kA = (uint16_t)findGlyphIndex(font, 'A'), kV = (uint16_t)findGlyphIndex(font, 'V');
+  const uint16_t kT = (uint16_t)findGlyphIndex(font, 'T'), kO = (uint16_t)findGlyphIndex(font, 'o');
+  runner.expectTrue(getKerning(font, kA, kV) == -3 && getKerning(font, kT, kO) == -2 && getKerning(font, kV, kA) == 0,
+                    "kerning table loaded");
+  runner.expectTrue(findGlyphIndex(font, 0xDF) == findGlyphIndex(builtIn, 0xDF) &&
+                        findGlyphIndex(font, 0x2014) == findGlyphIndex(builtIn, 0x2014),
+                    "glyph lookup matches built-in font");
+
+  EInkDisplay display(TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN,
+                      TestConfig::DUMMY_PIN, TestConfig::DUMMY_PIN);
+  display.begin();
+  TextRenderer renderer(display);
+
+  uint16_t wSd = 0, wBuiltIn = 0, h = 0;
+  int16_t x1 = 0, y1 = 0;
+  renderer.setFont(font);
+  renderer.getTextBounds(kSample, 0, 0, &x1, &y1, &wSd, &h);
+  renderer.setFont(builtIn);
+  renderer.getTextBounds(kSample, 0, 0, &x1, &y1, &wBuiltIn, &h);
+  runner.expectTrue(wSd == wBuiltIn && wSd > 0, "measured width matches built-in font");
+
+  std::vector<uint8_t> actual(EInkDisplay::BUFFER_SIZE), expected(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> lsb(EInkDisplay::BUFFER_SIZE), expectedLsb(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> msb(EInkDisplay::BUFFER_SIZE), expectedMsb(EInkDisplay::BUFFER_SIZE);
+  const char* orientationNames[] = {"Portrait", "LandscapeClockwise", "PortraitInverted",
+                                    "LandscapeCounterClockwise"};
+  renderer.setBitmapType(TextRenderer::BITMAP_ALL_PLANES);
+  for (int o = 0; o < 4; ++o) {
+    renderer.setOrientation(static_cast<TextRenderer::Orientation>(o));
+    int mismatches = 0;
+    for (int pos = 0; pos < 20; ++pos) {
+      const int16_t x = -60 + pos * 41;
+      const int16_t y = -20 + pos * 39;
+      std::fill(actual.begin(), actual.end(), 0xFF);
+      std::fill(lsb.begin(), lsb.end(), 0xFF);
+      std::fill(msb.begin(), msb.end(), 0xFF);
+      expected = actual;
+      expectedLsb = lsb;
+      expectedMsb = msb;
+
+      renderer.setFont(builtIn);
+      renderer.setFrameBuffer(expected.data());
+      renderer.setGrayscalePlanes(expectedLsb.data(), expectedMsb.data());
+      renderer.setCursor(x, y);
+      renderer.print(kSample);
+
+      renderer.setFont(font);
+      renderer.setFrameBuffer(actual.data());
+      renderer.setGrayscalePlanes(lsb.data(), msb.data());
+      renderer.setCursor(x, y);
+      renderer.print(kSample);
+
+      if (actual != expected || lsb != expectedLsb || msb != expectedMsb) {
+        ++mismatches;
+      }
+    }
+    runner.expectTrue(mismatches == 0, std::string(orientationNames[o]) + " SD font draws like built-in",
+                      std::to_string(mismatches) + " of 20 positions differ");
+  }
+  renderer.setGrayscalePlanes(nullptr, nullptr);
+
+  const GlyphCache& cache = sdFont.getCache();
+  runner.expectTrue(cache.getSlotCount() * cache.getSlotBytes() <= 1024 || cache.getSlotCount() == 4,
+                    "glyph cache stays within its budget");
+  runner.expectTrue(cache.getEvictions() > 0 && cache.getHits() > 0, "glyph cache evicts and hits",
+                    "hits=" + std::to_string(cache.getHits()) + " evictions=" + std::to_string(cache.getEvictions()));
+  sdFont.close();
+  runner.expectTrue(sdFont.getFont() == nullptr, "close releases the font");
+
+  // With the default cache the sample is read once, and only its glyphs
+  SdFont roomy;
+  runner.expectTrue(roomy.open(path.c_str()), "reopen with default cache");
+  renderer.setFont(roomy.getFont());
+  renderer.setFrameBuffer(actual.data());
+  renderer.setCursor(10, 100);
+  renderer.print(kSample);
+  const uint32_t firstRead = roomy.getBytesRead();
+  renderer.setCursor(10, 200);
+  renderer.print(kSample);
+  runner.expectTrue(firstRead > 0 && firstRead < image.size() / 10, "only drawn glyphs are read",
+                    std::to_string(firstRead) + " of " + std::to_string(image.size()) + " bytes");
+  runner.expectTrue(roomy.getBytesRead() == firstRead, "second draw served from cache");
+  renderer.setFont(builtIn);
+  roomy.close();
+
+  // --- Malformed files ---
+  std::string bad = image;
+  bad[0] = 'X';
+  writeFile(path, bad);
+  runner.expectTrue(!sdFont.open(path.c_str()), "bad magic rejected");
+
+  bad = image;
+  std::swap_ranges(bad.begin() + 64, bad.begin() + 68, bad.begin() + 80);  // swap two codepoints
+  writeFile(path, bad);
+  runner.expectTrue(!sdFont.open(path.c_str()), "unsorted glyph table rejected");
+
+  runner.expectTrue(!sdFont.open((TestConfig::TEST_OUTPUT_DIR + "/missing.mrf").c_str()), "missing file rejected");
+  SD.remove(path.c_str());
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}
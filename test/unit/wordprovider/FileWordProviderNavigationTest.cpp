@@ -12,6 +12,7 @@
  * 5. Small buffer stress test
  * 6. Unicode content handling
  * 7. Specific content verification
+ * 8. Paragraph format tokens (ESC+'P')
  */
 
 #include <algorithm>
@@ -1037,6 +1038,70 @@ void testStyleParsingWithGeneratedFile(TestUtils::TestRunner& runner) {
   }
 }
 
+// ============================================================================
+// Test: paragraph format tokens
+// ============================================================================
+void testParagraphFormatToken(TestUtils::TestRunner& runner) {
+  std::cout << "\n=== Test: Paragraph Format Tokens ===\n";
+
+  const char* testFilePath = "test/output/format_test_generated.txt";
+  ParagraphFormat heading;
+  heading.marginTop = 5;
+  heading.marginBottom = 3;
+  heading.fontSize = 20;
+  ParagraphFormat indented;
+  indented.indent = 4;
+
+  String content;
+  FileWordProvider::appendFormatToken(content, heading);
+  content += "\x1B" "CBig title\x1B" "c\n";
+  FileWordProvider::appendFormatToken(content, indented);
+  content += "First words\x1B" "Bbold\x1B" "b end\n";
+  content += "Plain line\n";
+  {
+    std::ofstream outFile(testFilePath, std::ios::binary);
+    outFile << content.c_str();
+  }
+
+  FileWordProvider provider(testFilePath);
+  std::vector<std::string> forward;
+  std::vector<ParagraphFormat> formats;
+  while (provider.hasNextWord()) {
+    StyledWord sw = provider.getNextWord();
+    if (sw.text.isEmpty()) {
+      continue;
+    }
+    forward.push_back(sw.text.c_str());
+    formats.push_back(provider.getParagraphFormat());
+  }
+  std::vector<std::string> backward;
+  provider.setPosition(content.length());
+  while (provider.hasPrevWord()) {
+    StyledWord sw = provider.getPrevWord();
+    if (!sw.text.isEmpty()) {
+      backward.insert(backward.begin(), sw.text.c_str());
+    }
+  }
+
+  const std::vector<std::string> expected = {"Big", " ", "title", "\n", "First", " ", "words", "bold",
+                                             " ", "end", "\n", "Plain", " ", "line", "\n"};
+  runner.expectTrue(forward == expected, "Format tokens: skipped when reading forward");
+  runner.expectTrue(backward == expected, "Format tokens: skipped when reading backward");
+  runner.expectTrue(formats.size() == expected.size() && formats[0] == heading && formats[4] == indented &&
+                        formats[11] == ParagraphFormat(),
+                    "Format tokens: format holds until the newline");
+
+  // Seeking into a paragraph finds the format at its start
+  provider.setPosition(content.indexOf("words"));
+  runner.expectTrue(provider.getParagraphFormat() == indented &&
+                        std::string(provider.getNextWord().text.c_str()) == "words",
+                    "Format tokens: seek inside a paragraph");
+  provider.setPosition(content.indexOf("title"));
+  runner.expectTrue(provider.getParagraphFormat() == heading && provider.getParagraphAlignment() == TextAlign::Center,
+                    "Format tokens: format and alignment together");
+  std::remove(testFilePath);
+}
+
 // ============================================================================
 // Run all tests
 // ============================================================================
@@ -1050,6 +1115,7 @@ void runAllTests(TestUtils::TestRunner& runner) {
   // testSpecificContent(runner);
   // testStyleConsistency(runner);
   testStyleParsingWithGeneratedFile(runner);
+  testParagraphFormatToken(runner);
 }
 
 }  // namespace FileWordProviderNavigationTests
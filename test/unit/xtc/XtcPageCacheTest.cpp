@@ -0,0 +1,158 @@
+/**
+ * XtcPageCacheTest.cpp - XTC Page Read-Ahead Cache Test
+ *
+ * Writes a small XTC file and checks that XtcPageCache returns each page's
+ * bitmap, reads the next pages ahead in bounded steps, serves cached pages
+ * without touching the file, evicts pages behind the current one first,
+ * caches a single plane when asked to, and fails cleanly on a truncated
+ * file or a bad page header.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "content/xtc/XtcFile.h"
+#include "content/xtc/XtcPageCache.h"
+#include "test_utils.h"
+
+static const uint16_t kWidth = 16;
+static const uint16_t kHeight = 8;
+static const size_t kPageBytes = (kWidth / 8) * kHeight;
+static const uint32_t kPages = 6;
+
+template <typename T>
+static void append(std::string& out, T value) {
+  out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static uint8_t pageByte(uint32_t page, size_t i) {
+  return (uint8_t)(page * 31 + i * 7 + 1);
+}
+
+// A 1-bit XTC file: 56-byte header, page table, then an XTG header and
+// bitmap per page. `badPage` gets a wrong page magic.
+static std::string makeXtc(uint32_t badPage = kPages) {
+  const uint64_t tableOffset = 56;
+  const uint64_t dataOffset = tableOffset + kPages * 16;
+  const size_t pageSize = 22 + kPageBytes;
+
+  std::string xtc;
+  append<uint32_t>(xtc, 0x00435458);
+  append<uint8_t>(xtc, 1);
+  append<uint8_t>(xtc, 0);
+  append<uint16_t>(xtc, kPages);
+  append<uint32_t>(xtc, 0);
+  append<uint32_t>(xtc, 56);
+  append<uint32_t>(xtc, 0);
+  append<uint32_t>(xtc, 0);
+  append<uint64_t>(xtc, tableOffset);
+  append<uint64_t>(xtc, dataOffset);
+  append<uint64_t>(xtc, 0);
+  append<uint32_t>(xtc, 0);
+  append<uint32_t>(xtc, 0);
+  for (uint32_t p = 0; p < kPages; ++p) {
+    append<uint64_t>(xtc, dataOffset + p * pageSize);
+    append<uint32_t>(xtc, (uint32_t)pageSize);
+    append<uint16_t>(xtc, kWidth);
+    append<uint16_t>(xtc, kHeight);
+  }
+  for (uint32_t p = 0; p < kPages; ++p) {
+    append<uint32_t>(xtc, p == badPage ? 0x12345678 : 0x00475458);
+    append<uint16_t>(xtc, kWidth);
+    append<uint16_t>(xtc, kHeight);
+    append<uint8_t>(xtc, 0);
+    append<uint8_t>(xtc, 0);
+    append<uint32_t>(xtc, (uint32_t)kPageBytes);
+    append<uint64_t>(xtc, 0);
+    for (size_t i = 0; i < kPageBytes; ++i) {
+      xtc += (char)pageByte(p, i);
+    }
+  }
+  return xtc;
+}
+
+static void writeFile(const char* path, const std::string& content) {
+  std::ofstream out(path, std::ios::binary);
+  out.write(content.data(), content.size());
+}
+
+static bool pageMatches(const uint8_t* data, uint32_t page, size_t skip = 0, size_t bytes = kPageBytes) {
+  if (!data) {
+    return false;
+  }
+  for (size_t i = 0; i < bytes; ++i) {
+    if (data[i] != pageByte(page, skip + i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  TestUtils::TestRunner runner("XTC Page Cache Test");
+  const char* path = "xtc_page_cache_test.xtc";
+  writeFile(path, makeXtc());
+
+  XtcFile xtc;
+  runner.expectTrue(xtc.open(path) && xtc.getPageCount() == kPages, "test file opens");
+
+  // A budget of three pages: the current one and two ahead
+  XtcPageCache cache(xtc, 3 * kPageBytes + kPageBytes / 2);
+  runner.expectTrue(cache.reset(0, kPageBytes) && cache.getSlotCount() == 3, "slots from the budget",
+                    std::to_string(cache.getSlotCount()));
+  runner.expectTrue(pageMatches(cache.getPage(0), 0), "page read on demand");
+
+  // Read-ahead works in steps and stops after the window
+  runner.expectTrue(cache.readAhead(5) && !cache.isCached(1), "read-ahead step is bounded");
+  int steps = 1;
+  while (cache.readAhead(5) && steps < 100) {
+    steps++;
+  }
+  runner.expectTrue(cache.isCached(1) && cache.isCached(2) && !cache.isCached(3), "next two pages read ahead",
+                    std::to_string(steps) + " steps");
+
+  // Cached pages come without file reads
+  const uint64_t before = g_mockFileBytesRead;
+  const bool cachedOk = pageMatches(cache.getPage(1), 1) && pageMatches(cache.getPage(2), 2);
+  runner.expectTrue(cachedOk && g_mockFileBytesRead == before, "cached pages served from RAM");
+
+  // Moving on drops the pages behind first
+  while (cache.readAhead(kPageBytes)) {
+  }
+  runner.expectTrue(!cache.isCached(0) && !cache.isCached(1) && cache.isCached(2) && cache.isCached(3) &&
+                        cache.isCached(4),
+                    "pages behind evicted for pages ahead");
+  runner.expectTrue(pageMatches(cache.getPage(0), 0) && cache.isCached(2) && !cache.isCached(4),
+                    "going back evicts the farthest page ahead");
+
+  // Nothing to read past the last page
+  runner.expectTrue(pageMatches(cache.getPage(kPages - 1), kPages - 1) && !cache.readAhead(kPageBytes) &&
+                        cache.getPage(kPages) == nullptr,
+                    "last page");
+
+  // A part of each bitmap, as for the displayed plane of a 2-bit page
+  runner.expectTrue(cache.reset(kPageBytes / 2, kPageBytes / 2) && cache.getSlotCount() == 7 &&
+                        pageMatches(cache.getPage(3), 3, kPageBytes / 2, kPageBytes / 2),
+                    "single plane cached", std::to_string(cache.getSlotCount()));
+
+  XtcPageCache tiny(xtc, kPageBytes - 1);
+  runner.expectTrue(!tiny.reset(0, kPageBytes) && tiny.getPage(0) == nullptr, "budget below one page");
+  xtc.close();
+
+  // Truncated file and bad page header
+  const std::string full = makeXtc(2);
+  writeFile(path, full.substr(0, full.size() - 3));
+  runner.expectTrue(xtc.open(path) && cache.reset(0, kPageBytes), "damaged file opens");
+  runner.expectTrue(pageMatches(cache.getPage(1), 1) && cache.getPage(2) == nullptr && !cache.isCached(2),
+                    "bad page header");
+  runner.expectTrue(cache.getPage(kPages - 1) == nullptr && !cache.isCached(kPages - 1), "truncated page");
+  cache.release();
+  xtc.close();
+  std::remove(path);
+
+  runner.printSummary();
+  return runner.allPassed() ? 0 : 1;
+}